@@ -0,0 +1,82 @@
+// SPDX-License-Identifier: GPL-3.0-only
+// Copyright (c) 2026 Elia Chiarucci
+
+/*
+ * Adaptive clock: the DAC clock steered to the host's frame clock
+ * PI loop on the audio queued ahead of the DAC (USB FIFO plus I2S ring),
+ * acquiring fast then tracking slow; output in 1/256 ppm for audio_pll.c.
+ * Pure C, no hardware dependencies: compiles unmodified on the host.
+ */
+
+#ifndef AUDIO_ADAPTIVE_H
+#define AUDIO_ADAPTIVE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Packets per control update, and packets the queue average spans
+#define AUDIO_AD_STRIDE     16
+#define AUDIO_AD_AVG_SHIFT  5
+
+// Gains: proportional ppm per us of error (Q8), integral per update (Q16)
+#define AUDIO_AD_KP_ACQUIRE 1434  // 5.6
+#define AUDIO_AD_KI_ACQUIRE 16777 // 16/s at 16ms per update
+#define AUDIO_AD_KP_TRACK   256   // 1.0
+#define AUDIO_AD_KI_TRACK   262   // 0.25/s at 16ms per update
+
+// Slew limits of the correction per update, 1/256 ppm
+#define AUDIO_AD_SLEW_ACQUIRE (400 * 256)
+#define AUDIO_AD_SLEW_TRACK   (4 * 256)
+
+// Tracking after AUDIO_AD_LOCK_UPDATES updates within AUDIO_AD_LOCK_US
+#define AUDIO_AD_LOCK_US      200
+#define AUDIO_AD_LOCK_UPDATES 32
+#define AUDIO_AD_UNLOCK_US    2000
+
+typedef enum {
+    AUDIO_AD_IDLE = 0, // waiting for the output to play
+    AUDIO_AD_ACQUIRING,
+    AUDIO_AD_TRACKING,
+} audio_ad_state_t;
+
+typedef struct {
+    uint8_t state;       // audio_ad_state_t
+    uint32_t lock_ms;    // stream open to first tracking, 0 until then
+    int32_t ppm_q8;      // current correction
+    int32_t error_us;    // last queue error (positive: above target)
+    int32_t error_min_us; // extremes since tracking
+    int32_t error_max_us;
+    uint16_t saturated;  // updates held at the range limit
+    uint16_t slewed;     // updates held at the slew limit
+    uint16_t unlocks;    // falls back from tracking to acquiring
+} audio_ad_stats_t;
+
+typedef struct {
+    uint32_t sample_rate;
+    uint8_t frame_bytes;
+    int32_t min_q8, max_q8; // correction range
+    int64_t integ_q16;   // integrator, 1/65536 ppm
+    uint32_t target_q8;  // queue the loop holds, 1/256 frame
+    uint32_t queue_q8;   // queue average, 1/256 frame
+    uint32_t packets;    // since init
+    uint8_t stable;      // consecutive updates within AUDIO_AD_LOCK_US
+    audio_ad_stats_t stats;
+} audio_adaptive_t;
+
+// Start over, from start_q8 (the last stream's), within min_q8 .. max_q8
+void audio_adaptive_init(audio_adaptive_t *ad, uint32_t sample_rate,
+                         uint8_t frame_bytes, int32_t start_q8,
+                         int32_t min_q8, int32_t max_q8);
+
+// Hold the queue at target_q8 (1/256 frame) instead of where it started
+void audio_adaptive_set_target(audio_adaptive_t *ad, uint32_t target_q8);
+
+// A packet landed; ring_q8 is the I2S ring ahead of the DAC (1/256 frame).
+// Holds unless playing. Returns true when the correction changed.
+bool audio_adaptive_packet(audio_adaptive_t *ad, uint16_t fifo_bytes,
+                           uint32_t ring_q8, bool playing);
+
+// Current correction of the DAC clock, 1/256 ppm (positive: faster)
+int32_t audio_adaptive_ppm_q8(const audio_adaptive_t *ad);
+
+#endif // AUDIO_ADAPTIVE_H
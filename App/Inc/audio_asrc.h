@@ -0,0 +1,126 @@
+// SPDX-License-Identifier: GPL-3.0-only
+// Copyright (c) 2026 Elia Chiarucci
+
+/*
+ * Asynchronous sample-rate converter for hosts that ignore feedback
+ * Monitor: engages when the host's packets stop following the feedback
+ * (or the FIFO drifts off target). Converter: polyphase filter between the
+ * FIFO and the DSP chain, ratio from the adaptive clock's PI loop.
+ */
+
+#ifndef AUDIO_ASRC_H
+#define AUDIO_ASRC_H
+
+#include "audio_adaptive.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#define AUDIO_ASRC_TAPS   32
+#define AUDIO_ASRC_PHASES 128
+
+// [phase][tap], first half of the phases (scripts/gen_resample_taps.py --asrc)
+extern const float audio_asrc_taps[AUDIO_ASRC_PHASES / 2][AUDIO_ASRC_TAPS];
+
+// Ratio range either side of 1, 1/256 ppm
+#define AUDIO_ASRC_RANGE_Q8 (1000 * 256)
+
+// Audio the host may owe the feedback, either way, before engaging
+#define AUDIO_ASRC_OWED_US 150
+
+// FIFO drift that engages the backstop: a third of the target below it,
+// half of it (at least AUDIO_ASRC_FILL_MIN_US) above
+#define AUDIO_ASRC_DRAIN_DIV    3
+#define AUDIO_ASRC_FILL_DIV     2
+#define AUDIO_ASRC_FILL_MIN_US  1500
+
+// Packets played before the monitor can engage
+#define AUDIO_ASRC_SETTLE_PACKETS 256
+
+// Delay the converter adds, 1/256 frame: half the filter less half a frame
+#define AUDIO_ASRC_DELAY_Q8 ((AUDIO_ASRC_TAPS / 2U) * 256U - 128U)
+
+// Inputs one call can take beyond its output frames
+#define AUDIO_ASRC_EXTRA_FRAMES (AUDIO_ASRC_TAPS / 2U + 4U)
+
+typedef enum {
+    AUDIO_ASRC_OFF = 0,  // not engaged
+    AUDIO_ASRC_IGNORED,  // the host's packets don't follow the feedback
+    AUDIO_ASRC_DRAINING, // FIFO fell below the target: host slow
+    AUDIO_ASRC_FILLING,  // ... rose above it: host fast
+    AUDIO_ASRC_UNDERRUN, // the output ran short of audio
+} audio_asrc_reason_t;
+
+typedef struct {
+    uint8_t reason;         // audio_asrc_reason_t, OFF until engaged
+    uint32_t engage_ms;     // playing to engaging, 0 until then
+    int32_t engage_drift_us; // FIFO drift when it engaged
+    int32_t owed_us;        // audio asked for but not sent (negative: more)
+    int32_t drift_us;       // FIFO drift from target; engaged, queue error
+    audio_ad_stats_t loop;  // ratio loop: ppm_q8 is the ratio - 1
+} audio_asrc_stats_t;
+
+// Monitor and ratio loop: the USB interrupt's, one packet at a time
+typedef struct {
+    uint32_t sample_rate;
+    uint8_t frame_bytes;
+    uint32_t target_q8;    // FIFO target, 1/256 frame
+    uint32_t drain_q8;     // drifts that engage, 1/256 frame
+    uint32_t fill_q8;
+    uint32_t packets;      // played since init
+    uint32_t level_q8;     // FIFO level average, 1/256 frame
+    uint32_t queue_q8;     // queue average (FIFO and ring), 1/256 frame
+    int64_t owed_q16;      // host's debt to the feedback, 1/65536 frame
+    int64_t owed_max_q16;  // AUDIO_ASRC_OWED_US of it
+    audio_adaptive_t loop;
+    audio_asrc_stats_t stats;
+} audio_asrc_ctl_t;
+
+// Converter: the audio stage's
+typedef struct {
+    // Last TAPS stereo frames, stored twice so the window is contiguous
+    float hist[2 * AUDIO_ASRC_TAPS][2];
+    uint8_t pos;       // slot of the oldest frame in the window
+    uint64_t ahead_q32; // inputs before the next output, less a step, 32.32
+    uint64_t step_q32; // inputs per output, 32.32
+} audio_asrc_t;
+
+// Start over, disengaged; the feedback holds the FIFO at fifo_target bytes
+void audio_asrc_ctl_init(audio_asrc_ctl_t *ctl, uint32_t sample_rate,
+                         uint8_t frame_bytes, uint16_t fifo_target);
+
+// A packet landed against asked_q16 frames of feedback (16.16); true when
+// the ratio changed, the first time as the converter engages
+bool audio_asrc_ctl_packet(audio_asrc_ctl_t *ctl, uint16_t packet_bytes,
+                           uint32_t asked_q16, uint16_t fifo_bytes,
+                           uint32_t ring_q8, bool playing, bool underrun);
+
+bool audio_asrc_ctl_engaged(const audio_asrc_ctl_t *ctl);
+
+// Ratio - 1, 1/256 ppm (positive: inputs taken faster than the DAC plays)
+int32_t audio_asrc_ctl_ppm_q8(const audio_asrc_ctl_t *ctl);
+
+// Silence in the history, ratio 1
+void audio_asrc_reset(audio_asrc_t *as);
+
+// Fill the history from the direct path's last inputs, before engaging
+void audio_asrc_prime(audio_asrc_t *as, const int32_t *in, uint16_t frames);
+
+// Engage: the next output is the frame after the last primed
+void audio_asrc_start(audio_asrc_t *as);
+
+// Ratio - 1, 1/256 ppm, from the next output on
+void audio_asrc_set_ppm(audio_asrc_t *as, int32_t ppm_q8);
+
+// Input frames the next out_frames outputs take
+uint16_t audio_asrc_needed(const audio_asrc_t *as, uint16_t out_frames);
+
+// Outputs in_frames input frames are enough for
+uint16_t audio_asrc_possible(const audio_asrc_t *as, uint16_t in_frames);
+
+// Convert out_frames stereo frames, taking audio_asrc_needed() inputs: the
+// first in_frames from in, the rest from in2. in may overlap out's tail.
+void audio_asrc_process(audio_asrc_t *as, const int32_t *in,
+                        uint16_t in_frames, const int32_t *in2, int32_t *out,
+                        uint16_t out_frames);
+
+#endif // AUDIO_ASRC_H
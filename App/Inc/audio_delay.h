@@ -0,0 +1,55 @@
+// SPDX-License-Identifier: GPL-3.0-only
+// Copyright (c) 2026 Elia Chiarucci
+
+/*
+ * End-to-end output delay estimator
+ * FIFO, I2S ring, DSP look-ahead and DAC group delay ahead of each packet,
+ * as min/avg/max over windows of AUDIO_DELAY_WINDOW packets.
+ * Pure C, no hardware dependencies: compiles unmodified on the host.
+ */
+
+#ifndef AUDIO_DELAY_H
+#define AUDIO_DELAY_H
+
+#include <stdint.h>
+
+// Packets per reported window
+#define AUDIO_DELAY_WINDOW 1000
+
+// EQ biquads and volume work sample by sample: no look-ahead
+#define AUDIO_DELAY_DSP_FRAMES 0
+
+// PCM5102A interpolation filter group delay, normal-latency filter (FLT
+// low): 20 sample periods
+#define AUDIO_DELAY_DAC_FRAMES 20
+
+typedef struct {
+    uint32_t now_us;   // last estimate
+    uint32_t min_us;   // last complete window
+    uint32_t avg_us;
+    uint32_t max_us;
+    uint32_t windows;  // complete windows since the stream opened
+} audio_delay_stats_t;
+
+typedef struct {
+    uint32_t sample_rate;
+    uint16_t frame_bytes;
+    uint16_t count;    // estimates in the current window
+    uint32_t min_q8;   // current window, 1/256 frame
+    uint32_t max_q8;
+    uint64_t sum_q8;
+    audio_delay_stats_t stats;
+} audio_delay_t;
+
+// Start over for a stream at sample_rate Hz, frame_bytes per USB frame
+void audio_delay_init(audio_delay_t *d, uint32_t sample_rate,
+                      uint16_t frame_bytes);
+
+// A packet of packet_bytes landed, leaving fifo_bytes in the USB FIFO (it
+// included); ring_q8 is what the I2S ring holds ahead of the DAC, in 1/256
+// frame. Returns the estimate for the packet's middle sample, in
+// microseconds.
+uint32_t audio_delay_packet(audio_delay_t *d, uint16_t fifo_bytes,
+                            uint16_t packet_bytes, uint32_t ring_q8);
+
+#endif // AUDIO_DELAY_H
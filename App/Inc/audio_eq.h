@@ -32,6 +32,10 @@ void audio_eq_set_band(uint8_t band, int8_t value);
 // Get EQ band value
 int8_t audio_eq_get_band(uint8_t band);
 
+// Stream rate: picks the filter coefficients (48000 or 96000 Hz, same
+// corner frequencies) and resets the filter state. False for other rates.
+bool audio_eq_set_rate(uint32_t rate);
+
 // Reset filter state (call on stream start to avoid transient spikes)
 void audio_eq_reset_state(void);
 
@@ -0,0 +1,96 @@
+// SPDX-License-Identifier: GPL-3.0-only
+// Copyright (c) 2026 Elia Chiarucci
+
+/*
+ * Explicit feedback from the measured I2S clock
+ * The DAC clock's frame count against the SOFs gives the rate; a slow trim
+ * on the FIFO level holds it on target. Values are 16.16 frames per USB frame.
+ * Pure C, no hardware dependencies: compiles unmodified on the host.
+ */
+
+#ifndef AUDIO_FEEDBACK_H
+#define AUDIO_FEEDBACK_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Clock sampled every AUDIO_FB_STRIDE_MS SOFs, rate over the last
+// AUDIO_FB_HISTORY samples once AUDIO_FB_MIN_SAMPLES span it
+#define AUDIO_FB_STRIDE_MS   16
+#define AUDIO_FB_HISTORY     64
+#define AUDIO_FB_MIN_SAMPLES 8
+#define AUDIO_FB_WINDOW_MS (AUDIO_FB_STRIDE_MS * (AUDIO_FB_HISTORY - 1))
+
+// Clock readings are in 1/256 frame
+#define AUDIO_FB_CLOCK_SHIFT 8
+
+// Locked once the rate held within AUDIO_FB_LOCK_TOL for LOCK_UPDATES
+#define AUDIO_FB_LOCK_TOL     16
+#define AUDIO_FB_LOCK_UPDATES 8
+
+// FIFO trim: 16.16 per byte of level error, limited to about 330ppm
+#define AUDIO_FB_TRIM_GAIN   3
+#define AUDIO_FB_TRIM_MAX    1024
+#define AUDIO_FB_FRAME_BYTES 6
+
+typedef enum {
+    AUDIO_FB_IDLE = 0,  // no clock sample yet
+    AUDIO_FB_MEASURING, // window filling, rate still moving
+    AUDIO_FB_LOCKED,
+} audio_fb_state_t;
+
+// Convergence and jitter, reset when the stream opens
+typedef struct {
+    uint8_t state;      // audio_fb_state_t
+    uint32_t lock_ms;   // stream open to first lock, 0 until then
+    uint32_t rate;      // measured stream frames per USB frame
+    uint32_t value;     // sent to the host: rate + trim, clamped
+    int32_t trim;
+    uint32_t rate_min;  // measured rate extremes since lock
+    uint32_t rate_max;
+    uint32_t step_max;  // largest change of value between updates since lock
+    uint16_t level;     // mean FIFO level as packets land, bytes
+    uint16_t target;    // level the trim holds, bytes
+    uint16_t resyncs;   // window restarts (ring restart, missed SOF)
+} audio_fb_stats_t;
+
+typedef struct {
+    uint32_t nominal;  // sample_rate / 1000
+    uint32_t min, max; // +-1 frame, as TinyUSB clamps FIFO_COUNT
+    int32_t trim_max;  // AUDIO_FB_TRIM_MAX at the stream rate
+    uint32_t sample_rate;
+    uint32_t clock_rate; // of the I2S clock, Hz: sample_rate unless resampled
+    uint8_t frame_bytes; // USB bytes per stereo frame
+    uint32_t clock[AUDIO_FB_HISTORY];
+    uint8_t head;      // slot of the next sample
+    uint8_t count;     // samples in the window
+    uint8_t epoch;     // clock epoch of the samples
+    uint8_t stable;    // consecutive updates within AUDIO_FB_LOCK_TOL
+    uint32_t last_frame;
+    uint32_t sofs;     // SOFs since init
+    uint32_t level_q8; // FIFO level average, 1/256 byte
+    audio_fb_stats_t stats;
+} audio_feedback_t;
+
+// Start over at nominal, the FIFO held at fifo_target bytes
+void audio_feedback_init(audio_feedback_t *fb, uint32_t sample_rate,
+                         uint16_t fifo_target);
+
+// The I2S clock runs at clock_rate Hz (resampled stream); after init
+void audio_feedback_set_clock_rate(audio_feedback_t *fb, uint32_t clock_rate);
+
+// Bytes per stereo frame, to keep the trim's gain per frame; after init
+void audio_feedback_set_frame_bytes(audio_feedback_t *fb, uint8_t frame_bytes);
+
+// A packet landed: FIFO level after it, bytes
+void audio_feedback_packet(audio_feedback_t *fb, uint16_t fifo_level);
+
+// One call per SOF: I2S frame count in 1/256 frame and its epoch (changed
+// whenever the count jumps). Returns true when the value changed.
+bool audio_feedback_sof(audio_feedback_t *fb, uint32_t frame_number,
+                        uint32_t clock, uint8_t epoch);
+
+// Current value, 16.16
+uint32_t audio_feedback_value(const audio_feedback_t *fb);
+
+#endif // AUDIO_FEEDBACK_H
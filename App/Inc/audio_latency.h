@@ -0,0 +1,73 @@
+// SPDX-License-Identifier: GPL-3.0-only
+// Copyright (c) 2026 Elia Chiarucci
+
+/*
+ * Audio latency profiles
+ * Each picks the USB FIFO target and the I2S ring's periods, for the packet
+ * jitter tests/test_audio_latency.c checks it against.
+ * Pure C, no hardware dependencies: compiles unmodified on the host.
+ */
+
+#ifndef AUDIO_LATENCY_H
+#define AUDIO_LATENCY_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef enum {
+    AUDIO_LATENCY_LOW = 0,  // monitoring, gaming
+    AUDIO_LATENCY_BALANCED,
+    AUDIO_LATENCY_STANDARD, // the original fixed configuration
+    AUDIO_LATENCY_ROBUST,   // busy hosts, hubs
+    AUDIO_LATENCY_COUNT
+} audio_latency_id_t;
+
+#define AUDIO_LATENCY_DEFAULT AUDIO_LATENCY_STANDARD
+
+// Stream format the presets are expressed in: 48kHz, packed 24-bit stereo
+#define AUDIO_LATENCY_RATE          48000U
+#define AUDIO_LATENCY_FRAME_BYTES   6U
+#define AUDIO_LATENCY_PACKET_FRAMES 48U // nominal full-speed packet (1ms)
+
+// Highest stream rate: a whole multiple of AUDIO_LATENCY_RATE. Presets run
+// at it scaled (audio_latency_at_rate), with the same times.
+#define AUDIO_LATENCY_MAX_RATE 96000U
+
+// Ring limits at AUDIO_LATENCY_RATE (the I2S buffer and linked-list nodes
+// are sized for these, the buffer for the highest rate the build streams)
+#define AUDIO_LATENCY_MAX_PERIODS     4
+#define AUDIO_LATENCY_MAX_RING_FRAMES 288
+
+typedef struct {
+    const char *name;
+    uint16_t period_frames; // frames per DMA period (one audio stage run)
+    uint8_t periods;        // DMA ring length
+    uint16_t fifo_target;   // USB FIFO level the feedback regulates to, bytes
+    uint16_t jitter_us;     // USB arrival jitter the preset absorbs
+} audio_latency_preset_t;
+
+// NULL if id is out of range
+const audio_latency_preset_t *audio_latency_preset(uint8_t id);
+
+// I2S rate a stream at rate Hz plays at: the rate itself for a whole
+// multiple of AUDIO_LATENCY_RATE up to AUDIO_LATENCY_MAX_RATE, the 48kHz
+// family rate for a 44.1kHz family one (resampled, see audio_resample.h),
+// 0 if unsupported
+uint32_t audio_latency_i2s_rate(uint32_t rate);
+
+// The preset for a stream at rate Hz (one audio_latency_i2s_rate() takes):
+// period and FIFO target hold the same time. The period is in frames at
+// the I2S rate, the FIFO target in bytes of the stream. False (out
+// untouched) for any other rate.
+bool audio_latency_at_rate(const audio_latency_preset_t *p, uint32_t rate,
+                           audio_latency_preset_t *out);
+
+// Time the DMA takes to play one period (presets as in the table, at
+// AUDIO_LATENCY_RATE)
+uint32_t audio_latency_period_us(const audio_latency_preset_t *p);
+
+// Nominal USB-to-DAC delay: the mean time a sample waits in the FIFO plus
+// the mean time it spends in the ring (filled one ring ahead of the DMA)
+uint32_t audio_latency_total_us(const audio_latency_preset_t *p);
+
+#endif // AUDIO_LATENCY_H
@@ -4,11 +4,20 @@
 /*
  * Audio Output via I2S DMA
  * Works with TinyUSB audio FIFO
+ *
+ * The I2S DMA plays a ring of periods sized by the latency profile
+ * (audio_latency.h). The period fill (FIFO unpack, EQ, volume) runs in the
+ * audio stage: the PendSV exception, pended by the DMA interrupt at the end
+ * of each period. It sits below every hardware IRQ and above the main loop,
+ * so neither the main loop's display/flash work nor USB interrupts can make
+ * it miss a period.
  */
 
 #ifndef AUDIO_OUTPUT_H
 #define AUDIO_OUTPUT_H
 
+#include "audio_stats.h"
+#include <stdbool.h>
 #include <stdint.h>
 
 // Initialize audio output hardware
@@ -20,10 +29,101 @@ void audio_output_start_streaming(void);
 // Stop streaming (called when USB alt interface is set to 0 or disconnect)
 void audio_output_stop_streaming(void);
 
-// Audio processing task - call this from main loop
+// NVIC priority of the audio stage (PendSV), set in configure_nvic_priorities
+#define AUDIO_OUTPUT_IRQ_PRIORITY 4
+
+// Audio stage - call this from PendSV_Handler
 // Reads from USB FIFO and feeds I2S DMA buffer
+void audio_output_process(void);
+
+// I2S DMA interrupt - call this from GPDMA1_Channel0_IRQHandler
+void audio_output_dma_irq(void);
+
+// Main loop housekeeping (debug statistics); the audio path does not depend on it
 void audio_output_task(void);
 
+// Telemetry counts since the last reset (audio_stats.h); with reset, the
+// next call counts from here. Returns the milliseconds they cover. Thread
+// mode only.
+uint32_t audio_output_get_stats(audio_stats_counters_t *counters, bool reset);
+
+// Microseconds until the I2S DMA finishes the period it is playing, i.e.
+// until the audio stage next takes the CPU (UINT32_MAX while it is stopped)
+uint32_t audio_output_us_to_next_period(void);
+
+// I2S frames played since start, in 1/256 frame (whole 32-bit words, so
+// half-frame steps), read from the DMA position: the DAC clock as the
+// feedback endpoint measures it against SOF. Free-running, wraps; *epoch
+// changes whenever the count jumps (ring restart or profile switch).
+uint32_t audio_output_clock(uint8_t *epoch);
+
+// Audio the I2S ring holds ahead of the DAC, in 1/256 stream frame (the
+// resampler's and converter's delays included), not counting bytes the USB
+// FIFO still reports. False while no stream plays (stopped,
+// prebuffering) or the audio stage is part-way through a refill.
+bool audio_output_queued(uint32_t *frames_q8);
+
+// Asynchronous sample-rate converter (audio_asrc.h) between the FIFO and the
+// DSP chain, for hosts that ignore the feedback endpoint: the adaptive
+// endpoint has none to ignore
+#if AUDIO_ADAPTIVE_CLOCK
+#define AUDIO_OUTPUT_ASRC 0
+#else
+#define AUDIO_OUTPUT_ASRC 1
+#endif
+
+// The monitor's verdict (usb_audio.c, USB interrupt): engaged, the
+// converter takes over from the next period at ratio 1 + ppm_q8 / 256e6
+// inputs per output, then follows ppm_q8 period by period. Disengaged, the
+// direct path from the next period (only as the stream restarts).
+void audio_output_set_asrc(bool engaged, int32_t ppm_q8);
+
+// The output ran short of audio (a partial or held fill) since the last
+// call. USB interrupt only.
+bool audio_output_ran_short(void);
+
+// Loopback capture (USB_AUDIO_LOOPBACK, usb_audio.c): while on, each period
+// the DMA has played goes to the capture FIFO as the DAC got it (resampled,
+// converted, EQ and volume applied; L/R as the host sent them), just before
+// the audio stage refills it. Starts from an empty FIFO. Thread mode only;
+// a no-op in other builds.
+void audio_output_set_capture(bool on);
+
+// Latency profile (audio_latency_id_t). The ring switches at the next period
+// end while no stream is open; a request made during a stream waits for it
+// to stop, as TinyUSB only takes a new feedback target when the host opens
+// the stream. Returns false for an unknown id.
+bool audio_output_set_latency(uint8_t id);
+uint8_t audio_output_get_latency(void);         // profile the ring runs
+uint8_t audio_output_get_latency_request(void); // last requested
+
+// USB FIFO level the feedback endpoint regulates to (active profile, at the
+// stream rate and format)
+uint16_t audio_output_fifo_target(void);
+
+// Stream sample format, from the alternate setting the host opens: 3 bytes
+// (24-bit) or 2 bytes (16-bit) per sample. Call before
+// audio_output_start_streaming, with the stream stopped. False for any
+// other size.
+bool audio_output_set_format(uint8_t sample_bytes);
+uint8_t audio_output_get_frame_bytes(void); // USB bytes per stereo frame
+
+// Stream sample rate: 48000 or 96000 (AUDIO_LATENCY_MAX_RATE), or 44100 or
+// 88200, resampled to the I2S rate of the 48kHz family
+// (audio_latency_i2s_rate); up to CFG_TUD_AUDIO_FUNC_1_MAX_SAMPLE_RATE_FS. Restarts the ring at a new I2S rate, and an
+// open stream's prebuffering, and switches the EQ coefficients. Thread
+// mode only. False for an unsupported rate, or if the I2S could not be
+// reconfigured (it keeps the old rate).
+bool audio_output_set_rate(uint32_t rate);
+uint32_t audio_output_get_rate(void);
+uint32_t audio_output_get_i2s_rate(void); // the rate audio_output_clock runs at
+
+// Hold off the audio stage while thread-mode code changes state it reads
+// (EQ profiles, stream start/stop). Hardware IRQs stay enabled. Nestable:
+// pass the returned key back to audio_output_unlock.
+uint32_t audio_output_lock(void);
+void audio_output_unlock(uint32_t key);
+
 // Set USB mute state (called from USB volume control)
 void audio_output_set_mute(uint8_t mute);
 
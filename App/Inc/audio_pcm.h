@@ -0,0 +1,42 @@
+// SPDX-License-Identifier: GPL-3.0-only
+// Copyright (c) 2026 Elia Chiarucci
+
+/*
+ * PCM conversion kernels of the audio stage
+ * L/R swap, volume ramp and I2S packing, and back for the loopback capture.
+ * Stereo interleaved 24-bit in int32_t; sample_count counts mono samples.
+ * Pure C, no hardware dependencies: compiles unmodified on the host.
+ */
+
+#ifndef AUDIO_PCM_H
+#define AUDIO_PCM_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define AUDIO_PCM_UNITY 65536U // volume scale of 0dB
+
+// PCM5102A anti-pop: 1 LSB DC offset prevents the DAC's Zero Data Detect
+// from engaging analog mute during silence. Inaudible (AC-coupled output).
+// 24-bit sample value 1, left-justified in 32-bit I2S word = 0x00000100.
+#define AUDIO_PCM_DC_OFFSET 1
+
+void audio_pcm_swap(int32_t *buf, uint16_t sample_count);
+
+// Volume scale 0-AUDIO_PCM_UNITY. When from != to the gain is linearly
+// interpolated across the buffer, so a change never steps (clicks);
+// otherwise a flat gain, skipped at unity.
+void audio_pcm_volume(int32_t *buf, uint16_t sample_count, uint32_t from,
+                      uint32_t to);
+
+// In place to left-justified I2S words (uint32_t, same size). Zero samples
+// are sent as AUDIO_PCM_DC_OFFSET.
+void audio_pcm_pack(int32_t *buf, uint16_t sample_count);
+
+// Played I2S words back to packed 24-bit little-endian USB samples (3 bytes
+// each), L/R swapped back per frame when swap is set (sample_count even).
+// Exact but for the pack's DC offset: a zero sample reads back as 1.
+void audio_pcm_unpack_i2s(const uint32_t *words, uint8_t *out,
+                          uint16_t sample_count, bool swap);
+
+#endif // AUDIO_PCM_H
@@ -0,0 +1,42 @@
+// SPDX-License-Identifier: GPL-3.0-only
+// Copyright (c) 2026 Elia Chiarucci
+
+/*
+ * Steerable I2S kernel clock for the adaptive clock mode
+ * SPI1 from PLL2P: HSI 64MHz / 8 * (64 + FRACN/8192) / 21 = 24.576MHz,
+ * FRACN steps of 1.89ppm, about -0.79 .. +0.76% around nominal.
+ */
+
+#ifndef AUDIO_PLL_H
+#define AUDIO_PLL_H
+
+#include <stdint.h>
+
+#ifndef AUDIO_ADAPTIVE_CLOCK
+#define AUDIO_ADAPTIVE_CLOCK 0
+#endif
+
+#define AUDIO_PLL_M            8
+#define AUDIO_PLL_N            64
+#define AUDIO_PLL_P            21
+#define AUDIO_PLL_FRACN_CENTER 4194 // 24.576MHz, -0.6ppm
+#define AUDIO_PLL_FRACN_MAX    8191
+
+// FRACN steps per unit multiplier: a step is 1/AUDIO_PLL_STEPS of the clock
+#define AUDIO_PLL_STEPS (8192 * AUDIO_PLL_N + AUDIO_PLL_FRACN_CENTER)
+
+// Correction range, 1/256 ppm (whole steps either side of the center)
+#define AUDIO_PLL_MIN_Q8                                                      \
+    (-(int32_t)((int64_t)AUDIO_PLL_FRACN_CENTER * 256000000 / AUDIO_PLL_STEPS))
+#define AUDIO_PLL_MAX_Q8                                                      \
+    ((int32_t)((int64_t)(AUDIO_PLL_FRACN_MAX - AUDIO_PLL_FRACN_CENTER) *       \
+               256000000 / AUDIO_PLL_STEPS))
+
+// Switch SPI1 to PLL2P at the center frequency, before HAL_I2S_Init
+void audio_pll_init(void);
+
+// Pull the clock by ppm_q8 (1/256 ppm, positive faster), to the nearest
+// FRACN step; glitch-free, callable from an interrupt
+void audio_pll_set_ppm(int32_t ppm_q8);
+
+#endif // AUDIO_PLL_H
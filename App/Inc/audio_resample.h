@@ -0,0 +1,52 @@
+// SPDX-License-Identifier: GPL-3.0-only
+// Copyright (c) 2026 Elia Chiarucci
+
+/*
+ * 44.1kHz-family to 48kHz-family resampler
+ * Fixed ratio 160/147, polyphase FIR (scripts/gen_resample_taps.py): 32 taps
+ * per phase, within +-0.01dB to 20kHz, images below -90dB.
+ * Pure C, no hardware dependencies: compiles unmodified on the host.
+ */
+
+#ifndef AUDIO_RESAMPLE_H
+#define AUDIO_RESAMPLE_H
+
+#include <stdint.h>
+
+#define AUDIO_RESAMPLE_PHASES 160 // output frames per AUDIO_RESAMPLE_STEP in
+#define AUDIO_RESAMPLE_STEP   147
+#define AUDIO_RESAMPLE_TAPS   32  // input frames each output is made of
+
+// Group delay in 1/256 input frame: half the prototype, plus the inputs
+// taken ahead of each output (less one step)
+#define AUDIO_RESAMPLE_DELAY_Q8                                               \
+    (((AUDIO_RESAMPLE_TAPS * AUDIO_RESAMPLE_PHASES - 1) * 128U +              \
+      (AUDIO_RESAMPLE_PHASES - AUDIO_RESAMPLE_STEP) * 256U) /                 \
+     AUDIO_RESAMPLE_PHASES)
+
+// Phases 0 .. PHASES/2-1 of the symmetric prototype (audio_resample_taps.c)
+extern const float audio_resample_taps[AUDIO_RESAMPLE_PHASES / 2]
+                                      [AUDIO_RESAMPLE_TAPS];
+
+typedef struct {
+    // Last TAPS stereo frames, stored twice so the window is contiguous
+    float hist[2 * AUDIO_RESAMPLE_TAPS][2];
+    uint8_t pos;   // slot of the oldest frame in the window
+    uint8_t phase; // of the next output, 0 .. PHASES-1
+} audio_resample_t;
+
+// Silence in the history, phase 0
+void audio_resample_reset(audio_resample_t *rs);
+
+// Input frames the next out_frames outputs take
+uint16_t audio_resample_needed(const audio_resample_t *rs, uint16_t out_frames);
+
+// Outputs in_frames input frames are enough for
+uint16_t audio_resample_possible(const audio_resample_t *rs, uint16_t in_frames);
+
+// Resample out_frames stereo frames, taking audio_resample_needed() inputs;
+// in may overlap out's tail
+void audio_resample_process(audio_resample_t *rs, const int32_t *in,
+                            int32_t *out, uint16_t out_frames);
+
+#endif // AUDIO_RESAMPLE_H
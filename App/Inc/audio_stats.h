@@ -0,0 +1,54 @@
+// SPDX-License-Identifier: GPL-3.0-only
+// Copyright (c) 2026 Elia Chiarucci
+
+/*
+ * Audio pipeline telemetry
+ * Always-on counters from one writer; readers copy under a sequence count
+ * and reset by moving their baseline, never by writing the counters.
+ * Pure C, no hardware dependencies: compiles unmodified on the host.
+ */
+
+#ifndef AUDIO_STATS_H
+#define AUDIO_STATS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// FIFO level histogram: one bin per AUDIO_STATS_LEVEL_STEP bytes (a
+// full-size 1ms packet), the last bin taking everything above
+#define AUDIO_STATS_LEVEL_STEP 294
+#define AUDIO_STATS_LEVEL_BINS 16
+
+typedef struct {
+    uint32_t periods;          // periods played while streaming
+    uint32_t underruns;        // ... with no audio at all
+    uint32_t partial_fills;    // ... short of a full period
+    uint32_t concealed_frames; // frames replaced by the held last sample
+    uint32_t dropped_bytes;    // prebuffer overshoot discarded at start
+    uint32_t stream_starts;
+    uint32_t stream_stops;
+    uint32_t dma_errors;       // I2S ring restarts
+    uint32_t level_hist[AUDIO_STATS_LEVEL_BINS]; // FIFO level per period
+} audio_stats_counters_t;
+
+typedef struct {
+    volatile uint32_t seq; // odd while the writer is mid-update
+    audio_stats_counters_t c;
+    audio_stats_counters_t base; // reader's baseline (last reset)
+} audio_stats_t;
+
+void audio_stats_init(audio_stats_t *s);
+
+// Writer side (one context only)
+void audio_stats_period(audio_stats_t *s, uint16_t fifo_level,
+                        uint16_t frames, uint16_t frames_read);
+void audio_stats_dropped(audio_stats_t *s, uint16_t bytes);
+void audio_stats_stream(audio_stats_t *s, bool start);
+void audio_stats_dma_error(audio_stats_t *s);
+
+// Reader side (one context only, preemptible by the writer): the counts
+// since the last reset. With reset, the next snapshot counts from here.
+void audio_stats_snapshot(audio_stats_t *s, audio_stats_counters_t *out,
+                          bool reset);
+
+#endif // AUDIO_STATS_H
@@ -0,0 +1,67 @@
+// SPDX-License-Identifier: GPL-3.0-only
+// Copyright (c) 2026 Elia Chiarucci
+
+/*
+ * USB sample unpacking
+ * Packed 16/24-bit USB samples to left-justified 24-bit int32_t, on the CPU
+ * or as a GPDMA 2D transfer plan (with a bit-exact host model).
+ * Pure C, no hardware dependencies: compiles unmodified on the host.
+ */
+
+#ifndef AUDIO_UNPACK_H
+#define AUDIO_UNPACK_H
+
+#include "usb_audio.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+// Bytes per packed stereo frame on the USB side (2 x 24-bit, 2 x 16-bit)
+#define AUDIO_UNPACK_FRAME_BYTES     6
+#define AUDIO_UNPACK_FRAME_BYTES_S16 4
+
+// One transfer per channel per FIFO region (the data may wrap the ring)
+#define AUDIO_UNPACK_MAX_XFERS 4
+
+// Unpack count packed 24-bit LE samples to sign-extended int32_t
+void audio_unpack_s24(const uint8_t *src, int32_t *dst, uint16_t count);
+
+// Same, reading straight out of the (possibly wrapped) USB FIFO regions.
+// A sample straddling the ring end is stitched through a small scratch.
+void audio_unpack_s24_regions(const usb_audio_regions_t *rgn, int32_t *dst,
+                              uint16_t sample_count);
+
+// Unpack count 16-bit LE samples to 24-bit int32_t (sample << 8). One word
+// load per L/R pair, each half sign-extended by a shift: half the USB bytes
+// and about half the cost of the 24-bit kernel.
+void audio_unpack_s16(const uint8_t *src, int32_t *dst, uint16_t count);
+
+// Same, from the FIFO regions (a sample straddling the ring end stitched)
+void audio_unpack_s16_regions(const usb_audio_regions_t *rgn, int32_t *dst,
+                              uint16_t sample_count);
+
+// One GPDMA block transfer, byte data width on both sides. Field names map
+// 1:1 onto the channel registers (see audio_output.c).
+typedef struct {
+    const uint8_t *src;   // CxSAR
+    uint32_t dst_offset;  // CxDAR, relative to the I2S half-buffer
+    uint16_t bytes;       // CxBR1.BNDT
+    uint8_t burst;        // CxTR1.SBL_1/DBL_1 + 1
+    uint8_t src_gap;      // CxTR3.SAO: bytes skipped after each source burst
+    uint8_t dst_gap;      // CxTR3.DAO: bytes skipped after each dest burst
+} audio_unpack_xfer_t;
+
+// Plan the GPDMA transfers that unpack `frames` stereo frames from the FIFO
+// regions into an I2S buffer of left-justified 32-bit words. Returns the
+// number of transfers written to out (2 or 4), or 0 if a frame straddles
+// the ring end (caller falls back to the CPU kernel).
+uint8_t audio_unpack_dma_plan(const usb_audio_regions_t *rgn, uint16_t frames,
+                              bool swap,
+                              audio_unpack_xfer_t out[AUDIO_UNPACK_MAX_XFERS]);
+
+// Host-side model of the GPDMA executing the planned transfers into dst.
+// Byte 0 of each destination word is never written (the pad byte of the
+// left-justified layout), exactly as on the hardware.
+void audio_unpack_dma_model(const audio_unpack_xfer_t *xfers, uint8_t count,
+                            uint8_t *dst);
+
+#endif // AUDIO_UNPACK_H
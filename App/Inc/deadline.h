@@ -0,0 +1,54 @@
+// SPDX-License-Identifier: GPL-3.0-only
+// Copyright (c) 2026 Elia Chiarucci
+
+/*
+ * Audio deadline monitor
+ * Slack of each I2S refill before the DMA reaches it, logged misses and the
+ * main-loop pass period, in log2 histograms (bin n: [2^(n-1), 2^n) us).
+ * Pure C, no hardware dependencies: compiles unmodified on the host.
+ */
+
+#ifndef DEADLINE_H
+#define DEADLINE_H
+
+#include <stdint.h>
+
+#define DEADLINE_HIST_BINS 16
+#define DEADLINE_MISS_LOG  8 // last misses kept
+
+typedef struct {
+    uint32_t count;
+    uint32_t min_us;
+    uint32_t max_us;
+    uint32_t bins[DEADLINE_HIST_BINS];
+} deadline_hist_t;
+
+typedef struct {
+    uint32_t tick_ms; // HAL tick when the refill finished
+    uint32_t late_us; // how far the DMA had played into the period
+    uint8_t task;     // main-loop task running (sched_current())
+    uint8_t latency;  // latency profile (audio_latency_id_t)
+} deadline_miss_t;
+
+typedef struct {
+    deadline_hist_t loop;  // main loop pass period
+    deadline_hist_t slack; // refill slack
+    uint32_t misses;       // total since boot
+    uint32_t log_start;    // first miss logged since the last reset
+    deadline_miss_t log[DEADLINE_MISS_LOG]; // miss n in log[n % size]
+} deadline_state_t;
+
+void deadline_hist_add(deadline_hist_t *h, uint32_t us);
+
+// Writers
+void deadline_loop_pass(uint32_t us);
+void deadline_slack(uint32_t us);
+void deadline_miss(const deadline_miss_t *miss);
+
+// Readers: copy the state under audio_output_lock; the miss total survives
+// a reset
+const deadline_state_t *deadline_state(void);
+const deadline_miss_t *deadline_logged(uint32_t seq);
+void deadline_reset(void);
+
+#endif // DEADLINE_H
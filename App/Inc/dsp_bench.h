@@ -0,0 +1,53 @@
+// SPDX-License-Identifier: GPL-3.0-only
+// Copyright (c) 2026 Elia Chiarucci
+
+/*
+ * On-target DSP kernel benchmark (CMD_RUN_BENCHMARK)
+ * Times the audio stage's kernels over a canned buffer with the DWT cycle
+ * counter. Not while streaming; compare min, max can include ISR time.
+ */
+
+#ifndef DSP_BENCH_H
+#define DSP_BENCH_H
+
+#include <stdint.h>
+
+#define DSP_BENCH_FRAMES 96 // stereo frames per run (a standard period)
+#define DSP_BENCH_RUNS   16
+
+typedef enum {
+    DSP_BENCH_UNPACK16 = 0, // packed 16-bit -> int32 (16-bit streams)
+    DSP_BENCH_UNPACK,     // packed 24-bit -> int32
+    DSP_BENCH_RESAMPLE,   // 44.1 -> 48kHz, in place from the buffer's tail
+    DSP_BENCH_SWAP,       // L/R swap
+    DSP_BENCH_EQ_BT,      // bass/treble (audio_eq)
+    DSP_BENCH_EQ_PROFILE, // active profile's biquads; no runs when off
+    DSP_BENCH_VOLUME,     // ramped (the per-sample interpolation path)
+    DSP_BENCH_PACK,       // int32 -> I2S words
+    DSP_BENCH_COUNT
+} dsp_bench_kernel_t;
+
+#define DSP_BENCH_NAME_LEN 8 // characters reported over CDC (not terminated)
+
+// Data layout of the buffer the kernels run on
+#define DSP_BENCH_LAYOUT_S24_IN_S32 0 // interleaved stereo, 24-bit in int32
+
+typedef struct {
+    uint32_t runs;
+    uint32_t min; // cycles per run
+    uint32_t max;
+    uint32_t mean;
+} dsp_bench_result_t;
+
+typedef struct {
+    dsp_bench_result_t kernel[DSP_BENCH_COUNT];
+    uintptr_t buffer;      // address of the work buffer (memory bank)
+    uint8_t filter_count;  // active profile's enabled filters, 0 when off
+    int8_t bass, treble;   // audio_eq settings
+} dsp_bench_report_t;
+
+const char *dsp_bench_name(uint8_t id);
+
+void dsp_bench_run(dsp_bench_report_t *out);
+
+#endif // DSP_BENCH_H
@@ -136,4 +136,11 @@ void eq_profile_process(int32_t *buffer, uint16_t sample_count,
 // Clear biquad filter state (call on stream start to avoid transients).
 void eq_profile_reset_state(void);
 
+// Stream rate. Stored coefficients are for 48kHz; at other rates the
+// active profile is redesigned from its freq/gain/Q. Clears filter state.
+// Returns false (rate unchanged) outside 8-192kHz.
+bool eq_profile_set_rate(uint32_t rate);
+
+uint32_t eq_profile_get_rate(void);
+
 #endif // EQ_PROFILE_H
@@ -0,0 +1,33 @@
+// SPDX-License-Identifier: GPL-3.0-only
+// Copyright (c) 2026 Elia Chiarucci
+
+/*
+ * Checksums for the flash stores and the CDC protocol
+ * CRC-32 as zlib computes it, on the CRC peripheral once integrity_init
+ * has checked it, unless built with INTEGRITY_HW_CRC=0; CRC-8 (SMBus) for
+ * the CDC frames.
+ */
+
+#ifndef INTEGRITY_H
+#define INTEGRITY_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifndef INTEGRITY_HW_CRC
+#define INTEGRITY_HW_CRC 1
+#endif
+
+// Boot check of the CRC peripheral against the software CRC-32, at every
+// alignment: CRC-32 runs on the peripheral only once they agree (in
+// software until then, and for good if they don't). True if they agree,
+// or without INTEGRITY_HW_CRC.
+bool integrity_init(void);
+
+// Continue from the last call's result, 0 to start; main loop only
+uint32_t integrity_crc32(uint32_t crc, const void *data, uint32_t len);
+
+// Polynomial 0x07, continuing from crc (0 to start)
+uint8_t integrity_crc8(uint8_t crc, const void *data, uint32_t len);
+
+#endif // INTEGRITY_H
@@ -0,0 +1,78 @@
+// SPDX-License-Identifier: GPL-3.0-only
+// Copyright (c) 2026 Elia Chiarucci
+
+/*
+ * Cycle-count profiler for the DSP and I/O stages (CMD_GET_PERF)
+ * PERF_BEGIN/PERF_END time a stage with the DWT cycle counter. Built only
+ * with PERF_PROFILE=1; each stage is recorded by one context.
+ */
+
+#ifndef PERF_H
+#define PERF_H
+
+#include <stdint.h>
+
+#ifndef PERF_PROFILE
+#define PERF_PROFILE 0
+#endif
+
+typedef enum {
+    // Audio stage (PendSV)
+    PERF_AUDIO = 0, // one whole run: every period it refills
+    PERF_UNPACK,    // FIFO 24-bit -> int32
+    PERF_RESAMPLE,  // 44.1kHz family -> I2S rate
+    PERF_ASRC,      // converter, engaged for hosts that ignore feedback
+    PERF_SWAP,      // L/R swap
+    PERF_EQ,        // EQ profile or bass/treble
+    PERF_VOLUME,
+    PERF_PACK,      // int32 -> I2S words
+    // Main loop
+    PERF_USB,       // tud_task
+    PERF_DISPLAY,   // display_draw
+    PERF_FLASH,     // EQ profile flash steps and settings saves
+    PERF_STAGE_COUNT
+} perf_stage_id_t;
+
+#define PERF_NAME_LEN 8 // characters reported over CDC (not terminated)
+
+// Histogram: bin 0 counts runs under 2^PERF_HIST_SHIFT cycles, bin n runs
+// of [2^(PERF_HIST_SHIFT+n-1), 2^(PERF_HIST_SHIFT+n)) cycles, the last bin
+// everything longer (2^18 cycles is about 1ms at 248MHz)
+#define PERF_HIST_BINS  12
+#define PERF_HIST_SHIFT 8
+
+// Counters saturate
+typedef struct {
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint64_t total;
+    uint16_t hist[PERF_HIST_BINS];
+} perf_stage_t;
+
+const char *perf_stage_name(uint8_t id);
+
+#if PERF_PROFILE
+
+#ifndef PERF_CYCLES
+#define PERF_CYCLES() (DWT->CYCCNT) // enabled in app_init
+#endif
+
+#define PERF_BEGIN(id) uint32_t perf_start_##id = PERF_CYCLES()
+#define PERF_END(id) perf_record((id), PERF_CYCLES() - perf_start_##id)
+
+void perf_record(uint8_t id, uint32_t cycles);
+const perf_stage_t *perf_stage(uint8_t id);
+void perf_reset(void);
+
+// Share of window_cycles the stage ran, in 0.01% units (saturates)
+uint16_t perf_load(const perf_stage_t *s, uint64_t window_cycles);
+
+#else
+
+#define PERF_BEGIN(id) do { } while (0)
+#define PERF_END(id) do { } while (0)
+
+#endif
+
+#endif // PERF_H
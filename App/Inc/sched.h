@@ -0,0 +1,74 @@
+// SPDX-License-Identifier: GPL-3.0-only
+// Copyright (c) 2026 Elia Chiarucci
+
+/*
+ * Cooperative main-loop scheduler
+ * Run-to-completion tasks in priority order, polled or periodic with a
+ * deadline; deferrable ones wait for room before the audio stage.
+ * Pure C, no hardware dependencies: time comes from the port.
+ */
+
+#ifndef SCHED_H
+#define SCHED_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define SCHED_MAX_TASKS 12
+#define SCHED_NAME_LEN  8 // characters reported over CDC (not terminated)
+#define SCHED_NO_TASK   0xFF
+
+// Task flags
+#define SCHED_DEFERRABLE 0x01
+
+// Returns true while the task has more work pending (run again next pass)
+typedef bool (*sched_run_fn)(uint32_t now_ms);
+
+typedef struct {
+    const char *name;
+    sched_run_fn run;
+    uint16_t period_ms;   // 0 = every pass
+    uint16_t deadline_ms; // 0 = period_ms (periodic) / none (poll)
+    uint8_t flags;
+} sched_task_t;
+
+typedef struct {
+    uint32_t (*now_ms)(void);
+    uint32_t (*cycles)(void);   // free-running cycle counter (run times)
+    uint32_t cycles_per_us;
+    uint32_t (*window_us)(void); // NULL = never defer
+    void (*idle)(void);          // NULL = busy loop
+} sched_port_t;
+
+// Per-task run statistics (times in microseconds, counters saturate)
+typedef struct {
+    uint32_t runs;
+    uint32_t total_us;
+    uint16_t last_us;
+    uint16_t max_us;
+    uint16_t deferred;
+    uint16_t missed;
+} sched_stats_t;
+
+// Tasks and port must stay valid for the scheduler's lifetime
+void sched_init(const sched_task_t *tasks, uint8_t count,
+                const sched_port_t *port);
+
+// One scheduler pass; call from the main loop
+void sched_run(void);
+
+uint8_t sched_task_count(void);
+const sched_task_t *sched_task(uint8_t id);
+const sched_stats_t *sched_stats(uint8_t id);
+
+// Task running now (for interrupts to tell what they preempted), or
+// SCHED_NO_TASK between tasks and while idle
+uint8_t sched_current(void);
+
+// Passes run and passes that ended in the idle hook
+uint32_t sched_pass_count(void);
+uint32_t sched_idle_count(void);
+
+void sched_reset_stats(void);
+
+#endif // SCHED_H
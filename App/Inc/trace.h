@@ -0,0 +1,78 @@
+// SPDX-License-Identifier: GPL-3.0-only
+// Copyright (c) 2026 Elia Chiarucci
+
+/*
+ * Binary event trace over RTT
+ * 8-byte records stamped with the DWT cycle counter, decoded by
+ * scripts/trace_decode.py. Built only with TRACE_RTT=1; full buffer drops.
+ */
+
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stdint.h>
+
+#ifndef TRACE_RTT
+#define TRACE_RTT 0
+#endif
+
+#define TRACE_CHANNEL     1    // RTT up-buffer (0 is the text terminal)
+#define TRACE_BUFFER_SIZE 1024 // bytes: 127 records (RTT keeps one free)
+#define TRACE_VERSION     1    // record layout, in TRACE_START
+
+// Event IDs: keep in step with scripts/trace_decode.py. _BEGIN/_END pairs
+// are spans on the timeline, the rest instants.
+typedef enum {
+    TRACE_START = 0,      // arg8: TRACE_VERSION, arg16: CPU clock in MHz
+    TRACE_LOST,           // arg16: records dropped (saturates)
+    // I2S DMA interrupt
+    TRACE_DMA_PERIOD,     // arg16: periods played (low 16 bits)
+    TRACE_DMA_ERROR,
+    // Audio stage (PendSV)
+    TRACE_FILL_BEGIN,     // arg8: period, arg16: FIFO bytes
+    TRACE_FILL_END,       // arg8: period
+    // USB interrupt
+    TRACE_USB_SOF,        // arg16: frame number
+    TRACE_USB_AUDIO_RX,   // arg16: packet bytes
+    // Main loop
+    TRACE_CDC_RX,         // arg8: command, arg16: payload bytes
+    TRACE_CDC_TX,         // arg8: command | 0x80, arg16: frame bytes
+    TRACE_FLASH_ERASE_BEGIN,   // arg8: trace_flash_area_t
+    TRACE_FLASH_ERASE_END,     // arg8: trace_flash_area_t
+    TRACE_FLASH_PROGRAM_BEGIN, // arg8: trace_flash_area_t, arg16: offset
+    TRACE_FLASH_PROGRAM_END,   // arg8: trace_flash_area_t
+    // Display (main loop starts a page, I2C DMA interrupt ends it)
+    TRACE_DISPLAY_PAGE_BEGIN,  // arg8: page
+    TRACE_DISPLAY_PAGE_END,    // arg8: page
+    TRACE_EVENT_COUNT
+} trace_event_t;
+
+typedef enum {
+    TRACE_FLASH_PROFILES = 0, // EQ profiles sector
+    TRACE_FLASH_SETTINGS,     // settings sector
+} trace_flash_area_t;
+
+// Little-endian, as on the wire
+typedef struct {
+    uint32_t cycles; // DWT cycle counter (wraps)
+    uint8_t event;   // trace_event_t
+    uint8_t arg8;
+    uint16_t arg16;
+} trace_record_t;
+
+#if TRACE_RTT
+
+// Sets up the RTT up-buffer and writes TRACE_START, once DWT runs
+void trace_init(uint32_t cpu_hz);
+void trace_event(uint8_t event, uint8_t arg8, uint16_t arg16);
+
+#define TRACE(event, arg8, arg16)                                            \
+    trace_event((event), (uint8_t)(arg8), (uint16_t)(arg16))
+
+#else
+
+#define TRACE(event, arg8, arg16) do { } while (0)
+
+#endif
+
+#endif // TRACE_H
@@ -2,7 +2,8 @@
 // Copyright (c) 2026 Elia Chiarucci
 
 /*
- * TinyUSB Configuration for STM32H503 USB Audio (UAC1)
+ * TinyUSB Configuration for STM32H503 USB Audio (UAC1, or UAC2; UAC1 with a
+ * loopback capture interface)
  */
 
 #ifndef _TUSB_CONFIG_H_
@@ -62,36 +63,103 @@ extern "C" {
 // AUDIO CLASS DRIVER CONFIGURATION
 //--------------------------------------------------------------------+
 
-// Audio format: 48kHz, 24-bit stereo (3 bytes per sample over USB)
+// Audio class version: UAC1, or UAC2 with USB_AUDIO_UAC2=1 (the UAC2 CMake
+// option). Full speed either way, same formats, rates and feedback loop.
+#ifndef USB_AUDIO_UAC2
+#define USB_AUDIO_UAC2 0
+#endif
+
+// Clock sync: asynchronous with a feedback endpoint, or adaptive with
+// AUDIO_ADAPTIVE_CLOCK=1 (the ADAPTIVE_CLOCK CMake option): no feedback, the
+// I2S clock steered to the host's instead (audio_pll.h)
+#ifndef AUDIO_ADAPTIVE_CLOCK
+#define AUDIO_ADAPTIVE_CLOCK 0
+#endif
+
+// Loopback capture with USB_AUDIO_LOOPBACK=1 (the LOOPBACK CMake option): a
+// second streaming interface sends the host what the DAC played, after the
+// whole DSP chain (audio_output.h). UAC1 only, and the playback rates stop at
+// 48kHz: the 2KB of packet memory holds every endpoint double-buffered
+// (isochronous), and a 96kHz OUT endpoint (2 x 608 bytes) leaves no room for
+// a 24-bit IN one (2 x 320) next to the control, feedback and CDC endpoints.
+#ifndef USB_AUDIO_LOOPBACK
+#define USB_AUDIO_LOOPBACK 0
+#endif
+
+#if USB_AUDIO_LOOPBACK && USB_AUDIO_UAC2
+#error "The loopback capture interface is UAC1 only"
+#endif
+
+// 44.1 and 48kHz only with USB_AUDIO_NO_96K=1 (the NO_96K CMake option): the
+// EP OUT FIFO and the I2S ring are sized for the highest rate listed, so
+// this halves both (6.75KB of RAM)
+#ifndef USB_AUDIO_NO_96K
+#define USB_AUDIO_NO_96K 0
+#endif
+
+// Audio format: 44.1 to 96kHz, 24-bit stereo (3 bytes per sample over USB)
+// on alternate setting 1, 16-bit (2 bytes) on alternate setting 2
 #define CFG_TUD_AUDIO_FUNC_1_N_CHANNELS_RX             2
 #define CFG_TUD_AUDIO_FUNC_1_N_BYTES_PER_SAMPLE_RX     3
 #define CFG_TUD_AUDIO_FUNC_1_RESOLUTION_RX             24
+#define CFG_TUD_AUDIO_FUNC_1_N_BYTES_PER_SAMPLE_RX_16  2
+#define CFG_TUD_AUDIO_FUNC_1_RESOLUTION_RX_16          16
 
-// Sample rate (single rate for Full-Speed UAC1)
+// Highest sample rate (the descriptor lists 48kHz and 96kHz; 48kHz with
+// the loopback capture or USB_AUDIO_NO_96K)
+#if USB_AUDIO_LOOPBACK || USB_AUDIO_NO_96K
 #define CFG_TUD_AUDIO_FUNC_1_MAX_SAMPLE_RATE_FS        48000
+#else
+#define CFG_TUD_AUDIO_FUNC_1_MAX_SAMPLE_RATE_FS        96000
+#endif
 
-// Full-Speed endpoint size calculation
+// Samples per channel in the largest packet: a frame's worth at the highest
+// rate, plus 1 sample margin (the feedback stretching it)
+#define USB_AUDIO_EP_SAMPLES (CFG_TUD_AUDIO_FUNC_1_MAX_SAMPLE_RATE_FS / 1000 + 1)
+
+// Full-Speed endpoint size calculation, at the highest rate
 // EP size = samples_per_frame * bytes_per_sample * channels
-// At 48kHz, Full-Speed: 48 samples/ms * 3 bytes * 2 channels = 288 bytes
-// Add 1 sample margin: 49 * 3 * 2 = 294 bytes
-#define CFG_TUD_AUDIO_FUNC_1_EP_OUT_SZ_FS    (49 * CFG_TUD_AUDIO_FUNC_1_N_BYTES_PER_SAMPLE_RX * CFG_TUD_AUDIO_FUNC_1_N_CHANNELS_RX)
+// At 96kHz, Full-Speed: 97 * 3 * 2 = 582 bytes (48kHz: 294)
+#define CFG_TUD_AUDIO_FUNC_1_EP_OUT_SZ_FS    (USB_AUDIO_EP_SAMPLES * CFG_TUD_AUDIO_FUNC_1_N_BYTES_PER_SAMPLE_RX * CFG_TUD_AUDIO_FUNC_1_N_CHANNELS_RX)
+// 16-bit: 97 * 2 * 2 = 388 bytes (48kHz: 196)
+#define CFG_TUD_AUDIO_FUNC_1_EP_OUT_SZ_FS_16 (USB_AUDIO_EP_SAMPLES * CFG_TUD_AUDIO_FUNC_1_N_BYTES_PER_SAMPLE_RX_16 * CFG_TUD_AUDIO_FUNC_1_N_CHANNELS_RX)
 
-// Maximum EP size (Full-Speed only device)
+// Maximum EP size (Full-Speed only device): the 24-bit setting's
 #define CFG_TUD_AUDIO_FUNC_1_EP_OUT_SZ_MAX   CFG_TUD_AUDIO_FUNC_1_EP_OUT_SZ_FS
 
 // Software buffer size for endpoint OUT
-// AUDIO_FEEDBACK_METHOD_FIFO_COUNT needs buffer size >= 4 * EP size
-// 16 packets = ~16ms headroom with feedback (4x minimum)
+// 16 packets at the highest rate = ~16ms at it (24ms in 16-bit): the robust
+// latency profile's target plus a burst of late packets (the feedback itself
+// needs little, see audio_feedback.h). 9312 bytes with 96kHz, 4704 without.
 #define CFG_TUD_AUDIO_FUNC_1_EP_OUT_SW_BUF_SZ    (16 * CFG_TUD_AUDIO_FUNC_1_EP_OUT_SZ_FS)
 
 // Enable EP OUT for audio data reception
 #define CFG_TUD_AUDIO_ENABLE_EP_OUT                    1
 
 // Enable feedback endpoint for asynchronous mode
-#define CFG_TUD_AUDIO_ENABLE_FEEDBACK_EP               1
-
-// No EP IN (this is a speaker, not microphone)
-#define CFG_TUD_AUDIO_ENABLE_EP_IN                     0
+#define CFG_TUD_AUDIO_ENABLE_FEEDBACK_EP               (!AUDIO_ADAPTIVE_CLOCK)
+
+// EP IN only for the loopback capture (otherwise a speaker, not microphone)
+#define CFG_TUD_AUDIO_ENABLE_EP_IN                     USB_AUDIO_LOOPBACK
+
+#if USB_AUDIO_LOOPBACK
+// Capture format: 48kHz (the I2S rate), 24-bit stereo, as alternate setting
+// 1 of the playback
+#define CFG_TUD_AUDIO_FUNC_1_N_CHANNELS_TX             2
+#define CFG_TUD_AUDIO_FUNC_1_N_BYTES_PER_SAMPLE_TX     3
+#define CFG_TUD_AUDIO_FUNC_1_RESOLUTION_TX             24
+#define USB_AUDIO_CAPTURE_RATE                         48000
+
+// 49 * 3 * 2 = 294 bytes: TinyUSB's flow control sends 47 to 49 frames per
+// packet to hold the FIFO at half its depth
+#define CFG_TUD_AUDIO_FUNC_1_EP_IN_SZ_MAX    ((USB_AUDIO_CAPTURE_RATE / 1000 + 1) * CFG_TUD_AUDIO_FUNC_1_N_BYTES_PER_SAMPLE_TX * CFG_TUD_AUDIO_FUNC_1_N_CHANNELS_TX)
+
+// Software buffer size for endpoint IN: 8 packets, so half of it holds the
+// longest period (2ms) and the packets the host reads meanwhile. Whole
+// frames: a frame never straddles the ring end.
+#define CFG_TUD_AUDIO_FUNC_1_EP_IN_SW_BUF_SZ     (8 * CFG_TUD_AUDIO_FUNC_1_EP_IN_SZ_MAX)
+#define CFG_TUD_AUDIO_EP_IN_FLOW_CONTROL               1
+#endif
 
 // No encoding/decoding
 #define CFG_TUD_AUDIO_ENABLE_ENCODING                  0
@@ -2,7 +2,7 @@
 // Copyright (c) 2026 Elia Chiarucci
 
 /*
- * USB Audio API for TinyUSB UAC1
+ * USB Audio API for TinyUSB UAC1 (or UAC2)
  */
 
 #ifndef USB_AUDIO_H_
@@ -10,6 +10,10 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include "audio_adaptive.h"
+#include "audio_asrc.h"
+#include "audio_delay.h"
+#include "audio_feedback.h"
 
 // Get current sample rate set by host
 uint32_t usb_audio_get_sample_rate(void);
@@ -17,13 +21,54 @@ uint32_t usb_audio_get_sample_rate(void);
 // Check if audio is currently streaming
 bool usb_audio_is_streaming(void);
 
-// Read audio data from USB FIFO
-// Returns number of bytes read
-uint16_t usb_audio_read(uint8_t* buffer, uint16_t max_length);
+// Zero-copy view of the EP OUT FIFO: up to two linear regions of the ring
+// (the second is only used when the data wraps past the end of the buffer)
+typedef struct {
+    const uint8_t* ptr[2];
+    uint16_t len[2];
+} usb_audio_regions_t;
+
+// Map up to max_length readable bytes of the USB FIFO in place, without
+// copying or advancing the read index. Returns the total bytes mapped.
+uint16_t usb_audio_peek(usb_audio_regions_t* regions, uint16_t max_length);
+
+// Release length bytes previously mapped with usb_audio_peek()
+void usb_audio_consume(uint16_t length);
 
 // Get number of bytes available in USB FIFO
 uint16_t usb_audio_available(void);
 
+// Get number of bytes the ISR can still write to the USB FIFO
+uint16_t usb_audio_free(void);
+
+// Zero-copy view of the free space in the EP IN FIFO (loopback capture,
+// USB_AUDIO_LOOPBACK builds): as usb_audio_regions_t, writable
+typedef struct {
+    uint8_t* ptr[2];
+    uint16_t len[2];
+} usb_audio_space_t;
+
+// Map up to max_length writable bytes of the capture FIFO in place, without
+// advancing the write index. Returns the total bytes mapped.
+uint16_t usb_audio_capture_reserve(usb_audio_space_t* space, uint16_t max_length);
+
+// Hand length bytes written through usb_audio_capture_reserve() to the host
+void usb_audio_capture_commit(uint16_t length);
+
+// Feedback endpoint convergence and jitter for the open (or last) stream
+void usb_audio_get_feedback_stats(audio_fb_stats_t* stats);
+
+// Adaptive clock loop of the open (or last) stream; returns false (stats
+// untouched) unless built with AUDIO_ADAPTIVE_CLOCK
+bool usb_audio_get_adaptive_stats(audio_ad_stats_t* stats);
+
+// Converter monitor of the open (or last) stream; returns false (stats
+// untouched) in builds without the converter (AUDIO_OUTPUT_ASRC)
+bool usb_audio_get_asrc_stats(audio_asrc_stats_t* stats);
+
+// Estimated output delay of the open (or last) stream
+void usb_audio_get_delay_stats(audio_delay_stats_t* stats);
+
 // Get current volume in dB (-90 to 0)
 int8_t usb_audio_get_volume(void);
 
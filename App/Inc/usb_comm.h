@@ -39,12 +39,24 @@
 #define CMD_SET_AMP           0x96
 #define CMD_GET_FAULT_INFO    0x97
 #define CMD_CLEAR_FAULT       0x98
+#define CMD_GET_TASK_STATS    0xA0
+#define CMD_GET_LATENCY       0xA1
+#define CMD_SET_LATENCY       0xA2
+#define CMD_GET_FEEDBACK      0xA3
+#define CMD_GET_DELAY         0xA4
+#define CMD_GET_AUDIO_STATS   0xA5
+#define CMD_GET_PERF          0xA6
+#define CMD_GET_DEADLINE      0xA7
+#define CMD_RUN_BENCHMARK     0xA8
+#define CMD_GET_ADAPTIVE      0xA9
+#define CMD_GET_ASRC          0xAA
 
 // Response status codes
 #define STATUS_OK             0x00
 #define STATUS_ERR_INVALID_CMD    0x01
 #define STATUS_ERR_INVALID_PARAM  0x02
 #define STATUS_ERR_FLASH          0x03
+#define STATUS_ERR_BUSY           0x04
 
 // Hardware info
 #define HW_MODEL          1  // 1 = DA15
@@ -2,7 +2,8 @@
 // Copyright (c) 2026 Elia Chiarucci
 
 /*
- * USB Descriptors for UAC1 Speaker with Feedback
+ * USB Descriptors for a UAC1 or UAC2 Speaker with Feedback (or adaptive),
+ * and with USB_AUDIO_LOOPBACK a UAC1 capture of what it plays
  */
 
 #ifndef USB_DESCRIPTORS_H_
@@ -31,6 +32,9 @@ void usb_desc_set_audio_itf(const char *str);
 enum {
   ITF_NUM_AUDIO_CONTROL = 0,
   ITF_NUM_AUDIO_STREAMING,
+#if USB_AUDIO_LOOPBACK
+  ITF_NUM_AUDIO_CAPTURE,
+#endif
   ITF_NUM_DFU,
   ITF_NUM_CDC,
   ITF_NUM_CDC_DATA,
@@ -46,6 +50,7 @@ enum {
 #define EPNUM_CDC_NOTIF       0x82  // CDC notification (IN)
 #define EPNUM_CDC_OUT         0x03  // CDC data (OUT)
 #define EPNUM_CDC_IN          0x83  // CDC data (IN)
+#define EPNUM_AUDIO_IN        0x84  // Loopback capture (USB_AUDIO_LOOPBACK)
 
 //--------------------------------------------------------------------+
 // MS OS 2.0 Vendor Request Code
@@ -53,60 +58,239 @@ enum {
 #define VENDOR_REQUEST_MICROSOFT  0x01
 
 //--------------------------------------------------------------------+
-// UAC1 Entity IDs (used in TUD_AUDIO10_SPEAKER_STEREO_FB_DESCRIPTOR)
+// UAC1 Entity IDs (used in TUD_AUDIO10_SPEAKER_STEREO_FB_DESCRIPTOR, and
+// by the UAC2 descriptor for the same entities, plus its clock source)
 //--------------------------------------------------------------------+
 #define UAC1_ENTITY_INPUT_TERMINAL      0x01
 #define UAC1_ENTITY_FEATURE_UNIT        0x02
 #define UAC1_ENTITY_OUTPUT_TERMINAL     0x03
+#define UAC2_ENTITY_CLOCK_SOURCE        0x04
+
+// Loopback capture (USB_AUDIO_LOOPBACK): the DAC's feed as a microphone
+// would be, straight to the host (no feature unit: the samples are exact)
+#define UAC1_ENTITY_LOOPBACK_INPUT_TERMINAL   0x05
+#define UAC1_ENTITY_LOOPBACK_OUTPUT_TERMINAL  0x06
+
+// Sample rates the device plays (the 44.1kHz family resampled): listed in
+// the UAC1 format descriptor, answered to a UAC2 clock RANGE request. The
+// loopback and NO_96K builds stop at 48kHz (tusb_config.h).
+#if CFG_TUD_AUDIO_FUNC_1_MAX_SAMPLE_RATE_FS < 96000
+#define USB_AUDIO_SAMPLE_RATES          44100, 48000
+#define USB_AUDIO_SAMPLE_RATE_COUNT     2
+#else
+#define USB_AUDIO_SAMPLE_RATES          44100, 48000, 88200, 96000
+#define USB_AUDIO_SAMPLE_RATE_COUNT     4
+#endif
+
+// UAC2 feedback: 16.16 in 4 bytes, as TinyUSB sends it for UAC2 at any
+// speed (UAC1 at full speed: 10.14 in 3 bytes)
+#define UAC2_FEEDBACK_EP_SIZE           4
+
+// Streaming endpoint sync: asynchronous with the feedback endpoint, or
+// adaptive (AUDIO_ADAPTIVE_CLOCK) with none. The FB_EP macros carry their
+// leading comma so they can expand to nothing.
+#if AUDIO_ADAPTIVE_CLOCK
+#define USB_AUDIO_FB_EPS                0
+#define USB_AUDIO_ISO_EP_SYNC           TUSB_ISO_EP_ATT_ADAPTIVE
+#define UAC1_SYNC_EP_ADDR(_epfb)        0x00
+#define UAC1_FB_EP(_epfb)
+#define UAC2_FB_EP(_epfb)
+#else
+#define USB_AUDIO_FB_EPS                1
+#define USB_AUDIO_ISO_EP_SYNC           TUSB_ISO_EP_ATT_ASYNCHRONOUS
+#define UAC1_SYNC_EP_ADDR(_epfb)        (_epfb)
+/* bRefresh: feedback refresh period = 2^n frames; spec range is 1-9 */
+#define UAC1_FB_EP(_epfb)               , TUD_AUDIO10_DESC_STD_AS_ISO_SYNC_EP(/*_ep*/ _epfb, /*_bRefresh*/ 1)
+/* every frame */
+#define UAC2_FB_EP(_epfb)               , TUD_AUDIO20_DESC_STD_AS_ISO_FB_EP(/*_ep*/ _epfb, /*_epsize*/ UAC2_FEEDBACK_EP_SIZE, /*_interval*/ 1)
+#endif
+
+// Loopback capture: its terminals in the control interface and its
+// streaming interface after the playback's, or nothing. As the FB_EP macros,
+// they carry their leading comma.
+#if USB_AUDIO_LOOPBACK
+#define USB_AUDIO_CAPTURE_ITFS          1
+#define UAC1_LOOPBACK_AC_LEN            (TUD_AUDIO10_DESC_INPUT_TERM_LEN + TUD_AUDIO10_DESC_OUTPUT_TERM_LEN)
+#define UAC1_LOOPBACK_ITF(_itfnum)      , (_itfnum)+2
+#define UAC1_LOOPBACK_TERMS             , TUD_AUDIO10_LOOPBACK_TERMS
+#define UAC1_LOOPBACK_AS(_itfnum)       , TUD_AUDIO10_LOOPBACK_AS((_itfnum)+2)
+#else
+#define USB_AUDIO_CAPTURE_ITFS          0
+#define UAC1_LOOPBACK_AC_LEN            0
+#define UAC1_LOOPBACK_ITF(_itfnum)
+#define UAC1_LOOPBACK_TERMS
+#define UAC1_LOOPBACK_AS(_itfnum)
+#endif
 
 //--------------------------------------------------------------------+
 // UAC1 Descriptor Length Calculation
 //--------------------------------------------------------------------+
-// Descriptor for stereo speaker with feedback, supporting 2 sample rates (44.1kHz, 48kHz)
+// Descriptor for stereo speaker with feedback, with _nfreqs discrete sample
+// rates (and the loopback capture)
 #define TUD_AUDIO10_SPEAKER_STEREO_FB_DESC_LEN(_nfreqs) (\
   + TUD_AUDIO10_DESC_STD_AC_LEN\
-  + TUD_AUDIO10_DESC_CS_AC_LEN(1)\
+  + TUD_AUDIO10_DESC_CS_AC_LEN(1 + USB_AUDIO_CAPTURE_ITFS)\
   + TUD_AUDIO10_DESC_INPUT_TERM_LEN\
   + TUD_AUDIO10_DESC_OUTPUT_TERM_LEN\
   + TUD_AUDIO10_DESC_FEATURE_UNIT_LEN(2)\
   + TUD_AUDIO10_DESC_STD_AS_LEN\
+  + 2 * TUD_AUDIO10_SPEAKER_STEREO_FB_ALT_LEN(_nfreqs)\
+  + USB_AUDIO_CAPTURE_ITFS * (UAC1_LOOPBACK_AC_LEN + TUD_AUDIO10_LOOPBACK_AS_LEN))
+
+// One streaming alternate setting: format, data endpoint and feedback
+#define TUD_AUDIO10_SPEAKER_STEREO_FB_ALT_LEN(_nfreqs) (\
   + TUD_AUDIO10_DESC_STD_AS_LEN\
   + TUD_AUDIO10_DESC_CS_AS_INT_LEN\
   + TUD_AUDIO10_DESC_TYPE_I_FORMAT_LEN(_nfreqs)\
   + TUD_AUDIO10_DESC_STD_AS_ISO_EP_LEN\
   + TUD_AUDIO10_DESC_CS_AS_ISO_EP_LEN\
-  + TUD_AUDIO10_DESC_STD_AS_ISO_SYNC_EP_LEN)
+  + USB_AUDIO_FB_EPS * TUD_AUDIO10_DESC_STD_AS_ISO_SYNC_EP_LEN)
+
+// Capture streaming interface: the zero-bandwidth setting and one at 48kHz
+#define TUD_AUDIO10_LOOPBACK_AS_LEN (\
+  + 2 * TUD_AUDIO10_DESC_STD_AS_LEN\
+  + TUD_AUDIO10_DESC_CS_AS_INT_LEN\
+  + TUD_AUDIO10_DESC_TYPE_I_FORMAT_LEN(1)\
+  + TUD_AUDIO10_DESC_STD_AS_ISO_EP_LEN\
+  + TUD_AUDIO10_DESC_CS_AS_ISO_EP_LEN)
+
+// Streaming alternate settings (USB_AUDIO_ALT_24 on the 24-bit format; the
+// capture's only one is USB_AUDIO_ALT_24 too)
+#define USB_AUDIO_ALT_24  1
+#define USB_AUDIO_ALT_16  2
 
 //--------------------------------------------------------------------+
 // UAC1 Descriptor Macro
 //--------------------------------------------------------------------+
-#define TUD_AUDIO10_SPEAKER_STEREO_FB_DESCRIPTOR(_itfnum, _stridx, _nBytesPerSample, _nBitsUsedPerSample, _epout, _epoutsize, _epfb, ...) \
+// Alternate setting 1 streams _nBytesPerSample/_nBitsUsedPerSample samples
+// in up to _epoutsize byte packets, alternate setting 2 the _16 variants;
+// both on the same endpoints and rates
+#define TUD_AUDIO10_SPEAKER_STEREO_FB_DESCRIPTOR(_itfnum, _stridx, _nBytesPerSample, _nBitsUsedPerSample, _epoutsize, _nBytesPerSample16, _nBitsUsedPerSample16, _epoutsize16, _epout, _epfb, ...) \
   /* Standard AC Interface Descriptor(4.3.1) */\
   TUD_AUDIO10_DESC_STD_AC(/*_itfnum*/ _itfnum, /*_nEPs*/ 0x00, /*_stridx*/ _stridx),\
   /* Class-Specific AC Interface Header Descriptor(4.3.2) */\
-  TUD_AUDIO10_DESC_CS_AC(/*_bcdADC*/ 0x0100, /*_totallen*/ (TUD_AUDIO10_DESC_INPUT_TERM_LEN+TUD_AUDIO10_DESC_OUTPUT_TERM_LEN+TUD_AUDIO10_DESC_FEATURE_UNIT_LEN(2)), /*_itf*/ ((_itfnum)+1)),\
+  TUD_AUDIO10_DESC_CS_AC(/*_bcdADC*/ 0x0100, /*_totallen*/ (TUD_AUDIO10_DESC_INPUT_TERM_LEN+TUD_AUDIO10_DESC_OUTPUT_TERM_LEN+TUD_AUDIO10_DESC_FEATURE_UNIT_LEN(2)+UAC1_LOOPBACK_AC_LEN), /*_itf*/ ((_itfnum)+1) UAC1_LOOPBACK_ITF(_itfnum)),\
   /* Input Terminal Descriptor(4.3.2.1) */\
   TUD_AUDIO10_DESC_INPUT_TERM(/*_termid*/ 0x01, /*_termtype*/ AUDIO_TERM_TYPE_USB_STREAMING, /*_assocTerm*/ 0x00, /*_nchannels*/ 0x02, /*_channelcfg*/ AUDIO10_CHANNEL_CONFIG_LEFT_FRONT | AUDIO10_CHANNEL_CONFIG_RIGHT_FRONT, /*_idxchannelnames*/ 0x00, /*_stridx*/ 0x00),\
   /* Output Terminal Descriptor(4.3.2.2) */\
   TUD_AUDIO10_DESC_OUTPUT_TERM(/*_termid*/ 0x03, /*_termtype*/ AUDIO_TERM_TYPE_OUT_DESKTOP_SPEAKER, /*_assocTerm*/ 0x00, /*_srcid*/ 0x02, /*_stridx*/ 0x00),\
   /* Feature Unit Descriptor(4.3.2.5) */\
-  TUD_AUDIO10_DESC_FEATURE_UNIT(/*_unitid*/ 0x02, /*_srcid*/ 0x01, /*_stridx*/ 0x00, /*_ctrlmaster*/ (AUDIO10_FU_CONTROL_BM_MUTE | AUDIO10_FU_CONTROL_BM_VOLUME), /*_ctrlch1*/ (AUDIO10_FU_CONTROL_BM_MUTE | AUDIO10_FU_CONTROL_BM_VOLUME), /*_ctrlch2*/ (AUDIO10_FU_CONTROL_BM_MUTE | AUDIO10_FU_CONTROL_BM_VOLUME)),\
+  TUD_AUDIO10_DESC_FEATURE_UNIT(/*_unitid*/ 0x02, /*_srcid*/ 0x01, /*_stridx*/ 0x00, /*_ctrlmaster*/ (AUDIO10_FU_CONTROL_BM_MUTE | AUDIO10_FU_CONTROL_BM_VOLUME), /*_ctrlch1*/ (AUDIO10_FU_CONTROL_BM_MUTE | AUDIO10_FU_CONTROL_BM_VOLUME), /*_ctrlch2*/ (AUDIO10_FU_CONTROL_BM_MUTE | AUDIO10_FU_CONTROL_BM_VOLUME))\
+  /* Loopback Input and Output Terminal Descriptors(4.3.2.1, 4.3.2.2) */\
+  UAC1_LOOPBACK_TERMS,\
   /* Standard AS Interface Descriptor(4.5.1) */\
   /* Interface 1, Alternate 0 - default alternate setting with 0 bandwidth */\
   TUD_AUDIO10_DESC_STD_AS_INT(/*_itfnum*/ (uint8_t)((_itfnum)+1), /*_altset*/ 0x00, /*_nEPs*/ 0x00, /*_stridx*/ 0x00),\
+  /* Interface 1, Alternate 1 - 24-bit data streaming */\
+  TUD_AUDIO10_SPEAKER_STEREO_FB_ALT((_itfnum)+1, USB_AUDIO_ALT_24, _nBytesPerSample, _nBitsUsedPerSample, _epout, _epoutsize, _epfb, __VA_ARGS__),\
+  /* Interface 1, Alternate 2 - 16-bit data streaming */\
+  TUD_AUDIO10_SPEAKER_STEREO_FB_ALT((_itfnum)+1, USB_AUDIO_ALT_16, _nBytesPerSample16, _nBitsUsedPerSample16, _epout, _epoutsize16, _epfb, __VA_ARGS__)\
+  /* Interface 2 - loopback capture */\
+  UAC1_LOOPBACK_AS(_itfnum)
+
+#define TUD_AUDIO10_SPEAKER_STEREO_FB_ALT(_itfnum, _altset, _nBytesPerSample, _nBitsUsedPerSample, _epout, _epoutsize, _epfb, ...) \
   /* Standard AS Interface Descriptor(4.5.1) */\
-  /* Interface 1, Alternate 1 - alternate interface for data streaming */\
-  TUD_AUDIO10_DESC_STD_AS_INT(/*_itfnum*/ (uint8_t)((_itfnum)+1), /*_altset*/ 0x01, /*_nEPs*/ 0x02, /*_stridx*/ 0x00),\
+  TUD_AUDIO10_DESC_STD_AS_INT(/*_itfnum*/ (uint8_t)(_itfnum), /*_altset*/ _altset, /*_nEPs*/ 1 + USB_AUDIO_FB_EPS, /*_stridx*/ 0x00),\
   /* Class-Specific AS Interface Descriptor(4.5.2) */\
   TUD_AUDIO10_DESC_CS_AS_INT(/*_termid*/ 0x01, /*_delay*/ 0x00, /*_formattype*/ AUDIO10_DATA_FORMAT_TYPE_I_PCM),\
   /* Type I Format Type Descriptor(2.2.5) */\
   TUD_AUDIO10_DESC_TYPE_I_FORMAT(/*_nrchannels*/ 0x02, /*_subframesize*/ _nBytesPerSample, /*_bitresolution*/ _nBitsUsedPerSample, /*_freqs*/ __VA_ARGS__),\
   /* Standard AS Isochronous Audio Data Endpoint Descriptor(4.6.1.1) */\
-  TUD_AUDIO10_DESC_STD_AS_ISO_EP(/*_ep*/ _epout, /*_attr*/ (uint8_t) ((uint8_t)TUSB_XFER_ISOCHRONOUS | (uint8_t)TUSB_ISO_EP_ATT_ASYNCHRONOUS), /*_maxEPsize*/ _epoutsize, /*_interval*/ 0x01, /*_sync_ep*/ _epfb),\
+  TUD_AUDIO10_DESC_STD_AS_ISO_EP(/*_ep*/ _epout, /*_attr*/ (uint8_t) ((uint8_t)TUSB_XFER_ISOCHRONOUS | (uint8_t)USB_AUDIO_ISO_EP_SYNC), /*_maxEPsize*/ _epoutsize, /*_interval*/ 0x01, /*_sync_ep*/ UAC1_SYNC_EP_ADDR(_epfb)),\
   /* Class-Specific AS Isochronous Audio Data Endpoint Descriptor(4.6.1.2) */\
-  TUD_AUDIO10_DESC_CS_AS_ISO_EP(/*_attr*/ AUDIO10_CS_AS_ISO_DATA_EP_ATT_SAMPLING_FRQ, /*_lockdelayunits*/ AUDIO10_CS_AS_ISO_DATA_EP_LOCK_DELAY_UNIT_UNDEFINED, /*_lockdelay*/ 0x0000),\
+  TUD_AUDIO10_DESC_CS_AS_ISO_EP(/*_attr*/ AUDIO10_CS_AS_ISO_DATA_EP_ATT_SAMPLING_FRQ, /*_lockdelayunits*/ AUDIO10_CS_AS_ISO_DATA_EP_LOCK_DELAY_UNIT_UNDEFINED, /*_lockdelay*/ 0x0000)\
   /* Standard AS Isochronous Synch Endpoint Descriptor (4.6.2.1) */\
-  /* bRefresh: feedback refresh period = 2^n frames; spec range is 1-9 */\
-  TUD_AUDIO10_DESC_STD_AS_ISO_SYNC_EP(/*_ep*/ _epfb, /*_bRefresh*/ 1)
+  UAC1_FB_EP(_epfb)
+
+// Loopback capture terminals: what the DAC plays, in, to the host, out
+#define TUD_AUDIO10_LOOPBACK_TERMS \
+  /* Input Terminal Descriptor(4.3.2.1) */\
+  TUD_AUDIO10_DESC_INPUT_TERM(/*_termid*/ UAC1_ENTITY_LOOPBACK_INPUT_TERMINAL, /*_termtype*/ AUDIO_TERM_TYPE_IN_GENERIC_MIC, /*_assocTerm*/ 0x00, /*_nchannels*/ 0x02, /*_channelcfg*/ AUDIO10_CHANNEL_CONFIG_LEFT_FRONT | AUDIO10_CHANNEL_CONFIG_RIGHT_FRONT, /*_idxchannelnames*/ 0x00, /*_stridx*/ 0x00),\
+  /* Output Terminal Descriptor(4.3.2.2) */\
+  TUD_AUDIO10_DESC_OUTPUT_TERM(/*_termid*/ UAC1_ENTITY_LOOPBACK_OUTPUT_TERMINAL, /*_termtype*/ AUDIO_TERM_TYPE_USB_STREAMING, /*_assocTerm*/ 0x00, /*_srcid*/ UAC1_ENTITY_LOOPBACK_INPUT_TERMINAL, /*_stridx*/ 0x00)
+
+// Loopback capture streaming interface: 24-bit stereo at the I2S rate, sent
+// asynchronously (the DAC's clock) with no feedback needed from the host
+#define TUD_AUDIO10_LOOPBACK_AS(_itfnum) \
+  /* Standard AS Interface Descriptor(4.5.1) */\
+  /* Alternate 0 - default alternate setting with 0 bandwidth */\
+  TUD_AUDIO10_DESC_STD_AS_INT(/*_itfnum*/ (uint8_t)(_itfnum), /*_altset*/ 0x00, /*_nEPs*/ 0x00, /*_stridx*/ 0x00),\
+  /* Alternate 1 - 24-bit data streaming */\
+  TUD_AUDIO10_DESC_STD_AS_INT(/*_itfnum*/ (uint8_t)(_itfnum), /*_altset*/ USB_AUDIO_ALT_24, /*_nEPs*/ 0x01, /*_stridx*/ 0x00),\
+  /* Class-Specific AS Interface Descriptor(4.5.2) */\
+  TUD_AUDIO10_DESC_CS_AS_INT(/*_termid*/ UAC1_ENTITY_LOOPBACK_OUTPUT_TERMINAL, /*_delay*/ 0x00, /*_formattype*/ AUDIO10_DATA_FORMAT_TYPE_I_PCM),\
+  /* Type I Format Type Descriptor(2.2.5) */\
+  TUD_AUDIO10_DESC_TYPE_I_FORMAT(/*_nrchannels*/ CFG_TUD_AUDIO_FUNC_1_N_CHANNELS_TX, /*_subframesize*/ CFG_TUD_AUDIO_FUNC_1_N_BYTES_PER_SAMPLE_TX, /*_bitresolution*/ CFG_TUD_AUDIO_FUNC_1_RESOLUTION_TX, /*_freqs*/ USB_AUDIO_CAPTURE_RATE),\
+  /* Standard AS Isochronous Audio Data Endpoint Descriptor(4.6.1.1) */\
+  TUD_AUDIO10_DESC_STD_AS_ISO_EP(/*_ep*/ EPNUM_AUDIO_IN, /*_attr*/ (uint8_t) ((uint8_t)TUSB_XFER_ISOCHRONOUS | (uint8_t)TUSB_ISO_EP_ATT_ASYNCHRONOUS), /*_maxEPsize*/ CFG_TUD_AUDIO_FUNC_1_EP_IN_SZ_MAX, /*_interval*/ 0x01, /*_sync_ep*/ 0x00),\
+  /* Class-Specific AS Isochronous Audio Data Endpoint Descriptor(4.6.1.2) */\
+  TUD_AUDIO10_DESC_CS_AS_ISO_EP(/*_attr*/ 0x00, /*_lockdelayunits*/ AUDIO10_CS_AS_ISO_DATA_EP_LOCK_DELAY_UNIT_UNDEFINED, /*_lockdelay*/ 0x0000)
+
+//--------------------------------------------------------------------+
+// UAC2 Descriptor Length Calculation
+//--------------------------------------------------------------------+
+// The same speaker as UAC2 (IAD included): a programmable internal clock
+// source the host sets the rate on, instead of the endpoint's rate list
+#define TUD_AUDIO20_SPEAKER_STEREO_FB_DESC_LEN (\
+  + TUD_AUDIO20_DESC_IAD_LEN\
+  + TUD_AUDIO20_DESC_STD_AC_LEN\
+  + TUD_AUDIO20_DESC_CS_AC_LEN\
+  + TUD_AUDIO20_DESC_CLK_SRC_LEN\
+  + TUD_AUDIO20_DESC_INPUT_TERM_LEN\
+  + TUD_AUDIO20_DESC_OUTPUT_TERM_LEN\
+  + TUD_AUDIO20_DESC_FEATURE_UNIT_LEN(2)\
+  + TUD_AUDIO20_DESC_STD_AS_LEN\
+  + 2 * TUD_AUDIO20_SPEAKER_STEREO_FB_ALT_LEN)
+
+#define TUD_AUDIO20_SPEAKER_STEREO_FB_ALT_LEN (\
+  + TUD_AUDIO20_DESC_STD_AS_LEN\
+  + TUD_AUDIO20_DESC_CS_AS_INT_LEN\
+  + TUD_AUDIO20_DESC_TYPE_I_FORMAT_LEN\
+  + TUD_AUDIO20_DESC_STD_AS_ISO_EP_LEN\
+  + TUD_AUDIO20_DESC_CS_AS_ISO_EP_LEN\
+  + USB_AUDIO_FB_EPS * TUD_AUDIO20_DESC_STD_AS_ISO_FB_EP_LEN)
+
+//--------------------------------------------------------------------+
+// UAC2 Descriptor Macro
+//--------------------------------------------------------------------+
+#define UAC2_FU_CTRL_MUTE_VOLUME (AUDIO20_CTRL_RW << AUDIO20_FEATURE_UNIT_CTRL_MUTE_POS | AUDIO20_CTRL_RW << AUDIO20_FEATURE_UNIT_CTRL_VOLUME_POS)
+
+// Parameters as TUD_AUDIO10_SPEAKER_STEREO_FB_DESCRIPTOR, without the rates
+#define TUD_AUDIO20_SPEAKER_STEREO_FB_DESCRIPTOR(_itfnum, _stridx, _nBytesPerSample, _nBitsUsedPerSample, _epoutsize, _nBytesPerSample16, _nBitsUsedPerSample16, _epoutsize16, _epout, _epfb) \
+  /* Standard Interface Association Descriptor (IAD) */\
+  TUD_AUDIO20_DESC_IAD(/*_firstitf*/ _itfnum, /*_nitfs*/ 0x02, /*_stridx*/ _stridx),\
+  /* Standard AC Interface Descriptor(4.7.1) */\
+  TUD_AUDIO20_DESC_STD_AC(/*_itfnum*/ _itfnum, /*_nEPs*/ 0x00, /*_stridx*/ _stridx),\
+  /* Class-Specific AC Interface Header Descriptor(4.7.2) */\
+  TUD_AUDIO20_DESC_CS_AC(/*_bcdADC*/ 0x0200, /*_category*/ AUDIO20_FUNC_DESKTOP_SPEAKER, /*_totallen*/ TUD_AUDIO20_DESC_CLK_SRC_LEN+TUD_AUDIO20_DESC_INPUT_TERM_LEN+TUD_AUDIO20_DESC_OUTPUT_TERM_LEN+TUD_AUDIO20_DESC_FEATURE_UNIT_LEN(2), /*_ctrl*/ 0x00),\
+  /* Clock Source Descriptor(4.7.2.1): the I2S clock, rate set by the host */\
+  TUD_AUDIO20_DESC_CLK_SRC(/*_clkid*/ UAC2_ENTITY_CLOCK_SOURCE, /*_attr*/ AUDIO20_CLOCK_SOURCE_ATT_INT_PRO_CLK, /*_ctrl*/ (AUDIO20_CTRL_RW << AUDIO20_CLOCK_SOURCE_CTRL_CLK_FRQ_POS) | (AUDIO20_CTRL_R << AUDIO20_CLOCK_SOURCE_CTRL_CLK_VAL_POS), /*_assocTerm*/ 0x00, /*_stridx*/ 0x00),\
+  /* Input Terminal Descriptor(4.7.2.4) */\
+  TUD_AUDIO20_DESC_INPUT_TERM(/*_termid*/ UAC1_ENTITY_INPUT_TERMINAL, /*_termtype*/ AUDIO_TERM_TYPE_USB_STREAMING, /*_assocTerm*/ 0x00, /*_clkid*/ UAC2_ENTITY_CLOCK_SOURCE, /*_nchannelslogical*/ 0x02, /*_channelcfg*/ AUDIO20_CHANNEL_CONFIG_FRONT_LEFT | AUDIO20_CHANNEL_CONFIG_FRONT_RIGHT, /*_idxchannelnames*/ 0x00, /*_ctrl*/ 0x0000, /*_stridx*/ 0x00),\
+  /* Output Terminal Descriptor(4.7.2.5) */\
+  TUD_AUDIO20_DESC_OUTPUT_TERM(/*_termid*/ UAC1_ENTITY_OUTPUT_TERMINAL, /*_termtype*/ AUDIO_TERM_TYPE_OUT_DESKTOP_SPEAKER, /*_assocTerm*/ 0x00, /*_srcid*/ UAC1_ENTITY_FEATURE_UNIT, /*_clkid*/ UAC2_ENTITY_CLOCK_SOURCE, /*_ctrl*/ 0x0000, /*_stridx*/ 0x00),\
+  /* Feature Unit Descriptor(4.7.2.8) */\
+  TUD_AUDIO20_DESC_FEATURE_UNIT(/*_unitid*/ UAC1_ENTITY_FEATURE_UNIT, /*_srcid*/ UAC1_ENTITY_INPUT_TERMINAL, /*_stridx*/ 0x00, /*_ctrlch0master*/ UAC2_FU_CTRL_MUTE_VOLUME, /*_ctrlch1*/ UAC2_FU_CTRL_MUTE_VOLUME, /*_ctrlch2*/ UAC2_FU_CTRL_MUTE_VOLUME),\
+  /* Standard AS Interface Descriptor(4.9.1) */\
+  /* Interface 1, Alternate 0 - default alternate setting with 0 bandwidth */\
+  TUD_AUDIO20_DESC_STD_AS_INT(/*_itfnum*/ (uint8_t)((_itfnum)+1), /*_altset*/ 0x00, /*_nEPs*/ 0x00, /*_stridx*/ 0x00),\
+  /* Interface 1, Alternate 1 - 24-bit data streaming */\
+  TUD_AUDIO20_SPEAKER_STEREO_FB_ALT((_itfnum)+1, USB_AUDIO_ALT_24, _nBytesPerSample, _nBitsUsedPerSample, _epout, _epoutsize, _epfb),\
+  /* Interface 1, Alternate 2 - 16-bit data streaming */\
+  TUD_AUDIO20_SPEAKER_STEREO_FB_ALT((_itfnum)+1, USB_AUDIO_ALT_16, _nBytesPerSample16, _nBitsUsedPerSample16, _epout, _epoutsize16, _epfb)
+
+#define TUD_AUDIO20_SPEAKER_STEREO_FB_ALT(_itfnum, _altset, _nBytesPerSample, _nBitsUsedPerSample, _epout, _epoutsize, _epfb) \
+  /* Standard AS Interface Descriptor(4.9.1) */\
+  TUD_AUDIO20_DESC_STD_AS_INT(/*_itfnum*/ (uint8_t)(_itfnum), /*_altset*/ _altset, /*_nEPs*/ 1 + USB_AUDIO_FB_EPS, /*_stridx*/ 0x00),\
+  /* Class-Specific AS Interface Descriptor(4.9.2) */\
+  TUD_AUDIO20_DESC_CS_AS_INT(/*_termid*/ UAC1_ENTITY_INPUT_TERMINAL, /*_ctrl*/ AUDIO20_CTRL_NONE, /*_formattype*/ AUDIO20_FORMAT_TYPE_I, /*_formats*/ AUDIO20_DATA_FORMAT_TYPE_I_PCM, /*_nchannelsphysical*/ 0x02, /*_channelcfg*/ AUDIO20_CHANNEL_CONFIG_FRONT_LEFT | AUDIO20_CHANNEL_CONFIG_FRONT_RIGHT, /*_stridx*/ 0x00),\
+  /* Type I Format Type Descriptor(2.3.1.6 - Audio Formats) */\
+  TUD_AUDIO20_DESC_TYPE_I_FORMAT(_nBytesPerSample, _nBitsUsedPerSample),\
+  /* Standard AS Isochronous Audio Data Endpoint Descriptor(4.10.1.1) */\
+  TUD_AUDIO20_DESC_STD_AS_ISO_EP(/*_ep*/ _epout, /*_attr*/ (uint8_t) ((uint8_t)TUSB_XFER_ISOCHRONOUS | (uint8_t)USB_AUDIO_ISO_EP_SYNC | (uint8_t)TUSB_ISO_EP_ATT_DATA), /*_maxEPsize*/ _epoutsize, /*_interval*/ 0x01),\
+  /* Class-Specific AS Isochronous Audio Data Endpoint Descriptor(4.10.1.2) */\
+  TUD_AUDIO20_DESC_CS_AS_ISO_EP(/*_attr*/ AUDIO20_CS_AS_ISO_DATA_EP_ATT_NON_MAX_PACKETS_OK, /*_ctrl*/ AUDIO20_CTRL_NONE, /*_lockdelayunit*/ AUDIO20_CS_AS_ISO_DATA_EP_LOCK_DELAY_UNIT_UNDEFINED, /*_lockdelay*/ 0x0000)\
+  /* Standard AS Isochronous Feedback Endpoint Descriptor(4.10.2.1) */\
+  UAC2_FB_EP(_epfb)
 
 #endif /* USB_DESCRIPTORS_H_ */
@@ -12,11 +12,16 @@
 #include "fault.h"
 #include "version.h"
 #include "audio_output.h"
+#include "deadline.h"
 #include "display.h"
 #include "encoder.h"
 #include "eq_profile.h"
+#include "integrity.h"
 #include "main.h"
+#include "perf.h"
+#include "sched.h"
 #include "settings.h"
+#include "trace.h"
 #include "usb_descriptors.h"
 #include "sh1106.h"
 #include "stm32h5xx_hal.h"
@@ -41,6 +46,8 @@ static void configure_nvic_priorities(void) {
   HAL_NVIC_SetPriority(I2C2_ER_IRQn, 2, 0);
   HAL_NVIC_SetPriority(EXTI14_IRQn, 3, 0);          // encoder (bouncy)
   HAL_NVIC_SetPriority(EXTI15_IRQn, 3, 0);
+  // Audio stage: fill + DSP, pended by the I2S callbacks
+  HAL_NVIC_SetPriority(PendSV_IRQn, AUDIO_OUTPUT_IRQ_PRIORITY, 0);
 }
 
 // ---------------------------------------------------------------------------
@@ -193,6 +200,7 @@ void app_save_settings(void) {
       .brightness = display_get_brightness(),
       .display_timeout = display_get_timeout_level(),
       .active_profile = eq_profile_get_active(),
+      .latency_profile = audio_output_get_latency_request(),
   };
   settings_save(&s);
 }
@@ -308,7 +316,9 @@ static void handle_encoder_rotate(int8_t delta, uint32_t now) {
               active = EQ_PROFILE_OFF;
           }
         }
+        uint32_t key = audio_output_lock();
         eq_profile_set_active(active);
+        audio_output_unlock(key);
         mark_settings_dirty(now);
         display_set_dirty();
       } break;
@@ -345,15 +355,178 @@ static void handle_encoder_rotate(int8_t delta, uint32_t now) {
   }
 }
 
+// ---------------------------------------------------------------------------
+// Main loop tasks (run by sched.c, table order = priority)
+// ---------------------------------------------------------------------------
+static bool task_usb(uint32_t now) {
+  (void)now;
+  PERF_BEGIN(PERF_USB);
+  tud_task();
+  PERF_END(PERF_USB);
+  return tud_task_event_ready();
+}
+
+static bool task_comm(uint32_t now) {
+  (void)now;
+  usb_comm_task();
+  return false;
+}
+
+// Chunked by eq_profile itself: one erase poll or write burst per call
+static bool task_flash(uint32_t now) {
+  (void)now;
+  PERF_BEGIN(PERF_FLASH);
+  eq_profile_flash_task();
+  PERF_END(PERF_FLASH);
+  return eq_profile_flash_busy();
+}
+
+static bool task_audio(uint32_t now) {
+  (void)now;
+  audio_output_task();
+  return false;
+}
+
+static bool task_ui(uint32_t now) {
+  // --- USB connection monitoring (idle screen for OLED burn-in protection) ---
+  // Any USB state change must hold stable for 3s before taking effect.
+  uint8_t usb_active = tud_mounted() && !tud_suspended();
+  if (usb_active)
+    usb_was_mounted = 1;
+
+  if (usb_was_mounted) {
+    if (usb_active != usb_stable) {
+      if (!usb_change_pending) {
+        usb_change_pending = 1;
+        usb_change_tick = now;
+      } else if (now - usb_change_tick >= USB_STATE_DEBOUNCE_MS) {
+        usb_change_pending = 0;
+        usb_stable = usb_active;
+        if (!usb_stable) {
+          if (display_get_screen() != SCREEN_IDLE)
+            display_enter_idle(now);
+        } else {
+          if (display_get_screen() == SCREEN_IDLE)
+            display_mark_activity(now);
+        }
+      }
+    } else {
+      usb_change_pending = 0;
+    }
+  }
+
+  // --- Idle dot position switch ---
+  display_idle_tick(now);
+
+  // --- Encoder input (drain events always, act only when USB active) ---
+  encoder_poll(now);
+
+  if (encoder_has_short_press() && usb_active) {
+    handle_short_press(now);
+  }
+  if (encoder_has_long_press() && usb_active) {
+    handle_long_press(now);
+  }
+
+  int8_t delta = encoder_get_delta();
+  if (delta != 0 && usb_active) {
+    handle_encoder_rotate(delta, now);
+  }
+
+  // --- Display timeout ---
+  display_check_timeout(now);
+
+  // --- Menu edit blink ---
+  display_blink_tick(now);
+  return false;
+}
+
+// --- Debounced settings save ---
+// Deferred while an EQ profile flash operation is running: a concurrent
+// HAL_FLASH_Program would block on the in-progress sector erase
+static bool task_settings(uint32_t now) {
+  if (settings_dirty && (now - settings_save_tick >= SETTINGS_SAVE_DELAY_MS) &&
+      !eq_profile_flash_busy()) {
+    PERF_BEGIN(PERF_FLASH);
+    app_save_settings();
+    PERF_END(PERF_FLASH);
+    settings_dirty = 0;
+  }
+  return false;
+}
+
+// --- Display update (rate-limited inside display_draw) ---
+static bool task_display(uint32_t now) {
+  PERF_BEGIN(PERF_DISPLAY);
+  display_draw(now);
+  PERF_END(PERF_DISPLAY);
+  return false;
+}
+
+// USB and CDC are polled every pass and must not go 2ms without service.
+// Settings (blocking flash erase) and display (framebuffer render) are the
+// long tasks: deferred while the next audio half is too close, within their
+// deadlines. The UI period stays well under the 50ms button debounce.
+static const sched_task_t app_tasks[] = {
+    {"usb",      task_usb,      0,   2,   0},
+    {"comm",     task_comm,     0,   5,   0},
+    {"flash",    task_flash,    0,   10,  SCHED_DEFERRABLE},
+    {"audio",    task_audio,    100, 0,   0},
+    {"ui",       task_ui,       5,   20,  0},
+    {"settings", task_settings, 100, 500, SCHED_DEFERRABLE},
+    {"display",  task_display,  10,  50,  SCHED_DEFERRABLE},
+};
+
+static uint32_t sched_now_ms(void) { return HAL_GetTick(); }
+
+static uint32_t sched_cycles(void) { return DWT->CYCCNT; }
+
+// Sleep until the next interrupt when no task has work. Everything the
+// tasks wait for is interrupt-driven (USB, I2S/display DMA, encoder EXTI,
+// 1ms SysTick), so at worst a pass is delayed by one tick. The check runs
+// with interrupts masked: one arriving in between still ends the WFI.
+static void sched_idle(void) {
+  __disable_irq();
+  if (!tud_task_event_ready())
+    __WFI();
+  __enable_irq();
+}
+
+static sched_port_t sched_port = {
+    .now_ms = sched_now_ms,
+    .cycles = sched_cycles,
+    .window_us = audio_output_us_to_next_period,
+    .idle = sched_idle,
+};
+
+static void scheduler_start(void) {
+  sched_port.cycles_per_us = SystemCoreClock / 1000000U;
+  sched_init(app_tasks, (uint8_t)(sizeof(app_tasks) / sizeof(app_tasks[0])),
+             &sched_port);
+}
+
 // ---------------------------------------------------------------------------
 // Initialization
 // ---------------------------------------------------------------------------
 void app_init(void) {
+  // DWT cycle counter: scheduler task run times, the perf.h profiler and
+  // the trace.h timestamps, from audio_output_init on
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#if TRACE_RTT
+  trace_init(SystemCoreClock);
+#endif
+
   SEGGER_RTT_printf(0, "\n=== DA15 boot (FW v" FW_VERSION_STRING ") ===\n");
 
   // Log reset cause + any fault stored before the last reset
   fault_boot_report();
 
+  // CRC peripheral self-test, before the first flash store is checked
+  if (!integrity_init())
+    SEGGER_RTT_printf(0, "[init] CRC peripheral mismatch, CRC-32 in software\n");
+
   // Re-tier interrupt priorities (CubeMX sets everything to 0)
   configure_nvic_priorities();
 
@@ -411,7 +584,10 @@ void app_init(void) {
     audio_eq_set_band(EQ_BAND_TREBLE, saved.treble);
     brightness = saved.brightness;
     timeout = saved.display_timeout;
+    uint32_t key = audio_output_lock(); // the host may already be streaming
     eq_profile_set_active(saved.active_profile);
+    audio_output_unlock(key);
+    audio_output_set_latency(saved.latency_profile);
   } else {
     SEGGER_RTT_printf(0, "[init] no valid settings, using defaults\n");
   }
@@ -429,6 +605,8 @@ void app_init(void) {
   SEGGER_RTT_printf(0, "[init] display init...\n");
   display_init(brightness, timeout);
 
+  scheduler_start();
+
   // Start the watchdog last: init (with its long settle delays) is done and
   // the main loop must now run at least once a second
   watchdog_start();
@@ -440,76 +618,13 @@ void app_init(void) {
 // Main loop
 // ---------------------------------------------------------------------------
 void app_loop(void) {
-  uint32_t now = HAL_GetTick();
+  // Pass-to-pass period (deadline.h), idle sleep included
+  static uint32_t last_pass = 0;
+  uint32_t now = DWT->CYCCNT;
+  if (last_pass)
+    deadline_loop_pass((now - last_pass) / (SystemCoreClock / 1000000U));
+  last_pass = now;
 
   watchdog_refresh();
-
-  // --- High priority: USB + audio + flash ---
-  tud_task();
-  audio_output_task();
-  eq_profile_flash_task();
-  usb_comm_task();
-
-  // --- USB connection monitoring (idle screen for OLED burn-in protection) ---
-  // Any USB state change must hold stable for 3s before taking effect.
-  uint8_t usb_active = tud_mounted() && !tud_suspended();
-  if (usb_active)
-    usb_was_mounted = 1;
-
-  if (usb_was_mounted) {
-    if (usb_active != usb_stable) {
-      if (!usb_change_pending) {
-        usb_change_pending = 1;
-        usb_change_tick = now;
-      } else if (now - usb_change_tick >= USB_STATE_DEBOUNCE_MS) {
-        usb_change_pending = 0;
-        usb_stable = usb_active;
-        if (!usb_stable) {
-          if (display_get_screen() != SCREEN_IDLE)
-            display_enter_idle(now);
-        } else {
-          if (display_get_screen() == SCREEN_IDLE)
-            display_mark_activity(now);
-        }
-      }
-    } else {
-      usb_change_pending = 0;
-    }
-  }
-
-  // --- Idle dot position switch ---
-  display_idle_tick(now);
-
-  // --- Encoder input (drain events always, act only when USB active) ---
-  encoder_poll(now);
-
-  if (encoder_has_short_press() && usb_active) {
-    handle_short_press(now);
-  }
-  if (encoder_has_long_press() && usb_active) {
-    handle_long_press(now);
-  }
-
-  int8_t delta = encoder_get_delta();
-  if (delta != 0 && usb_active) {
-    handle_encoder_rotate(delta, now);
-  }
-
-  // --- Debounced settings save ---
-  // Deferred while an EQ profile flash operation is running: a concurrent
-  // HAL_FLASH_Program would block on the in-progress sector erase
-  if (settings_dirty && (now - settings_save_tick >= SETTINGS_SAVE_DELAY_MS) &&
-      !eq_profile_flash_busy()) {
-    app_save_settings();
-    settings_dirty = 0;
-  }
-
-  // --- Display timeout ---
-  display_check_timeout(now);
-
-  // --- Menu edit blink ---
-  display_blink_tick(now);
-
-  // --- Display update (rate-limited) ---
-  display_draw(now);
+  sched_run();
 }
@@ -0,0 +1,143 @@
+// SPDX-License-Identifier: GPL-3.0-only
+// Copyright (c) 2026 Elia Chiarucci
+
+/*
+ * Adaptive clock: the DAC clock steered to the host's frame clock (see
+ * audio_adaptive.h)
+ */
+
+#include "audio_adaptive.h"
+#include <string.h>
+
+void audio_adaptive_init(audio_adaptive_t *ad, uint32_t sample_rate,
+                         uint8_t frame_bytes, int32_t start_q8,
+                         int32_t min_q8, int32_t max_q8) {
+    memset(ad, 0, sizeof(*ad));
+    if (start_q8 > max_q8)
+        start_q8 = max_q8;
+    if (start_q8 < min_q8)
+        start_q8 = min_q8;
+    ad->sample_rate = sample_rate;
+    ad->frame_bytes = frame_bytes;
+    ad->min_q8 = min_q8;
+    ad->max_q8 = max_q8;
+    ad->integ_q16 = (int64_t)start_q8 << 8;
+    ad->stats.ppm_q8 = start_q8;
+}
+
+void audio_adaptive_set_target(audio_adaptive_t *ad, uint32_t target_q8) {
+    ad->target_q8 = target_q8;
+}
+
+// Queue error in us of audio, positive when above the target (the DAC is
+// behind: speed it up)
+static int32_t queue_error_us(const audio_adaptive_t *ad) {
+    int64_t err_q8 = (int64_t)ad->queue_q8 - ad->target_q8;
+    return (int32_t)(err_q8 * 1000000 / ((int64_t)ad->sample_rate * 256));
+}
+
+static int32_t abs32(int32_t v) { return v < 0 ? -v : v; }
+
+// Shift gears on the queue error
+static void update_state(audio_adaptive_t *ad, int32_t err_us) {
+    audio_ad_stats_t *s = &ad->stats;
+    if (s->state == AUDIO_AD_ACQUIRING) {
+        ad->stable = abs32(err_us) <= AUDIO_AD_LOCK_US ? ad->stable + 1 : 0;
+        if (ad->stable < AUDIO_AD_LOCK_UPDATES)
+            return;
+        // Bumpless: the integrator takes the proportional part the lower
+        // gain drops, so the output doesn't step
+        ad->integ_q16 += ((int64_t)(AUDIO_AD_KP_ACQUIRE - AUDIO_AD_KP_TRACK) *
+                          err_us) << 8;
+        s->state = AUDIO_AD_TRACKING;
+        if (!s->lock_ms)
+            s->lock_ms = ad->packets;
+        s->error_min_us = err_us;
+        s->error_max_us = err_us;
+        return;
+    }
+
+    if (abs32(err_us) > AUDIO_AD_UNLOCK_US) {
+        s->state = AUDIO_AD_ACQUIRING;
+        ad->stable = 0;
+        s->unlocks++;
+        return;
+    }
+    if (err_us < s->error_min_us)
+        s->error_min_us = err_us;
+    if (err_us > s->error_max_us)
+        s->error_max_us = err_us;
+}
+
+// One control update: PI on the queue error, limited in range and slew
+static bool update(audio_adaptive_t *ad) {
+    audio_ad_stats_t *s = &ad->stats;
+    int32_t err_us = queue_error_us(ad);
+    s->error_us = err_us;
+
+    bool tracking = s->state == AUDIO_AD_TRACKING;
+    int32_t kp = tracking ? AUDIO_AD_KP_TRACK : AUDIO_AD_KP_ACQUIRE;
+    int32_t ki = tracking ? AUDIO_AD_KI_TRACK : AUDIO_AD_KI_ACQUIRE;
+    int32_t slew = tracking ? AUDIO_AD_SLEW_TRACK : AUDIO_AD_SLEW_ACQUIRE;
+
+    int64_t integ = ad->integ_q16 + (int64_t)err_us * ki;
+    int64_t want = (int64_t)err_us * kp + (integ >> 8);
+
+    int32_t prev = s->ppm_q8;
+    int64_t out = want;
+    if (out > ad->max_q8) {
+        out = ad->max_q8;
+        if (s->saturated < UINT16_MAX)
+            s->saturated++;
+    } else if (out < ad->min_q8) {
+        out = ad->min_q8;
+        if (s->saturated < UINT16_MAX)
+            s->saturated++;
+    }
+    if (out > (int64_t)prev + slew) {
+        out = (int64_t)prev + slew;
+        if (s->slewed < UINT16_MAX)
+            s->slewed++;
+    } else if (out < (int64_t)prev - slew) {
+        out = (int64_t)prev - slew;
+        if (s->slewed < UINT16_MAX)
+            s->slewed++;
+    }
+
+    // Anti-windup: no integration while the output is held short of what
+    // the loop wants in the direction the error pushes it
+    bool held = out != want && (want > out) == (err_us > 0);
+    if (!held) {
+        int64_t lo = (int64_t)ad->min_q8 << 8, hi = (int64_t)ad->max_q8 << 8;
+        ad->integ_q16 = integ < lo ? lo : integ > hi ? hi : integ;
+    }
+    s->ppm_q8 = (int32_t)out;
+
+    update_state(ad, err_us);
+    return s->ppm_q8 != prev;
+}
+
+bool audio_adaptive_packet(audio_adaptive_t *ad, uint16_t fifo_bytes,
+                           uint32_t ring_q8, bool playing) {
+    ad->packets++;
+    if (!playing)
+        return false;
+
+    uint32_t queue_q8 = ((uint32_t)fifo_bytes << 8) / ad->frame_bytes + ring_q8;
+    if (ad->stats.state == AUDIO_AD_IDLE) {
+        ad->stats.state = AUDIO_AD_ACQUIRING;
+        if (!ad->target_q8)
+            ad->target_q8 = queue_q8;
+        ad->queue_q8 = queue_q8;
+    }
+    ad->queue_q8 = ad->queue_q8 - (ad->queue_q8 >> AUDIO_AD_AVG_SHIFT) +
+                   (queue_q8 >> AUDIO_AD_AVG_SHIFT);
+
+    if (ad->packets % AUDIO_AD_STRIDE)
+        return false;
+    return update(ad);
+}
+
+int32_t audio_adaptive_ppm_q8(const audio_adaptive_t *ad) {
+    return ad->stats.ppm_q8;
+}
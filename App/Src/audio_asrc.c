@@ -0,0 +1,232 @@
+// SPDX-License-Identifier: GPL-3.0-only
+// Copyright (c) 2026 Elia Chiarucci
+
+/*
+ * Asynchronous sample-rate converter for hosts that ignore feedback (see
+ * audio_asrc.h)
+ */
+
+#include "audio_asrc.h"
+#include <string.h>
+
+#define L AUDIO_ASRC_PHASES
+#define T AUDIO_ASRC_TAPS
+#define ONE_Q32 (1ULL << 32)
+
+_Static_assert(T <= 128, "pos is uint8_t");
+
+#define SAMPLE_MAX 8388607.0f
+#define SAMPLE_MIN -8388608.0f
+
+//--------------------------------------------------------------------+
+// Monitor and ratio loop
+//--------------------------------------------------------------------+
+
+void audio_asrc_ctl_init(audio_asrc_ctl_t *ctl, uint32_t sample_rate,
+                         uint8_t frame_bytes, uint16_t fifo_target) {
+    memset(ctl, 0, sizeof(*ctl));
+    ctl->sample_rate = sample_rate;
+    ctl->frame_bytes = frame_bytes;
+    ctl->target_q8 = ((uint32_t)fifo_target << 8) / frame_bytes;
+    ctl->drain_q8 = ctl->target_q8 / AUDIO_ASRC_DRAIN_DIV;
+    uint32_t fill_min_q8 = (uint32_t)((uint64_t)AUDIO_ASRC_FILL_MIN_US *
+                                      sample_rate * 256U / 1000000U);
+    ctl->fill_q8 = ctl->target_q8 / AUDIO_ASRC_FILL_DIV;
+    if (ctl->fill_q8 < fill_min_q8)
+        ctl->fill_q8 = fill_min_q8;
+    ctl->owed_max_q16 = (int64_t)AUDIO_ASRC_OWED_US * sample_rate * 65536 /
+                        1000000;
+}
+
+static int32_t q8_to_us(const audio_asrc_ctl_t *ctl, int64_t q8) {
+    return (int32_t)(q8 * 1000000 / ((int64_t)ctl->sample_rate * 256));
+}
+
+bool audio_asrc_ctl_packet(audio_asrc_ctl_t *ctl, uint16_t packet_bytes,
+                           uint32_t asked_q16, uint16_t fifo_bytes,
+                           uint32_t ring_q8, bool playing, bool underrun) {
+    audio_asrc_stats_t *s = &ctl->stats;
+    if (s->reason != AUDIO_ASRC_OFF) {
+        bool changed = audio_adaptive_packet(&ctl->loop, fifo_bytes, ring_q8,
+                                             playing);
+        s->loop = ctl->loop.stats;
+        s->drift_us = s->loop.error_us;
+        return changed;
+    }
+    if (!playing)
+        return false;
+
+    uint32_t level_q8 = ((uint32_t)fifo_bytes << 8) / ctl->frame_bytes;
+    if (ctl->packets++ == 0) {
+        ctl->level_q8 = level_q8;
+        ctl->queue_q8 = level_q8 + ring_q8;
+    }
+    ctl->level_q8 = ctl->level_q8 - (ctl->level_q8 >> AUDIO_AD_AVG_SHIFT) +
+                    (level_q8 >> AUDIO_AD_AVG_SHIFT);
+    ctl->queue_q8 = ctl->queue_q8 - (ctl->queue_q8 >> AUDIO_AD_AVG_SHIFT) +
+                    ((level_q8 + ring_q8) >> AUDIO_AD_AVG_SHIFT);
+
+    int64_t drift_q8 = (int64_t)ctl->level_q8 - ctl->target_q8;
+    s->drift_us = q8_to_us(ctl, drift_q8);
+    if (ctl->packets < AUDIO_ASRC_SETTLE_PACKETS)
+        return false; // a short fill while settling is the start's
+
+    // Per packet the debt moves by the host's offset alone (a packet
+    // skipped while not playing is no loss)
+    ctl->owed_q16 += (int64_t)asked_q16 -
+                     ((int64_t)(packet_bytes / ctl->frame_bytes) << 16);
+    s->owed_us = q8_to_us(ctl, ctl->owed_q16 / 256);
+    if (underrun)
+        s->reason = AUDIO_ASRC_UNDERRUN;
+    else if (ctl->owed_q16 > ctl->owed_max_q16 ||
+             ctl->owed_q16 < -ctl->owed_max_q16)
+        s->reason = AUDIO_ASRC_IGNORED;
+    else if (drift_q8 < -(int64_t)ctl->drain_q8)
+        s->reason = AUDIO_ASRC_DRAINING;
+    else if (drift_q8 > (int64_t)ctl->fill_q8)
+        s->reason = AUDIO_ASRC_FILLING;
+    else
+        return false;
+
+    // Engaged: the loop pulls the queue back to where it is with the FIFO on
+    // target and the converter's delay added, from ratio 1
+    s->engage_ms = ctl->packets;
+    s->engage_drift_us = s->drift_us;
+    int64_t hold_q8 =
+        (int64_t)ctl->queue_q8 - drift_q8 + AUDIO_ASRC_DELAY_Q8;
+    audio_adaptive_init(&ctl->loop, ctl->sample_rate, ctl->frame_bytes, 0,
+                        -AUDIO_ASRC_RANGE_Q8, AUDIO_ASRC_RANGE_Q8);
+    audio_adaptive_set_target(&ctl->loop,
+                              hold_q8 > 256 ? (uint32_t)hold_q8 : 256U);
+    audio_adaptive_packet(&ctl->loop, fifo_bytes, ring_q8, playing);
+    s->loop = ctl->loop.stats;
+    return true;
+}
+
+bool audio_asrc_ctl_engaged(const audio_asrc_ctl_t *ctl) {
+    return ctl->stats.reason != AUDIO_ASRC_OFF;
+}
+
+int32_t audio_asrc_ctl_ppm_q8(const audio_asrc_ctl_t *ctl) {
+    return audio_asrc_ctl_engaged(ctl) ? audio_adaptive_ppm_q8(&ctl->loop)
+                                       : 0;
+}
+
+//--------------------------------------------------------------------+
+// Converter
+//--------------------------------------------------------------------+
+
+void audio_asrc_reset(audio_asrc_t *as) {
+    memset(as, 0, sizeof(*as));
+    as->step_q32 = ONE_Q32;
+}
+
+static inline void push(audio_asrc_t *as, const int32_t *frame) {
+    float l = (float)frame[0];
+    float r = (float)frame[1];
+    as->hist[as->pos][0] = l;
+    as->hist[as->pos][1] = r;
+    as->hist[as->pos + T][0] = l;
+    as->hist[as->pos + T][1] = r;
+    as->pos = (uint8_t)((as->pos + 1U) % T);
+}
+
+void audio_asrc_prime(audio_asrc_t *as, const int32_t *in, uint16_t frames) {
+    uint16_t first = frames > T ? (uint16_t)(frames - T) : 0;
+    for (uint16_t i = first; i < frames; i++)
+        push(as, &in[2 * i]);
+}
+
+// An output at phase p lags the newest input by T/2 - p/L - 1/(2L) frames
+// (the centre of the prototype): the first output, half a phase short of
+// the next input after T/2 more, is the frame after the newest primed
+void audio_asrc_start(audio_asrc_t *as) {
+    as->ahead_q32 = (uint64_t)(T / 2U + 1U) * ONE_Q32 - ONE_Q32 / (2U * L) -
+                    as->step_q32;
+}
+
+void audio_asrc_set_ppm(audio_asrc_t *as, int32_t ppm_q8) {
+    if (ppm_q8 > AUDIO_ASRC_RANGE_Q8)
+        ppm_q8 = AUDIO_ASRC_RANGE_Q8;
+    if (ppm_q8 < -AUDIO_ASRC_RANGE_Q8)
+        ppm_q8 = -AUDIO_ASRC_RANGE_Q8;
+    // 2^32 / (256 * 1e6) per 1/256 ppm
+    as->step_q32 = ONE_Q32 + (int64_t)ppm_q8 * (1LL << 24) / 1000000;
+}
+
+uint16_t audio_asrc_needed(const audio_asrc_t *as, uint16_t out_frames) {
+    if (!out_frames)
+        return 0; // inputs are taken by the output they lead up to
+    return (uint16_t)((as->ahead_q32 + out_frames * as->step_q32) >> 32);
+}
+
+uint16_t audio_asrc_possible(const audio_asrc_t *as, uint16_t in_frames) {
+    // Largest n with ahead + n * step < (in_frames + 1) * 2^32
+    uint64_t limit = ((uint64_t)in_frames + 1U) << 32;
+    if (as->ahead_q32 >= limit)
+        return 0;
+    uint64_t n = (limit - 1U - as->ahead_q32) / as->step_q32;
+    return n > UINT16_MAX ? UINT16_MAX : (uint16_t)n;
+}
+
+static inline int32_t to_s24(float y) {
+    if (y > SAMPLE_MAX)
+        y = SAMPLE_MAX;
+    if (y < SAMPLE_MIN)
+        y = SAMPLE_MIN;
+    return (int32_t)(y >= 0.0f ? y + 0.5f : y - 0.5f);
+}
+
+// Phase p (0 .. L) of the prototype, oldest tap first: the upper half are
+// the lower half's reversed, and phase L is phase 0 one input later
+static void phase_taps(uint32_t p, float *c) {
+    if (p == L) {
+        c[0] = 0.0f;
+        for (uint32_t j = 1; j < T; j++)
+            c[j] = audio_asrc_taps[0][T - j];
+    } else if (p < L / 2) {
+        for (uint32_t j = 0; j < T; j++)
+            c[j] = audio_asrc_taps[p][T - 1 - j];
+    } else {
+        memcpy(c, audio_asrc_taps[L - 1 - p], sizeof(float) * T);
+    }
+}
+
+void audio_asrc_process(audio_asrc_t *as, const int32_t *in,
+                        uint16_t in_frames, const int32_t *in2, int32_t *out,
+                        uint16_t out_frames) {
+    uint64_t ahead = as->ahead_q32;
+    uint64_t step = as->step_q32;
+    uint16_t taken = 0;
+    for (uint16_t n = 0; n < out_frames; n++) {
+        // Take the inputs up to this output's position first: with in at
+        // the tail of out, or at out with more inputs than outputs, the
+        // slot stored below is then always free
+        ahead += step;
+        while (ahead >= ONE_Q32) {
+            push(as, taken < in_frames ? &in[2 * taken]
+                                       : &in2[2 * (taken - in_frames)]);
+            taken++;
+            ahead -= ONE_Q32;
+        }
+
+        // Position between the two nearest phases
+        uint64_t pos = ahead * L;
+        uint32_t p = (uint32_t)(pos >> 32);
+        float mu = (float)(uint32_t)pos * (1.0f / 4294967296.0f);
+        float c0[T], c1[T];
+        phase_taps(p, c0);
+        phase_taps(p + 1U, c1);
+
+        const float (*w)[2] = &as->hist[as->pos];
+        float l = 0.0f, r = 0.0f;
+        for (uint32_t j = 0; j < T; j++) {
+            float c = c0[j] + mu * (c1[j] - c0[j]);
+            l += c * w[j][0];
+            r += c * w[j][1];
+        }
+        out[2 * n] = to_s24(l);
+        out[2 * n + 1] = to_s24(r);
+    }
+    as->ahead_q32 = ahead;
+}
@@ -0,0 +1,657 @@
+// SPDX-License-Identifier: GPL-3.0-only
+// Copyright (c) 2026 Elia Chiarucci
+
+/*
+ * Polyphase filter of the asynchronous sample-rate converter (see
+ * audio_asrc.h)
+ *
+ * Generated by scripts/gen_resample_taps.py --asrc: 32 taps x 128
+ * phases, Kaiser beta 8.408, passband 20000Hz, stopband
+ * 28000Hz at 48kHz in. Do not edit.
+ */
+
+#include "audio_asrc.h"
+
+// [phase][tap]: tap k of phase p multiplies the input k frames back
+const float audio_asrc_taps[AUDIO_ASRC_PHASES / 2][AUDIO_ASRC_TAPS] = {
+    {  // phase 0
+        -3.895986696e-07f, 1.911197350e-06f, -5.351565598e-06f, 1.197117931e-05f,
+        -2.346201824e-05f, 4.199936606e-05f, -7.030699959e-05f, 1.117756305e-04f,
+        -1.707178072e-04f, 2.529343946e-04f, -3.669890174e-04f, 5.271981819e-04f,
+        -7.613266981e-04f, 1.133913059e-03f, -1.839874219e-03f, 3.861877359e-03f,
+        9.999750494e-01f, -3.830899036e-03f, 1.831811799e-03f, -1.130133088e-03f,
+        7.590869244e-04f, -5.257103336e-04f, 3.659434246e-04f, -2.521824339e-04f,
+        1.701759895e-04f, -1.113903062e-04f, 7.003975688e-05f, -4.182061264e-05f,
+        2.334810276e-05f, -1.190308658e-05f, 5.314273311e-06f, -1.893253123e-06f,
+    },
+    {  // phase 1
+        -1.189400238e-06f, 5.786612582e-06f, -1.616391527e-05f, 3.611147587e-05f,
+        -7.071493512e-05f, 1.265108264e-04f, -2.116827717e-04f, 3.364187346e-04f,
+        -5.136803250e-04f, 7.609125795e-04f, -1.103891244e-03f, 1.585753893e-03f,
+        -2.290265064e-03f, 3.412450738e-03f, -5.542881663e-03f, 1.167767859e-02f,
+        9.997731418e-01f, -1.139889593e-02f, 5.470332305e-03f, -3.378437399e-03f,
+        2.270111004e-03f, -1.572365884e-03f, 1.094482765e-03f, -7.541462717e-04f,
+        5.088049314e-04f, -3.329515032e-04f, 2.092780631e-04f, -1.249023631e-04f,
+        6.968989748e-05f, -3.549876111e-05f, 1.582834973e-05f, -5.625145330e-06f,
+    },
+    {  // phase 2
+        -2.016564433e-06f, 9.731309445e-06f, -2.711733039e-05f, 6.050487871e-05f,
+        -1.183844944e-04f, 2.116660233e-04f, -3.540066035e-04f, 5.624092023e-04f,
+        -8.585122443e-04f, 1.271456014e-03f, -1.844333680e-03f, 2.649342146e-03f,
+        -3.826850238e-03f, 5.704208498e-03f, -9.275326518e-03f, 1.961467577e-02f,
+        9.993686286e-01f, -1.884040367e-02f, 9.073869683e-03f, -5.609762586e-03f,
+        3.770888460e-03f, -2.612167847e-03f, 1.818209347e-03f, -1.252668166e-03f,
+        8.449748594e-04f, -5.527818261e-04f, 3.473295049e-04f, -2.071998366e-04f,
+        1.155382896e-04f, -5.880356025e-05f, 2.618556591e-05f, -9.282960699e-06f,
+    },
+    {  // phase 3
+        -2.870932374e-06f, 1.374352099e-05f, -3.820618989e-05f, 8.513814137e-05f,
+        -1.664440029e-04f, 2.974163651e-04f, -4.971962742e-04f, 7.896154089e-04f,
+        -1.205011691e-03f, 1.784265055e-03f, -2.587881851e-03f, 3.717341354e-03f,
+        -5.370193946e-03f, 8.007897832e-03f, -1.303529117e-02f, 2.767097800e-02f,
+        9.987616589e-01f, -2.615377032e-02f, 1.264063922e-02f, -7.822888515e-03f,
+        5.260572749e-03f, -3.644522706e-03f, 2.536708545e-03f, -1.747462789e-03f,
+        1.178494225e-03f, -7.707569924e-04f, 4.841169478e-04f, -2.886678359e-04f,
+        1.608687416e-04f, -8.180551887e-05f, 3.638099629e-05f, -1.286526156e-05f,
+    },
+    {  // phase 4
+        -3.752313655e-06f, 1.782139804e-05f, -4.942470299e-05f, 1.099977102e-04f,
+        -2.148662591e-04f, 3.837124706e-04f, -6.411683963e-04f, 1.017904067e-03f,
+        -1.552974480e-03f, 2.299036885e-03f, -3.334096908e-03f, 4.789123745e-03f,
+        -6.919398640e-03f, 1.032221470e-02f, -1.682082660e-02f, 3.584463590e-02f,
+        9.979524567e-01f, -3.333740505e-02f, 1.616889121e-02f, -1.001661367e-02f,
+        6.738328896e-03f, -4.668844783e-03f, 3.249571267e-03f, -2.238248787e-03f,
+        1.509174325e-03f, -9.867547235e-04f, 6.195646306e-04f, -3.692620695e-04f,
+        2.056572838e-04f, -1.044930046e-04f, 4.640989292e-05f, -1.637069251e-05f,
+    },
+    {  // phase 5
+        -4.660485971e-06f, 2.196300944e-05f, -6.076691116e-05f, 1.350697305e-04f,
+        -2.636235658e-04f, 4.705041946e-04f, -7.858384600e-04f, 1.247140299e-03f,
+        -1.902194226e-03f, 2.815465683e-03f, -4.082535873e-03f, 5.864055710e-03f,
+        -8.473557980e-03f, 1.264584018e-02f, -2.062995315e-02f, 4.413364225e-02f,
+        9.969413206e-01f, -4.038977865e-02f, 1.965691159e-02f, -1.218975572e-02f,
+        8.203333921e-03f, -5.684556543e-03f, 3.956394182e-03f, -2.724748931e-03f,
+        1.836829399e-03f, -1.200654807e-03f, 7.535982028e-04f, -4.489391726e-04f,
+        2.498805246e-04f, -1.268547221e-04f, 5.626768661e-05f, -1.979798021e-05f,
+    },
+    {  // phase 6
+        -5.595194759e-06f, 2.616634228e-05f, -7.222669031e-05f, 1.603400523e-04f,
+        -3.126877443e-04f, 5.577406541e-04f, -9.311208789e-04f, 1.477187712e-03f,
+        -2.252462463e-03f, 3.333242794e-03f, -4.832751890e-03f, 6.941498157e-03f,
+        -1.003175733e-02f, 1.497744116e-02f, -2.446066132e-02f, 5.253593263e-02f,
+        9.957286238e-01f, -4.730942392e-02f, 2.310302262e-02f, -1.434115212e-02f,
+        9.654777271e-03f, -6.691088905e-03f, 4.656779928e-03f, -3.206690264e-03f,
+        2.161276730e-03f, -1.412339160e-03f, 8.861447618e-04f, -5.276567272e-04f,
+        2.935156610e-04f, -1.488797173e-04f, 6.594998795e-05f, -2.314593318e-05f,
+    },
+    {  // phase 7
+        -6.556152871e-06f, 3.042930229e-05f, -8.379775310e-05f, 1.857942374e-04f,
+        -3.620301482e-04f, 6.453702554e-04f, -1.076929037e-03f, 1.707908473e-03f,
+        -2.603568759e-03f, 3.852056906e-03f, -5.584294479e-03f, 8.020806870e-03f,
+        -1.159307425e-02f, 1.731567097e-02f, -2.831091261e-02f, 6.104938611e-02f,
+        9.943148138e-01f, -5.409493605e-02f, 2.650558344e-02f, -1.646966059e-02f,
+        1.109186123e-02f, -7.687881539e-03f, 5.350337328e-03f, -3.683804247e-03f,
+        2.482336738e-03f, -1.621691886e-03f, 1.017132888e-03f, -6.053732821e-04f,
+        3.365404872e-04f, -1.705573808e-04f, 7.545258816e-05f, -2.641344143e-05f,
+    },
+    {  // phase 8
+        -7.543040271e-06f, 3.474971424e-05f, -9.547365141e-05f, 2.114175657e-04f,
+        -4.116216783e-04f, 7.333407212e-04f, -1.223175335e-03f, 1.939163387e-03f,
+        -2.955300837e-03f, 4.371594230e-03f, -6.336709788e-03f, 9.101332874e-03f,
+        -1.315657902e-02f, 1.965917013e-02f, -3.217864035e-02f, 6.967182596e-02f,
+        9.927004123e-01f, -6.074497301e-02f, 2.986299070e-02f, -1.857415973e-02f,
+        1.251380130e-02f, -8.674383156e-03f, 6.036681591e-03f, -4.155826894e-03f,
+        2.799833070e-03f, -1.828599338e-03f, 1.146492681e-03f, -6.820483712e-04f,
+        3.789334048e-04f, -1.918774517e-04f, 8.477145979e-05f, -2.959947615e-05f,
+    },
+    {  // phase 9
+        -8.555503754e-06f, 3.912532246e-05f, -1.072477789e-04f, 2.371950426e-04f,
+        -4.614327974e-04f, 8.215991195e-04f, -1.369771241e-03f, 2.170811977e-03f,
+        -3.307444693e-03f, 4.891538675e-03f, -7.089540860e-03f, 1.018242280e-02f,
+        -1.472133515e-02f, 2.200656702e-02f, -3.606175054e-02f, 7.840102041e-02f,
+        9.908860151e-01f, -6.725825586e-02f, 3.317367913e-02f, -2.065354948e-02f,
+        1.391982666e-02f, -9.650051796e-03f, 6.715434513e-03f, -4.622498914e-03f,
+        3.113592694e-03f, -2.032950167e-03f, 1.274155788e-03f, -7.576425314e-04f,
+        4.206734300e-04f, -2.128300205e-04f, 9.390275735e-05f, -3.270308925e-05f,
+    },
+    {  // phase 10
+        -9.593156702e-06f, 4.355379134e-05f, -1.191133739e-04f, 2.631114058e-04f,
+        -5.114335458e-04f, 9.100918920e-04f, -1.516627341e-03f, 2.402712562e-03f,
+        -3.659784728e-03f, 5.411572035e-03f, -7.842327895e-03f, 1.126341927e-02f,
+        -1.628639987e-02f, 2.435647864e-02f, -3.995812276e-02f, 8.723468336e-02f,
+        9.888722914e-01f, -7.363356903e-02f, 3.643612206e-02f, -2.270675165e-02f,
+        1.530918046e-02f, -1.061435510e-02f, 7.386224676e-03f, -5.083565841e-03f,
+        3.423445982e-03f, -2.234635385e-03f, 1.400055442e-03f, -8.321173201e-04f,
+        4.617402027e-04f, -2.334055323e-04f, 1.028428177e-04f, -3.572341288e-05f,
+    },
+    {  // phase 11
+        -1.065557885e-05f, 4.803270603e-05f, -1.310635221e-04f, 2.891511334e-04f,
+        -5.615935576e-04f, 9.987648837e-04f, -1.663653385e-03f, 2.634722337e-03f,
+        -4.012103861e-03f, 5.931374174e-03f, -8.594608515e-03f, 1.234366125e-02f,
+        -1.785082473e-02f, 2.670751125e-02f, -4.386561105e-02f, 9.617047522e-02f,
+        9.866599839e-01f, -7.986976064e-02f, 3.964883194e-02f, -2.473271040e-02f,
+        1.668112026e-02f, -1.156677059e-02f, 8.048687630e-03f, -5.538778162e-03f,
+        3.729226797e-03f, -2.433548411e-03f, 1.524126488e-03f, -9.054353308e-04f,
+        5.021139937e-04f, -2.535947895e-04f, 1.115881604e-04f, -3.865965889e-05f,
+    },
+    {  // phase 12
+        -1.174231611e-05f, 5.255957312e-05f, -1.430911597e-04f, 3.152984513e-04f,
+        -6.118820761e-04f, 1.087563374e-03f, -1.810758342e-03f, 2.866697462e-03f,
+        -4.364183666e-03f, 6.450623213e-03f, -9.345918037e-03f, 1.342248447e-02f,
+        -1.941365605e-02f, 2.905826122e-02f, -4.778204481e-02f, 1.052060037e-01f,
+        9.842499086e-01f, -8.596574269e-02f, 4.281036089e-02f, -2.673039270e-02f,
+        1.803491837e-02f, -1.250678592e-02f, 8.702466085e-03f, -5.987891447e-03f,
+        4.030772575e-03f, -2.629585126e-03f, 1.646305414e-03f, -9.775602096e-04f,
+        5.417757113e-04f, -2.733889537e-04f, 1.201354878e-04f, -4.151111823e-05f,
+    },
+    {  // phase 13
+        -1.285288038e-05f, 5.713182142e-05f, -1.551890767e-04f, 3.415373416e-04f,
+        -6.622679715e-04f, 1.176432105e-03f, -1.957850452e-03f, 3.098493139e-03f,
+        -4.715804495e-03f, 6.968995719e-03f, -1.009578974e-02f, 1.449922178e-02f,
+        -2.097393553e-02f, 3.140731569e-02f, -5.170522976e-02f, 1.143388248e-01f,
+        9.816429538e-01f, -9.192049129e-02f, 4.591930112e-02f, -2.869878883e-02f,
+        1.936986219e-02f, -1.343389914e-02f, 9.347210087e-03f, -6.430666464e-03f,
+        4.327924402e-03f, -2.822643917e-03f, 1.766530377e-03f, -1.048456669e-03f,
+        5.807069087e-04f, -2.927795485e-04f, 1.284816852e-04f, -4.427716028e-05f,
+    },
+    {  // phase 14
+        -1.398674943e-05f, 6.174680278e-05f, -1.673499202e-04f, 3.678515504e-04f,
+        -7.127197574e-04f, 1.265315316e-03f, -2.104837280e-03f, 3.329963700e-03f,
+        -5.066745611e-03f, 7.486166898e-03f, -1.084375516e-02f, 1.557320355e-02f,
+        -2.253070076e-02f, 3.375325334e-02f, -5.563294886e-02f, 1.235664433e-01f,
+        9.788400803e-01f, -9.773304681e-02f, 4.897428540e-02f, -3.063691276e-02f,
+        2.068525457e-02f, -1.434761894e-02f, 9.982577189e-03f, -6.866869302e-03f,
+        4.620527089e-03f, -3.012625730e-03f, 1.884741235e-03f, -1.118090502e-03f,
+        6.188897893e-04f, -3.117584607e-04f, 1.366238207e-04f, -4.695723217e-05f,
+    },
+    {  // phase 15
+        -1.514336677e-05f, 6.640179308e-05f, -1.795661975e-04f, 3.942245969e-04f,
+        -7.632056085e-04f, 1.354156775e-03f, -2.251625768e-03f, 3.560962695e-03f,
+        -5.416785315e-03f, 8.001810787e-03f, -1.158934434e-02f, 1.664375807e-02f,
+        -2.408298578e-02f, 3.609464522e-02f, -5.956296329e-02f, 1.328863141e-01f,
+        9.758423208e-01f, -1.034025141e-01f, 5.197398752e-02f, -3.254380264e-02f,
+        2.198041414e-02f, -1.524746487e-02f, 1.060823262e-02f, -7.296271479e-03f,
+        4.908429252e-03f, -3.199434110e-03f, 2.000879567e-03f, -1.186428596e-03f,
+        6.563072129e-04f, -3.303179425e-04f, 1.445591447e-04f, -4.955085799e-05f,
+    },
+    {  // phase 16
+        -1.632214160e-05f, 7.109399318e-05f, -1.918302803e-04f, 4.206397821e-04f,
+        -8.136933785e-04f, 1.442899809e-03f, -2.398122290e-03f, 3.791342976e-03f,
+        -5.765701084e-03f, 8.515600452e-03f, -1.233208613e-02f, 1.771021192e-02f,
+        -2.562982165e-02f, 3.843005544e-02f, -6.349301342e-02f, 1.422958429e-01f,
+        9.726507792e-01f, -1.089280625e-01f, 5.491712265e-02f, -3.441852114e-02f,
+        2.325467560e-02f, -1.613296763e-02f, 1.122384946e-02f, -7.718650059e-03f,
+        5.191483375e-03f, -3.382975245e-03f, 2.114888698e-03f, -1.253438943e-03f,
+        6.929427005e-04f, -3.484506122e-04f, 1.522850902e-04f, -5.205763798e-05f,
+    },
+    {  // phase 17
+        -1.752244876e-05f, 7.582052999e-05f, -2.041344083e-04f, 4.470801976e-04f,
+        -8.641506182e-04f, 1.531487337e-03f, -2.544232710e-03f, 4.020956787e-03f,
+        -6.113269702e-03f, 9.027208183e-03f, -1.307150847e-02f, 1.877189043e-02f,
+        -2.717023698e-02f, 4.075804200e-02f, -6.742081979e-02f, 1.517923873e-01f,
+        9.692666306e-01f, -1.143089259e-01f, 5.780244777e-02f, -3.626015591e-02f,
+        2.450739006e-02f, -1.700366923e-02f, 1.182910877e-02f, -8.133787749e-03f,
+        5.469545881e-03f, -3.563158010e-03f, 2.226713726e-03f, -1.319090654e-03f,
+        7.287804389e-04f, -3.661494555e-04f, 1.597992714e-04f, -5.447724771e-05f,
+    },
+    {  // phase 18
+        -1.874362867e-05f, 8.057845765e-05f, -2.164706927e-04f, 4.735287348e-04f,
+        -9.145445945e-04f, 1.619861909e-03f, -2.689862435e-03f, 4.249655851e-03f,
+        -6.459267397e-03f, 9.536305695e-03f, -1.380713866e-02f, 1.982811801e-02f,
+        -2.870325854e-02f, 4.307715758e-02f, -7.134408419e-02f, 1.613732576e-01f,
+        9.656911203e-01f, -1.195444032e-01f, 6.062876197e-02f, -3.806781989e-02f,
+        2.573792531e-02f, -1.785912323e-02f, 1.242369977e-02f, -8.541473006e-03f,
+        5.742477196e-03f, -3.739894000e-03f, 2.336301541e-03f, -1.383353967e-03f,
+        7.638052847e-04f, -3.834078266e-04f, 1.670994840e-04f, -5.680943711e-05f,
+    },
+    {  // phase 19
+        -1.998498742e-05f, 8.536475871e-05f, -2.288311207e-04f, 4.999680952e-04f,
+        -9.648423089e-04f, 1.707965733e-03f, -2.834916476e-03f, 4.477291465e-03f,
+        -6.803469975e-03f, 1.004256433e-02f, -1.453850367e-02f, 2.087821862e-02f,
+        -3.022791180e-02f, 4.538595033e-02f, -7.526049058e-02f, 1.710357178e-01f,
+        9.619255634e-01f, -1.246338576e-01f, 6.339490684e-02f, -3.984065173e-02f,
+        2.694566613e-02f, -1.869889495e-02f, 1.300731996e-02f, -8.941500130e-03f,
+        6.010141814e-03f, -3.913097573e-03f, 2.443600843e-03f, -1.446200257e-03f,
+        7.980027685e-04f, -4.002194480e-04f, 1.741837039e-04f, -5.905402954e-05f,
+    },
+    {  // phase 20
+        -2.124579676e-05f, 9.017634544e-05f, -2.412075597e-04f, 5.263807991e-04f,
+        -1.015010517e-03f, 1.795740714e-03f, -2.979299501e-03f, 4.703714586e-03f,
+        -7.145652962e-03f, 1.054565525e-02f, -1.526513041e-02f, 2.192151612e-02f,
+        -3.174322151e-02f, 4.768296467e-02f, -7.916770621e-02f, 1.807769868e-01f,
+        9.579713444e-01f, -1.295767172e-01f, 6.609976678e-02f, -4.157781608e-02f,
+        2.813001454e-02f, -1.952256167e-02f, 1.357967529e-02f, -9.333669362e-03f,
+        6.272408350e-03f, -4.082685884e-03f, 2.548562165e-03f, -1.507602047e-03f,
+        8.313590974e-04f, -4.165784115e-04f, 1.810500862e-04f, -6.121092081e-05f,
+    },
+    {  // phase 21
+        -2.252529422e-05f, 9.501006121e-05f, -2.535917612e-04f, 5.527491963e-04f,
+        -1.065015750e-03f, 1.883128489e-03f, -3.122915897e-03f, 4.928775926e-03f,
+        -7.485591738e-03f, 1.104524964e-02f, -1.598654605e-02f, 2.295733475e-02f,
+        -3.324821230e-02f, 4.996674213e-02f, -8.306338265e-02f, 1.905942393e-01f,
+        9.538299164e-01f, -1.343724747e-01f, 6.874226923e-02f, -4.327850395e-02f,
+        2.929039007e-02f, -2.032971282e-02f, 1.414048024e-02f, -9.717786967e-03f,
+        6.529149602e-03f, -4.248578914e-03f, 2.651137889e-03f, -1.567533015e-03f,
+        8.638611581e-04f, -4.324791776e-04f, 1.876969649e-04f, -6.328007808e-05f,
+    },
+    {  // phase 22
+        -2.382268318e-05f, 9.986268189e-05f, -2.659753656e-04f, 5.790554759e-04f,
+        -1.114824329e-03f, 1.970070459e-03f, -3.265669828e-03f, 5.152326043e-03f,
+        -7.823061682e-03f, 1.154101895e-02f, -1.670227825e-02f, 2.398499947e-02f,
+        -3.474190924e-02f, 5.223582214e-02f, -8.694515684e-02f, 2.004846070e-01f,
+        9.495028004e-01f, -1.390206876e-01f, 7.132138500e-02f, -4.494193302e-02f,
+        3.042622999e-02f, -2.111995016e-02f, 1.468945802e-02f, -1.009366532e-02f,
+        6.780242598e-03f, -4.410699505e-03f, 2.751282261e-03f, -1.625967999e-03f,
+        8.954965189e-04f, -4.479165756e-04f, 1.941228510e-04f, -6.526153883e-05f,
+    },
+    {  // phase 23
+        -2.513713308e-05f, 1.047309174e-04f, -2.783499066e-04f, 6.052816771e-04f,
+        -1.164402394e-03f, 2.056507830e-03f, -3.407465295e-03f, 5.374215434e-03f,
+        -8.157838306e-03f, 1.203263503e-02f, -1.741185554e-02f, 2.500383642e-02f,
+        -3.622333841e-02f, 5.448874286e-02f, -9.081065220e-02f, 2.104451796e-01f,
+        9.449915849e-01f, -1.435209776e-01f, 7.383612847e-02f, -4.656734788e-02f,
+        3.153698959e-02f, -2.189288795e-02f, 1.522634063e-02f, -1.046112300e-02f,
+        7.025568654e-03f, -4.568973387e-03f, 2.848951410e-03f, -1.682883008e-03f,
+        9.262534316e-04f, -4.628858030e-04f, 2.003264320e-04f, -6.715540967e-05f,
+    },
+    {  // phase 24
+        -2.646777953e-05f, 1.096114133e-04f, -2.907068161e-04f, 6.314096994e-04f,
+        -1.213715917e-03f, 2.142381646e-03f, -3.548206194e-03f, 5.594294631e-03f,
+        -8.489697403e-03f, 1.251977040e-02f, -1.811480753e-02f, 2.601317335e-02f,
+        -3.769152754e-02f, 5.672404205e-02f, -9.465747967e-02f, 2.204730057e-01f,
+        9.402979247e-01f, -1.478730310e-01f, 7.628555783e-02f, -4.815402038e-02f,
+        3.262214235e-02f, -2.264815312e-02f, 1.575086900e-02f, -1.081998482e-02f,
+        7.265013412e-03f, -4.723329207e-03f, 2.944103357e-03f, -1.738255224e-03f,
+        9.561208325e-04f, -4.773824247e-04f, 2.063065699e-04f, -6.896186523e-05f,
+    },
+    {  // phase 25
+        -2.781372458e-05f, 1.145007524e-04f, -3.030374290e-04f, 6.574213137e-04f,
+        -1.262730725e-03f, 2.227632827e-03f, -3.687796377e-03f, 5.812414294e-03f,
+        -8.818415183e-03f, 1.300209841e-02f, -1.881066526e-02f, 2.701233997e-02f,
+        -3.914550655e-02f, 5.894025785e-02f, -9.848323889e-02f, 2.305650944e-01f,
+        9.354235408e-01f, -1.520765983e-01f, 7.866877524e-02f, -4.970124982e-02f,
+        3.368118020e-02f, -2.338538542e-02f, 1.626279311e-02f, -1.117008197e-02f,
+        7.498466890e-03f, -4.873698553e-03f, 3.036698032e-03f, -1.792063009e-03f,
+        9.850883434e-04f, -4.914023719e-04f, 2.120623003e-04f, -7.068114688e-05f,
+    },
+    {  // phase 26
+        -2.917403696e-05f, 1.193954565e-04f, -3.153329880e-04f, 6.832981730e-04f,
+        -1.311412526e-03f, 2.312202206e-03f, -3.826139717e-03f, 6.028425307e-03f,
+        -9.143768422e-03f, 1.347929351e-02f, -1.949896150e-02f, 2.800066844e-02f,
+        -4.058430816e-02f, 6.113592966e-02f, -1.022855192e-01f, 2.407184161e-01f,
+        9.303702192e-01f, -1.561314938e-01f, 8.098492703e-02f, -5.120836324e-02f,
+        3.471361369e-02f, -2.410423760e-02f, 1.676187204e-02f, -1.151125203e-02f,
+        7.725823522e-03f, -5.020015974e-03f, 3.126697279e-03f, -1.844285906e-03f,
+        1.013146272e-03f, -5.049419411e-04f, 2.175928306e-04f, -7.231356155e-05f,
+    },
+    {  // phase 27
+        -3.054775233e-05f, 1.242919883e-04f, -3.275846488e-04f, 7.090218241e-04f,
+        -1.359726921e-03f, 2.396030567e-03f, -3.963140164e-03f, 6.242178872e-03f,
+        -9.465534597e-03f, 1.395103137e-02f, -2.017923099e-02f, 2.897749377e-02f,
+        -4.200696849e-02f, 6.330959898e-02f, -1.060619010e-01f, 2.509299038e-01f,
+        9.251398101e-01f, -1.600375960e-01f, 8.323320384e-02f, -5.267471560e-02f,
+        3.571897219e-02f, -2.480437550e-02f, 1.724787416e-02f, -1.184333904e-02f,
+        7.946982195e-03f, -5.162219005e-03f, 3.214064875e-03f, -1.894904649e-03f,
+        1.040285611e-03f, -5.179977924e-04f, 2.228975383e-04f, -7.385948041e-05f,
+    },
+    {  // phase 28
+        -3.193387363e-05f, 1.291867531e-04f, -3.397834855e-04f, 7.345737187e-04f,
+        -1.407639436e-03f, 2.479058683e-03f, -4.098701810e-03f, 6.453526606e-03f,
+        -9.783492039e-03f, 1.441698916e-02f, -2.085101081e-02f, 2.994215421e-02f,
+        -4.341252765e-02f, 6.545981023e-02f, -1.098099565e-01f, 2.611964542e-01f,
+        9.197342273e-01f, -1.637948466e-01f, 8.541284071e-02f, -5.409969001e-02f,
+        3.669680407e-02f, -2.548547820e-02f, 1.772057712e-02f, -1.216619357e-02f,
+        8.161846284e-03f, -5.300248185e-03f, 3.298766527e-03f, -1.943901155e-03f,
+        1.066498040e-03f, -5.305669481e-04f, 2.279759693e-04f, -7.531933757e-05f,
+    },
+    {  // phase 29
+        -3.333137144e-05f, 1.340761008e-04f, -3.519204957e-04f, 7.599352248e-04f,
+        -1.455115537e-03f, 2.561227351e-03f, -4.232728950e-03f, 6.662320640e-03f,
+        -1.009742007e-02f, 1.487684574e-02f, -2.151384061e-02f, 3.089399170e-02f,
+        -4.480003034e-02f, 6.758511167e-02f, -1.135272512e-01f, 2.715149292e-01f,
+        9.141554474e-01f, -1.674032509e-01f, 8.752311721e-02f, -5.548269792e-02f,
+        3.764667685e-02f, -2.614723818e-02f, 1.817976799e-02f, -1.247967277e-02f,
+        8.370323683e-03f, -5.434047072e-03f, 3.380769892e-03f, -1.991258537e-03f,
+        1.091775920e-03f, -5.426467900e-04f, 2.328278360e-04f, -7.669362872e-05f,
+    },
+    {  // phase 30
+        -3.473918434e-05f, 1.389563281e-04f, -3.639866059e-04f, 7.850876388e-04f,
+        -1.502120654e-03f, 2.642477437e-03f, -4.365126145e-03f, 6.868413710e-03f,
+        -1.040709914e-02f, 1.533028185e-02f, -2.216726298e-02f, 3.183235229e-02f,
+        -4.616852643e-02f, 6.968405618e-02f, -1.172113450e-01f, 2.818821567e-01f,
+        9.084055086e-01f, -1.708628771e-01f, 8.956335749e-02f, -5.682317928e-02f,
+        3.856817735e-02f, -2.678936136e-02f, 1.862524335e-02f, -1.278364044e-02f,
+        8.572326838e-03f, -5.563562260e-03f, 3.460044570e-03f, -2.036961096e-03f,
+        1.116112295e-03f, -5.542350583e-04f, 2.374530155e-04f, -7.798290976e-05f,
+    },
+    {  // phase 31
+        -3.615621936e-05f, 1.438236803e-04f, -3.759726774e-04f, 8.100121974e-04f,
+        -1.548620204e-03f, 2.722749907e-03f, -4.495798286e-03f, 7.071659259e-03f,
+        -1.071231100e-02f, 1.577698034e-02f, -2.281082367e-02f, 3.275658655e-02f,
+        -4.751707156e-02f, 7.175520217e-02f, -1.208597932e-01f, 2.922949323e-01f,
+        9.024865099e-01f, -1.741738559e-01f, 9.153293034e-02f, -5.812060268e-02f,
+        3.946091187e-02f, -2.741156728e-02f, 1.905680930e-02f, -1.307796702e-02f,
+        8.767772768e-03f, -5.688743388e-03f, 3.536562118e-03f, -2.080994327e-03f,
+        1.139500892e-03f, -5.653298481e-04f, 2.418515474e-04f, -7.918779538e-05f,
+    },
+    {  // phase 32
+        -3.758135240e-05f, 1.486743536e-04f, -3.878695118e-04f, 8.346900893e-04f,
+        -1.594579614e-03f, 2.801985873e-03f, -4.624650652e-03f, 7.271911531e-03f,
+        -1.101283881e-02f, 1.621662638e-02f, -2.344407194e-02f, 3.366604998e-02f,
+        -4.884472778e-02f, 7.379711442e-02f, -1.244701477e-01f, 3.027500200e-01f,
+        8.964006104e-01f, -1.773363807e-01f, 9.343124921e-02f, -5.937446551e-02f,
+        4.032450623e-02f, -2.801358913e-02f, 1.947428160e-02f, -1.336252969e-02f,
+        8.956583089e-03f, -5.809543157e-03f, 3.610296050e-03f, -2.123344913e-03f,
+        1.161936114e-03f, -5.759296077e-04f, 2.460236314e-04f, -8.030895767e-05f,
+    },
+    {  // phase 33
+        -3.901342879e-05f, 1.535044973e-04f, -3.996678567e-04f, 8.591024679e-04f,
+        -1.639964344e-03f, 2.880126629e-03f, -4.751588982e-03f, 7.469025671e-03f,
+        -1.130846731e-02f, 1.664890764e-02f, -2.406656085e-02f, 3.456010345e-02f,
+        -5.015056409e-02f, 7.580836494e-02f, -1.280399584e-01f, 3.132441543e-01f,
+        8.901500283e-01f, -1.803507065e-01f, 9.525777223e-02f, -6.058429408e-02f,
+        4.115860600e-02f, -2.859517388e-02f, 1.987748566e-02f, -1.363721237e-02f,
+        9.138684036e-03f, -5.925917331e-03f, 3.681221839e-03f, -2.164000728e-03f,
+        1.183413039e-03f, -5.860331350e-04f, 2.499696257e-04f, -8.134712457e-05f,
+    },
+    {  // phase 34
+        -4.045126377e-05f, 1.583102162e-04f, -4.113584118e-04f, 8.832304635e-04f,
+        -1.684739908e-03f, 2.957113687e-03f, -4.876519529e-03f, 7.662857821e-03f,
+        -1.159898294e-02f, 1.707351454e-02f, -2.467784752e-02f, 3.543811363e-02f,
+        -5.143365704e-02f, 7.778753386e-02f, -1.315667741e-01f, 3.237740406e-01f,
+        8.837370395e-01f, -1.832171498e-01f, 9.701200213e-02f, -6.174964368e-02f,
+        4.196287649e-02f, -2.915608235e-02f, 2.026625666e-02f, -1.390190578e-02f,
+        9.314006478e-03f, -6.037824752e-03f, 3.749316918e-03f, -2.202950833e-03f,
+        1.203927418e-03f, -5.956395751e-04f, 2.536900440e-04f, -8.230307849e-05f,
+    },
+    {  // phase 35
+        -4.189364304e-05f, 1.630875726e-04f, -4.229318347e-04f, 9.070551958e-04f,
+        -1.728871899e-03f, 3.032888825e-03f, -4.999349131e-03f, 7.853265216e-03f,
+        -1.188417402e-02f, 1.749014043e-02f, -2.527749349e-02f, 3.629945336e-02f,
+        -5.269309138e-02f, 7.973321025e-02f, -1.350481439e-01f, 3.343363574e-01f,
+        8.771639772e-01f, -1.859360884e-01f, 9.869348628e-02f, -6.287009871e-02f,
+        4.273700292e-02f, -2.969608927e-02f, 2.064043953e-02f, -1.415650743e-02f,
+        9.482485931e-03f, -6.145227338e-03f, 3.814560677e-03f, -2.240185475e-03f,
+        1.223475672e-03f, -6.047484164e-04f, 2.571855533e-04f, -8.317765471e-05f,
+    },
+    {  // phase 36
+        -4.333932343e-05f, 1.678325893e-04f, -4.343787471e-04f, 9.305577865e-04f,
+        -1.772326013e-03f, 3.107394117e-03f, -5.119985269e-03f, 8.040106282e-03f,
+        -1.216383085e-02f, 1.789848179e-02f, -2.586506495e-02f, 3.714350209e-02f,
+        -5.392796057e-02f, 8.164399302e-02f, -1.384816182e-01f, 3.449277567e-01f,
+        8.704332305e-01f, -1.885079607e-01f, 1.003018165e-01f, -6.394527273e-02f,
+        4.348069045e-02f, -3.021498333e-02f, 2.099988903e-02f, -1.440092168e-02f,
+        9.644062570e-03f, -6.248090088e-03f, 3.876934468e-03f, -2.275696077e-03f,
+        1.242054883e-03f, -6.133594878e-04f, 2.604569717e-04f, -8.397173989e-05f,
+    },
+    {  // phase 37
+        -4.478703347e-05f, 1.725412514e-04f, -4.456897412e-04f, 9.537193723e-04f,
+        -1.815068069e-03f, 3.180571982e-03f, -5.238336135e-03f, 8.223240736e-03f,
+        -1.243774589e-02f, 1.829823847e-02f, -2.644013305e-02f, 3.796964632e-02f,
+        -5.513736747e-02f, 8.351849179e-02f, -1.418647503e-01f, 3.555448663e-01f,
+        8.635472432e-01f, -1.909332648e-01f, 1.018366292e-01f, -6.497480849e-02f,
+        4.419366426e-02f, -3.071256728e-02f, 2.134446978e-02f, -1.463505974e-02f,
+        9.798681239e-03f, -6.346381084e-03f, 3.936421593e-03f, -2.309475242e-03f,
+        1.259662796e-03f, -6.214729545e-04f, 2.635052654e-04f, -8.468627055e-05f,
+    },
+    {  // phase 38
+        -4.623547410e-05f, 1.772095096e-04f, -4.568553856e-04f, 9.765211177e-04f,
+        -1.857064037e-03f, 3.252365216e-03f, -5.354310691e-03f, 8.402529679e-03f,
+        -1.270571389e-02f, 1.868911386e-02f, -2.700227423e-02f, 3.877727997e-02f,
+        -5.632042482e-02f, 8.535532769e-02f, -1.451950970e-01f, 3.661842905e-01f,
+        8.565085133e-01f, -1.932125590e-01f, 1.032976050e-01f, -6.595837800e-02f,
+        4.487566963e-02f, -3.118865789e-02f, 2.167405629e-02f, -1.485883967e-02f,
+        9.946291449e-03f, -6.440071489e-03f, 3.993007308e-03f, -2.341516741e-03f,
+        1.276297810e-03f, -6.290893142e-04f, 2.663315462e-04f, -8.532223142e-05f,
+    },
+    {  // phase 39
+        -4.768331935e-05f, 1.818332819e-04f, -4.678662320e-04f, 9.989442278e-04f,
+        -1.898280059e-03f, 3.322717037e-03f, -5.467818739e-03f, 8.577835696e-03f,
+        -1.296753202e-02f, 1.907081512e-02f, -2.755107045e-02f, 3.956580482e-02f,
+        -5.747625592e-02f, 8.715313432e-02f, -1.484702202e-01f, 3.768426116e-01f,
+        8.493195913e-01f, -1.953464601e-01f, 1.046844685e-01f, -6.689568251e-02f,
+        4.552647192e-02f, -3.164308607e-02f, 2.198853296e-02f, -1.507218644e-02f,
+        1.008684739e-02f, -6.529135542e-03f, 4.046678811e-03f, -2.371815512e-03f,
+        1.291958973e-03f, -6.362093935e-04f, 2.689370688e-04f, -8.588065393e-05f,
+    },
+    {  // phase 40
+        -4.912921712e-05f, 1.864084571e-04f, -4.787128217e-04f, 1.020969962e-03f,
+        -1.938682474e-03f, 3.391571124e-03f, -5.578770979e-03f, 8.749022947e-03f,
+        -1.322300002e-02f, 1.944305337e-02f, -2.808610953e-02f, 4.033463088e-02f,
+        -5.860399515e-02f, 8.891055853e-02f, -1.516876882e-01f, 3.875163917e-01f,
+        8.419830796e-01f, -1.973356437e-01f, 1.059969888e-01f, -6.778645251e-02f,
+        4.614585664e-02f, -3.207569685e-02f, 2.228779411e-02f, -1.527503188e-02f,
+        1.022030791e-02f, -6.613550556e-03f, 4.097425241e-03f, -2.400367650e-03f,
+        1.306645979e-03f, -6.428343431e-04f, 2.713232280e-04f, -8.636261457e-05f,
+    },
+    {  // phase 41
+        -5.057178992e-05f, 1.909308973e-04f, -4.893856917e-04f, 1.042579646e-03f,
+        -1.978237841e-03f, 3.458871655e-03f, -5.687079072e-03f, 8.915957272e-03f,
+        -1.347192036e-02f, 1.980554390e-02f, -2.860698539e-02f, 4.108317685e-02f,
+        -5.970278859e-02f, 9.062626131e-02f, -1.548450766e-01f, 3.982021734e-01f,
+        8.345016307e-01f, -1.991808431e-01f, 1.072349785e-01f, -6.863044774e-02f,
+        4.673362947e-02f, -3.248634939e-02f, 2.257174399e-02f, -1.546731470e-02f,
+        1.034663655e-02f, -6.693296910e-03f, 4.145237665e-03f, -2.427170401e-03f,
+        1.320359158e-03f, -6.489656338e-04f, 2.734915558e-04f, -8.676923329e-05f,
+    },
+    {  // phase 42
+        -5.200963571e-05f, 1.953964402e-04f, -4.998753819e-04f, 1.063754688e-03f,
+        -2.016912963e-03f, 3.524563351e-03f, -5.792655708e-03f, 9.078506279e-03f,
+        -1.371409835e-02f, 2.015800634e-02f, -2.911329838e-02f, 4.181087046e-02f,
+        -6.077179457e-02f, 9.229891864e-02f, -1.579399699e-01f, 4.088964819e-01f,
+        8.268779466e-01f, -2.008828489e-01f, 1.083982938e-01f, -6.942745713e-02f,
+        4.728961625e-02f, -3.287491700e-02f, 2.284029678e-02f, -1.564898050e-02f,
+        1.046580148e-02f, -6.768358039e-03f, 4.190109072e-03f, -2.452222153e-03f,
+        1.333099475e-03f, -6.546050517e-04f, 2.754437184e-04f, -8.710167186e-05f,
+    },
+    {  // phase 43
+        -5.344132871e-05f, 1.998009027e-04f, -5.101724416e-04f, 1.084476587e-03f,
+        -2.054674913e-03f, 3.588591511e-03f, -5.895414666e-03f, 9.236539441e-03f,
+        -1.394934229e-02f, 2.050016493e-02f, -2.960465552e-02f, 4.251714891e-02f,
+        -6.181018426e-02f, 9.392722235e-02f, -1.609699622e-01f, 4.195958260e-01f,
+        8.191147777e-01f, -2.024425083e-01f, 1.094868345e-01f, -7.017729876e-02f,
+        4.781366295e-02f, -3.324128715e-02f, 2.309337660e-02f, -1.581998177e-02f,
+        1.057777555e-02f, -6.838720424e-03f, 4.232034363e-03f, -2.475522429e-03f,
+        1.344868516e-03f, -6.597546934e-04f, 2.771815132e-04f, -8.736113224e-05f,
+    },
+    {  // phase 44
+        -5.486542033e-05f, 2.041400832e-04f, -5.202674360e-04f, 1.104726952e-03f,
+        -2.091491055e-03f, 3.650902055e-03f, -5.995270878e-03f, 9.389928191e-03f,
+        -1.417746362e-02f, 2.083174862e-02f, -3.008067081e-02f, 4.320145926e-02f,
+        -6.281714223e-02f, 9.550988096e-02f, -1.639326590e-01f, 4.302966997e-01f,
+        8.112149208e-01f, -2.038607243e-01f, 1.105005434e-01f, -7.087981976e-02f,
+        4.830563570e-02f, -3.358536146e-02f, 2.333091746e-02f, -1.598027783e-02f,
+        1.068253624e-02f, -6.904373579e-03f, 4.271010337e-03f, -2.497071877e-03f,
+        1.355668489e-03f, -6.644169614e-04f, 2.787068660e-04f, -8.754885494e-05f,
+    },
+    {  // phase 45
+        -5.628044007e-05f, 2.084097648e-04f, -5.301509537e-04f, 1.124487511e-03f,
+        -2.127329070e-03f, 3.711441566e-03f, -6.092140488e-03f, 9.538546019e-03f,
+        -1.439827705e-02f, 2.115249136e-02f, -3.054096546e-02f, 4.386325878e-02f,
+        -6.379186701e-02f, 9.704562052e-02f, -1.668256781e-01f, 4.409955836e-01f,
+        8.031812188e-01f, -2.051384554e-01f, 1.114394064e-01f, -7.153489626e-02f,
+        4.876542071e-02f, -3.390705564e-02f, 2.355286330e-02f, -1.612983488e-02f,
+        1.078006564e-02f, -6.965310038e-03f, 4.307035682e-03f, -2.516872258e-03f,
+        1.365502209e-03f, -6.685945587e-04f, 2.800218275e-04f, -8.766611735e-05f,
+    },
+    {  // phase 46
+        -5.768489644e-05f, 2.126057184e-04f, -5.398136129e-04f, 1.143740127e-03f,
+        -2.162156979e-03f, 3.770157324e-03f, -6.185940918e-03f, 9.682268560e-03f,
+        -1.461160067e-02f, 2.146213223e-02f, -3.098516824e-02f, 4.450201541e-02f,
+        -6.473357167e-02f, 9.853318547e-02f, -1.696466506e-01f, 4.516889464e-01f,
+        7.950165589e-01f, -2.062767143e-01f, 1.123034518e-01f, -7.214243330e-02f,
+        4.919292425e-02f, -3.420629953e-02f, 2.375916793e-02f, -1.626862592e-02f,
+        1.087035045e-02f, -7.021525336e-03f, 4.340110958e-03f, -2.534926439e-03f,
+        1.374373096e-03f, -6.722904835e-04f, 2.811285704e-04f, -8.771423208e-05f,
+    },
+    {  // phase 47
+        -5.907727797e-05f, 2.167237055e-04f, -5.492460686e-04f, 1.162466811e-03f,
+        -2.195943169e-03f, 3.826997349e-03f, -6.276590930e-03f, 9.820973690e-03f,
+        -1.481725614e-02f, 2.176041565e-02f, -3.141291568e-02f, 4.511720807e-02f,
+        -6.564148434e-02f, 9.997133945e-02f, -1.723932228e-01f, 4.623732462e-01f,
+        7.867238715e-01f, -2.072765676e-01f, 1.130927502e-01f, -7.270236465e-02f,
+        4.958807260e-02f, -3.448303701e-02f, 2.394979500e-02f, -1.639663077e-02f,
+        1.095338197e-02f, -7.073017994e-03f, 4.370238584e-03f, -2.551238379e-03f,
+        1.382285163e-03f, -6.755080243e-04f, 2.820293860e-04f, -8.769454530e-05f,
+    },
+    {  // phase 48
+        -6.045605423e-05f, 2.207594815e-04f, -5.584390199e-04f, 1.180649736e-03f,
+        -2.228656414e-03f, 3.881910442e-03f, -6.364010683e-03f, 9.954541614e-03f,
+        -1.501506876e-02f, 2.204709157e-02f, -3.182385235e-02f, 4.570832707e-02f,
+        -6.651484876e-02f, 1.013588661e-01f, -1.750630567e-01f, 4.730449323e-01f,
+        7.783061290e-01f, -2.081391348e-01f, 1.138074143e-01f, -7.321465275e-02f,
+        4.995081196e-02f, -3.473722597e-02f, 2.412471799e-02f, -1.651383601e-02f,
+        1.102915603e-02f, -7.119789498e-03f, 4.397422824e-03f, -2.565813116e-03f,
+        1.389243011e-03f, -6.782507539e-04f, 2.827266811e-04f, -8.760843509e-05f,
+    },
+    {  // phase 49
+        -6.181967687e-05f, 2.247087987e-04f, -5.673832169e-04f, 1.198271250e-03f,
+        -2.260265902e-03f, 3.934846221e-03f, -6.448121800e-03f, 1.008285496e-02f,
+        -1.520486765e-02f, 2.232191567e-02f, -3.221763115e-02f, 4.627487449e-02f,
+        -6.735292488e-02f, 1.026945701e-01f, -1.776538317e-01f, 4.837004464e-01f,
+        7.697663442e-01f, -2.088655878e-01f, 1.144475983e-01f, -7.367928849e-02f,
+        5.028110838e-02f, -3.496883829e-02f, 2.428392018e-02f, -1.662023498e-02f,
+        1.109767303e-02f, -7.161844275e-03f, 4.421669765e-03f, -2.578656758e-03f,
+        1.395251817e-03f, -6.805225238e-04f, 2.832229747e-04f, -8.745730971e-05f,
+    },
+    {  // phase 50
+        -6.316658068e-05f, 2.285674097e-04f, -5.760694677e-04f, 1.215313889e-03f,
+        -2.290741257e-03f, 3.985755161e-03f, -6.528847422e-03f, 1.020579888e-02f,
+        -1.538648586e-02f, 2.258464953e-02f, -3.259391356e-02f, 4.681636453e-02f,
+        -6.815498931e-02f, 1.039772775e-01f, -1.801632456e-01f, 4.943362241e-01f,
+        7.611075693e-01f, -2.094571497e-01f, 1.150134976e-01f, -7.409629110e-02f,
+        5.057894768e-02f, -3.517785973e-02f, 2.442739454e-02f, -1.671582772e-02f,
+        1.115893784e-02f, -7.199189674e-03f, 4.442987306e-03f, -2.589776469e-03f,
+        1.400317326e-03f, -6.823274586e-04f, 2.835208943e-04f, -8.724260600e-05f,
+    },
+    {  // phase 51
+        -6.449518473e-05f, 2.323310703e-04f, -5.844886454e-04f, 1.231760393e-03f,
+        -2.320052563e-03f, 4.034588634e-03f, -6.606112272e-03f, 1.032326110e-02f,
+        -1.555976050e-02f, 2.283506080e-02f, -3.295236986e-02f, 4.733232387e-02f,
+        -6.892033589e-02f, 1.052058370e-01f, -1.825890157e-01f, 5.049486966e-01f,
+        7.523328946e-01f, -2.099150942e-01f, 1.155053486e-01f, -7.446570796e-02f,
+        5.084433533e-02f, -3.536428990e-02f, 2.455514376e-02f, -1.680062094e-02f,
+        1.121295981e-02f, -7.231835937e-03f, 4.461385131e-03f, -2.599180451e-03f,
+        1.404445843e-03f, -6.836699502e-04f, 2.836231731e-04f, -8.696578765e-05f,
+    },
+    {  // phase 52
+        -6.580389353e-05f, 2.359955432e-04f, -5.926316958e-04f, 1.247593717e-03f,
+        -2.348170389e-03f, 4.081298945e-03f, -6.679842715e-03f, 1.043513207e-02f,
+        -1.572453285e-02f, 2.307292340e-02f, -3.329267945e-02f, 4.782229206e-02f,
+        -6.964827623e-02f, 1.063791208e-01f, -1.849288805e-01f, 5.155342920e-01f,
+        7.434454468e-01f, -2.102407448e-01f, 1.159234280e-01f, -7.478761437e-02f,
+        5.107729636e-02f, -3.552814216e-02f, 2.466718015e-02f, -1.687462796e-02f,
+        1.125975274e-02f, -7.259796177e-03f, 4.476874697e-03f, -2.606877937e-03f,
+        1.407644221e-03f, -6.845546512e-04f, 2.835326459e-04f, -8.662834358e-05f,
+    },
+    {  // phase 53
+        -6.709109813e-05f, 2.395566008e-04f, -6.004896444e-04f, 1.262797048e-03f,
+        -2.375065812e-03f, 4.125839374e-03f, -6.749966811e-03f, 1.054130498e-02f,
+        -1.588064852e-02f, 2.329801769e-02f, -3.361453102e-02f, 4.828582182e-02f,
+        -7.033814019e-02f, 1.074960248e-01f, -1.871806002e-01f, 5.260894367e-01f,
+        7.344483880e-01f, -2.104354737e-01f, 1.162680525e-01f, -7.506211336e-02f,
+        5.127787522e-02f, -3.566944357e-02f, 2.476352558e-02f, -1.693786868e-02f,
+        1.129933482e-02f, -7.283086344e-03f, 4.489469209e-03f, -2.612879168e-03f,
+        1.409919855e-03f, -6.849864693e-04f, 2.832522463e-04f, -8.623178622e-05f,
+    },
+    {  // phase 54
+        -6.835517742e-05f, 2.430100292e-04f, -6.080536034e-04f, 1.277353814e-03f,
+        -2.400710437e-03f, 4.168164209e-03f, -6.816414380e-03f, 1.064167591e-02f,
+        -1.602795755e-02f, 2.351013064e-02f, -3.391762284e-02f, 4.872247944e-02f,
+        -7.098927639e-02f, 1.085554700e-01f, -1.893419584e-01f, 5.366105572e-01f,
+        7.253449140e-01f, -2.105007012e-01f, 1.165395784e-01f, -7.528933548e-02f,
+        5.144613564e-02f, -3.578823474e-02f, 2.484421143e-02f, -1.699036954e-02f,
+        1.133172861e-02f, -7.301725200e-03f, 4.499183595e-03f, -2.617195386e-03f,
+        1.411280665e-03f, -6.849705607e-04f, 2.827850028e-04f, -8.577764991e-05f,
+    },
+    {  // phase 55
+        -6.959449927e-05f, 2.463516309e-04f, -6.153147792e-04f, 1.291247703e-03f,
+        -2.425076429e-03f, 4.208228787e-03f, -6.879117054e-03f, 1.073614386e-02f,
+        -1.616631453e-02f, 2.370905599e-02f, -3.420166301e-02f, 4.913184505e-02f,
+        -7.160105272e-02f, 1.095564030e-01f, -1.914107633e-01f, 5.470940816e-01f,
+        7.161382532e-01f, -2.104378944e-01f, 1.167384009e-01f, -7.546943855e-02f,
+        5.158216049e-02f, -3.588456979e-02f, 2.490927847e-02f, -1.703216344e-02f,
+        1.135696097e-02f, -7.315734283e-03f, 4.506034491e-03f, -2.619838812e-03f,
+        1.411735095e-03f, -6.845123239e-04f, 2.821340352e-04f, -8.526748919e-05f,
+    },
+    {  // phase 56
+        -7.080742187e-05f, 2.495772287e-04f, -6.222644796e-04f, 1.304462672e-03f,
+        -2.448136525e-03f, 4.245989530e-03f, -6.938008336e-03f, 1.082461089e-02f,
+        -1.629557873e-02f, 2.389459445e-02f, -3.446636965e-02f, 4.951351304e-02f,
+        -7.217285683e-02f, 1.104977969e-01f, -1.933848485e-01f, 5.575364408e-01f,
+        7.068316653e-01f, -2.102485668e-01f, 1.168649542e-01f, -7.560260738e-02f,
+        5.168605162e-02f, -3.595851621e-02f, 2.495877686e-02f, -1.706328966e-02f,
+        1.137506305e-02f, -7.325137879e-03f, 4.510040211e-03f, -2.620822630e-03f,
+        1.411292092e-03f, -6.836173932e-04f, 2.813025516e-04f, -8.470287720e-05f,
+    },
+    {  // phase 57
+        -7.199229498e-05f, 2.526826689e-04f, -6.288941213e-04f, 1.316982964e-03f,
+        -2.469864068e-03f, 4.281403982e-03f, -6.993023655e-03f, 1.090698213e-02f,
+        -1.641561419e-02f, 2.406655383e-02f, -3.471147116e-02f, 4.986709229e-02f,
+        -7.270409658e-02f, 1.113786516e-01f, -1.952620744e-01f, 5.679340700e-01f,
+        6.974284392e-01f, -2.099342769e-01f, 1.169197102e-01f, -7.568905352e-02f,
+        5.175792973e-02f, -3.601015476e-02f, 2.499276599e-02f, -1.708379388e-02f,
+        1.138607023e-02f, -7.329962985e-03f, 4.511220724e-03f, -2.620160976e-03f,
+        1.409961104e-03f, -6.822916321e-04f, 2.802938443e-04f, -8.408540402e-05f,
+    },
+    {  // phase 58
+        -7.314746123e-05f, 2.556638251e-04f, -6.351952369e-04f, 1.328793117e-03f,
+        -2.490233020e-03f, 4.314430844e-03f, -7.044100420e-03f, 1.098316593e-02f,
+        -1.652628988e-02f, 2.422474920e-02f, -3.493670643e-02f, 5.019220657e-02f,
+        -7.319420056e-02f, 1.121979955e-01f, -1.970403297e-01f, 5.782834109e-01f,
+        6.879318924e-01f, -2.094966273e-01f, 1.169031785e-01f, -7.572901501e-02f,
+        5.179793411e-02f, -3.603957931e-02f, 2.501131445e-02f, -1.709372801e-02f,
+        1.139002205e-02f, -7.330239270e-03f, 4.509597629e-03f, -2.617868912e-03f,
+        1.407752063e-03f, -6.805411265e-04f, 2.791112864e-04f, -8.341667502e-05f,
+    },
+    {  // phase 59
+        -7.427125750e-05f, 2.585166011e-04f, -6.411594823e-04f, 1.339877983e-03f,
+        -2.509217991e-03f, 4.345030011e-03f, -7.091178076e-03f, 1.105307390e-02f,
+        -1.662747976e-02f, 2.436900307e-02f, -3.514182506e-02f, 5.048849479e-02f,
+        -7.364261851e-02f, 1.129548851e-01f, -1.987175319e-01f, 5.885809122e-01f,
+        6.783453692e-01f, -2.089372641e-01f, 1.168159057e-01f, -7.572275600e-02f,
+        5.180622254e-02f, -3.604689677e-02f, 2.501449987e-02f, -1.709315019e-02f,
+        1.138696219e-02f, -7.325999045e-03f, 4.505194129e-03f, -2.613962414e-03f,
+        1.404675375e-03f, -6.783721784e-04f, 2.777583282e-04f, -8.269830931e-05f,
+    },
+    {  // phase 60
+        -7.536201629e-05f, 2.612369350e-04f, -6.467786442e-04f, 1.350222739e-03f,
+        -2.526794261e-03f, 4.373162607e-03f, -7.134198155e-03f, 1.111662099e-02f,
+        -1.671906292e-02f, 2.449914553e-02f, -3.532658759e-02f, 5.075561135e-02f,
+        -7.404882179e-02f, 1.136484066e-01f, -2.002916290e-01f, 5.988230320e-01f,
+        6.686722391e-01f, -2.082578752e-01f, 1.166584750e-01f, -7.567056652e-02f,
+        5.178297104e-02f, -3.603222692e-02f, 2.500240891e-02f, -1.708212472e-02f,
+        1.137693840e-02f, -7.317277215e-03f, 4.498035002e-03f, -2.608458353e-03f,
+        1.400741912e-03f, -6.757912985e-04f, 2.762384939e-04f, -8.193193805e-05f,
+    },
+    {  // phase 61
+        -7.641806706e-05f, 2.638208026e-04f, -6.520446469e-04f, 1.359812896e-03f,
+        -2.542937798e-03f, 4.398791018e-03f, -7.173104327e-03f, 1.117372556e-02f,
+        -1.680092370e-02f, 2.461501439e-02f, -3.549076568e-02f, 5.099322641e-02f,
+        -7.441230382e-02f, 1.142776762e-01f, -2.017606003e-01f, 6.090062386e-01f,
+        6.589158956e-01f, -2.074601901e-01f, 1.164315054e-01f, -7.557276213e-02f,
+        5.172837367e-02f, -3.599570225e-02f, 2.497513706e-02f, -1.706072191e-02f,
+        1.136000244e-02f, -7.304111245e-03f, 4.488146574e-03f, -2.601374476e-03f,
+        1.395962994e-03f, -6.728051999e-04f, 2.745553775e-04f, -8.111920294e-05f,
+    },
+    {  // phase 62
+        -7.743773772e-05f, 2.662642206e-04f, -6.569495603e-04f, 1.368634321e-03f,
+        -2.557625284e-03f, 4.421878931e-03f, -7.207842457e-03f, 1.122430950e-02f,
+        -1.687295173e-02f, 2.471645534e-02f, -3.563414234e-02f, 5.120102616e-02f,
+        -7.473258049e-02f, 1.148418408e-01f, -2.031224577e-01f, 6.191270124e-01f,
+        6.490797547e-01f, -2.065459783e-01f, 1.161356511e-01f, -7.542968356e-02f,
+        5.164264235e-02f, -3.593746785e-02f, 2.493278860e-02f, -1.702901810e-02f,
+        1.133621004e-02f, -7.286541119e-03f, 4.475556691e-03f, -2.592729385e-03f,
+        1.390350382e-03f, -6.694207906e-04f, 2.727126395e-04f, -8.026175460e-05f,
+    },
+    {  // phase 63
+        -7.841935601e-05f, 2.685632508e-04f, -6.614856064e-04f, 1.376673242e-03f,
+        -2.570834134e-03f, 4.442391361e-03f, -7.238360648e-03f, 1.126829823e-02f,
+        -1.693504212e-02f, 2.480332207e-02f, -3.575651210e-02f, 5.137871316e-02f,
+        -7.500919064e-02f, 1.153400790e-01f, -2.043752469e-01f, 6.291818476e-01f,
+        6.391672532e-01f, -2.055170484e-01f, 1.157716013e-01f, -7.524169637e-02f,
+        5.152600655e-02f, -3.585768122e-02f, 2.487547645e-02f, -1.698709550e-02f,
+        1.130562082e-02f, -7.264609291e-03f, 4.460294689e-03f, -2.582542518e-03f,
+        1.383916264e-03f, -6.656451669e-04f, 2.707140031e-04f, -7.936125102e-05f,
+    },
+};
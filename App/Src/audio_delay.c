@@ -0,0 +1,52 @@
+// SPDX-License-Identifier: GPL-3.0-only
+// Copyright (c) 2026 Elia Chiarucci
+
+/*
+ * End-to-end output delay estimator (see audio_delay.h)
+ */
+
+#include "audio_delay.h"
+#include <string.h>
+
+void audio_delay_init(audio_delay_t *d, uint32_t sample_rate,
+                      uint16_t frame_bytes) {
+    memset(d, 0, sizeof(*d));
+    d->sample_rate = sample_rate;
+    d->frame_bytes = frame_bytes;
+}
+
+// 1/256 frame -> microseconds
+static uint32_t q8_to_us(const audio_delay_t *d, uint64_t q8) {
+    return (uint32_t)((q8 * 1000000U / 256U + d->sample_rate / 2) /
+                      d->sample_rate);
+}
+
+uint32_t audio_delay_packet(audio_delay_t *d, uint16_t fifo_bytes,
+                            uint16_t packet_bytes, uint32_t ring_q8) {
+    // The middle sample waits behind the bytes ahead of it in the FIFO,
+    // everything in the ring, then the fixed stages
+    uint32_t ahead = fifo_bytes > packet_bytes / 2
+                         ? fifo_bytes - packet_bytes / 2U
+                         : 0;
+    uint32_t q8 = (ahead << 8) / d->frame_bytes + ring_q8 +
+                  ((AUDIO_DELAY_DSP_FRAMES + AUDIO_DELAY_DAC_FRAMES) << 8);
+
+    if (d->count == 0 || q8 < d->min_q8)
+        d->min_q8 = q8;
+    if (d->count == 0 || q8 > d->max_q8)
+        d->max_q8 = q8;
+    d->sum_q8 += q8;
+    d->count++;
+
+    audio_delay_stats_t *s = &d->stats;
+    s->now_us = q8_to_us(d, q8);
+    if (d->count == AUDIO_DELAY_WINDOW) {
+        s->min_us = q8_to_us(d, d->min_q8);
+        s->max_us = q8_to_us(d, d->max_q8);
+        s->avg_us = q8_to_us(d, d->sum_q8 / AUDIO_DELAY_WINDOW);
+        s->windows++;
+        d->count = 0;
+        d->sum_q8 = 0;
+    }
+    return s->now_us;
+}
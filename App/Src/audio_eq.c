@@ -42,6 +42,29 @@ static inline int32_t mul_q12(int32_t a, int32_t b) {
 #define TREBLE_LP_ALPHA  817    // ~0.1995 * 4096 for ~1700Hz lowpass
 #define TREBLE_LP_BETA   3279   // 4096 - 817
 
+//--------------------------------------------------------------------+
+// Per-rate coefficients: the same corner frequencies at 96kHz,
+// alpha = 1 - exp(-2*pi*fc/fs)
+//--------------------------------------------------------------------+
+
+typedef struct {
+    int32_t bass_lp_alpha, bass_lp_beta;
+    int32_t bass_hp_alpha, bass_hp_beta;
+    int32_t treble_lp_alpha, treble_lp_beta;
+} eq_coeffs_t;
+
+static const eq_coeffs_t coeffs_48k = {
+    BASS_LP_ALPHA, BASS_LP_BETA,
+    BASS_HP_ALPHA, BASS_HP_BETA,
+    TREBLE_LP_ALPHA, TREBLE_LP_BETA,
+};
+
+static const eq_coeffs_t coeffs_96k = {
+    48, 4096 - 48,    // ~180Hz
+    14, 4096 - 14,    // ~52Hz (13.5 rounds up; Q12 is coarse this low)
+    431, 4096 - 431,  // ~1700Hz
+};
+
 // 24-bit signed range limits
 #define AUDIO_24BIT_MAX  8388607
 #define AUDIO_24BIT_MIN  (-8388608)
@@ -79,6 +102,7 @@ static const int16_t preatt_table[7] = {
 static int8_t bass_level = 0;
 static int8_t treble_level = 0;
 static bool eq_enabled = true;
+static const eq_coeffs_t *coeffs = &coeffs_48k;
 
 // Bass filter state: highpass (for sub-bass cut) + two-stage lowpass
 static int32_t bass_hp_lp_left = 0;   // Lowpass state for computing highpass
@@ -122,6 +146,17 @@ void audio_eq_set_band(uint8_t band, int8_t value) {
         treble_level = value;
 }
 
+bool audio_eq_set_rate(uint32_t rate) {
+    if (rate == 48000)
+        coeffs = &coeffs_48k;
+    else if (rate == 96000)
+        coeffs = &coeffs_96k;
+    else
+        return false;
+    audio_eq_reset_state();
+    return true;
+}
+
 int8_t audio_eq_get_band(uint8_t band) {
     if (band == EQ_BAND_BASS) return (int8_t)bass_level;
     if (band == EQ_BAND_TREBLE) return (int8_t)treble_level;
@@ -179,6 +214,13 @@ void audio_eq_process(int32_t *buffer, uint16_t sample_count, uint32_t volume_sc
     if (max_boost < 0) max_boost = 0;
     int32_t preatt = preatt_table[max_boost];
 
+    const int32_t hp_alpha = coeffs->bass_hp_alpha;
+    const int32_t hp_beta = coeffs->bass_hp_beta;
+    const int32_t lp_alpha = coeffs->bass_lp_alpha;
+    const int32_t lp_beta = coeffs->bass_lp_beta;
+    const int32_t tr_alpha = coeffs->treble_lp_alpha;
+    const int32_t tr_beta = coeffs->treble_lp_beta;
+
     // Process stereo interleaved: L, R, L, R, ...
     // All filter math at full 24-bit precision using split-multiply
     for (uint16_t i = 0; i < sample_count; i += 2) {
@@ -194,17 +236,17 @@ void audio_eq_process(int32_t *buffer, uint16_t sample_count, uint32_t volume_sc
 
             // Highpass at ~50Hz: removes sub-bass rumble, keeps punch
             // hp = in - lp, where lp tracks the sub-bass
-            bass_hp_lp_left = mul_q12(in_l, BASS_HP_ALPHA) + mul_q12(bass_hp_lp_left, BASS_HP_BETA);
-            bass_hp_lp_right = mul_q12(in_r, BASS_HP_ALPHA) + mul_q12(bass_hp_lp_right, BASS_HP_BETA);
+            bass_hp_lp_left = mul_q12(in_l, hp_alpha) + mul_q12(bass_hp_lp_left, hp_beta);
+            bass_hp_lp_right = mul_q12(in_r, hp_alpha) + mul_q12(bass_hp_lp_right, hp_beta);
             int32_t hp_l = in_l - bass_hp_lp_left;
             int32_t hp_r = in_r - bass_hp_lp_right;
 
             // Two-stage lowpass at ~180Hz on the highpassed signal
             // This isolates the 50-180Hz "thump" band
-            lp1_left = mul_q12(hp_l, BASS_LP_ALPHA) + mul_q12(lp1_left, BASS_LP_BETA);
-            lp1_right = mul_q12(hp_r, BASS_LP_ALPHA) + mul_q12(lp1_right, BASS_LP_BETA);
-            lp2_left = mul_q12(lp1_left, BASS_LP_ALPHA) + mul_q12(lp2_left, BASS_LP_BETA);
-            lp2_right = mul_q12(lp1_right, BASS_LP_ALPHA) + mul_q12(lp2_right, BASS_LP_BETA);
+            lp1_left = mul_q12(hp_l, lp_alpha) + mul_q12(lp1_left, lp_beta);
+            lp1_right = mul_q12(hp_r, lp_alpha) + mul_q12(lp1_right, lp_beta);
+            lp2_left = mul_q12(lp1_left, lp_alpha) + mul_q12(lp2_left, lp_beta);
+            lp2_right = mul_q12(lp1_right, lp_alpha) + mul_q12(lp2_right, lp_beta);
 
             // Boost (positive) or cut (negative): out = in ± gain * bandpassed
             int32_t bl = mul_q12(lp2_left, bass_gain);
@@ -224,8 +266,8 @@ void audio_eq_process(int32_t *buffer, uint16_t sample_count, uint32_t volume_sc
             int32_t in_r = out_r;
 
             // First-order lowpass (to subtract for highpass)
-            treble_lp_left = mul_q12(in_l, TREBLE_LP_ALPHA) + mul_q12(treble_lp_left, TREBLE_LP_BETA);
-            treble_lp_right = mul_q12(in_r, TREBLE_LP_ALPHA) + mul_q12(treble_lp_right, TREBLE_LP_BETA);
+            treble_lp_left = mul_q12(in_l, tr_alpha) + mul_q12(treble_lp_left, tr_beta);
+            treble_lp_right = mul_q12(in_r, tr_alpha) + mul_q12(treble_lp_right, tr_beta);
 
             // Highpass = input - lowpass
             int32_t hp_l = in_l - treble_lp_left;
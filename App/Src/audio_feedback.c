@@ -0,0 +1,180 @@
+// SPDX-License-Identifier: GPL-3.0-only
+// Copyright (c) 2026 Elia Chiarucci
+
+/*
+ * Explicit feedback from the measured I2S clock (see audio_feedback.h)
+ */
+
+#include "audio_feedback.h"
+#include <string.h>
+
+// Full-speed frame numbers are 11 bits; the stride divides the wrap
+#define FRAME_MASK 0x7FFU
+_Static_assert((FRAME_MASK + 1) % AUDIO_FB_STRIDE_MS == 0,
+               "stride must divide the frame number wrap");
+
+void audio_feedback_init(audio_feedback_t *fb, uint32_t sample_rate,
+                         uint16_t fifo_target) {
+    memset(fb, 0, sizeof(*fb));
+    // Same nominal and limits as TinyUSB's FIFO_COUNT setup
+    fb->nominal = ((sample_rate / 100) << 16) / 10;
+    fb->min = ((sample_rate - 1) / 1000) << 16;
+    fb->max = (sample_rate / 1000 + 1) << 16;
+    fb->trim_max = (int32_t)((uint64_t)fb->nominal * AUDIO_FB_TRIM_MAX /
+                             (48U << 16));
+    fb->sample_rate = sample_rate;
+    fb->clock_rate = sample_rate;
+    fb->frame_bytes = AUDIO_FB_FRAME_BYTES;
+    // Level starts on target, so there is no trim while the output
+    // prebuffers up to it
+    fb->level_q8 = (uint32_t)fifo_target << 8;
+    fb->stats.rate = fb->nominal;
+    fb->stats.value = fb->nominal;
+    fb->stats.level = fifo_target;
+    fb->stats.target = fifo_target;
+}
+
+void audio_feedback_set_clock_rate(audio_feedback_t *fb, uint32_t clock_rate) {
+    fb->clock_rate = clock_rate;
+    fb->count = 0;
+    fb->head = 0;
+    fb->stable = 0;
+}
+
+void audio_feedback_set_frame_bytes(audio_feedback_t *fb, uint8_t frame_bytes) {
+    fb->frame_bytes = frame_bytes;
+}
+
+void audio_feedback_packet(audio_feedback_t *fb, uint16_t fifo_level) {
+    // Low-pass over 64 packets, as FIFO_COUNT averages
+    fb->level_q8 = fb->level_q8 - (fb->level_q8 >> 6) +
+                   ((uint32_t)fifo_level << (8 - 6));
+}
+
+// Drop the window: the next sample starts a new one. The value holds.
+static void restart_window(audio_feedback_t *fb) {
+    if (fb->count)
+        fb->stats.resyncs++;
+    fb->count = 0;
+    fb->head = 0;
+    fb->stable = 0;
+    if (fb->stats.state == AUDIO_FB_LOCKED)
+        fb->stats.state = AUDIO_FB_MEASURING;
+}
+
+// Frames per USB frame over the window plus the new sample, 16.16: the
+// least-squares slope through all of them. The DMA position only reads to
+// half a frame; a fit through every sample resolves the rate about ten
+// times better than the two end points would.
+static uint32_t measure_rate(const audio_feedback_t *fb, uint32_t clock) {
+    uint32_t n = (uint32_t)fb->count + 1;
+    uint8_t oldest = (uint8_t)((fb->head + AUDIO_FB_HISTORY - fb->count) %
+                               AUDIO_FB_HISTORY);
+    uint32_t base = fb->clock[oldest];
+
+    // With d = 2i - (n - 1) centred on the window, slope = 2 sum(d y) /
+    // sum(d^2) per stride; y relative to the oldest sample, so the wrap of
+    // the counter cancels
+    int64_t sum_dy = 0;
+    for (uint32_t i = 0; i < n; i++) {
+        uint32_t y = i + 1 < n ? fb->clock[(oldest + i) % AUDIO_FB_HISTORY]
+                               : clock;
+        sum_dy += (int64_t)(2 * (int32_t)i - (int32_t)(n - 1)) * (y - base);
+    }
+    int64_t sum_dd = (int64_t)n * (n * n - 1) / 3;
+
+    // 1/256 clock frame per stride -> 16.16 stream frames per ms. Within
+    // int64: sum_dy < 2^35 at 96kHz over a full window
+    int64_t num = (2 * sum_dy << (16 - AUDIO_FB_CLOCK_SHIFT)) *
+                  fb->sample_rate;
+    int64_t den = sum_dd * AUDIO_FB_STRIDE_MS * fb->clock_rate;
+    return (uint32_t)((num + den / 2) / den);
+}
+
+// Proportional trim toward the FIFO target, 16.16
+static int32_t fifo_trim(const audio_feedback_t *fb) {
+    int32_t err_q8 = ((int32_t)fb->stats.target << 8) - (int32_t)fb->level_q8;
+    int32_t trim = err_q8 * (AUDIO_FB_TRIM_GAIN * AUDIO_FB_FRAME_BYTES) /
+                   (256 * fb->frame_bytes);
+    if (trim > fb->trim_max)
+        trim = fb->trim_max;
+    if (trim < -fb->trim_max)
+        trim = -fb->trim_max;
+    return trim;
+}
+
+// New value from the rate (measured, or held while the window is short)
+static void update_value(audio_feedback_t *fb, uint32_t rate, bool measured) {
+    audio_fb_stats_t *s = &fb->stats;
+    uint32_t prev_rate = s->rate;
+    uint32_t prev_value = s->value;
+
+    s->rate = rate;
+    s->level = (uint16_t)(fb->level_q8 >> 8);
+    s->trim = fifo_trim(fb);
+
+    int64_t v = (int64_t)rate + s->trim;
+    if (v > (int64_t)fb->max)
+        v = fb->max;
+    if (v < (int64_t)fb->min)
+        v = fb->min;
+    s->value = (uint32_t)v;
+
+    uint32_t moved = rate > prev_rate ? rate - prev_rate : prev_rate - rate;
+    if (s->state == AUDIO_FB_LOCKED) {
+        uint32_t step = s->value > prev_value ? s->value - prev_value
+                                              : prev_value - s->value;
+        if (step > s->step_max)
+            s->step_max = step;
+        if (rate < s->rate_min)
+            s->rate_min = rate;
+        if (rate > s->rate_max)
+            s->rate_max = rate;
+        return;
+    }
+    if (!measured)
+        return;
+
+    fb->stable = moved <= AUDIO_FB_LOCK_TOL ? fb->stable + 1 : 0;
+    if (fb->stable >= AUDIO_FB_LOCK_UPDATES) {
+        s->state = AUDIO_FB_LOCKED;
+        if (!s->lock_ms)
+            s->lock_ms = fb->sofs;
+        s->rate_min = rate;
+        s->rate_max = rate;
+    }
+}
+
+bool audio_feedback_sof(audio_feedback_t *fb, uint32_t frame_number,
+                        uint32_t clock, uint8_t epoch) {
+    fb->sofs++;
+    frame_number &= FRAME_MASK;
+    if (frame_number % AUDIO_FB_STRIDE_MS)
+        return false;
+
+    // A missed sample or a jump of the clock breaks the window
+    if (fb->count && (epoch != fb->epoch ||
+                      frame_number != ((fb->last_frame + AUDIO_FB_STRIDE_MS) &
+                                       FRAME_MASK)))
+        restart_window(fb);
+    if (fb->stats.state == AUDIO_FB_IDLE)
+        fb->stats.state = AUDIO_FB_MEASURING;
+
+    uint32_t prev_value = fb->stats.value;
+    if (fb->count >= AUDIO_FB_MIN_SAMPLES)
+        update_value(fb, measure_rate(fb, clock), true);
+    else
+        update_value(fb, fb->stats.rate, false);
+
+    fb->clock[fb->head] = clock;
+    fb->head = (uint8_t)((fb->head + 1) % AUDIO_FB_HISTORY);
+    if (fb->count < AUDIO_FB_HISTORY - 1)
+        fb->count++;
+    fb->epoch = epoch;
+    fb->last_frame = frame_number;
+    return fb->stats.value != prev_value;
+}
+
+uint32_t audio_feedback_value(const audio_feedback_t *fb) {
+    return fb->stats.value;
+}
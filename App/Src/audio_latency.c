@@ -0,0 +1,70 @@
+// SPDX-License-Identifier: GPL-3.0-only
+// Copyright (c) 2026 Elia Chiarucci
+
+/*
+ * Audio latency profiles (see audio_latency.h)
+ */
+
+#include "audio_latency.h"
+#include "audio_resample.h"
+#include <stddef.h>
+
+// Sized with the simulation in tests/test_audio_latency.c, which runs the
+// firmware's feedback. A FIFO target (whole frames) must cover two periods
+// plus the jitter, since a late packet lets two refills run back to back,
+// and stay far enough below the 16-packet (4704 byte) FIFO to take a burst
+// of late packets arriving together. With the measured-clock feedback the
+// level no longer sags with the clock offset, which took 16 frames off the
+// 1ms-period targets.
+static const audio_latency_preset_t presets[AUDIO_LATENCY_COUNT] = {
+    [AUDIO_LATENCY_LOW] = {"low", 48, 2, 576, 250},
+    [AUDIO_LATENCY_BALANCED] = {"balanced", 48, 3, 768, 1000},
+    [AUDIO_LATENCY_STANDARD] = {"standard", 96, 2, 2352, 3000},
+    [AUDIO_LATENCY_ROBUST] = {"robust", 96, 3, 2880, 6000},
+};
+
+const audio_latency_preset_t *audio_latency_preset(uint8_t id) {
+    return id < AUDIO_LATENCY_COUNT ? &presets[id] : NULL;
+}
+
+uint32_t audio_latency_i2s_rate(uint32_t rate) {
+    uint32_t i2s = rate;
+    if (rate % AUDIO_LATENCY_RATE) {
+        if (rate % AUDIO_RESAMPLE_STEP)
+            return 0;
+        i2s = rate / AUDIO_RESAMPLE_STEP * AUDIO_RESAMPLE_PHASES;
+    }
+    if (i2s < AUDIO_LATENCY_RATE || i2s > AUDIO_LATENCY_MAX_RATE ||
+        i2s % AUDIO_LATENCY_RATE)
+        return 0;
+    return i2s;
+}
+
+bool audio_latency_at_rate(const audio_latency_preset_t *p, uint32_t rate,
+                           audio_latency_preset_t *out) {
+    uint32_t i2s = audio_latency_i2s_rate(rate);
+    if (!i2s)
+        return false;
+    // FIFO target in whole stream frames, rounded
+    uint32_t frames = p->fifo_target / AUDIO_LATENCY_FRAME_BYTES;
+    frames = (frames * rate + AUDIO_LATENCY_RATE / 2) / AUDIO_LATENCY_RATE;
+    *out = *p;
+    out->period_frames =
+        (uint16_t)(p->period_frames * (i2s / AUDIO_LATENCY_RATE));
+    out->fifo_target = (uint16_t)(frames * AUDIO_LATENCY_FRAME_BYTES);
+    return true;
+}
+
+uint32_t audio_latency_period_us(const audio_latency_preset_t *p) {
+    return (uint32_t)p->period_frames * 1000000U / AUDIO_LATENCY_RATE;
+}
+
+uint32_t audio_latency_total_us(const audio_latency_preset_t *p) {
+    // The feedback regulates the level seen right after each packet lands;
+    // averaged over time the FIFO holds half a packet less
+    uint32_t fifo_frames = p->fifo_target / AUDIO_LATENCY_FRAME_BYTES -
+                           AUDIO_LATENCY_PACKET_FRAMES / 2;
+    uint32_t fifo_us = fifo_frames * 1000000U / AUDIO_LATENCY_RATE;
+    uint32_t period_us = audio_latency_period_us(p);
+    return fifo_us + p->periods * period_us - period_us / 2;
+}
@@ -10,17 +10,27 @@
 #include "audio_output.h"
 #include "SEGGER_RTT.h"
 #include "app.h"
+#include "audio_asrc.h"
 #include "audio_eq.h"
+#include "audio_latency.h"
+#include "audio_pcm.h"
+#include "audio_resample.h"
+#include "audio_stats.h"
+#include "audio_unpack.h"
+#include "deadline.h"
 #include "eq_profile.h"
 #include "main.h"
+#include "perf.h"
+#include "sched.h"
 #include "sh1106.h"
 #include "stm32h5xx_hal.h"
+#include "trace.h"
 #include "tusb.h"
 #include "usb_audio.h"
 #include <string.h>
 
 
-// Debug: set to 1 to enable RTT logging
+// Debug: set to 1 for a periodic RTT report of the telemetry
 #define AUDIO_DEBUG 0
 
 // Swap L/R channels (Necessary for DA15)
@@ -30,6 +40,13 @@
 #define SWAP_CHANNELS 0
 #endif
 
+// GPDMA passthrough unpack (CMake option DMA_UNPACK): when no DSP is
+// active, full halves are expanded 24 -> 32-bit by a memory-to-memory GPDMA
+// transfer and the CPU never touches the samples
+#ifndef DMA_UNPACK
+#define DMA_UNPACK 0
+#endif
+
 // External I2S handle from main.c
 extern I2S_HandleTypeDef hi2s1;
 
@@ -37,59 +54,97 @@ extern I2S_HandleTypeDef hi2s1;
 // Configuration
 //--------------------------------------------------------------------+
 
-// Audio format: 48kHz, 24-bit stereo in 32-bit I2S frames
+// Audio format: 48 or 96kHz, 24-bit stereo in 32-bit I2S frames; 44.1 and
+// 88.2kHz streams are resampled to them (audio_resample.h)
 // USB: 3 bytes per sample (packed 24-bit)
 // I2S: 32-bit frames = 2 x uint16_t per channel
-// Small halves keep the FIFO drain granularity fine-grained, so the FIFO
-// level never swings far below the feedback target (low latency + robust).
-// The main loop must run at least once per half period (2ms).
-#define STEREO_FRAMES_PER_HALF 96 // 2ms at 48kHz
-
-// I2S DMA buffer: 4 uint16_t per stereo frame (2 per channel in 32-bit mode)
-#define I2S_HALFWORDS_PER_HALF (STEREO_FRAMES_PER_HALF * 4) // 384
-#define I2S_HALFWORDS_TOTAL (I2S_HALFWORDS_PER_HALF * 2)    // 768
-
-// HAL_I2S_Transmit_DMA Size parameter: number of "data samples"
-// For 24-bit, HAL internally doubles this for DMA transfers
-#define I2S_DMA_SIZE (STEREO_FRAMES_PER_HALF * 2 * 2) // 384
-
-// USB bytes per half: 96 frames x 2 channels x 3 bytes = 576
-#define USB_BYTES_PER_HALF (STEREO_FRAMES_PER_HALF * 2 * 3) // 576
-
-// Mono samples per half (L + R)
-#define MONO_SAMPLES_PER_HALF (STEREO_FRAMES_PER_HALF * 2) // 192
-
-// Pre-buffer threshold: wait until the FIFO holds the level the feedback
-// endpoint regulates to (half the EP OUT software buffer, ~8ms — see
-// tud_audio_feedback_params_cb) before consuming, so there is no slow
-// post-start drift from the start level down to the feedback target.
-#define PREBUFFER_THRESHOLD (CFG_TUD_AUDIO_FUNC_1_EP_OUT_SW_BUF_SZ / 2)
-
-// PCM5102A anti-pop: 1 LSB DC offset prevents the DAC's Zero Data Detect
-// from engaging analog mute during silence. Inaudible (AC-coupled output).
-// 24-bit sample value 1, left-justified in 32-bit I2S word = 0x00000100.
-#define SILENCE_DC_OFFSET 1
+// The I2S DMA plays a ring of periods whose size and count come from the
+// latency profile (audio_latency.h). Each period is refilled by the audio
+// stage (PendSV, see below) as soon as the DMA has played it, and the fill
+// must finish within one period whatever the main loop is doing.
+
+// I2S DMA buffer: 4 uint16_t per stereo frame (2 per channel in 32-bit mode),
+// for the longest ring at the highest rate the build streams
+#define I2S_HALFWORDS_PER_FRAME 4
+#define I2S_BYTES_PER_FRAME 8
+#define I2S_RING_FRAMES                                                       \
+  (AUDIO_LATENCY_MAX_RING_FRAMES *                                            \
+   (CFG_TUD_AUDIO_FUNC_1_MAX_SAMPLE_RATE_FS / AUDIO_LATENCY_RATE))
+#define I2S_HALFWORDS_TOTAL (I2S_RING_FRAMES * I2S_HALFWORDS_PER_FRAME) // 2304 at 96kHz
+
+_Static_assert(CFG_TUD_AUDIO_FUNC_1_MAX_SAMPLE_RATE_FS % AUDIO_LATENCY_RATE == 0,
+               "the ring scales the presets by a whole factor");
+
+
+_Static_assert(I2S_AUDIOFREQ_48K == AUDIO_LATENCY_RATE,
+               "main.c starts the I2S at the presets' rate");
+
+// PCM5102A anti-pop DC offset (audio_pcm.h), left-justified in the I2S word
+#define SILENCE_DC_OFFSET AUDIO_PCM_DC_OFFSET
 #define SILENCE_I2S_WORD  ((uint32_t)SILENCE_DC_OFFSET << 8)
 
 //--------------------------------------------------------------------+
 // State
 //--------------------------------------------------------------------+
 
-// I2S DMA buffer (double buffer for circular DMA)
+// I2S DMA buffer, sized for the longest ring; the active profile uses the
+// first periods x period_frames frames of it
 // 24-bit in 32-bit frames: each stereo frame = 4 uint16_t
 static uint16_t i2s_buffer[I2S_HALFWORDS_TOTAL] __attribute__((aligned(4)));
 
-// Temporary buffer for reading packed 24-bit USB data
-static uint8_t usb_read_buf[USB_BYTES_PER_HALF];
-
 // Streaming state
 static volatile uint8_t streaming = 0;
 static volatile uint8_t dma_running = 0;
 static volatile uint8_t prebuffering = 0;
 
-// Buffer fill tracking
-static volatile uint8_t first_half_needs_fill = 0;
-static volatile uint8_t second_half_needs_fill = 0;
+// Latency profile: the one the ring runs, and the one last requested (they
+// differ until the audio stage can switch, see ring_switch)
+static uint8_t ring_id = AUDIO_LATENCY_DEFAULT;
+static volatile uint8_t ring_request = AUDIO_LATENCY_DEFAULT;
+
+// I2S and stream sample rates, and the ring's profile scaled to them (same
+// times, audio_latency_at_rate). The USB interrupt reads the layout: it
+// only changes with interrupts off.
+static uint32_t i2s_rate = AUDIO_LATENCY_RATE;
+static uint32_t stream_rate = AUDIO_LATENCY_RATE;
+static audio_latency_preset_t ring_cfg;
+static const audio_latency_preset_t *const ring = &ring_cfg;
+
+// 44.1kHz family stream: converted to the I2S rate as it is read
+static uint8_t resampling = 0;
+static audio_resample_t resampler;
+
+#if AUDIO_OUTPUT_ASRC
+// Converter for hosts that ignore feedback (audio_asrc.h): the monitor in
+// the USB interrupt sets the verdict, the audio stage follows it at the
+// next period. Between engagements the direct path primes its history.
+static volatile uint8_t asrc_engaged = 0;
+static volatile int32_t asrc_ppm_q8 = 0;
+static uint8_t asrc_running = 0;
+static audio_asrc_t asrc;
+// Inputs a fill takes beyond its own frames, which don't fit the period
+static int32_t asrc_spill[2 * AUDIO_ASRC_EXTRA_FRAMES];
+#endif
+
+// A fill ran short of audio since the USB interrupt last asked
+static volatile uint8_t ran_short = 0;
+
+// USB bytes per stereo frame: 2 channels x 3 bytes, or x 2 on the 16-bit
+// alternate setting
+static uint8_t usb_frame_bytes = AUDIO_LATENCY_FRAME_BYTES;
+
+// Ring fill tracking: the DMA IRQ counts played periods, the audio stage
+// refills them in ring order
+static volatile uint32_t periods_played = 0;
+static uint32_t periods_seen = 0;
+static uint8_t fill_index = 0;   // next period to refill
+static uint8_t skip_periods = 0; // played periods of a replaced layout
+static volatile uint8_t ring_error = 0;
+static volatile uint8_t filling = 0; // audio stage part-way through refills
+
+// Moves on whenever the played-frame count jumps (ring restart or layout
+// switch), so the feedback measurement drops its window
+static volatile uint8_t clock_epoch = 0;
 
 // Last sample for smooth underrun handling (prevents clicks)
 // 24-bit signed values stored in int32_t
@@ -104,34 +159,64 @@ static uint8_t usb_muted = 0;
 // Volume ramping: smooths transitions to prevent clicks
 static uint32_t prev_volume_scale = 0;
 
+#if DMA_UNPACK
+// Last DMA-unpacked period ended in digital zero (see unpack_dma_finish)
+static uint8_t passthrough_zero_tail = 0;
+#endif
+
+#if USB_AUDIO_LOOPBACK
+// Loopback capture, opened by the host (usb_audio.c): the audio stage sends
+// each played period before refilling it, dropping the frames the capture
+// FIFO has no room for (the host stopped reading)
+static volatile uint8_t capturing = 0;
+static volatile uint32_t capture_dropped = 0;
+static uint32_t capture_reported = 0; // main loop's
+#endif
+
+// Everything above except the volume inputs is owned by the audio stage once
+// the I2S DMA runs: thread-mode writers go through audio_output_lock().
+// The volume inputs are single bytes, read once per period.
+
+// Telemetry (audio_stats.h): written by the audio stage, and by stream
+// start/stop while they hold it off
+static audio_stats_t stats;
+static uint32_t stats_reset_tick = 0;
+
 #if AUDIO_DEBUG
-// Debug counters
-static volatile uint32_t underrun_count = 0;
-static volatile uint32_t partial_fill_count = 0;
-static volatile uint32_t full_fill_count = 0;
-static volatile uint32_t last_report_tick = 0;
-
-// FIFO level tracking (sampled at each DMA half-complete)
-static volatile int16_t fifo_min_delta = 0;   // min deviation from midpoint
-static volatile int16_t fifo_max_delta = 0;   // max deviation from midpoint
-static volatile int32_t fifo_sum_delta = 0;    // sum for averaging
-static volatile uint16_t fifo_sample_count = 0; // number of samples
-#define FIFO_MIDPOINT PREBUFFER_THRESHOLD // == feedback regulation target
-
-static void fifo_track_level(void) {
-  int16_t delta = (int16_t)usb_audio_available() - (int16_t)FIFO_MIDPOINT;
-  if (fifo_sample_count == 0) {
-    fifo_min_delta = delta;
-    fifo_max_delta = delta;
-  } else {
-    if (delta < fifo_min_delta) fifo_min_delta = delta;
-    if (delta > fifo_max_delta) fifo_max_delta = delta;
-  }
-  fifo_sum_delta += delta;
-  fifo_sample_count++;
-}
+static uint32_t last_report_tick = 0;
 #endif
 
+// Deadline misses already reported over RTT (deadline.h)
+static uint32_t misses_reported = 0;
+
+//--------------------------------------------------------------------+
+// Audio stage (PendSV)
+//--------------------------------------------------------------------+
+
+// Bound for the busy-waits on DMA hardware (2ms), in DWT cycles (enabled in
+// app_init): they can run in the audio stage, where SysTick doesn't advance
+#define SPIN_TIMEOUT_CYCLES() (SystemCoreClock / 500U)
+
+// BASEPRI value that masks the audio stage and everything below it
+#define AUDIO_STAGE_BASEPRI                                                   \
+  ((uint32_t)AUDIO_OUTPUT_IRQ_PRIORITY << (8U - __NVIC_PRIO_BITS))
+
+uint32_t audio_output_lock(void) {
+  uint32_t key = __get_BASEPRI();
+  __set_BASEPRI_MAX(AUDIO_STAGE_BASEPRI); // only ever raises the mask
+  return key;
+}
+
+void audio_output_unlock(uint32_t key) {
+  __set_BASEPRI(key); // a pended period fill runs right here
+}
+
+// Request the audio stage. Called from the I2S DMA IRQ (priority 0), so the
+// fill itself never delays the next DMA or USB interrupt.
+static inline void audio_stage_pend(void) {
+  SCB->ICSR = SCB_ICSR_PENDSVSET_Msk;
+}
+
 //--------------------------------------------------------------------+
 // Hardware Control
 //--------------------------------------------------------------------+
@@ -255,66 +340,150 @@ static uint32_t get_volume_scale(void) {
   return scale;
 }
 
-// Read packed 24-bit USB audio data, process EQ+volume, write to I2S buffer
-// Returns number of stereo frames written
-static uint16_t read_audio_data(uint16_t *i2s_dest,
-                                uint16_t usb_bytes_to_read) {
-  uint16_t bytes_read = usb_audio_read(usb_read_buf, usb_bytes_to_read);
-  if (bytes_read < 6)
-    return 0; // Need at least one stereo frame (6 bytes)
+// FIFO bytes that make frames I2S-rate frames before the converter
+static uint16_t input_bytes(uint16_t frames) {
+  if (resampling)
+    frames = audio_resample_needed(&resampler, frames);
+  return frames * usb_frame_bytes;
+}
+
+// FIFO bytes a fill of frames I2S frames takes
+static uint16_t stream_bytes(uint16_t frames) {
+#if AUDIO_OUTPUT_ASRC
+  if (asrc_running)
+    frames = audio_asrc_needed(&asrc, frames);
+#endif
+  return input_bytes(frames);
+}
+
+// Unpack (and resample) up to frames I2S-rate frames from the FIFO into out
+// (fewer if the FIFO runs short), as 24-bit samples in int32_t
+static uint16_t read_input(int32_t *out, uint16_t frames) {
+  usb_audio_regions_t rgn;
+  uint16_t bytes_mapped = usb_audio_peek(&rgn, input_bytes(frames));
+
+  // Whole frames only: a trailing partial frame stays in the FIFO so the
+  // L/R byte alignment of the stream is never lost
+  uint16_t in_frames = bytes_mapped / usb_frame_bytes;
+  if (resampling) {
+    if (frames > audio_resample_possible(&resampler, in_frames))
+      frames = audio_resample_possible(&resampler, in_frames);
+    in_frames = audio_resample_needed(&resampler, frames);
+  } else {
+    frames = in_frames;
+  }
+  if (frames == 0)
+    return 0;
+
+  // Unpack from the FIFO in place, then release the FIFO bytes at once so
+  // the ISR gets the room back before the DSP runs. Resampled: into the
+  // tail, which the resampler reads ahead of its output.
+  int32_t *in = &out[2 * (frames - in_frames)];
+  PERF_BEGIN(PERF_UNPACK);
+  if (usb_frame_bytes == AUDIO_UNPACK_FRAME_BYTES_S16)
+    audio_unpack_s16_regions(&rgn, in, in_frames * 2);
+  else
+    audio_unpack_s24_regions(&rgn, in, in_frames * 2);
+  usb_audio_consume(in_frames * usb_frame_bytes);
+  PERF_END(PERF_UNPACK);
+
+  if (resampling) {
+    PERF_BEGIN(PERF_RESAMPLE);
+    audio_resample_process(&resampler, in, out, frames);
+    PERF_END(PERF_RESAMPLE);
+  }
+  return frames;
+}
 
-  uint16_t stereo_frames = bytes_read / 6;
-  uint16_t sample_count = stereo_frames * 2; // Mono samples (L + R)
+#if AUDIO_OUTPUT_ASRC
+// Converted: up to frames output frames from the inputs the FIFO holds
+static uint16_t read_converted(int32_t *proc, uint16_t frames) {
+  uint16_t in_frames = usb_audio_available() / usb_frame_bytes;
+  if (resampling)
+    in_frames = audio_resample_possible(&resampler, in_frames);
+  if (frames > audio_asrc_possible(&asrc, in_frames))
+    frames = audio_asrc_possible(&asrc, in_frames);
+  if (frames == 0)
+    return 0;
 
-  // Unpack 24-bit little-endian to int32_t (sign-extended)
-  // Uses the I2S destination as scratch space (int32_t overlay, same size)
+  // The inputs go into the tail when they fit, as for the resampler; when
+  // there are more (the ratio above 1) the rest spill over
+  uint16_t need = audio_asrc_needed(&asrc, frames);
+  int32_t *in = proc;
+  uint16_t spill = 0;
+  if (need <= frames) {
+    in = &proc[2 * (frames - need)];
+    read_input(in, need);
+  } else {
+    spill = need - frames;
+    read_input(proc, frames);
+    read_input(asrc_spill, spill);
+  }
+  PERF_BEGIN(PERF_ASRC);
+  audio_asrc_process(&asrc, in, need - spill, asrc_spill, proc, frames);
+  PERF_END(PERF_ASRC);
+  return frames;
+}
+
+// Follow the monitor's verdict: the latest ratio once per period, and take
+// over from the direct path's last frames at a fill the FIFO covers (the
+// first takes the filter's lookahead on top)
+static void asrc_update(uint16_t available, uint16_t frames) {
+  if (!asrc_engaged) {
+    asrc_running = 0;
+    return;
+  }
+  audio_asrc_set_ppm(&asrc, asrc_ppm_q8);
+  if (!asrc_running) {
+    audio_asrc_start(&asrc);
+    asrc_running = available >= input_bytes(audio_asrc_needed(&asrc, frames));
+  }
+}
+#endif
+
+// Read packed 24 or 16-bit USB audio data, process EQ+volume, write up to frames
+// stereo frames to the I2S buffer (fewer if the FIFO runs short)
+// Returns number of stereo frames written
+static uint16_t read_audio_data(uint16_t *i2s_dest, uint16_t frames) {
+  // The I2S destination is the scratch space (int32_t overlay, same size)
   int32_t *proc = (int32_t *)i2s_dest;
-  for (uint16_t i = 0; i < sample_count; i++) {
-    uint8_t *src = &usb_read_buf[i * 3];
-    uint32_t raw = src[0] | ((uint32_t)src[1] << 8) | ((uint32_t)src[2] << 16);
-    // Sign-extend from 24-bit
-    if (raw & 0x800000)
-      raw |= 0xFF000000;
-    proc[i] = (int32_t)raw;
+#if AUDIO_OUTPUT_ASRC
+  if (asrc_running) {
+    frames = read_converted(proc, frames);
+  } else {
+    frames = read_input(proc, frames);
+    audio_asrc_prime(&asrc, proc, frames);
   }
+#else
+  frames = read_input(proc, frames);
+#endif
+  if (frames == 0)
+    return 0;
+  uint16_t sample_count = frames * 2; // Mono samples (L + R)
 
 #if SWAP_CHANNELS
   // Swap L/R channels
-  for (uint16_t i = 0; i < sample_count; i += 2) {
-    int32_t tmp = proc[i];
-    proc[i] = proc[i + 1];
-    proc[i + 1] = tmp;
-  }
+  PERF_BEGIN(PERF_SWAP);
+  audio_pcm_swap(proc, sample_count);
+  PERF_END(PERF_SWAP);
 #endif
 
   // EQ processing (operates on 24-bit values in int32_t)
   // Volume is applied separately below with per-sample ramping to prevent clicks
   uint32_t cur_vol = get_volume_scale();
+  PERF_BEGIN(PERF_EQ);
   if (eq_profile_get_active() != EQ_PROFILE_OFF)
     eq_profile_process(proc, sample_count, 65536);
   else
     audio_eq_process(proc, sample_count, 65536);
+  PERF_END(PERF_EQ);
 
   // Per-sample volume ramping: linearly interpolate from prev to current
-  // over the buffer to avoid step discontinuities (clicks) on volume changes.
-  // Incremental Q16.16 step — one division per buffer, not per sample.
-  if (cur_vol != prev_volume_scale) {
-    int64_t acc = (int64_t)prev_volume_scale << 16;
-    int64_t step =
-        (((int64_t)cur_vol - (int64_t)prev_volume_scale) << 16) / sample_count;
-    for (uint16_t i = 0; i < sample_count; i++) {
-      uint32_t v = (uint32_t)(acc >> 16);
-      proc[i] = (int32_t)(((int64_t)proc[i] * v) >> 16);
-      acc += step;
-    }
-    prev_volume_scale = cur_vol;
-  } else if (cur_vol < 65536) {
-    // Steady non-unity volume: flat gain
-    for (uint16_t i = 0; i < sample_count; i++) {
-      proc[i] = (int32_t)(((int64_t)proc[i] * cur_vol) >> 16);
-    }
-  }
-  // Steady unity volume: nothing to apply
+  // over the buffer to avoid step discontinuities (clicks) on volume changes
+  PERF_BEGIN(PERF_VOLUME);
+  audio_pcm_volume(proc, sample_count, prev_volume_scale, cur_vol);
+  prev_volume_scale = cur_vol;
+  PERF_END(PERF_VOLUME);
 
   // Save last samples before packing (pack overwrites in-place)
   if (sample_count >= 2) {
@@ -322,17 +491,496 @@ static uint16_t read_audio_data(uint16_t *i2s_dest,
     last_sample_right = proc[sample_count - 1] ? proc[sample_count - 1] : SILENCE_DC_OFFSET;
   }
 
-  // Pack int32_t (24-bit) to uint32_t for word-mode DMA (in-place,
-  // forward-safe: proc[i] and out32[i] share the same address at offset i*4)
-  // Add DC offset to prevent PCM5102A zero-detect from engaging analog mute
-  uint32_t *out32 = (uint32_t *)i2s_dest;
-  for (uint16_t i = 0; i < sample_count; i++) {
-    int32_t s = proc[i];
-    if (s == 0) s = SILENCE_DC_OFFSET;
-    out32[i] = (uint32_t)s << 8;
+  // Pack int32_t (24-bit) to uint32_t for word-mode DMA, in place, with the
+  // DC offset for zeros
+  PERF_BEGIN(PERF_PACK);
+  audio_pcm_pack(proc, sample_count);
+  PERF_END(PERF_PACK);
+
+#if DMA_UNPACK
+  passthrough_zero_tail = 0; // zeros above were replaced by the DC offset
+#endif
+
+  return frames;
+}
+
+#if DMA_UNPACK
+//--------------------------------------------------------------------+
+// GPDMA passthrough unpack
+//--------------------------------------------------------------------+
+
+// Channel 7 is one of the two 2D-addressing channels (per-burst address
+// offsets, needed to scatter 3-byte samples into 4-byte words). Channel 0
+// is the display's I2C DMA.
+#define UNPACK_DMA_CH GPDMA2_Channel7
+
+#define UNPACK_DMA_ERRORS (DMA_CSR_DTEF | DMA_CSR_ULEF | DMA_CSR_USEF)
+#define UNPACK_DMA_CLEAR_ALL                                                  \
+  (DMA_CFCR_TCF | DMA_CFCR_HTF | DMA_CFCR_DTEF | DMA_CFCR_ULEF |              \
+   DMA_CFCR_USEF | DMA_CFCR_SUSPF | DMA_CFCR_TOF)
+
+// Registers reloaded from each linked-list item, in the hardware load order
+#define UNPACK_LLI_UPDATE                                                     \
+  (DMA_CLLR_UB1 | DMA_CLLR_USA | DMA_CLLR_UDA | DMA_CLLR_UT3 | DMA_CLLR_ULL)
+
+typedef struct {
+  uint32_t br1, sar, dar, tr3, llr;
+} unpack_lli_t;
+
+_Static_assert(CFG_TUD_AUDIO_FUNC_1_EP_OUT_SW_BUF_SZ % 6 == 0,
+               "DMA unpack needs whole frames up to the FIFO ring end");
+
+static unpack_lli_t unpack_lli[AUDIO_UNPACK_MAX_XFERS - 1];
+static uint16_t unpack_dma_pending = 0; // FIFO bytes the DMA is reading
+static uint16_t *unpack_dma_dest;
+static uint16_t unpack_dma_frames;
+static uint8_t unpack_dma_failed = 0;
+
+static uint32_t unpack_tr3(const audio_unpack_xfer_t *x) {
+  return ((uint32_t)x->src_gap << DMA_CTR3_SAO_Pos) |
+         ((uint32_t)x->dst_gap << DMA_CTR3_DAO_Pos);
+}
+
+static uint32_t unpack_llr(const unpack_lli_t *next) {
+  return next ? (UNPACK_LLI_UPDATE | ((uint32_t)(uintptr_t)next & DMA_CLLR_LA))
+              : 0U;
+}
+
+// Program the first transfer into the channel and chain the rest as
+// linked-list items; the TC flag is raised after the last one
+static void unpack_dma_start(const audio_unpack_xfer_t *x, uint8_t n,
+                             uint16_t *i2s_dest) {
+  DMA_Channel_TypeDef *ch = UNPACK_DMA_CH;
+  uint32_t dst = (uint32_t)(uintptr_t)i2s_dest;
+
+  for (uint8_t i = 1; i < n; i++) {
+    unpack_lli_t *lli = &unpack_lli[i - 1];
+    lli->br1 = x[i].bytes;
+    lli->sar = (uint32_t)(uintptr_t)x[i].src;
+    lli->dar = dst + x[i].dst_offset;
+    lli->tr3 = unpack_tr3(&x[i]);
+    lli->llr = unpack_llr(i + 1 < n ? &unpack_lli[i] : NULL);
+  }
+
+  ch->CFCR = UNPACK_DMA_CLEAR_ALL;
+  // Byte data width both sides, incrementing 3-byte bursts
+  ch->CTR1 = ((uint32_t)(x[0].burst - 1U) << DMA_CTR1_SBL_1_Pos) |
+             DMA_CTR1_SINC |
+             ((uint32_t)(x[0].burst - 1U) << DMA_CTR1_DBL_1_Pos) |
+             DMA_CTR1_DINC;
+  // Memory-to-memory (software request), TC at the end of the last LLI
+  ch->CTR2 = DMA_CTR2_SWREQ | DMA_CTR2_TCEM;
+  ch->CBR1 = x[0].bytes;
+  ch->CSAR = (uint32_t)(uintptr_t)x[0].src;
+  ch->CDAR = dst + x[0].dst_offset;
+  ch->CTR3 = unpack_tr3(&x[0]);
+  ch->CBR2 = 0;
+  ch->CLBAR = (uint32_t)(uintptr_t)unpack_lli & DMA_CLBAR_LBA;
+  ch->CLLR = unpack_llr(n > 1 ? &unpack_lli[0] : NULL);
+  ch->CCR = DMA_CCR_EN;
+}
+
+// Wait for an in-flight transfer (a few microseconds for one period) and
+// release its FIFO bytes. Called before anything looks at the FIFO level.
+static void unpack_dma_finish(void) {
+  if (!unpack_dma_pending)
+    return;
+
+  DMA_Channel_TypeDef *ch = UNPACK_DMA_CH;
+  uint32_t start = DWT->CYCCNT;
+  uint32_t sr;
+  while (!((sr = ch->CSR) & (DMA_CSR_TCF | UNPACK_DMA_ERRORS))) {
+    if (DWT->CYCCNT - start >= SPIN_TIMEOUT_CYCLES()) {
+      sr = UNPACK_DMA_ERRORS; // stuck: treat as an error
+      break;
+    }
+  }
+
+  uint32_t *w = (uint32_t *)unpack_dma_dest + (unpack_dma_frames - 1) * 2;
+  if (sr & UNPACK_DMA_ERRORS) {
+    ch->CCR = DMA_CCR_RESET;
+    unpack_dma_failed = 1; // stay on the CPU path from now on
+    fill_with_hold(unpack_dma_dest, unpack_dma_frames);
+    SEGGER_RTT_printf(0, "[audio] DMA unpack error (CSR=%08x), disabled\n",
+                      (unsigned)sr);
+  } else {
+    // Only the last frame is read back: the hold value for underruns, and
+    // the zero-run guard below
+    last_sample_left = (int32_t)w[0] >> 8;
+    last_sample_right = (int32_t)w[1] >> 8;
+
+    // PCM5102A zero-detect needs 1024 consecutive zero samples. A period
+    // that ends in digital zero sends the next one through the CPU path
+    // (which substitutes the DC offset), so a true-zero run never exceeds
+    // one period.
+    passthrough_zero_tail = (w[0] == 0 || w[1] == 0);
+    if (last_sample_left == 0)
+      last_sample_left = SILENCE_DC_OFFSET;
+    if (last_sample_right == 0)
+      last_sample_right = SILENCE_DC_OFFSET;
+#if AUDIO_OUTPUT_ASRC
+    // And the frames the converter starts from, as the stream sent them
+    int32_t tail[2 * AUDIO_ASRC_TAPS];
+    uint16_t n = unpack_dma_frames < AUDIO_ASRC_TAPS ? unpack_dma_frames
+                                                      : AUDIO_ASRC_TAPS;
+    const uint32_t *t = w + 2 - 2 * n;
+    for (uint16_t i = 0; i < n; i++) {
+      tail[2 * i + SWAP_CHANNELS] = (int32_t)t[2 * i] >> 8;
+      tail[2 * i + 1 - SWAP_CHANNELS] = (int32_t)t[2 * i + 1] >> 8;
+    }
+    audio_asrc_prime(&asrc, tail, n);
+#endif
   }
+  ch->CFCR = UNPACK_DMA_CLEAR_ALL;
+
+  usb_audio_consume(unpack_dma_pending);
+  unpack_dma_pending = 0;
+}
+
+// Passthrough = output is the input: 24-bit samples (the transfer plan
+// moves 3-byte bursts), no resampling or conversion, no EQ, steady unity
+// volume
+static bool passthrough_eligible(void) {
+  if (resampling || usb_frame_bytes != AUDIO_UNPACK_FRAME_BYTES)
+    return false;
+#if AUDIO_OUTPUT_ASRC
+  if (asrc_running)
+    return false;
+#endif
+  if (eq_profile_get_active() != EQ_PROFILE_OFF)
+    return false;
+  if (audio_eq_is_enabled() && (audio_eq_get_band(EQ_BAND_BASS) != 0 ||
+                                audio_eq_get_band(EQ_BAND_TREBLE) != 0))
+    return false;
+  return get_volume_scale() == 65536 && prev_volume_scale == 65536;
+}
+
+// Start a GPDMA unpack of one full period. Returns false if the CPU path
+// must be used instead (DSP active, zero-run guard, a frame split by the
+// wrap, or no room for the packets due while the transfer runs).
+static bool passthrough_dma_fill(uint16_t *i2s_dest, uint16_t frames) {
+  if (unpack_dma_failed || passthrough_zero_tail || !passthrough_eligible())
+    return false;
+
+  uint16_t bytes = frames * AUDIO_UNPACK_FRAME_BYTES;
+  usb_audio_regions_t rgn;
+  if (usb_audio_peek(&rgn, bytes) < bytes)
+    return false;
+
+  // The bytes stay in the FIFO until the next fill (unpack_dma_finish), a
+  // period later: the ISR must fit that period of audio meanwhile, plus one
+  // packet for a host running fast. Otherwise the CPU path frees them now.
+  if (usb_audio_free() < bytes + CFG_TUD_AUDIO_FUNC_1_EP_OUT_SZ_FS)
+    return false;
+
+  audio_unpack_xfer_t x[AUDIO_UNPACK_MAX_XFERS];
+  uint8_t n = audio_unpack_dma_plan(&rgn, frames, SWAP_CHANNELS, x);
+  if (n == 0)
+    return false;
+
+  unpack_dma_dest = i2s_dest;
+  unpack_dma_frames = frames;
+  unpack_dma_pending = bytes;
+  unpack_dma_start(x, n, i2s_dest);
+  return true;
+}
+#endif
 
-  return stereo_frames;
+// FIFO level as seen by the fill logic (never counts bytes still owned by
+// an in-flight DMA unpack)
+static uint16_t fifo_available(void) {
+#if DMA_UNPACK
+  unpack_dma_finish();
+#endif
+  return usb_audio_available();
+}
+
+// Full-period fill: GPDMA in passthrough when enabled, else the CPU path
+static void fill_full_period(uint16_t *i2s_dest, uint16_t frames) {
+#if DMA_UNPACK
+  if (passthrough_dma_fill(i2s_dest, frames))
+    return;
+#endif
+  read_audio_data(i2s_dest, frames);
+}
+
+#if USB_AUDIO_LOOPBACK
+// USB bytes per captured stereo frame (24-bit)
+#define CAPTURE_FRAME_BYTES                                                   \
+  (CFG_TUD_AUDIO_FUNC_1_N_CHANNELS_TX *                                       \
+   CFG_TUD_AUDIO_FUNC_1_N_BYTES_PER_SAMPLE_TX)
+
+_Static_assert(USB_AUDIO_CAPTURE_RATE == AUDIO_LATENCY_RATE,
+               "the capture streams at the I2S rate");
+_Static_assert(CFG_TUD_AUDIO_FUNC_1_EP_IN_SW_BUF_SZ % CAPTURE_FRAME_BYTES ==
+                   0,
+               "both regions of the capture FIFO hold whole frames");
+
+// Copy the period the DMA has just played into the capture FIFO, before it
+// is refilled: what the DAC got, after the whole chain, straight from the
+// I2S words (no extra pass over the playback path)
+static void capture_period(const uint16_t *period) {
+  uint16_t frames = ring->period_frames;
+  usb_audio_space_t space;
+  uint16_t room =
+      usb_audio_capture_reserve(&space, frames * CAPTURE_FRAME_BYTES);
+  const uint32_t *words = (const uint32_t *)period;
+  for (uint8_t r = 0; r < 2; r++) {
+    uint16_t n = space.len[r] / CAPTURE_FRAME_BYTES;
+    audio_pcm_unpack_i2s(words, space.ptr[r], n * 2, SWAP_CHANNELS);
+    words += n * 2;
+  }
+  usb_audio_capture_commit(room);
+  capture_dropped += frames - room / CAPTURE_FRAME_BYTES;
+}
+#endif
+
+// Refill one period the DMA has just played. Safe: the DMA is at least one
+// period away from coming back to it.
+static void fill_period(uint16_t *dest) {
+  uint16_t frames = ring->period_frames;
+
+  if (!streaming || prebuffering) {
+    // DC-offset silence, so the DMA doesn't loop stale audio. Prebuffering
+    // waits until the FIFO holds the level the feedback endpoint regulates
+    // to (the profile's FIFO target) before consuming. A burst of late
+    // packets can overshoot it by several ms; the excess is dropped, so the
+    // stream starts on the target instead of draining down to it over
+    // seconds (and a second burst cannot overflow the FIFO meanwhile).
+    fill_with_silence(dest, frames);
+#if AUDIO_OUTPUT_ASRC
+    asrc_running = 0; // stale history: restarts from the direct path
+#endif
+    uint16_t level = streaming ? fifo_available() : 0;
+    if (streaming && level >= ring->fifo_target) {
+      uint16_t excess = level - ring->fifo_target;
+      excess -= excess % usb_frame_bytes;
+      usb_audio_consume(excess);
+      if (excess)
+        audio_stats_dropped(&stats, excess);
+      prebuffering = 0;
+    }
+    return;
+  }
+
+  uint16_t available = fifo_available();
+  uint16_t frames_read = frames;
+#if AUDIO_OUTPUT_ASRC
+  asrc_update(available, frames);
+#endif
+
+  if (available >= stream_bytes(frames)) {
+    // Full fill
+    fill_full_period(dest, frames);
+  } else if (available >= usb_frame_bytes) {
+    // Partial fill - read what we can, hold the rest
+    frames_read = read_audio_data(dest, frames);
+    fill_with_hold(&dest[frames_read * I2S_HALFWORDS_PER_FRAME],
+                   frames - frames_read);
+  } else {
+    // No data available - fill with held last sample
+    frames_read = 0;
+    fill_with_hold(dest, frames);
+  }
+  if (frames_read < frames)
+    ran_short = 1;
+  audio_stats_period(&stats, available, frames, frames_read);
+}
+
+//--------------------------------------------------------------------+
+// I2S DMA ring
+//--------------------------------------------------------------------+
+
+// GPDMA1 channel 0 (SPI1 TX request) plays the ring as a circular linked
+// list, one item per period, with a TC event at the end of each. CubeMX
+// still initialises the channel (priority, port allocation); the list is
+// built here so the period size and count can change at run time. Items
+// only reload the block size, source address and link.
+#define I2S_DMA_CH GPDMA1_Channel0
+
+#define I2S_DMA_ERRORS (DMA_CSR_DTEF | DMA_CSR_ULEF | DMA_CSR_USEF)
+#define I2S_DMA_CLEAR_ALL                                                     \
+  (DMA_CFCR_TCF | DMA_CFCR_HTF | DMA_CFCR_DTEF | DMA_CFCR_ULEF |              \
+   DMA_CFCR_USEF | DMA_CFCR_SUSPF | DMA_CFCR_TOF)
+#define I2S_LLI_UPDATE (DMA_CLLR_UB1 | DMA_CLLR_USA | DMA_CLLR_ULL)
+
+// A layout switch rewrites the item the channel loads at the end of the
+// current period: only with at least this much of the period left
+#define I2S_SWITCH_MARGIN (8 * I2S_BYTES_PER_FRAME)
+
+typedef struct {
+  uint32_t br1, sar, llr;
+} i2s_lli_t;
+
+static i2s_lli_t i2s_lli[AUDIO_LATENCY_MAX_PERIODS];
+
+static uint16_t *period_buffer(uint8_t period) {
+  return &i2s_buffer[(uint32_t)period * ring->period_frames *
+                     I2S_HALFWORDS_PER_FRAME];
+}
+
+static uint32_t i2s_llr(uint8_t item) {
+  return I2S_LLI_UPDATE | ((uint32_t)(uintptr_t)&i2s_lli[item] & DMA_CLLR_LA);
+}
+
+// Lay the active ring out over the items starting at `first` (wrapping),
+// the last linking back to the first. Refills restart at period 0.
+static void ring_link(uint8_t first) {
+  uint32_t bytes = (uint32_t)ring->period_frames * I2S_BYTES_PER_FRAME;
+  for (uint8_t p = 0; p < ring->periods; p++) {
+    uint8_t next = (uint8_t)((p + 1) % ring->periods);
+    i2s_lli_t *lli = &i2s_lli[(first + p) % AUDIO_LATENCY_MAX_PERIODS];
+    lli->br1 = bytes;
+    lli->sar = (uint32_t)(uintptr_t)period_buffer(p);
+    lli->llr = i2s_llr((uint8_t)((first + next) % AUDIO_LATENCY_MAX_PERIODS));
+  }
+  fill_index = 0;
+}
+
+// Profile id at the stream rate and format (the presets' FIFO targets are
+// in 24-bit frames)
+static audio_latency_preset_t ring_preset(uint8_t id) {
+  audio_latency_preset_t cfg = {0};
+  audio_latency_at_rate(audio_latency_preset(id), stream_rate, &cfg);
+  cfg.fifo_target =
+      (uint16_t)(cfg.fifo_target / AUDIO_LATENCY_FRAME_BYTES * usb_frame_bytes);
+  return cfg;
+}
+
+// (Re)start the ring from period 0 with DC-offset silence
+static void ring_start(void) {
+  DMA_Channel_TypeDef *ch = I2S_DMA_CH;
+  SPI_TypeDef *spi = hi2s1.Instance;
+  audio_latency_preset_t cfg = ring_preset(ring_id);
+
+  uint32_t primask = __get_PRIMASK();
+  __disable_irq();
+  ring_cfg = cfg;
+  __set_PRIMASK(primask);
+  fill_with_silence(i2s_buffer, I2S_RING_FRAMES);
+  ring_link(0);
+  periods_seen = periods_played;
+  skip_periods = 0;
+  ring_error = 0;
+  clock_epoch++;
+
+  ch->CCR &= ~DMA_CCR_EN;
+  ch->CFCR = I2S_DMA_CLEAR_ALL;
+  // Word to word, incrementing source; hardware request, TC per block
+  ch->CTR1 = DMA_CTR1_SDW_LOG2_1 | DMA_CTR1_SINC | DMA_CTR1_DDW_LOG2_1;
+  ch->CTR2 = GPDMA1_REQUEST_SPI1_TX & DMA_CTR2_REQSEL;
+  ch->CBR1 = i2s_lli[0].br1;
+  ch->CSAR = i2s_lli[0].sar;
+  ch->CDAR = (uint32_t)(uintptr_t)&spi->TXDR;
+  ch->CTR3 = 0;
+  ch->CBR2 = 0;
+  ch->CLBAR = (uint32_t)(uintptr_t)i2s_lli & DMA_CLBAR_LBA;
+  ch->CLLR = i2s_lli[0].llr;
+  ch->CCR = (ch->CCR & (DMA_CCR_PRIO | DMA_CCR_LAP | DMA_CCR_LSM)) |
+            DMA_CCR_TCIE | DMA_CCR_DTEIE | DMA_CCR_ULEIE | DMA_CCR_USEIE |
+            DMA_CCR_EN;
+
+  // Same sequence as HAL_I2S_Transmit_DMA: TX DMA request, enable, start
+  SET_BIT(spi->CFG1, SPI_CFG1_TXDMAEN);
+  if (!(spi->CR1 & SPI_CR1_SPE))
+    SET_BIT(spi->CR1, SPI_CR1_SPE);
+  SET_BIT(spi->CR1, SPI_CR1_CSTART);
+}
+
+// Switch to the requested profile without stopping the I2S clocks (the DAC
+// would pop). The channel is part-way through a period of the old layout:
+// the new ring is laid out from the item it loads next, and the TC ending
+// that old period is skipped. Only called while no stream is open; the
+// whole buffer goes back to silence, cutting short the tail of a stream
+// that just stopped. Too close to the period end it does nothing, and the
+// next audio stage run tries again.
+static void ring_switch(void) {
+  DMA_Channel_TypeDef *ch = I2S_DMA_CH;
+  uint8_t id = ring_request;
+  uint32_t lli_base = (uint32_t)(uintptr_t)i2s_lli & DMA_CLLR_LA;
+  audio_latency_preset_t cfg = ring_preset(id);
+
+  fill_with_silence(i2s_buffer, I2S_RING_FRAMES);
+
+  // A handful of stores: nothing may delay them past the period end
+  uint32_t primask = __get_PRIMASK();
+  __disable_irq();
+  if ((ch->CBR1 & DMA_CBR1_BNDT) >= I2S_SWITCH_MARGIN) {
+    uint8_t item = (uint8_t)(((ch->CLLR & DMA_CLLR_LA) - lli_base) /
+                             sizeof(i2s_lli_t));
+    ring_id = id;
+    ring_cfg = cfg;
+    ring_link(item);
+    skip_periods = 1;
+    periods_seen = periods_played;
+    clock_epoch++;
+  }
+  __set_PRIMASK(primask);
+}
+
+// Stop the ring and the I2S clocks. An active GPDMA channel ignores EN
+// being cleared: it is suspended (SUSPF comes within a word transfer, the
+// timeout only guards a dead clock), then reset.
+static void ring_stop(void) {
+  DMA_Channel_TypeDef *ch = I2S_DMA_CH;
+
+  if (ch->CCR & DMA_CCR_EN) {
+    ch->CCR |= DMA_CCR_SUSP;
+    uint32_t start = DWT->CYCCNT;
+    while (!(ch->CSR & DMA_CSR_SUSPF) &&
+           DWT->CYCCNT - start < SPIN_TIMEOUT_CYCLES()) {
+    }
+    ch->CCR |= DMA_CCR_RESET;
+  }
+  ch->CFCR = I2S_DMA_CLEAR_ALL;
+  __HAL_I2S_DISABLE(&hi2s1);
+  CLEAR_BIT(hi2s1.Instance->CFG1, SPI_CFG1_TXDMAEN);
+}
+
+// DMA position: periods played and bytes left in the one playing, read
+// together with interrupts off. At a period end the channel reloads BNDT
+// before the IRQ counts the period: a full count with TC still pending
+// belongs to the next one.
+static uint32_t ring_position(uint32_t *left) {
+  DMA_Channel_TypeDef *ch = I2S_DMA_CH;
+  uint32_t period_bytes = (uint32_t)ring->period_frames * I2S_BYTES_PER_FRAME;
+  uint32_t primask = __get_PRIMASK();
+  __disable_irq();
+  uint32_t played = periods_played;
+  *left = ch->CBR1 & DMA_CBR1_BNDT;
+  if ((ch->CSR & DMA_CSR_TCF) && *left > period_bytes / 2)
+    played++;
+  __set_PRIMASK(primask);
+  return played;
+}
+
+static uint32_t ring_bytes_to_us(uint32_t bytes) {
+  return bytes / I2S_BYTES_PER_FRAME * 1000000U / i2s_rate;
+}
+
+// After a refill: how long the DMA still had to go before reaching the
+// period just written (deadline.h), or how far into it the DMA already was
+static void record_deadline(void) {
+  uint32_t left;
+  uint32_t pending = ring_position(&left) - periods_seen;
+  uint32_t period_bytes = (uint32_t)ring->period_frames * I2S_BYTES_PER_FRAME;
+
+  // The period just written is the last of those not pending
+  if (pending + 1U < ring->periods) {
+    uint32_t ahead = (ring->periods - 2U - pending) * period_bytes + left;
+    deadline_slack(ring_bytes_to_us(ahead));
+    return;
+  }
+
+  uint32_t behind = (pending + 1U - ring->periods) * period_bytes +
+                    (period_bytes - left);
+  deadline_miss_t miss = {
+      .tick_ms = HAL_GetTick(),
+      .late_us = ring_bytes_to_us(behind),
+      .task = sched_current(),
+      .latency = ring_id,
+  };
+  deadline_miss(&miss);
 }
 
 //--------------------------------------------------------------------+
@@ -341,13 +989,11 @@ static uint16_t read_audio_data(uint16_t *i2s_dest,
 
 void audio_output_init(void) {
   SEGGER_RTT_printf(0, "[audio] init start\n");
+  audio_stats_init(&stats);
 
   // Initialize EQ
   audio_eq_init();
 
-  // Fill buffer with DC-offset silence (prevents PCM5102A zero-detect pop)
-  fill_with_silence(i2s_buffer, STEREO_FRAMES_PER_HALF * 2);
-
   last_sample_left = SILENCE_DC_OFFSET;
   last_sample_right = SILENCE_DC_OFFSET;
 
@@ -357,12 +1003,12 @@ void audio_output_init(void) {
   mute_dac();
   disable_amplifier();
 
-  // Start I2S DMA with DC-offset silence
-  SEGGER_RTT_printf(0, "[audio] I2S DMA start (buf=%p, size=%d)...\n",
-                    i2s_buffer, I2S_DMA_SIZE);
-  HAL_StatusTypeDef rc = HAL_I2S_Transmit_DMA(&hi2s1, i2s_buffer, I2S_DMA_SIZE);
-  SEGGER_RTT_printf(0, "[audio] I2S DMA result: %d\n", rc);
+  // Start the I2S DMA ring with DC-offset silence (prevents PCM5102A
+  // zero-detect pop)
+  ring_start();
   dma_running = 1;
+  SEGGER_RTT_printf(0, "[audio] I2S ring started (%s: %d x %d frames)\n",
+                    ring->name, ring->periods, ring->period_frames);
 
   // Unmute DAC — now outputting DC-offset silence via I2S
   unmute_dac();
@@ -378,171 +1024,361 @@ void audio_output_init(void) {
   SEGGER_RTT_printf(0, "[audio] amp enabled, init done\n");
 }
 
+// Start/stop run from tud_task (thread mode) and switch the audio stage
+// between its silence and stream paths, so they hold it off while the state
+// changes. Played periods are left pending: the audio stage services them
+// as soon as the lock drops, with the new state (silence while prebuffering
+// or stopped), so a period is never left looping stale audio.
 void audio_output_start_streaming(void) {
+  uint32_t key = audio_output_lock();
   if (streaming) {
+    audio_output_unlock(key);
     return;
   }
 
+  // A profile requested just before the host opened the stream: switch now,
+  // TinyUSB reads the feedback target (audio_output_fifo_target) right after
+  if (dma_running && ring_request != ring_id)
+    ring_switch();
+
   streaming = 1;
   prebuffering = 1;
+  audio_stats_stream(&stats, true);
 
   audio_eq_reset_state();
   eq_profile_reset_state();
+  audio_resample_reset(&resampler);
+#if AUDIO_OUTPUT_ASRC
+  asrc_engaged = 0; // until the new stream's monitor engages it
+  asrc_running = 0;
+  audio_asrc_reset(&asrc);
+#endif
+  ran_short = 0;
+
+#if DMA_UNPACK
+  passthrough_zero_tail = 0;
+#endif
 
   last_sample_left = SILENCE_DC_OFFSET;
   last_sample_right = SILENCE_DC_OFFSET;
-
-  // Clear stale callback flags from idle period
-  first_half_needs_fill = 0;
-  second_half_needs_fill = 0;
+  audio_output_unlock(key);
 }
 
 void audio_output_stop_streaming(void) {
+  uint32_t key = audio_output_lock();
+#if DMA_UNPACK
+  unpack_dma_finish();
+#endif
+  if (streaming)
+    audio_stats_stream(&stats, false);
   streaming = 0;
   prebuffering = 0;
 
   last_sample_left = SILENCE_DC_OFFSET;
   last_sample_right = SILENCE_DC_OFFSET;
-
-  first_half_needs_fill = 0;
-  second_half_needs_fill = 0;
+  audio_output_unlock(key);
 }
 
-void audio_output_task(void) {
-  if (!streaming) {
-    // Not streaming — fill completed halves with DC-offset silence so DMA
-    // doesn't loop stale audio. Safe: we only write the half DMA just finished.
-    if (first_half_needs_fill) {
-      fill_with_silence(&i2s_buffer[0], STEREO_FRAMES_PER_HALF);
-      first_half_needs_fill = 0;
-    }
-    if (second_half_needs_fill) {
-      fill_with_silence(&i2s_buffer[I2S_HALFWORDS_PER_HALF],
-                        STEREO_FRAMES_PER_HALF);
-      second_half_needs_fill = 0;
-    }
+void audio_output_process(void) {
+  if (ring_error) {
+    // The channel stopped on a bus or link error: restart with silence
+    ring_start();
+    audio_stats_dma_error(&stats);
+    SEGGER_RTT_printf(0, "[audio] I2S DMA error, ring restarted\n");
     return;
   }
 
-  // Prebuffering phase: fill with DC-offset silence while waiting for data
-  if (prebuffering) {
-    if (first_half_needs_fill) {
-      fill_with_silence(&i2s_buffer[0], STEREO_FRAMES_PER_HALF);
-      first_half_needs_fill = 0;
-    }
-    if (second_half_needs_fill) {
-      fill_with_silence(&i2s_buffer[I2S_HALFWORDS_PER_HALF],
-                        STEREO_FRAMES_PER_HALF);
-      second_half_needs_fill = 0;
-    }
+  uint32_t played = periods_played;
+  uint32_t pending = played - periods_seen;
+  if (pending > ring->periods) {
+    // Held off for more than a whole ring (debugger halt): the periods
+    // played meanwhile have all been replayed, only the last ring counts
+    uint32_t lost = pending - ring->periods;
+    fill_index = (uint8_t)((fill_index + lost) % ring->periods);
+    periods_seen += lost;
+  }
 
-    uint16_t available = usb_audio_available();
-    if (available >= PREBUFFER_THRESHOLD) {
-      prebuffering = 0;
+  PERF_BEGIN(PERF_AUDIO);
+  filling = 1;
+  while (periods_seen != played) {
+    periods_seen++;
+    if (skip_periods) {
+      skip_periods--;
+      continue;
     }
-    return;
+    TRACE(TRACE_FILL_BEGIN, fill_index, fifo_available());
+#if USB_AUDIO_LOOPBACK
+    if (capturing)
+      capture_period(period_buffer(fill_index));
+#endif
+    fill_period(period_buffer(fill_index));
+    TRACE(TRACE_FILL_END, fill_index, 0);
+    fill_index = (uint8_t)((fill_index + 1) % ring->periods);
+    record_deadline();
   }
+  filling = 0;
+  PERF_END(PERF_AUDIO);
 
-  // Normal streaming: fill buffers as needed
+  if (!streaming && ring_request != ring_id)
+    ring_switch();
+}
 
-  // Fill first half of buffer if needed
-  if (first_half_needs_fill) {
-    uint16_t available = usb_audio_available();
+// Report new deadline misses over RTT
+static void report_misses(void) {
+  uint32_t key = audio_output_lock();
+  uint32_t misses = deadline_state()->misses;
+  audio_output_unlock(key);
 
-    if (available >= USB_BYTES_PER_HALF) {
-      // Full fill
-      read_audio_data(&i2s_buffer[0], USB_BYTES_PER_HALF);
-      first_half_needs_fill = 0;
-#if AUDIO_DEBUG
-      full_fill_count++;
-#endif
-    } else if (available >= 6) {
-      // Partial fill - read what we can, hold the rest
-      uint16_t frames_read = read_audio_data(&i2s_buffer[0], available);
-      uint16_t frames_remaining = STEREO_FRAMES_PER_HALF - frames_read;
-      fill_with_hold(&i2s_buffer[frames_read * 4], frames_remaining);
-      first_half_needs_fill = 0;
-#if AUDIO_DEBUG
-      partial_fill_count++;
-      SEGGER_RTT_printf(0, "PARTIAL1: avail=%d, frames=%d\n", available,
-                        frames_read);
+  if (misses - misses_reported > DEADLINE_MISS_LOG) {
+    SEGGER_RTT_printf(0, "[audio] %lu deadline misses not logged\n",
+                      misses - misses_reported - DEADLINE_MISS_LOG);
+    misses_reported = misses - DEADLINE_MISS_LOG;
+  }
+  for (; misses_reported != misses; misses_reported++) {
+    key = audio_output_lock();
+    const deadline_miss_t *m = deadline_logged(misses_reported);
+    deadline_miss_t miss = m ? *m : (deadline_miss_t){0};
+    audio_output_unlock(key);
+    if (!m)
+      continue; // cleared by a reset
+    SEGGER_RTT_printf(0,
+                      "[audio] deadline miss at %lu ms: %lu us late, task %u\n",
+                      miss.tick_ms, miss.late_us, miss.task);
+  }
+}
+
+void audio_output_task(void) {
+  report_misses();
+
+#if USB_AUDIO_LOOPBACK
+  uint32_t dropped = capture_dropped;
+  if (dropped != capture_reported) {
+    SEGGER_RTT_printf(0, "[audio] loopback: %lu frames dropped\n",
+                      dropped - capture_reported);
+    capture_reported = dropped;
+  }
 #endif
-    } else {
-      // No data available - fill with held last sample
-      fill_with_hold(&i2s_buffer[0], STEREO_FRAMES_PER_HALF);
-      first_half_needs_fill = 0;
+
 #if AUDIO_DEBUG
-      underrun_count++;
-      SEGGER_RTT_printf(0, "UNDERRUN1: t=%lu\n", HAL_GetTick());
+  // Periodic status report every 2 seconds (counts since the last CDC
+  // reset; the report itself does not reset them)
+  uint32_t now = HAL_GetTick();
+  if (now - last_report_tick >= 2000) {
+    audio_stats_counters_t c;
+    audio_stats_snapshot(&stats, &c, false);
+    SEGGER_RTT_printf(0,
+        "FIFO: now=%d target=%d | periods=%lu partial=%lu under=%lu "
+        "concealed=%lu\n",
+        usb_audio_available(), audio_output_fifo_target(), c.periods,
+        c.partial_fills, c.underruns, c.concealed_frames);
+    last_report_tick = now;
+  }
 #endif
-    }
+}
+
+uint32_t audio_output_get_stats(audio_stats_counters_t *counters,
+                                bool reset) {
+  audio_stats_snapshot(&stats, counters, reset);
+  uint32_t now = HAL_GetTick();
+  uint32_t elapsed = now - stats_reset_tick;
+  if (reset)
+    stats_reset_tick = now;
+  return elapsed;
+}
+
+uint32_t audio_output_us_to_next_period(void) {
+  if (!dma_running)
+    return UINT32_MAX;
+  // BNDT counts down the bytes left in the period being played
+  uint32_t left = I2S_DMA_CH->CBR1 & DMA_CBR1_BNDT;
+  return ring_bytes_to_us(left);
+}
+
+uint32_t audio_output_clock(uint8_t *epoch) {
+  uint32_t primask = __get_PRIMASK();
+  __disable_irq();
+  *epoch = clock_epoch;
+  if (!dma_running) {
+    __set_PRIMASK(primask);
+    return 0;
   }
+  uint32_t left;
+  uint32_t played = ring_position(&left);
+  uint32_t period_bytes = (uint32_t)ring->period_frames * I2S_BYTES_PER_FRAME;
+  __set_PRIMASK(primask);
+
+  // Bytes of the ring played, in 1/256 frame. Wraps consistently: only
+  // differences are used.
+  uint32_t bytes = played * period_bytes + (period_bytes - left);
+  return bytes * (256U / I2S_BYTES_PER_FRAME);
+}
 
-  // Fill second half of buffer if needed
-  if (second_half_needs_fill) {
-    uint16_t available = usb_audio_available();
+bool audio_output_queued(uint32_t *frames_q8) {
+  // A refill moves a period from the FIFO into the ring: mid-way, the two
+  // counts overlap
+  if (!dma_running || !streaming || prebuffering || filling)
+    return false;
+
+  uint32_t left;
+  uint32_t played = ring_position(&left);
+  uint32_t period_bytes = (uint32_t)ring->period_frames * I2S_BYTES_PER_FRAME;
+
+  // Ahead of the DMA: the rest of the period it plays, and every other
+  // period except those played but not refilled yet
+  uint32_t pending = played - periods_seen;
+  uint32_t full = pending < ring->periods ? ring->periods - 1U - pending : 0;
+  uint32_t bytes = full * period_bytes + left;
+#if DMA_UNPACK
+  // Unpacked into the ring but still counted by the FIFO until the audio
+  // stage releases it
+  uint32_t unpacked = (uint32_t)unpack_dma_pending / AUDIO_UNPACK_FRAME_BYTES *
+                      I2S_BYTES_PER_FRAME;
+  bytes = bytes > unpacked ? bytes - unpacked : 0;
+#endif
+  *frames_q8 = bytes * (256U / I2S_BYTES_PER_FRAME);
+#if AUDIO_OUTPUT_ASRC
+  if (asrc_running)
+    *frames_q8 += AUDIO_ASRC_DELAY_Q8; // held in the converter
+#endif
+  if (resampling) {
+    // In stream frames, plus those the resampler holds back
+    *frames_q8 = *frames_q8 / AUDIO_RESAMPLE_PHASES * AUDIO_RESAMPLE_STEP +
+                 AUDIO_RESAMPLE_DELAY_Q8;
+  }
+  return true;
+}
 
-    if (available >= USB_BYTES_PER_HALF) {
-      // Full fill
-      read_audio_data(&i2s_buffer[I2S_HALFWORDS_PER_HALF], USB_BYTES_PER_HALF);
-      second_half_needs_fill = 0;
-#if AUDIO_DEBUG
-      full_fill_count++;
-#endif
-    } else if (available >= 6) {
-      // Partial fill - read what we can, hold the rest
-      uint16_t frames_read =
-          read_audio_data(&i2s_buffer[I2S_HALFWORDS_PER_HALF], available);
-      uint16_t frames_remaining = STEREO_FRAMES_PER_HALF - frames_read;
-      fill_with_hold(&i2s_buffer[I2S_HALFWORDS_PER_HALF + frames_read * 4],
-                     frames_remaining);
-      second_half_needs_fill = 0;
-#if AUDIO_DEBUG
-      partial_fill_count++;
-      SEGGER_RTT_printf(0, "PARTIAL2: avail=%d, frames=%d\n", available,
-                        frames_read);
+void audio_output_set_asrc(bool engaged, int32_t ppm_q8) {
+#if AUDIO_OUTPUT_ASRC
+  asrc_ppm_q8 = ppm_q8;
+  asrc_engaged = engaged;
+#else
+  (void)engaged;
+  (void)ppm_q8;
 #endif
-    } else {
-      // No data available - fill with held last sample
-      fill_with_hold(&i2s_buffer[I2S_HALFWORDS_PER_HALF],
-                     STEREO_FRAMES_PER_HALF);
-      second_half_needs_fill = 0;
-#if AUDIO_DEBUG
-      underrun_count++;
-      SEGGER_RTT_printf(0, "UNDERRUN2: t=%lu\n", HAL_GetTick());
+}
+
+bool audio_output_ran_short(void) {
+  // The audio stage only sets it, below the USB interrupt
+  bool r = ran_short;
+  ran_short = 0;
+  return r;
+}
+
+bool audio_output_set_latency(uint8_t id) {
+  if (!audio_latency_preset(id))
+    return false;
+  ring_request = id; // picked up by the audio stage
+  return true;
+}
+
+uint8_t audio_output_get_latency(void) { return ring_id; }
+
+uint8_t audio_output_get_latency_request(void) { return ring_request; }
+
+uint16_t audio_output_fifo_target(void) {
+  return ring->fifo_target;
+}
+
+// The I2S clock has to stop for the new divider (the PCM5102A mutes itself
+// on the clock halt and ramps back in). 48kHz: MCLK = 24.576MHz / 2 =
+// 256fs; 96kHz: undivided, 256fs again. 44.1 and 88.2kHz streams play at
+// 48 and 96kHz through the resampler: between rates of one I2S rate the
+// clock keeps running and only the FIFO target changes. The stale audio in
+// the FIFO is dropped and an open stream prebuffers again at the new rate.
+bool audio_output_set_rate(uint32_t rate) {
+  uint32_t i2s = audio_latency_i2s_rate(rate);
+  if (!i2s || rate > CFG_TUD_AUDIO_FUNC_1_MAX_SAMPLE_RATE_FS)
+    return false;
+  if (rate == stream_rate)
+    return true;
+
+  uint32_t key = audio_output_lock();
+#if DMA_UNPACK
+  unpack_dma_finish();
 #endif
+  bool ok = true;
+  if (i2s != i2s_rate) {
+    ring_stop();
+    uint32_t old = hi2s1.Init.AudioFreq;
+    hi2s1.Init.AudioFreq = i2s;
+    ok = HAL_I2S_Init(&hi2s1) == HAL_OK;
+    if (!ok) {
+      hi2s1.Init.AudioFreq = old;
+      HAL_I2S_Init(&hi2s1);
+    } else {
+      i2s_rate = i2s;
+      stream_rate = rate;
     }
+    ring_start();
+  } else {
+    stream_rate = rate;
+    audio_latency_preset_t cfg = ring_preset(ring_id);
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    ring_cfg = cfg;
+    __set_PRIMASK(primask);
   }
+  resampling = stream_rate != i2s_rate;
+  audio_resample_reset(&resampler);
+#if AUDIO_OUTPUT_ASRC
+  asrc_engaged = 0;
+  asrc_running = 0;
+  audio_asrc_reset(&asrc);
+#endif
 
-#if AUDIO_DEBUG
-  // Periodic status report every 2 seconds
-  uint32_t now = HAL_GetTick();
-  if (now - last_report_tick >= 2000) {
-    uint16_t fifo_now = usb_audio_available();
-    int16_t avg_delta = 0;
-    if (fifo_sample_count > 0)
-      avg_delta = (int16_t)(fifo_sum_delta / fifo_sample_count);
-
-    SEGGER_RTT_printf(0,
-        "FIFO: now=%d mid=%d | delta min=%d avg=%d max=%d | "
-        "fills=%lu partial=%lu under=%lu\n",
-        fifo_now, FIFO_MIDPOINT,
-        fifo_min_delta, avg_delta, fifo_max_delta,
-        full_fill_count, partial_fill_count, underrun_count);
-
-    // Reset counters
-    full_fill_count = 0;
-    partial_fill_count = 0;
-    underrun_count = 0;
-    fifo_min_delta = 0;
-    fifo_max_delta = 0;
-    fifo_sum_delta = 0;
-    fifo_sample_count = 0;
-    last_report_tick = now;
+  if (streaming) {
+    prebuffering = 1;
+    usb_audio_consume(usb_audio_available());
+    last_sample_left = SILENCE_DC_OFFSET;
+    last_sample_right = SILENCE_DC_OFFSET;
   }
+  // The EQ runs after the resampler
+  audio_eq_set_rate(i2s_rate);
+  eq_profile_set_rate(i2s_rate);
+  audio_output_unlock(key);
+
+  SEGGER_RTT_printf(0, "[audio] %u Hz stream, I2S at %u Hz%s\n",
+                    (unsigned)stream_rate, (unsigned)i2s_rate,
+                    ok ? "" : " (rate change failed)");
+  return ok;
+}
+
+uint32_t audio_output_get_rate(void) { return stream_rate; }
+
+void audio_output_set_capture(bool on) {
+#if USB_AUDIO_LOOPBACK
+  // From an empty FIFO: the audio stage may have been part-way through a
+  // period as TinyUSB cleared it on the last close
+  uint32_t key = audio_output_lock();
+  if (on && !capturing)
+    tud_audio_clear_ep_in_ff();
+  capturing = on;
+  audio_output_unlock(key);
+#else
+  (void)on;
 #endif
 }
 
+// The ring keeps running: only the FIFO target changes
+bool audio_output_set_format(uint8_t sample_bytes) {
+  if (sample_bytes != 2 && sample_bytes != 3)
+    return false;
+  uint32_t key = audio_output_lock();
+  usb_frame_bytes = (uint8_t)(2U * sample_bytes);
+  audio_latency_preset_t cfg = ring_preset(ring_id);
+  uint32_t primask = __get_PRIMASK();
+  __disable_irq();
+  ring_cfg = cfg;
+  __set_PRIMASK(primask);
+  audio_output_unlock(key);
+  return true;
+}
+
+uint8_t audio_output_get_frame_bytes(void) { return usb_frame_bytes; }
+
+uint32_t audio_output_get_i2s_rate(void) { return i2s_rate; }
+
 static void update_mute_state(void) {
   // Only local mute uses hardware DAC mute (user-initiated, accepts the pop).
   // USB mute is handled digitally via get_volume_scale() to avoid PCM5102A
@@ -574,25 +1410,23 @@ void audio_output_toggle_local_mute(void) {
 uint8_t audio_output_is_local_muted(void) { return local_muted; }
 
 //--------------------------------------------------------------------+
-// HAL I2S DMA Callbacks
+// I2S DMA interrupt
 //--------------------------------------------------------------------+
 
-// Called when first half of buffer has been sent
-void HAL_I2S_TxHalfCpltCallback(I2S_HandleTypeDef *hi2s) {
-  if (hi2s->Instance == SPI1) {
-    first_half_needs_fill = 1;
-#if AUDIO_DEBUG
-    fifo_track_level();
-#endif
-  }
-}
+// One TC per period played. Clears every flag, so the HAL handler that runs
+// after it in GPDMA1_Channel0_IRQHandler finds nothing to do.
+void audio_output_dma_irq(void) {
+  DMA_Channel_TypeDef *ch = I2S_DMA_CH;
+  uint32_t sr = ch->CSR;
+  ch->CFCR = I2S_DMA_CLEAR_ALL;
 
-// Called when second half of buffer has been sent (full transfer complete)
-void HAL_I2S_TxCpltCallback(I2S_HandleTypeDef *hi2s) {
-  if (hi2s->Instance == SPI1) {
-    second_half_needs_fill = 1;
-#if AUDIO_DEBUG
-    fifo_track_level();
-#endif
+  if (sr & I2S_DMA_ERRORS) {
+    ring_error = 1; // the hardware disabled the channel
+    TRACE(TRACE_DMA_ERROR, 0, 0);
+  }
+  if (sr & DMA_CSR_TCF) {
+    periods_played++;
+    TRACE(TRACE_DMA_PERIOD, 0, periods_played);
   }
+  audio_stage_pend();
 }
@@ -0,0 +1,56 @@
+// SPDX-License-Identifier: GPL-3.0-only
+// Copyright (c) 2026 Elia Chiarucci
+
+/*
+ * PCM conversion kernels of the audio stage (see audio_pcm.h)
+ */
+
+#include "audio_pcm.h"
+
+void audio_pcm_swap(int32_t *buf, uint16_t sample_count) {
+    for (uint16_t i = 0; i < sample_count; i += 2) {
+        int32_t tmp = buf[i];
+        buf[i] = buf[i + 1];
+        buf[i + 1] = tmp;
+    }
+}
+
+void audio_pcm_volume(int32_t *buf, uint16_t sample_count, uint32_t from,
+                      uint32_t to) {
+    if (from != to && sample_count) {
+        // Incremental Q16.16 step: one division per buffer, not per sample
+        int64_t acc = (int64_t)from << 16;
+        int64_t step = (((int64_t)to - (int64_t)from) << 16) / sample_count;
+        for (uint16_t i = 0; i < sample_count; i++) {
+            uint32_t v = (uint32_t)(acc >> 16);
+            buf[i] = (int32_t)(((int64_t)buf[i] * v) >> 16);
+            acc += step;
+        }
+    } else if (to < AUDIO_PCM_UNITY) {
+        for (uint16_t i = 0; i < sample_count; i++)
+            buf[i] = (int32_t)(((int64_t)buf[i] * to) >> 16);
+    }
+}
+
+// Forward-safe in place: buf[i] and out[i] share the same address
+void audio_pcm_pack(int32_t *buf, uint16_t sample_count) {
+    uint32_t *out = (uint32_t *)buf;
+    for (uint16_t i = 0; i < sample_count; i++) {
+        int32_t s = buf[i];
+        if (s == 0)
+            s = AUDIO_PCM_DC_OFFSET;
+        out[i] = (uint32_t)s << 8;
+    }
+}
+
+void audio_pcm_unpack_i2s(const uint32_t *words, uint8_t *out,
+                          uint16_t sample_count, bool swap) {
+    uint32_t flip = swap ? 1U : 0U;
+    for (uint16_t i = 0; i < sample_count; i++) {
+        uint32_t w = words[i ^ flip];
+        out[0] = (uint8_t)(w >> 8);
+        out[1] = (uint8_t)(w >> 16);
+        out[2] = (uint8_t)(w >> 24);
+        out += 3;
+    }
+}
@@ -0,0 +1,54 @@
+// SPDX-License-Identifier: GPL-3.0-only
+// Copyright (c) 2026 Elia Chiarucci
+
+/*
+ * Steerable I2S kernel clock for the adaptive clock mode (see audio_pll.h)
+ */
+
+#include "audio_pll.h"
+#include "main.h"
+
+#if AUDIO_ADAPTIVE_CLOCK
+
+void audio_pll_init(void) {
+    RCC_PeriphCLKInitTypeDef clk = {0};
+    clk.PeriphClockSelection = RCC_PERIPHCLK_SPI1;
+    clk.Spi1ClockSelection = RCC_SPI1CLKSOURCE_PLL2P;
+    clk.PLL2.PLL2Source = RCC_PLL2_SOURCE_HSI;
+    clk.PLL2.PLL2M = AUDIO_PLL_M;
+    clk.PLL2.PLL2N = AUDIO_PLL_N;
+    clk.PLL2.PLL2P = AUDIO_PLL_P;
+    clk.PLL2.PLL2Q = 2;
+    clk.PLL2.PLL2R = 2;
+    clk.PLL2.PLL2RGE = RCC_PLL2_VCIRANGE_3; // 8MHz in
+    clk.PLL2.PLL2VCOSEL = RCC_PLL2_VCORANGE_WIDE; // 516MHz
+    clk.PLL2.PLL2FRACN = AUDIO_PLL_FRACN_CENTER;
+    clk.PLL2.PLL2ClockOut = RCC_PLL2_DIVP;
+    if (HAL_RCCEx_PeriphCLKConfig(&clk) != HAL_OK)
+        Error_Handler();
+}
+
+void audio_pll_set_ppm(int32_t ppm_q8) {
+    // Nearest step: ppm * STEPS / 1e6, in 1/256 ppm
+    int64_t steps = (int64_t)ppm_q8 * AUDIO_PLL_STEPS;
+    steps = (steps + (steps < 0 ? -128000000 : 128000000)) / 256000000;
+    int32_t fracn = AUDIO_PLL_FRACN_CENTER + (int32_t)steps;
+    if (fracn < 0)
+        fracn = 0;
+    if (fracn > AUDIO_PLL_FRACN_MAX)
+        fracn = AUDIO_PLL_FRACN_MAX;
+
+    // FRACN is taken into the sigma-delta modulator as FRACEN rises: the
+    // VCO moves by the step without relocking
+    __HAL_RCC_PLL2_FRACN_DISABLE();
+    __HAL_RCC_PLL2_FRACN_CONFIG((uint32_t)fracn);
+    __HAL_RCC_PLL2_FRACN_ENABLE();
+}
+
+#else
+
+void audio_pll_init(void) {}
+
+void audio_pll_set_ppm(int32_t ppm_q8) { (void)ppm_q8; }
+
+#endif // AUDIO_ADAPTIVE_CLOCK
@@ -0,0 +1,89 @@
+// SPDX-License-Identifier: GPL-3.0-only
+// Copyright (c) 2026 Elia Chiarucci
+
+/*
+ * 44.1kHz-family to 48kHz-family resampler (see audio_resample.h)
+ */
+
+#include "audio_resample.h"
+#include <string.h>
+
+#define L AUDIO_RESAMPLE_PHASES
+#define M AUDIO_RESAMPLE_STEP
+#define T AUDIO_RESAMPLE_TAPS
+
+_Static_assert(M < L, "downsampling would need a narrower filter");
+_Static_assert(L <= 256 && T <= 128, "phase and pos are uint8_t");
+
+#define SAMPLE_MAX 8388607.0f
+#define SAMPLE_MIN -8388608.0f
+
+void audio_resample_reset(audio_resample_t *rs) {
+    memset(rs, 0, sizeof(*rs));
+}
+
+uint16_t audio_resample_needed(const audio_resample_t *rs,
+                               uint16_t out_frames) {
+    return (uint16_t)(((uint32_t)rs->phase + (uint32_t)out_frames * M) / L);
+}
+
+uint16_t audio_resample_possible(const audio_resample_t *rs,
+                                 uint16_t in_frames) {
+    // Largest n with phase + n * M < (in_frames + 1) * L
+    uint32_t room = ((uint32_t)in_frames + 1U) * L - rs->phase - 1U;
+    uint32_t n = room / M;
+    return n > UINT16_MAX ? UINT16_MAX : (uint16_t)n;
+}
+
+static inline void push(audio_resample_t *rs, const int32_t *frame) {
+    float l = (float)frame[0];
+    float r = (float)frame[1];
+    rs->hist[rs->pos][0] = l;
+    rs->hist[rs->pos][1] = r;
+    rs->hist[rs->pos + T][0] = l;
+    rs->hist[rs->pos + T][1] = r;
+    rs->pos = (uint8_t)((rs->pos + 1U) % T);
+}
+
+static inline int32_t to_s24(float y) {
+    if (y > SAMPLE_MAX)
+        y = SAMPLE_MAX;
+    if (y < SAMPLE_MIN)
+        y = SAMPLE_MIN;
+    return (int32_t)(y >= 0.0f ? y + 0.5f : y - 0.5f);
+}
+
+void audio_resample_process(audio_resample_t *rs, const int32_t *in,
+                            int32_t *out, uint16_t out_frames) {
+    for (uint16_t n = 0; n < out_frames; n++) {
+        // Take the inputs up to this output's position first: with in at
+        // the tail of out, the slot stored below is then always free
+        uint32_t phase = (uint32_t)rs->phase + M;
+        while (phase >= L) {
+            push(rs, in);
+            in += 2;
+            phase -= L;
+        }
+        rs->phase = (uint8_t)phase;
+
+        // Window oldest to newest. Phase p's taps run newest to oldest;
+        // the upper half are the lower half's reversed.
+        const float (*w)[2] = &rs->hist[rs->pos];
+        float l = 0.0f, r = 0.0f;
+        if (phase < L / 2) {
+            const float *c = &audio_resample_taps[phase][T - 1];
+            for (uint32_t j = 0; j < T; j++) {
+                l += c[-(int32_t)j] * w[j][0];
+                r += c[-(int32_t)j] * w[j][1];
+            }
+        } else {
+            const float *c = audio_resample_taps[L - 1 - phase];
+            for (uint32_t j = 0; j < T; j++) {
+                l += c[j] * w[j][0];
+                r += c[j] * w[j][1];
+            }
+        }
+        out[2 * n] = to_s24(l);
+        out[2 * n + 1] = to_s24(r);
+    }
+}
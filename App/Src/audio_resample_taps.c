@@ -0,0 +1,817 @@
+// SPDX-License-Identifier: GPL-3.0-only
+// Copyright (c) 2026 Elia Chiarucci
+
+/*
+ * Polyphase filter of the 44.1 -> 48kHz resampler (see audio_resample.h)
+ *
+ * Generated by scripts/gen_resample_taps.py: 32 taps x 160 phases,
+ * Kaiser beta 9.069, passband 20000Hz, stopband 28000Hz
+ * at 48kHz out. Do not edit.
+ */
+
+#include "audio_resample.h"
+
+// [phase][tap]: tap k of phase p multiplies the input k frames back
+const float audio_resample_taps[AUDIO_RESAMPLE_PHASES / 2]
+                               [AUDIO_RESAMPLE_TAPS] = {
+    {  // phase 0
+        -1.638803899e-05f, 8.562434431e-05f, -2.080183484e-04f, 3.279277038e-04f,
+        -2.758570138e-04f, -2.740099959e-04f, 1.809434679e-03f, -4.925248728e-03f,
+        1.019959563e-02f, -1.801747245e-02f, 2.838357323e-02f, -4.078262500e-02f,
+        5.414209699e-02f, -6.692250733e-02f, 7.728582257e-02f, -8.289832918e-02f,
+        1.088393042e+00f, -8.877696075e-02f, 7.970947985e-02f, -6.804878891e-02f,
+        5.458523466e-02f, -4.084709777e-02f, 2.825757637e-02f, -1.782222285e-02f,
+        1.000761482e-02f, -4.772151536e-03f, 1.704942083e-03f, -2.124702213e-04f,
+        -3.066008138e-04f, 3.403346980e-04f, -2.115779831e-04f, 8.602713465e-05f,
+    },
+    {  // phase 1
+        -1.655355542e-05f, 8.516776326e-05f, -2.043101197e-04f, 3.152376679e-04f,
+        -2.447223466e-04f, -3.358714147e-04f, 1.913757341e-03f, -5.076941773e-03f,
+        1.038785597e-02f, -1.820532651e-02f, 2.849700688e-02f, -4.069896391e-02f,
+        5.367176386e-02f, -6.575914371e-02f, 7.480916435e-02f, -7.690460955e-02f,
+        1.088226127e+00f, -9.453973502e-02f, 8.207943977e-02f, -6.913767893e-02f,
+        5.500110534e-02f, -4.089244223e-02f, 2.811913425e-02f, -1.761970523e-02f,
+        9.812022932e-03f, -4.617730119e-03f, 1.600329933e-03f, -1.512790572e-04f,
+        -3.369421400e-04f, 3.524552656e-04f, -2.149889435e-04f, 8.637674025e-05f,
+    },
+    {  // phase 2
+        -1.671016943e-05f, 8.465679379e-05f, -2.004534223e-04f, 3.022680984e-04f,
+        -2.132086695e-04f, -3.980270915e-04f, 2.017859092e-03f, -5.227150042e-03f,
+        1.057228577e-02f, -1.838565714e-02f, 2.859775965e-02f, -4.059605601e-02f,
+        5.317431029e-02f, -6.455901467e-02f, 7.228021633e-02f, -7.079659856e-02f,
+        1.087892152e+00f, -1.001859052e-01f, 8.439501862e-02f, -7.018887394e-02f,
+        5.538964061e-02f, -4.091871976e-02f, 2.796836517e-02f, -1.741004682e-02f,
+        9.612928800e-03f, -4.462063779e-03f, 1.495648082e-03f, -9.046309337e-05f,
+        -3.668696133e-04f, 3.642861340e-04f, -2.182511902e-04f, 8.667377429e-05f,
+    },
+    {  // phase 3
+        -1.685752831e-05f, 8.409087687e-05f, -1.964484996e-04f, 2.890227383e-04f,
+        -1.813281781e-04f, -4.604493372e-04f, 2.121689035e-03f, -5.375793971e-03f,
+        1.075277794e-02f, -1.855834244e-02f, 2.868572416e-02f, -4.047385858e-02f,
+        5.264983364e-02f, -6.332246693e-02f, 6.969973078e-02f, -6.457514819e-02f,
+        1.087391211e+00f, -1.057147791e-01f, 8.665557375e-02f, -7.120210060e-02f,
+        5.575079424e-02f, -4.092600730e-02f, 2.780539748e-02f, -1.719338067e-02f,
+        9.410444073e-03f, -4.305232797e-03f, 1.390946409e-03f, -3.004859539e-05f,
+        -3.963721977e-04f, 3.758242638e-04f, -2.213647987e-04f, 8.691888657e-05f,
+    },
+    {  // phase 4
+        -1.699527997e-05f, 8.346947787e-05f, -1.922956764e-04f, 2.755055064e-04f,
+        -1.490933490e-04f, -5.231101337e-04f, 2.225196072e-03f, -5.522794281e-03f,
+        1.092922665e-02f, -1.872326349e-02f, 2.876079849e-02f, -4.033233762e-02f,
+        5.209844414e-02f, -6.204986550e-02f, 6.706848709e-02f, -5.824115008e-02f,
+        1.086723444e+00f, -1.111257046e-01f, 8.886049016e-02f, -7.217710400e-02f,
+        5.608453268e-02f, -4.091439018e-02f, 2.763036460e-02f, -1.696984244e-02f,
+        9.204681401e-03f, -4.147317541e-03f, 1.286274486e-03f, 2.993855284e-05f,
+        -4.254391554e-04f, 3.870667918e-04f, -2.243299219e-04f, 8.711274792e-05f,
+    },
+    {  // phase 5
+        -1.712307326e-05f, 8.279208722e-05f, -1.879953603e-04f, 2.617204967e-04f,
+        -1.165169359e-04f, -5.859811459e-04f, 2.328328935e-03f, -5.668072007e-03f,
+        1.110152742e-02f, -1.888030443e-02f, 2.882288623e-02f, -4.017146792e-02f,
+        5.152026485e-02f, -6.074159354e-02f, 6.438729161e-02f, -5.179553541e-02f,
+        1.085889037e+00f, -1.164180700e-01f, 9.100918064e-02f, -7.311364773e-02f,
+        5.639083508e-02f, -4.088396206e-02f, 2.744340489e-02f, -1.673957031e-02f,
+        8.995754373e-03f, -3.988398423e-03f, 1.181681549e-03f, 8.947285913e-05f,
+        -4.540600495e-04f, 3.980110304e-04f, -2.271467895e-04f, 8.725604953e-05f,
+    },
+    {  // phase 6
+        -1.724055819e-05f, 8.205822100e-05f, -1.835480417e-04f, 2.476719779e-04f,
+        -8.361196544e-05f, -6.490337325e-04f, 2.431036203e-03f, -5.811548546e-03f,
+        1.126957718e-02f, -1.902935249e-02f, 2.887189656e-02f, -3.999123310e-02f,
+        5.091543174e-02f, -5.939805233e-02f, 6.165697752e-02f, -4.523927473e-02f,
+        1.084888222e+00f, -1.215913039e-01f, 9.310108581e-02f, -7.401151382e-02f,
+        5.666969319e-02f, -4.083482482e-02f, 2.724466162e-02f, -1.650270493e-02f,
+        8.783777455e-03f, -3.828555863e-03f, 1.077216485e-03f, 1.485292326e-04f,
+        -4.822247473e-04f, 4.086544679e-04f, -2.298157067e-04f, 8.734950224e-05f,
+    },
+    {  // phase 7
+        -1.734738628e-05f, 8.126742164e-05f, -1.789542952e-04f, 2.333643928e-04f,
+        -5.039173287e-05f, -7.122389584e-04f, 2.533266329e-03f, -5.953145693e-03f,
+        1.143327430e-02f, -1.917029811e-02f, 2.890774433e-02f, -3.979162566e-02f,
+        5.028409362e-02f, -5.801966116e-02f, 5.887840462e-02f, -3.857337774e-02f,
+        1.083721279e+00f, -1.266448753e-01f, 9.513567415e-02f, -7.487050281e-02f,
+        5.692111133e-02f, -4.076708848e-02f, 2.703428282e-02f, -1.625938931e-02f,
+        8.568865937e-03f, -3.667870250e-03f, 9.729278025e-04f, 2.070829930e-04f,
+        -5.099234221e-04f, 4.189947678e-04f, -2.323370533e-04f, 8.739383587e-05f,
+    },
+    {  // phase 8
+        -1.744321076e-05f, 8.041925854e-05f, -1.742147796e-04f, 2.188023580e-04f,
+        -1.686979766e-05f, -7.755676069e-04f, 2.634967665e-03f, -6.092785680e-03f,
+        1.159251867e-02f, -1.930303495e-02f, 2.893035012e-02f, -3.957264704e-02f,
+        4.962641216e-02f, -5.660685726e-02f, 5.605245919e-02f, -3.179889314e-02f,
+        1.082388532e+00f, -1.315782936e-01f, 9.711244212e-02f, -7.569043370e-02f,
+        5.714510631e-02f, -4.068087113e-02f, 2.681242122e-02f, -1.600976879e-02f,
+        8.351135867e-03f, -3.506421902e-03f, 8.688636160e-04f, 2.651098798e-04f,
+        -5.371465565e-04f, 4.290297685e-04f, -2.347112830e-04f, 8.738979850e-05f,
+    },
+    {  // phase 9
+        -1.752768697e-05f, 7.951332867e-05f, -1.693302387e-04f, 2.039906625e-04f,
+        1.694002118e-05f, -8.389901913e-04f, 2.736088485e-03f, -6.230391216e-03f,
+        1.174721174e-02f, -1.942746003e-02f, 2.893964028e-02f, -3.933430765e-02f,
+        4.894256189e-02f, -5.516009569e-02f, 5.318005376e-02f, -2.491690840e-02f,
+        1.080890355e+00f, -1.363911084e-01f, 9.903091411e-02f, -7.647114396e-02f,
+        5.734170740e-02f, -4.057629882e-02f, 2.657923418e-02f, -1.575399088e-02f,
+        8.130704000e-03f, -3.344291033e-03f, 7.650716236e-04f, 3.225860611e-04f,
+        -5.638849439e-04f, 4.387574826e-04f, -2.369389216e-04f, 8.733815581e-05f,
+    },
+    {  // phase 10
+        -1.760047255e-05f, 7.854925718e-05f, -1.643015019e-04f, 1.889342676e-04f,
+        5.102364997e-05f, -9.024769681e-04f, 2.836577009e-03f, -6.365885529e-03f,
+        1.189725657e-02f, -1.954347371e-02f, 2.893554704e-02f, -3.907662689e-02f,
+        4.823273017e-02f, -5.367984922e-02f, 5.026212695e-02f, -1.792854953e-02f,
+        1.079227164e+00f, -1.410829101e-01f, 1.008906425e-01f, -7.721248950e-02f,
+        5.751095619e-02f, -4.045350548e-02f, 2.633488353e-02f, -1.549220527e-02f,
+        7.907687732e-03f, -3.181557709e-03f, 6.615990870e-04f, 3.794881423e-04f,
+        -5.901296907e-04f, 4.481760966e-04f, -2.390205669e-04f, 8.723969035e-05f,
+    },
+    {  // phase 11
+        -1.766122781e-05f, 7.752669805e-05f, -1.591294847e-04f, 1.736383052e-04f,
+        8.536676524e-05f, -9.659979496e-04f, 2.936381428e-03f, -6.499192403e-03f,
+        1.204255792e-02f, -1.965097983e-02f, 2.891800852e-02f, -3.879963320e-02f,
+        4.749711716e-02f, -5.216660824e-02f, 4.729964318e-02f, -1.083498085e-02f,
+        1.077399424e+00f, -1.456533290e-01f, 1.026912078e-01f, -7.791434463e-02f,
+        5.765290662e-02f, -4.031263282e-02f, 2.607953554e-02f, -1.522456369e-02f,
+        7.682205046e-03f, -3.018301817e-03f, 5.584928115e-04f, 4.357931738e-04f,
+        -6.158722187e-04f, 4.572839698e-04f, -2.409568867e-04f, 8.709520083e-05f,
+    },
+    {  // phase 12
+        -1.770961597e-05f, 7.644533462e-05f, -1.538151889e-04f, 1.581080772e-04f,
+        1.199547990e-04f, -1.029522917e-03f, 3.035449930e-03f, -6.630236218e-03f,
+        1.218302226e-02f, -1.974988571e-02f, 2.888696883e-02f, -3.850336410e-02f,
+        4.673593580e-02f, -5.062088061e-02f, 4.429359253e-02f, -3.637404751e-03f,
+        1.075407645e+00f, -1.501020362e-01f, 1.044322183e-01f, -7.857660201e-02f,
+        5.776762477e-02f, -4.015383022e-02f, 2.581336079e-02f, -1.495121985e-02f,
+        7.454374453e-03f, -2.854603025e-03f, 4.557991263e-04f, 4.914786597e-04f,
+        -6.411042660e-04f, 4.660796340e-04f, -2.427486181e-04f, 8.690550146e-05f,
+    },
+    {  // phase 13
+        -1.774530351e-05f, 7.530488025e-05f, -1.483597033e-04f, 1.423490544e-04f,
+        1.547729438e-04f, -1.093021431e-03f, 3.133730723e-03f, -6.758941992e-03f,
+        1.231855785e-02f, -1.984010227e-02f, 2.884237809e-02f, -3.818786619e-02f,
+        4.594941176e-02f, -4.904319155e-02f, 4.124499044e-02f, 3.662938607e-03f,
+        1.073252381e+00f, -1.544287429e-01f, 1.061133105e-01f, -7.919917266e-02f,
+        5.785518889e-02f, -3.997725461e-02f, 2.553653406e-02f, -1.467232935e-02f,
+        7.224314931e-03f, -2.690540745e-03f, 3.535638655e-04f, 5.465225651e-04f,
+        -6.658178894e-04f, 4.745617920e-04f, -2.443965663e-04f, 8.667142123e-05f,
+    },
+    {  // phase 14
+        -1.776796043e-05f, 7.410507883e-05f, -1.427642039e-04f, 1.263668748e-04f,
+        1.898061585e-04f, -1.156462852e-03f, 3.231172062e-03f, -6.885235418e-03f,
+        1.244907478e-02f, -1.992154402e-02f, 2.878419249e-02f, -3.785319519e-02f,
+        4.513778342e-02f, -4.743408347e-02f, 3.815487749e-02f, 1.106477154e-02f,
+        1.070934234e+00f, -1.586332004e-01f, 1.077341488e-01f, -7.978198585e-02f,
+        5.791568922e-02f, -3.978307042e-02f, 2.524923426e-02f, -1.438804961e-02f,
+        6.992145867e-03f, -2.526194097e-03f, 2.518323492e-04f, 6.009033237e-04f,
+        -6.900054649e-04f, 4.827293175e-04f, -2.459016033e-04f, 8.639380319e-05f,
+    },
+    {  // phase 15
+        -1.777726058e-05f, 7.284570536e-05f, -1.370299544e-04f, 1.101673428e-04f,
+        2.250391739e-04f, -1.219816345e-03f, 3.327722274e-03f, -7.009042902e-03f,
+        1.257448504e-02f, -1.999412918e-02f, 2.871237436e-02f, -3.749941594e-02f,
+        4.430130179e-02f, -4.579411584e-02f, 3.502431914e-02f, 1.856677917e-02f,
+        1.068453850e+00f, -1.627152005e-01f, 1.092944255e-01f, -8.032498904e-02f,
+        5.794922794e-02f, -3.957144940e-02f, 2.495164431e-02f, -1.409853977e-02f,
+        6.757987000e-03f, -2.361641876e-03f, 1.506493651e-04f, 6.545998450e-04f,
+        -7.136596896e-04f, 4.905812531e-04f, -2.472646667e-04f, 8.607350377e-05f,
+    },
+    {  // phase 16
+        -1.777288195e-05f, 7.152656652e-05f, -1.311583063e-04f, 9.375642736e-05f,
+        2.604564981e-04f, -1.283050899e-03f, 3.423329782e-03f, -7.130291607e-03f,
+        1.269470253e-02f, -2.005777973e-02f, 2.862689219e-02f, -3.712660242e-02f,
+        4.344023050e-02f, -4.412386506e-02f, 3.185440542e-02f, 2.616760967e-02f,
+        1.065811920e+00f, -1.666745748e-01f, 1.107938609e-01f, -8.082814785e-02f,
+        5.795591907e-02f, -3.934257057e-02f, 2.464395103e-02f, -1.380396063e-02f,
+        6.521958361e-03f, -2.196962510e-03f, 5.005915004e-05f, 7.075915209e-04f,
+        -7.367735823e-04f, 4.981168103e-04f, -2.484867587e-04f, 8.571139208e-05f,
+    },
+    {  // phase 17
+        -1.775450698e-05f, 7.014750119e-05f, -1.251506989e-04f, 7.714026063e-05f,
+        2.960424229e-04f, -1.346135340e-03f, 3.517943131e-03f, -7.248909488e-03f,
+        1.280964317e-02f, -2.011242140e-02f, 2.852772068e-02f, -3.673483777e-02f,
+        4.255484569e-02f, -4.242392423e-02f, 2.864625073e-02f, 3.386587468e-02f,
+        1.063009180e+00f, -1.705111950e-01f, 1.122322030e-01f, -8.129144594e-02f,
+        5.793588833e-02f, -3.909662006e-02f, 2.432634505e-02f, -1.350447455e-02f,
+        6.284180218e-03f, -2.032234033e-03f, -4.989462742e-05f, 7.598582326e-04f,
+        -7.593404847e-04f, 5.053353672e-04f, -2.495689444e-04f, 8.530834919e-05f,
+    },
+    {  // phase 18
+        -1.772182287e-05f, 6.870838098e-05f, -1.190086601e-04f, 6.032513624e-05f,
+        3.317810297e-04f, -1.409038342e-03f, 3.611511015e-03f, -7.364825334e-03f,
+        1.291922491e-02f, -2.015798383e-02f, 2.841484079e-02f, -3.632421427e-02f,
+        4.164543600e-02f, -4.069490302e-02f, 2.540099344e-02f, 4.166014954e-02f,
+        1.060046412e+00f, -1.742249728e-01f, 1.136092278e-01f, -8.171488497e-02f,
+        5.788927305e-02f, -3.883379100e-02f, 2.399902068e-02f, -1.320024536e-02f,
+        6.044773013e-03f, -1.867534042e-03f, -1.491688844e-04f, 8.113803567e-04f,
+        -7.813540616e-04f, 5.122364681e-04f, -2.505123509e-04f, 8.486526746e-05f,
+    },
+    {  // phase 19
+        -1.767452189e-05f, 6.720911074e-05f, -1.127338062e-04f, 4.331750760e-05f,
+        3.676561959e-04f, -1.471728447e-03f, 3.703982302e-03f, -7.477968802e-03f,
+        1.302336779e-02f, -2.019440051e-02f, 2.828823978e-02f, -3.589483337e-02f,
+        4.071230243e-02f, -3.893742748e-02f, 2.211979569e-02f, 4.954897373e-02f,
+        1.056924439e+00f, -1.778158592e-01f, 1.149247389e-01f, -8.209848446e-02f,
+        5.781622206e-02f, -3.855428341e-02f, 2.366217585e-02f, -1.289143830e-02f,
+        5.803857306e-03f, -1.702939669e-03f, -2.477211407e-04f, 8.621387713e-04f,
+        -8.028083021e-04f, 5.188198218e-04f, -2.513181658e-04f, 8.438304983e-05f,
+    },
+    {  // phase 20
+        -1.761230167e-05f, 6.564962908e-05f, -1.063278416e-04f, 2.612398602e-05f,
+        4.036516012e-04f, -1.534174073e-03f, 3.795306057e-03f, -7.588270463e-03f,
+        1.312199399e-02f, -2.022160893e-02f, 2.814791123e-02f, -3.544680563e-02f,
+        3.975575832e-02f, -3.715213987e-02f, 1.880384300e-02f, 5.753085118e-02f,
+        1.053644132e+00f, -1.812838453e-01f, 1.161785675e-01f, -8.244228172e-02f,
+        5.771689555e-02f, -3.825830409e-02f, 2.331601194e-02f, -1.257821991e-02f,
+        5.561553722e-03f, -1.538527545e-03f, -3.455095355e-04f, 9.121148618e-04f,
+        -8.236975191e-04f, 5.250853003e-04f, -2.519876359e-04f, 8.386260911e-05f,
+    },
+    {  // phase 21
+        -1.753486553e-05f, 6.402990880e-05f, -9.979255973e-05f, 8.751338796e-06f,
+        4.397507340e-04f, -1.596343535e-03f, 3.885431573e-03f, -7.695661832e-03f,
+        1.321502788e-02f, -2.023955055e-02f, 2.799385508e-02f, -3.498025080e-02f,
+        3.877612925e-02f, -3.533969841e-02f, 1.545434399e-02f, 6.560425064e-02f,
+        1.050206402e+00f, -1.846289613e-01f, 1.173705723e-01f, -8.274633175e-02f,
+        5.759146495e-02f, -3.794606644e-02f, 2.296073371e-02f, -1.226075797e-02f,
+        5.317982886e-03f, -1.374373764e-03f, -4.424928430e-04f, 9.612905262e-04f,
+        -8.440163503e-04f, 5.310329370e-04f, -2.525220661e-04f, 8.330486732e-05f,
+    },
+    {  // phase 22
+        -1.744192278e-05f, 6.234995745e-05f, -9.312984219e-05f, -8.793512833e-06f,
+        4.759368983e-04f, -1.658205053e-03f, 3.974308393e-03f, -7.800075412e-03f,
+        1.330239606e-02f, -2.024817091e-02f, 2.782607767e-02f, -3.449529771e-02f,
+        3.777375294e-02f, -3.350077712e-02f, 1.207253002e-02f, 7.376760610e-02f,
+        1.046612207e+00f, -1.878512768e-01f, 1.185006395e-01f, -8.301070708e-02f,
+        5.744011280e-02f, -3.761779040e-02f, 2.259654918e-02f, -1.193922137e-02f,
+        5.073265373e-03f, -1.210553852e-03f, -5.386304890e-04f, 1.009648180e-03f,
+        -8.637597577e-04f, 5.366629259e-04f, -2.529228175e-04f, 8.271075500e-05f,
+    },
+    {  // phase 23
+        -1.733318905e-05f, 6.060981769e-05f, -8.634165920e-05f, -2.650349584e-05f,
+        5.121932209e-04f, -1.719726773e-03f, 4.061886338e-03f, -7.901444732e-03f,
+        1.338402741e-02f, -2.024741961e-02f, 2.764459175e-02f, -3.399208434e-02f,
+        3.674897914e-02f, -3.163606560e-02f, 8.659654855e-03f, 8.201931719e-02f,
+        1.042862546e+00f, -1.909509004e-01f, 1.195686827e-01f, -8.323549771e-02f,
+        5.726303265e-02f, -3.727370227e-02f, 2.222366950e-02f, -1.161378010e-02f,
+        4.827521647e-03f, -1.047142736e-03f, -6.338825653e-04f, 1.057170762e-03f,
+        -8.829230278e-04f, 5.419756191e-04f, -2.531913065e-04f, 8.208121048e-05f,
+    },
+    {  // phase 24
+        -1.720838655e-05f, 5.880956779e-05f, -7.943006932e-05f, -4.437138762e-05f,
+        5.485026575e-04f, -1.780876778e-03f, 4.148115530e-03f, -7.999704381e-03f,
+        1.345985314e-02f, -2.023725042e-02f, 2.744941652e-02f, -3.347075771e-02f,
+        3.570216959e-02f, -2.974626879e-02f, 5.216994308e-03f, 9.035774958e-02f,
+        1.038958460e+00f, -1.939279796e-01f, 1.205746425e-01f, -8.342081095e-02f,
+        5.706042883e-02f, -3.691403458e-02f, 2.184230889e-02f, -1.128460510e-02f,
+        4.580872008e-03f, -8.842147090e-04f, -7.282098454e-04f, 1.103841738e-03f,
+        -9.015017708e-04f, 5.469715259e-04f, -2.533290035e-04f, 8.141717928e-05f,
+    },
+    {  // phase 25
+        -1.706724444e-05f, 5.694932206e-05f, -7.239721932e-05f, -6.238981835e-05f,
+        5.848480007e-04f, -1.841623105e-03f, 4.232946423e-03f, -8.094790046e-03f,
+        1.352980684e-02f, -2.021762128e-02f, 2.724057764e-02f, -3.293147395e-02f,
+        3.463369784e-02f, -2.783210676e-02f, 1.745845873e-03f, 9.878123539e-02f,
+        1.034901035e+00f, -1.967827006e-01f, 1.215184865e-01f, -8.356677129e-02f,
+        5.683251643e-02f, -3.653902600e-02f, 2.145268445e-02f, -1.095186820e-02f,
+        4.333436531e-03f, -7.218433995e-04f, -8.215737984e-04f, 1.149645104e-03f,
+        -9.194919209e-04f, 5.516513104e-04f, -2.533374310e-04f, 8.071961335e-05f,
+    },
+    {  // phase 26
+        -1.690949909e-05f, 5.502923120e-05f, -6.524534400e-05f, -8.055127341e-05f,
+        6.212118868e-04f, -1.901933760e-03f, 4.316329823e-03f, -8.186638552e-03f,
+        1.359382449e-02f, -2.018849436e-02f, 2.701810725e-02f, -3.237439818e-02f,
+        3.354394917e-02f, -2.589431445e-02f, -1.752471652e-03f, 1.072880737e-01f,
+        1.030691397e+00f, -1.995152880e-01f, 1.224002094e-01f, -8.367352022e-02f,
+        5.657952102e-02f, -3.614892113e-02f, 2.105501610e-02f, -1.061574203e-02f,
+        4.085335017e-03f, -5.601017401e-04f, -9.139366034e-04f, 1.194565394e-03f,
+        -9.368897348e-04f, 5.560157902e-04f, -2.532181623e-04f, 7.998947046e-05f,
+    },
+    {  // phase 27
+        -1.673489440e-05f, 5.304948274e-05f, -5.797676592e-05f, -9.884809590e-05f,
+        6.575768034e-04f, -1.961776734e-03f, 4.398216919e-03f, -8.275187896e-03f,
+        1.365184455e-02f, -2.014983608e-02f, 2.678204400e-02f, -3.179970455e-02f,
+        3.243332047e-02f, -2.393364145e-02f, -5.276618550e-03f, 1.158765309e-01f,
+        1.026330715e+00f, -2.021260046e-01f, 1.232198326e-01f, -8.374121618e-02f,
+        5.630167863e-02f, -3.574397041e-02f, 2.064952646e-02f, -1.027639994e-02f,
+        3.836686933e-03f, -3.990619373e-04f, -1.005261163e-03f, 1.238587678e-03f,
+        -9.536917916e-04f, 5.600659342e-04f, -2.529728207e-04f, 7.922771350e-05f,
+    },
+    {  // phase 28
+        -1.654318214e-05f, 5.101030143e-05f, -5.059389510e-05f, -1.172724893e-04f,
+        6.939250969e-04f, -2.021120017e-03f, 4.478559306e-03f, -8.360377283e-03f,
+        1.370380799e-02f, -2.010161717e-02f, 2.653243304e-02f, -3.120757615e-02f,
+        3.130222014e-02f, -2.195085175e-02f, -8.825234584e-03f, 1.245448412e-01f,
+        1.021820198e+00f, -2.046151513e-01f, 1.239774039e-01f, -8.377003428e-02f,
+        5.599923547e-02f, -3.532442998e-02f, 2.023644071e-02f, -9.934015924e-03f,
+        3.587611361e-03f, -2.387954408e-04f, -1.095511117e-03f, 1.281697571e-03f,
+        -9.698949917e-04f, 5.638028608e-04f, -2.526030772e-04f, 7.843530986e-05f,
+    },
+    {  // phase 29
+        -1.633412221e-05f, 4.891194953e-05f, -4.309922868e-05f, -1.358165200e-04f,
+        7.302389800e-04f, -2.079931613e-03f, 4.557309012e-03f, -8.442147166e-03f,
+        1.374965829e-02f, -2.004381268e-02f, 2.626932603e-02f, -3.059820498e-02f,
+        3.015106789e-02f, -1.994672345e-02f, -1.239693940e-02f, 1.332912072e-01f,
+        1.017161098e+00f, -2.069830664e-01f, 1.246729977e-01f, -8.376016624e-02f,
+        5.567244787e-02f, -3.489056151e-02f, 1.981598648e-02f, -9.588764504e-03f,
+        3.338226939e-03f, -7.937291426e-05f, -1.184650853e-03f, 1.323881234e-03f,
+        -9.854965553e-04f, 5.672278360e-04f, -2.521106495e-04f, 7.761323072e-05f,
+    },
+    {  // phase 30
+        -1.610748297e-05f, 4.675472722e-05f, -3.549535050e-05f, -1.544721206e-04f,
+        7.665005398e-04f, -2.138179560e-03f, 4.634418524e-03f, -8.520439274e-03f,
+        1.378934153e-02f, -1.997640203e-02f, 2.599278118e-02f, -2.997179192e-02f,
+        2.898029469e-02f, -1.792204852e-02f, -1.599033294e-02f, 1.421138004e-01f,
+        1.012354705e+00f, -2.092301259e-01f, 1.253067144e-01f, -8.371182016e-02f,
+        5.532158206e-02f, -3.444263206e-02f, 1.938839375e-02f, -9.240820678e-03f,
+        3.088651813e-03f, 7.913579387e-05f, -1.272645522e-03f, 1.365125373e-03f,
+        -1.000494022e-03f, 5.703422710e-04f, -2.514973005e-04f, 7.676245043e-05f,
+    },
+    {  // phase 31
+        -1.586304152e-05f, 4.453897286e-05f, -2.778493066e-05f, -1.732310922e-04f,
+        8.026917455e-04f, -2.195831942e-03f, 4.709840813e-03f, -8.595196656e-03f,
+        1.382280643e-02f, -1.989936905e-02f, 2.570286321e-02f, -2.932854665e-02f,
+        2.779034254e-02f, -1.587763252e-02f, -1.960399588e-02f, 1.510107612e-01f,
+        1.007402352e+00f, -2.113567428e-01f, 1.258786805e-01f, -8.362522038e-02f,
+        5.494691402e-02f, -3.398091394e-02f, 1.895389473e-02f, -8.890359824e-03f,
+        2.839003579e-03f, 2.366616789e-04f, -1.359461048e-03f, 1.405417248e-03f,
+        -1.014885248e-03f, 5.731477206e-04f, -2.507648367e-04f, 7.588394588e-05f,
+    },
+    {  // phase 32
+        -1.560058405e-05f, 4.226506334e-05f, -1.997072499e-05f, -1.920851078e-04f,
+        8.387944567e-04f, -2.252856905e-03f, 4.783529359e-03f, -8.666363707e-03f,
+        1.385000432e-02f, -1.981270198e-02f, 2.539964338e-02f, -2.866868764e-02f,
+        2.658166441e-02f, -1.381429430e-02f, -2.323649005e-02f, 1.599802003e-01f,
+        1.002305407e+00f, -2.133633670e-01f, 1.263890483e-01f, -8.350060728e-02f,
+        5.454872930e-02f, -3.350568456e-02f, 1.851272370e-02f, -8.537557611e-03f,
+        2.589399236e-03f, 3.931366077e-04f, -1.445064141e-03f, 1.444744672e-03f,
+        -1.028668407e-03f, 5.756458806e-04f, -2.499151069e-04f, 7.497869585e-05f,
+    },
+    {  // phase 33
+        -1.531990607e-05f, 3.993341433e-05f, -1.205557451e-05f, -2.110257153e-04f,
+        8.747904311e-04f, -2.309222675e-03f, 4.855438181e-03f, -8.733886211e-03f,
+        1.387088927e-02f, -1.971639351e-02f, 2.508319947e-02f, -2.799244202e-02f,
+        2.535472401e-02f, -1.173286574e-02f, -2.688635888e-02f, 1.690201985e-01f,
+        9.970652829e-01f, -2.152504847e-01f, 1.268379958e-01f, -8.333823708e-02f,
+        5.412732287e-02f, -3.301722628e-02f, 1.806511696e-02f, -8.182589922e-03f,
+        2.339955127e-03f, 5.484933463e-04f, -1.529422305e-03f, 1.483096013e-03f,
+        -1.041841984e-03f, 5.778385857e-04f, -2.489500007e-04f, 7.404768036e-05f,
+    },
+    {  // phase 34
+        -1.502081275e-05f, 3.754448056e-05f, -4.042404829e-06f, -2.300443407e-04f,
+        9.106613332e-04f, -2.364897572e-03f, 4.925521856e-03f, -8.797711366e-03f,
+        1.388541807e-02f, -1.961044082e-02f, 2.475361581e-02f, -2.730004559e-02f,
+        2.410999568e-02f, -9.634191432e-03f, -3.055212787e-02f, 1.781288075e-01f,
+        9.916834269e-01f, -2.170186186e-01f, 1.272257261e-01f, -8.313838168e-02f,
+        5.368299891e-02f, -3.251582625e-02f, 1.761131264e-02f, -7.825632767e-03f,
+        2.090786892e-03f, 7.026655862e-04f, -1.612503851e-03f, 1.520460193e-03f,
+        -1.054404781e-03f, 5.797278072e-04f, -2.478714466e-04f, 7.309188011e-05f,
+    },
+    {  // phase 35
+        -1.470311922e-05f, 3.509875607e-05f, 4.065774546e-06f, -2.491322914e-04f,
+        9.463887425e-04f, -2.419850030e-03f, 4.993735549e-03f, -8.857787823e-03f,
+        1.389355027e-02f, -1.949484559e-02f, 2.441098319e-02f, -2.659174269e-02f,
+        2.284796420e-02f, -7.519128399e-03f, -3.423230503e-02f, 1.873040504e-01f,
+        9.861613265e-01f, -2.186683271e-01f, 1.275524676e-01f, -8.290132844e-02f,
+        5.321607063e-02f, -3.200177624e-02f, 1.715155065e-02f, -7.466862203e-03f,
+        1.842009418e-03f, 8.555879710e-04f, -1.694277907e-03f, 1.556826697e-03f,
+        -1.066355906e-03f, 5.813156511e-04f, -2.466814110e-04f, 7.211227579e-05f,
+    },
+    {  // phase 36
+        -1.436665083e-05f, 3.259677439e-05f, 1.226587091e-05f, -2.682807594e-04f,
+        9.819541621e-04f, -2.474048606e-03f, 5.060035037e-03f, -8.914065719e-03f,
+        1.389524821e-02f, -1.936961402e-02f, 2.405539896e-02f, -2.586778617e-02f,
+        2.156912466e-02f, -5.388545758e-03f, -3.792538135e-02f, 1.965439223e-01f,
+        9.805005062e-01f, -2.202002041e-01f, 1.278184735e-01f, -8.262737999e-02f,
+        5.272686013e-02f, -3.147537254e-02f, 1.668607248e-02f, -7.106454245e-03f,
+        1.593736785e-03f, 1.007196122e-03f, -1.774714428e-03f, 1.592185565e-03f,
+        -1.077694778e-03f, 5.826043549e-04f, -2.453818967e-04f, 7.110984754e-05f,
+    },
+    {  // phase 37
+        -1.401124346e-05f, 3.003910879e-05f, 2.055470913e-05f, -2.874808250e-04f,
+        1.017339027e-03f, -2.527462005e-03f, 5.124376734e-03f, -8.966496705e-03f,
+        1.389047709e-02f, -1.923475685e-02f, 2.368696691e-02f, -2.512843728e-02f,
+        2.027398221e-02f, -3.243324422e-03f, -4.162983131e-02f, 2.058463911e-01f,
+        9.747025280e-01f, -2.216148787e-01f, 1.280240218e-01f, -8.231685398e-02f,
+        5.221569816e-02f, -3.093691573e-02f, 1.621512117e-02f, -6.744584792e-03f,
+        1.346082220e-03f, 1.157426662e-03f, -1.853784201e-03f, 1.626527400e-03f,
+        -1.088421122e-03f, 5.835962860e-04f, -2.439749410e-04f, 7.008557430e-05f,
+    },
+    {  // phase 38
+        -1.363674377e-05f, 2.742637246e-05f, 2.892903246e-05f, -3.067234602e-04f,
+        1.052524714e-03f, -2.580059089e-03f, 5.186717717e-03f, -9.015033982e-03f,
+        1.387920496e-02f, -1.909028939e-02f, 2.330579732e-02f, -2.437396562e-02f,
+        1.896305195e-02f, -1.084356771e-03f, -4.534411332e-02f, 2.152093974e-01f,
+        9.687689904e-01f, -2.229130148e-01f, 1.281694146e-01f, -8.197008290e-02f,
+        5.168292395e-02f, -3.038671057e-02f, 1.573894111e-02f, -6.381429538e-03f,
+        1.099158045e-03f, 1.306217241e-03f, -1.931458861e-03f, 1.659843364e-03f,
+        -1.098534964e-03f, 5.842939387e-04f, -2.424626143e-04f, 6.904043328e-05f,
+    },
+    {  // phase 39
+        -1.324300956e-05f, 2.475921860e-05f, 3.738550344e-05f, -3.259995325e-04f,
+        1.087492547e-03f, -2.631808896e-03f, 5.247015747e-03f, -9.059632328e-03f,
+        1.386140275e-02f, -1.893623150e-02f, 2.291200693e-02f, -2.360464903e-02f,
+        1.763685871e-02f, 1.087453678e-03f, -4.906667028e-02f, 2.246308560e-01f,
+        9.627015282e-01f, -2.240953105e-01f, 1.282549783e-01f, -8.158741388e-02f,
+        5.112888501e-02f, -2.982506584e-02f, 1.525777796e-02f, -6.017163895e-03f,
+        8.530756323e-04f, 1.453506561e-03f, -2.007710891e-03f, 1.692125180e-03f,
+        -1.108036634e-03f, 5.846999321e-04f, -2.408470189e-04f, 6.797539930e-05f,
+    },
+    {  // phase 40
+        -1.282990994e-05f, 2.203834066e-05f, 4.592070479e-05f, -3.452998084e-04f,
+        1.122223812e-03f, -2.682680659e-03f, 5.305229300e-03f, -9.100248133e-03f,
+        1.383704433e-02f, -1.877260765e-02f, 2.250571887e-02f, -2.282077351e-02f,
+        1.629593687e-02f, 3.271192606e-03f, -5.279593002e-02f, 2.341086557e-01f,
+        9.565018116e-01f, -2.251624983e-01f, 1.282810631e-01f, -8.116920837e-02f,
+        5.055393695e-02f, -2.925229414e-02f, 1.477187855e-02f, -5.651962910e-03f,
+        6.079453536e-04f, 1.599234394e-03f, -2.082513636e-03f, 1.723365133e-03f,
+        -1.116926760e-03f, 5.848170071e-04f, -2.391302872e-04f, 6.689144431e-05f,
+    },
+    {  // phase 41
+        -1.239732569e-05f, 1.926447238e-05f, 5.453114040e-05f, -3.646149572e-04f,
+        1.156699760e-03f, -2.732643818e-03f, 5.361317586e-03f, -9.136839424e-03f,
+        1.380610652e-02f, -1.859944690e-02f, 2.208706269e-02f, -2.202263311e-02f,
+        1.494083016e-02f, 5.465935235e-03f, -5.653030585e-02f, 2.436406605e-01f,
+        9.501715460e-01f, -2.261153438e-01f, 1.282480425e-01f, -8.071584202e-02f,
+        4.995844327e-02f, -2.866871178e-02f, 1.428149070e-02f, -5.286001186e-03f,
+        3.638765355e-04f, 1.743341611e-03f, -2.155841308e-03f, 1.753556065e-03f,
+        -1.125206265e-03f, 5.846480241e-04f, -2.373145802e-04f, 6.578953674e-05f,
+    },
+    {  // phase 42
+        -1.194514949e-05f, 1.643838789e-05f, 6.321323639e-05f, -3.839355553e-04f,
+        1.190901619e-03f, -2.781668039e-03f, 5.415240575e-03f, -9.169365901e-03f,
+        1.376856910e-02f, -1.841678292e-02f, 2.165617431e-02f, -2.121052988e-02f,
+        1.357209144e-02f, 7.670746678e-03f, -6.026819707e-02f, 2.532247098e-01f,
+        9.437124713e-01f, -2.269546463e-01f, 1.281563137e-01f, -8.022770437e-02f,
+        4.934277513e-02f, -2.807463856e-02f, 1.378686314e-02f, -4.919452801e-03f,
+        1.209774124e-04f, 1.885770198e-03f, -2.227668991e-03f, 1.782691383e-03f,
+        -1.132876365e-03f, 5.841959605e-04f, -2.354020861e-04f, 6.467064102e-05f,
+    },
+    {  // phase 43
+        -1.147328617e-05f, 1.356090184e-05f, 7.196334215e-05f, -4.032520895e-04f,
+        1.224810602e-03f, -2.829723229e-03f, 5.466959024e-03f, -9.197788958e-03f,
+        1.372441489e-02f, -1.822465400e-02f, 2.121319595e-02f, -2.038477369e-02f,
+        1.219028254e-02f, 9.884682294e-03f, -6.400798951e-02f, 2.628586192e-01f,
+        9.371263613e-01f, -2.276812374e-01f, 1.280062963e-01f, -7.970519861e-02f,
+        4.870731120e-02f, -2.747039768e-02f, 1.328824539e-02f, -4.552491231e-03f,
+        -1.206449184e-04f, 2.026463283e-03f, -2.297972650e-03f, 1.810765049e-03f,
+        -1.139938567e-03f, 5.834639076e-04f, -2.333950187e-04f, 6.353571701e-05f,
+    },
+    {  // phase 44
+        -1.098165303e-05f, 1.063286936e-05f, 8.077773150e-05f, -4.225549618e-04f,
+        1.258407920e-03f, -2.876779553e-03f, 5.516434494e-03f, -9.222071716e-03f,
+        1.367362968e-02f, -1.802310303e-02f, 2.075827617e-02f, -1.954568219e-02f,
+        1.079597398e-02f, 1.210678805e-02f, -6.774805604e-02f, 2.725401813e-01f,
+        9.304150230e-01f, -2.282959814e-01f, 1.277984329e-01f, -7.914874137e-02f,
+        4.805243741e-02f, -2.685631549e-02f, 1.278588763e-02f, -4.185289269e-03f,
+        -3.608845411e-04f, 2.165365149e-03f, -2.366729138e-03f, 1.837771585e-03f,
+        -1.146394662e-03f, 5.824550685e-04f, -2.312956160e-04f, 6.238571943e-05f,
+    },
+    {  // phase 45
+        -1.047018001e-05f, 7.655186156e-06f, 8.965260389e-05f, -4.418344929e-04f,
+        1.291674784e-03f, -2.922807452e-03f, 5.563629380e-03f, -9.242179050e-03f,
+        1.361620236e-02f, -1.781217753e-02f, 2.029156975e-02f, -1.869358069e-02f,
+        9.389744838e-03f, 1.433610088e-02f, -7.148675713e-02f, 2.822671662e-01f,
+        9.235802961e-01f, -2.287997743e-01f, 1.275331883e-01f, -7.855876245e-02f,
+        4.737854675e-02f, -2.623272138e-02f, 1.228004059e-02f, -3.818018948e-03f,
+        -5.996367655e-04f, 2.302421260e-03f, -2.433916194e-03f, 1.863706068e-03f,
+        -1.152246727e-03f, 5.811727548e-04f, -2.291061384e-04f, 6.122159740e-05f,
+    },
+    {  // phase 46
+        -9.938810010e-06f, 4.628788461e-06f, 9.858408563e-05f, -4.610809268e-04f,
+        1.324592421e-03f, -2.967777655e-03f, 5.608506932e-03f, -9.258077612e-03f,
+        1.355212486e-02f, -1.759192965e-02f, 1.981323770e-02f, -1.782880200e-02f,
+        7.972182441e-03f, 1.657164907e-02f, -7.522244143e-02f, 2.920373220e-01f,
+        9.166240526e-01f, -2.291935434e-01f, 1.272110493e-01f, -7.793570453e-02f,
+        4.668603907e-02f, -2.559994763e-02f, 1.177095541e-02f, -3.450851468e-03f,
+        -8.367981693e-04f, 2.437578279e-03f, -2.499512460e-03f, 1.888564131e-03f,
+        -1.157497117e-03f, 5.796203841e-04f, -2.268288678e-04f, 6.004429389e-05f,
+    },
+    {  // phase 47
+        -9.387499098e-06f, 1.554653045e-06f, 1.075682312e-04f, -4.802844349e-04f,
+        1.357142082e-03f, -3.011661201e-03f, 5.651031277e-03f, -9.269735862e-03f,
+        1.348139220e-02f, -1.736241615e-02f, 1.932344719e-02f, -1.695168636e-02f,
+        6.543882199e-03f, 1.881245264e-02f, -7.895344624e-02f, 3.018483758e-01f,
+        9.095481957e-01f, -2.294782472e-01f, 1.268325243e-01f, -7.728002297e-02f,
+        4.597532086e-02f, -2.495832917e-02f, 1.125888354e-02f, -3.083957113e-03f,
+        -1.072266641e-03f, 2.570784082e-03f, -2.563497472e-03f, 1.912341960e-03f,
+        -1.162148464e-03f, 5.778014772e-04f, -2.244661052e-04f, 5.885474523e-05f,
+    },
+    {  // phase 48
+        -8.816216759e-06f, -1.566202852e-06f, 1.166010246e-04f, -4.994351206e-04f,
+        1.389305048e-03f, -3.054429448e-03f, 5.691167442e-03f, -9.277124090e-03f,
+        1.340400251e-02f, -1.712369840e-02f, 1.882237150e-02f, -1.606258130e-02f,
+        5.105447350e-03f, 2.105752369e-02f, -8.267809819e-02f, 3.116980342e-01f,
+        9.023546598e-01f, -2.296548747e-01f, 1.263981430e-01f, -7.659218548e-02f,
+        4.524680502e-02f, -2.430820349e-02f, 1.074407663e-02f, -2.717505182e-03f,
+        -1.305941419e-03f, 2.701987781e-03f, -2.625851675e-03f, 1.935036291e-03f,
+        -1.166203675e-03f, 5.757196554e-04f, -2.220201702e-04f, 5.765388061e-05f,
+    },
+    {  // phase 49
+        -8.224946126e-06f, -4.732721585e-06f, 1.256783806e-04f, -5.185230233e-04f,
+        1.421062642e-03f, -3.096054098e-03f, 5.728881378e-03f, -9.280214442e-03f,
+        1.331995707e-02f, -1.687584240e-02f, 1.831019000e-02f, -1.516184152e-02f,
+        3.657488730e-03f, 2.330586685e-02f, -8.639471372e-02f, 3.215839838e-01f,
+        8.950454091e-01f, -2.297244446e-01f, 1.259084561e-01f, -7.587267191e-02f,
+        4.450091065e-02f, -2.364991042e-02f, 1.022678637e-02f, -2.351663911e-03f,
+        -1.537723136e-03f, 2.831139738e-03f, -2.686556421e-03f, 1.956644408e-03f,
+        -1.169665922e-03f, 5.733786373e-04f, -2.194933988e-04f, 5.644262161e-05f,
+    },
+    {  // phase 50
+        -7.613684204e-06f, -7.943805204e-06f, 1.347961465e-04f, -5.375381233e-04f,
+        1.452396242e-03f, -3.136507206e-03f, 5.764139982e-03f, -9.278980942e-03f,
+        1.322926025e-02f, -1.661891871e-02f, 1.778708805e-02f, -1.424982872e-02f,
+        2.200624530e-03f, 2.555647962e-02f, -9.010159969e-02f, 3.315038925e-01f,
+        8.876224377e-01f, -2.296880054e-01f, 1.253640351e-01f, -7.512197392e-02f,
+        4.373806285e-02f, -2.298379199e-02f, 9.707264429e-03f, -1.986600400e-03f,
+        -1.767513853e-03f, 2.958191583e-03f, -2.745593972e-03f, 1.977164141e-03f,
+        -1.172538645e-03f, 5.707822363e-04f, -2.168881422e-04f, 5.522188174e-05f,
+    },
+    {  // phase 51
+        -6.982442092e-06f, -1.119831557e-05f, 1.439501035e-04f, -5.564703464e-04f,
+        1.483287284e-03f, -3.175761198e-03f, 5.796911114e-03f, -9.273399516e-03f,
+        1.313191962e-02f, -1.635300253e-02f, 1.725325696e-02f, -1.332691155e-02f,
+        7.354800526e-04f, 2.780835280e-02f, -9.379705396e-02f, 3.414554094e-01f,
+        8.800877683e-01f, -2.295466345e-01f, 1.247654714e-01f, -7.434059474e-02f,
+        4.295869247e-02f, -2.231019227e-02f, 9.185762290e-03f, -1.622480541e-03f,
+        -1.995217103e-03f, 3.083096227e-03f, -2.802947505e-03f, 1.996593864e-03f,
+        -1.174825545e-03f, 5.679343577e-04f, -2.142067653e-04f, 5.399256593e-05f,
+    },
+    {  // phase 52
+        -6.331245196e-06f, -1.449507452e-05f, 1.531359679e-04f, -5.753095682e-04f,
+        1.513717277e-03f, -3.213788890e-03f, 5.827163628e-03f, -9.263448016e-03f,
+        1.302794590e-02f, -1.607817359e-02f, 1.670889394e-02f, -1.239346538e-02f,
+        -7.373125378e-04f, 3.006047089e-02f, -9.747936599e-02f, 3.514361662e-01f,
+        8.724434520e-01f, -2.293014377e-01f, 1.241133765e-01f, -7.352904888e-02f,
+        4.216323590e-02f, -2.162945716e-02f, 8.662531161e-03f, -1.259468945e-03f,
+        -2.220737926e-03f, 3.205807881e-03f, -2.858601113e-03f, 2.014932489e-03f,
+        -1.176530581e-03f, 5.648389952e-04f, -2.114516453e-04f, 5.275557016e-05f,
+    },
+    {  // phase 53
+        -5.660133434e-06f, -1.783286401e-05f, 1.623493933e-04f, -5.940456191e-04f,
+        1.543667808e-03f, -3.250563499e-03f, 5.854867383e-03f, -9.249106236e-03f,
+        1.291735297e-02f, -1.579451621e-02f, 1.615420203e-02f, -1.144987222e-02f,
+        -2.217114467e-03f, 3.231181248e-02f, -1.011468174e-01f, 3.614437775e-01f,
+        8.646915674e-01f, -2.289535490e-01f, 1.234083814e-01f, -7.268786183e-02f,
+        4.135213483e-02f, -2.094193426e-02f, 8.137821854e-03f, -8.977288731e-04f,
+        -2.443982905e-03f, 3.326282066e-03f, -2.912539805e-03f, 2.032179463e-03f,
+        -1.177657962e-03f, 5.615002290e-04f, -2.086251699e-04f, 5.151178098e-05f,
+    },
+    {  // phase 54
+        -4.969161436e-06f, -2.121042632e-05f, 1.715859720e-04f, -6.126682890e-04f,
+        1.573120558e-03f, -3.286058664e-03f, 5.879993269e-03f, -9.230355941e-03f,
+        1.280015793e-02f, -1.550211925e-02f, 1.558939001e-02f, -1.049652055e-02f,
+        -3.703280610e-03f, 3.456135069e-02f, -1.047976827e-01f, 3.714758416e-01f,
+        8.568342199e-01f, -2.285041297e-01f, 1.226511362e-01f, -7.181756979e-02f,
+        4.052583606e-02f, -2.024797268e-02f, 7.611884662e-03f, -5.374221646e-04f,
+        -2.664860205e-03f, 3.444475628e-03f, -2.964749511e-03f, 2.048334769e-03f,
+        -1.178212150e-03f, 5.579222218e-04f, -2.057297366e-04f, 5.026207507e-05f,
+    },
+    {  // phase 55
+        -4.258398738e-06f, -2.462646431e-05f, 1.808412364e-04f, -6.311673320e-04f,
+        1.602057306e-03f, -3.320248456e-03f, 5.902513228e-03f, -9.207180877e-03f,
+        1.267638106e-02f, -1.520107608e-02f, 1.501467238e-02f, -9.533805160e-03f,
+        -5.195159751e-03f, 3.680805358e-02f, -1.084302296e-01f, 3.815299415e-01f,
+        8.488735413e-01f, -2.279543680e-01f, 1.218423097e-01f, -7.091871936e-02f,
+        3.968479124e-02f, -1.954792290e-02f, 7.084969254e-03f, -1.787091696e-04f,
+        -2.883279603e-03f, 3.560346751e-03f, -3.015217079e-03f, 2.063398914e-03f,
+        -1.178197849e-03f, 5.541092166e-04f, -2.027677503e-04f, 4.900731889e-05f,
+    },
+    {  // phase 56
+        -3.527929963e-06f, -2.807964163e-05f, 1.901106612e-04f, -6.495324717e-04f,
+        1.630459942e-03f, -3.353107399e-03f, 5.922400273e-03f, -9.179566799e-03f,
+        1.254604584e-02f, -1.489148458e-02f, 1.443026922e-02f, -8.562127039e-03f,
+        -6.692094852e-03f, 3.905088455e-02f, -1.120427201e-01f, 3.916036453e-01f,
+        8.408116884e-01f, -2.273054785e-01f, 1.209825891e-01f, -6.999186725e-02f,
+        3.882945664e-02f, -1.884213657e-02f, 6.557324557e-03f, 1.782513194e-04f,
+        -3.099152527e-03f, 3.673854971e-03f, -3.063930278e-03f, 2.077372933e-03f,
+        -1.177620003e-03f, 5.500655333e-04f, -1.997416229e-04f, 4.774836822e-05f,
+    },
+    {  // phase 57
+        -2.777854999e-06f, -3.156858300e-05f, 1.993896650e-04f, -6.677534057e-04f,
+        1.658310474e-03f, -3.384610482e-03f, 5.939628503e-03f, -9.147501482e-03f,
+        1.240917897e-02f, -1.457344712e-02f, 1.383640618e-02f, -7.581893173e-03f,
+        -8.193423316e-03f, 4.128880280e-02f, -1.156334104e-01f, 4.016945070e-01f,
+        8.326508431e-01f, -2.265587016e-01f, 1.200726797e-01f, -6.903758000e-02f,
+        3.796029293e-02f, -1.813096635e-02f, 6.029198643e-03f, 5.333021340e-04f,
+        -3.312392086e-03f, 3.784961181e-03f, -3.110877794e-03f, 2.090258379e-03f,
+        -1.176483795e-03f, 5.457955658e-04f, -1.966537709e-04f, 4.648606779e-05f,
+    },
+    {  // phase 58
+        -2.008289169e-06f, -3.509187452e-05f, 2.086736122e-04f, -6.858198109e-04f,
+        1.685591043e-03f, -3.414733178e-03f, 5.954173132e-03f, -9.110974742e-03f,
+        1.226581036e-02f, -1.424707050e-02f, 1.323331434e-02f, -6.593516411e-03f,
+        -9.698477270e-03f, 4.352076374e-02f, -1.192005524e-01f, 4.118000676e-01f,
+        8.243932112e-01f, -2.257153031e-01f, 1.191133041e-01f, -6.805643365e-02f,
+        3.707776497e-02f, -1.741476576e-02f, 5.500838622e-03f, 8.862877957e-04f,
+        -3.522913102e-03f, 3.893627649e-03f, -3.156049235e-03f, 2.102057321e-03f,
+        -1.174794635e-03f, 5.413037792e-04f, -1.935066147e-04f, 4.522125093e-05f,
+    },
+    {  // phase 59
+        -1.219363393e-06f, -3.864806402e-05f, 2.179578150e-04f, -7.037213484e-04f,
+        1.712283927e-03f, -3.443451453e-03f, 5.966010497e-03f, -9.069978450e-03f,
+        1.211597314e-02f, -1.391246597e-02f, 1.262123018e-02f, -5.597415293e-03f,
+        -1.120658383e-02f, 4.574571944e-02f, -1.227423935e-01f, 4.219178554e-01f,
+        8.160410218e-01f, -2.247765732e-01f, 1.181052022e-01f, -6.704901345e-02f,
+        3.618234154e-02f, -1.669388898e-02f, 4.972490527e-03f, 1.237054580e-03f,
+        -3.730632144e-03f, 3.999818024e-03f, -3.199435126e-03f, 2.112772339e-03f,
+        -1.172558162e-03f, 5.365947064e-04f, -1.903025771e-04f, 4.395473917e-05f,
+    },
+    {  // phase 60
+        -4.112243349e-07f, -4.223566135e-05f, 2.272375348e-04f, -7.214476687e-04f,
+        1.738371556e-03f, -3.470741789e-03f, 5.975118085e-03f, -9.024506552e-03f,
+        1.195970363e-02f, -1.356974914e-02f, 1.200039547e-02f, -4.594013887e-03f,
+        -1.271706539e-02f, 4.796261904e-02f, -1.262571778e-01f, 4.320453870e-01f,
+        8.075965266e-01f, -2.237438265e-01f, 1.170491307e-01f, -6.601591354e-02f,
+        3.527449513e-02f, -1.596869073e-02f, 4.444399204e-03f, 1.585450580e-03f,
+        -3.935467553e-03f, 4.103497346e-03f, -3.241026909e-03f, 2.122406517e-03f,
+        -1.169780236e-03f, 5.316729456e-04f, -1.870440817e-04f, 4.268734191e-05f,
+    },
+    {  // phase 61
+        4.159654473e-07f, -4.585313883e-05f, 2.365079851e-04f, -7.389884170e-04f,
+        1.763836515e-03f, -3.496581191e-03f, 5.981474546e-03f, -8.974555077e-03f,
+        1.179704141e-02f, -1.321904001e-02f, 1.137105717e-02f, -3.583741618e-03f,
+        -1.422923991e-02f, 5.017040923e-02f, -1.297431466e-01f, 4.421801680e-01f,
+        7.990619991e-01f, -2.226184010e-01f, 1.159458625e-01f, -6.495773666e-02f,
+        3.435470170e-02f, -1.523952606e-02f, 3.916808208e-03f, 1.931325770e-03f,
+        -4.137339473e-03f, 4.204632053e-03f, -3.280816940e-03f, 2.130963440e-03f,
+        -1.166466934e-03f, 5.265431567e-04f, -1.837335517e-04f, 4.141985609e-05f,
+    },
+    {  // phase 62
+        1.262027370e-06f, -4.949893160e-05f, 2.457643327e-04f, -7.563332382e-04f,
+        1.788661564e-03f, -3.520947209e-03f, 5.985059710e-03f, -8.920122155e-03f,
+        1.162802923e-02f, -1.286046288e-02f, 1.073346737e-02f, -2.567033095e-03f,
+        -1.574242119e-02f, 5.236803465e-02f, -1.331985386e-01f, 4.523196938e-01f,
+        7.904397337e-01f, -2.214016578e-01f, 1.147961865e-01f, -6.387509384e-02f,
+        3.342344046e-02f, -1.450675020e-02f, 3.389959693e-03f, 2.274532062e-03f,
+        -4.336169884e-03f, 4.303189991e-03f, -3.318798487e-03f, 2.138447189e-03f,
+        -1.162624545e-03f, 5.212100588e-04f, -1.803734086e-04f, 4.015306584e-05f,
+    },
+    {  // phase 63
+        2.126766698e-06f, -5.317143809e-05f, 2.550017004e-04f, -7.734717822e-04f,
+        1.812829636e-03f, -3.543817948e-03f, 5.985854609e-03f, -8.861208027e-03f,
+        1.145271308e-02f, -1.249414636e-02f, 1.008788318e-02f, -1.544327935e-03f,
+        -1.725591917e-02f, 5.455443838e-02f, -1.366215913e-01f, 4.624614505e-01f,
+        7.817320454e-01f, -2.200949800e-01f, 1.136009070e-01f, -6.276860405e-02f,
+        3.248119361e-02f, -1.377071840e-02f, 2.864094303e-03f, 2.614923371e-03f,
+        -4.531882619e-03f, 4.399140418e-03f, -3.354965730e-03f, 2.144862332e-03f,
+        -1.158259566e-03f, 5.156784267e-04f, -1.769660708e-04f, 3.888774218e-05f,
+    },
+    {  // phase 64
+        3.009972426e-06f, -5.686902046e-05f, 2.642151686e-04f, -7.903937094e-04f,
+        1.836323859e-03f, -3.565172084e-03f, 5.983841488e-03f, -8.797815060e-03f,
+        1.127114216e-02f, -1.212022328e-02f, 9.434566609e-03f, -5.160705832e-04f,
+        -1.876904020e-02f, 5.672856237e-02f, -1.400105411e-01f, 4.726029155e-01f,
+        7.729412685e-01f, -2.186997730e-01f, 1.123608433e-01f, -6.163889393e-02f,
+        3.152844613e-02f, -1.303178577e-02f, 2.339451073e-03f, 2.952355669e-03f,
+        -4.724403399e-03f, 4.492454015e-03f, -3.389313751e-03f, 2.150213923e-03f,
+        -1.153378695e-03f, 5.099530883e-04f, -1.735139522e-04f, 3.762464271e-05f,
+    },
+    {  // phase 65
+        3.911417170e-06f, -6.059000509e-05f, 2.733997780e-04f, -8.070886958e-04f,
+        1.859127555e-03f, -3.584988877e-03f, 5.979003823e-03f, -8.729947755e-03f,
+        1.108336883e-02f, -1.173883071e-02f, 8.773784527e-03f, 5.172898688e-04f,
+        -2.028108740e-02f, 5.888934790e-02f, -1.433636241e-01f, 4.827415584e-01f,
+        7.640697563e-01f, -2.172174629e-01f, 1.110768295e-01f, -6.048659743e-02f,
+        3.056568553e-02f, -1.229030709e-02f, 1.816267320e-03f, 3.286687047e-03f,
+        -4.913659854e-03f, 4.583102887e-03f, -3.421838540e-03f, 2.154507491e-03f,
+        -1.147988827e-03f, 5.040389214e-04f, -1.700194613e-04f, 3.636451134e-05f,
+    },
+    {  // phase 66
+        4.830857075e-06f, -6.433268308e-05f, 2.825505314e-04f, -8.235464385e-04f,
+        1.881224255e-03f, -3.603248188e-03f, 5.971326338e-03f, -8.657612756e-03f,
+        1.088944868e-02f, -1.135010986e-02f, 8.105808506e-03f, 1.555299868e-03f,
+        -2.179136087e-02f, 6.103573600e-02f, -1.466790767e-01f, 4.928748416e-01f,
+        7.551198800e-01f, -2.156494966e-01f, 1.097497138e-01f, -5.931235553e-02f,
+        2.959340163e-02f, -1.154663667e-02f, 1.294778544e-03f, 3.617777766e-03f,
+        -5.099581545e-03f, 4.671060568e-03f, -3.452536981e-03f, 2.157749037e-03f,
+        -1.142097050e-03f, 4.979408504e-04f, -1.664849993e-04f, 3.510807800e-05f,
+    },
+    {  // phase 67
+        5.768031720e-06f, -6.809531081e-05f, 2.916623960e-04f, -8.397566612e-04f,
+        1.902597712e-03f, -3.619930491e-03f, 5.960795017e-03f, -8.580818864e-03f,
+        1.068944045e-02f, -1.095420605e-02f, 7.430914742e-03f, 2.597501589e-03f,
+        -2.329915808e-02f, 6.316666800e-02f, -1.499551363e-01f, 5.030002214e-01f,
+        7.460940279e-01f, -2.139973410e-01f, 1.083803580e-01f, -5.811681587e-02f,
+        2.861208631e-02f, -1.080112820e-02f, 7.752183246e-04f, 3.945490313e-03f,
+        -5.282099991e-03f, 4.756302029e-03f, -3.481406856e-03f, 2.159945025e-03f,
+        -1.135710639e-03f, 4.916638438e-04f, -1.629129597e-04f, 3.385605837e-05f,
+    },
+    {  // phase 68
+        6.722664042e-06f, -7.187611050e-05f, 3.007303061e-04f, -8.557091195e-04f,
+        1.923231903e-03f, -3.635016885e-03f, 5.947397120e-03f, -8.499577036e-03f,
+        1.048340608e-02f, -1.055126869e-02f, 6.749383941e-03f, 3.643433123e-03f,
+        -2.480377410e-02f, 6.528108587e-02f, -1.531900421e-01f, 5.131151487e-01f,
+        7.369946051e-01f, -2.122624820e-01f, 1.069696374e-01f, -5.690063249e-02f,
+        2.762223328e-02f, -1.005413456e-02f, 2.578182215e-04f, 4.269689458e-03f,
+        -5.461148688e-03f, 4.838803678e-03f, -3.508446834e-03f, 2.161102379e-03f,
+        -1.128837049e-03f, 4.852129108e-04f, -1.593057261e-04f, 3.260915365e-05f,
+    },
+    {  // phase 69
+        7.694460270e-06f, -7.567327078e-05f, 3.097491649e-04f, -8.713936064e-04f,
+        1.943111043e-03f, -3.648489110e-03f, 5.931121200e-03f, -8.413900402e-03f,
+        1.027141065e-02f, -1.014145118e-02f, 6.061501214e-03f, 4.692628676e-03f,
+        -2.630450196e-02f, 6.737793278e-02f, -1.563820354e-01f, 5.232170697e-01f,
+        7.278240321e-01f, -2.104464245e-01f, 1.055184399e-01f, -5.566446545e-02f,
+        2.662433787e-02f, -9.306007677e-03f, -2.571923221e-04f, 4.590242300e-03f,
+        -5.636663130e-03f, 4.918543363e-03f, -3.533656469e-03f, 2.161228474e-03f,
+        -1.121483912e-03f, 4.785930984e-04f, -1.556656718e-04f, 3.136805030e-05f,
+    },
+    {  // phase 70
+        8.683109864e-06f, -7.948494734e-05f, 3.187138473e-04f, -8.867999581e-04f,
+        1.962219597e-03f, -3.660329561e-03f, 5.911957109e-03f, -8.323804262e-03f,
+        1.005352237e-02f, -9.724910901e-03f, 5.367555961e-03f, 5.744618760e-03f,
+        -2.780063294e-02f, 6.945615353e-02f, -1.595293607e-01f, 5.333034266e-01f,
+        7.185847444e-01f, -2.085506913e-01f, 1.040276660e-01f, -5.440898052e-02f,
+        2.561889674e-02f, -8.557098356e-03f, -7.695860783e-04f, 4.907018323e-03f,
+        -5.808580830e-03f, 4.995500374e-03f, -3.557036195e-03f, 2.160331127e-03f,
+        -1.113659032e-03f, 4.718094885e-04f, -1.519951582e-04f, 3.013341984e-05f,
+    },
+    {  // phase 71
+        9.688285467e-06f, -8.330926354e-05f, 3.276192019e-04f, -9.019180589e-04f,
+        1.980542284e-03f, -3.670521298e-03f, 5.889896018e-03f, -8.229306096e-03f,
+        9.829812587e-03f, -9.301809147e-03f, 4.667841756e-03f, 6.798930394e-03f,
+        -2.929145686e-02f, 7.151469500e-02f, -1.626302660e-01f, 5.433716589e-01f,
+        7.092791914e-01f, -2.065768229e-01f, 1.024982281e-01f, -5.313484889e-02f,
+        2.460640771e-02f, -7.807756140e-03f, -1.279138129e-03f, 5.219889443e-03f,
+        -5.976841336e-03f, 5.069655447e-03f, -3.578587315e-03f, 2.158418595e-03f,
+        -1.105370377e-03f, 4.648671946e-04f, -1.482965335e-04f, 2.890591861e-05f,
+    },
+    {  // phase 72
+        1.070964287e-05f, -8.714431110e-05f, 3.364600539e-04f, -9.167378476e-04f,
+        1.998064092e-03f, -3.679048060e-03f, 5.864930426e-03f, -8.130425568e-03f,
+        9.600355760e-03f, -8.872311056e-03f, 3.962656232e-03f, 7.855087307e-03f,
+        -3.077626244e-02f, 7.355250664e-02f, -1.656830035e-01f, 5.534192035e-01f,
+        6.999098361e-01f, -2.045263761e-01f, 1.009310501e-01f, -5.184274677e-02f,
+        2.358736948e-02f, -7.058329139e-03f, -1.785625959e-03f, 5.528730053e-03f,
+        -6.141386251e-03f, 5.140990760e-03f, -3.598312001e-03f, 2.155499562e-03f,
+        -1.096626076e-03f, 4.577713594e-04f, -1.445721320e-04f, 2.768618759e-05f,
+    },
+    {  // phase 73
+        1.174682099e-05f, -9.098815081e-05f, 3.452312075e-04f, -9.312493224e-04f,
+        2.014770281e-03f, -3.685894279e-03f, 5.837054172e-03f, -8.027184524e-03f,
+        9.365229430e-03f, -8.436585563e-03f, 3.252300963e-03f, 8.912610140e-03f,
+        -3.225433758e-02f, 7.556854094e-02f, -1.686858306e-01f, 5.634434964e-01f,
+        6.904791537e-01f, -2.024009245e-01f, 9.932706665e-02f, -5.053335513e-02f,
+        2.256228144e-02f, -6.309163884e-03f, -2.288829552e-03f, 5.833417076e-03f,
+        -6.302159248e-03f, 5.209489936e-03f, -3.616213285e-03f, 2.151583136e-03f,
+        -1.087434413e-03f, 4.505271511e-04f, -1.408242726e-04f, 2.647485219e-05f,
+    },
+    {  // phase 74
+        1.279944185e-05f, -9.483881322e-05f, 3.539274481e-04f, -9.454425467e-04f,
+        2.030646401e-03f, -3.691045089e-03f, 5.806262447e-03f, -7.919606998e-03f,
+        9.124514207e-03f, -7.994805337e-03f, 2.537081336e-03f, 9.971016653e-03f,
+        -3.372496970e-02f, 7.756175388e-02f, -1.716370101e-01f, 5.734419724e-01f,
+        6.809896313e-01f, -2.002020566e-01f, 9.768722334e-02f, -4.920735935e-02f,
+        2.153164338e-02f, -5.560605170e-03f, -2.788531474e-03f, 6.133830004e-03f,
+        -6.459106086e-03f, 5.275138043e-03f, -3.632295047e-03f, 2.146678839e-03f,
+        -1.077803821e-03f, 4.431397611e-04f, -1.370552579e-04f, 2.527252211e-05f,
+    },
+    {  // phase 75
+        1.386711056e-05f, -9.869429941e-05f, 3.625435452e-04f, -9.593076548e-04f,
+        2.045678292e-03f, -3.694486342e-03f, 5.772551802e-03f, -7.807719213e-03f,
+        8.878293745e-03f, -7.547146716e-03f, 1.817306431e-03f, 1.102982194e-02f,
+        -3.518744604e-02f, 7.953110543e-02f, -1.745348113e-01f, 5.834120672e-01f,
+        6.714437666e-01f, -1.979313762e-01f, 9.601247565e-02f, -4.786544887e-02f,
+        2.049595532e-02f, -4.812995904e-03f, -3.284516972e-03f, 6.429850945e-03f,
+        -6.612174624e-03f, 5.337921588e-03f, -3.646562017e-03f, 2.140796599e-03f,
+        -1.067742875e-03f, 4.356144007e-04f, -1.332673730e-04f, 2.407979115e-05f,
+    },
+    {  // phase 76
+        1.494941535e-05f, -1.025525818e-04f, 3.710742548e-04f, -9.728348576e-04f,
+        2.059852102e-03f, -3.696204616e-03f, 5.735920161e-03f, -7.691549577e-03f,
+        8.626654722e-03f, -7.093789644e-03f, 1.093288896e-03f, 1.208853861e-02f,
+        -3.664105400e-02f, 8.147555999e-02f, -1.773775102e-01f, 5.933512170e-01f,
+        6.618440677e-01f, -1.955905011e-01f, 9.430378872e-02f, -4.650831688e-02f,
+        1.945571724e-02f, -4.066676958e-03f, -3.776574053e-03f, 6.721364662e-03f,
+        -6.761314833e-03f, 5.397828519e-03f, -3.659019757e-03f, 2.133946745e-03f,
+        -1.057260292e-03f, 4.279562984e-04f, -1.294628843e-04f, 2.289723705e-05f,
+    },
+    {  // phase 77
+        1.604592759e-05f, -1.064116047e-04f, 3.795143223e-04f, -9.860144478e-04f,
+        2.073154289e-03f, -3.696187231e-03f, 5.696366830e-03f, -7.571128685e-03f,
+        8.369686809e-03f, -6.634917604e-03f, 3.653448132e-04f, 1.314667706e-02f,
+        -3.808508142e-02f, 8.339408689e-02f, -1.801633905e-01f, 6.032568602e-01f,
+        6.521930516e-01f, -1.931810629e-01f, 9.256213686e-02f, -4.513666000e-02f,
+        1.841142888e-02f, -3.321987019e-03f, -4.264493573e-03f, 7.008258619e-03f,
+        -6.906478810e-03f, 5.454848222e-03f, -3.669674660e-03f, 2.126139996e-03f,
+        -1.046364919e-03f, 4.201706966e-04f, -1.256440389e-04f, 2.172542140e-05f,
+    },
+    {  // phase 78
+        1.715620177e-05f, -1.102692858e-04f, 3.878584848e-04f, -9.988368061e-04f,
+        2.085571635e-03f, -3.694422254e-03f, 5.653892503e-03f, -7.446489316e-03f,
+        8.107482649e-03f, -6.170717546e-03f, -3.662064283e-04f, 1.420374562e-02f,
+        -3.951881699e-02f, 8.528566085e-02f, -1.828907444e-01f, 6.131264377e-01f,
+        6.424932441e-01f, -1.907047057e-01f, 9.078850309e-02f, -4.375117793e-02f,
+        1.736358948e-02f, -2.579262441e-03f, -4.748069322e-03f, 7.290423013e-03f,
+        -7.047620790e-03f, 5.508971513e-03f, -3.678533939e-03f, 2.117387452e-03f,
+        -1.035065730e-03f, 4.122628495e-04f, -1.218130629e-04f, 2.056488946e-05f,
+    },
+    {  // phase 79
+        1.827977562e-05f, -1.141235160e-04f, 3.961014741e-04f, -1.011292407e-03f,
+        2.097091251e-03f, -3.690898515e-03f, 5.608499274e-03f, -7.317666426e-03f,
+        7.840137821e-03f, -5.701379821e-03f, -1.101042267e-03f, 1.525925083e-02f,
+        -4.094155048e-02f, 8.714926246e-02f, -1.855578728e-01f, 6.229573941e-01f,
+        6.327471782e-01f, -1.881630863e-01f, 8.898387862e-02f, -4.235257313e-02f,
+        1.631269760e-02f, -1.838837104e-03f, -5.227098105e-03f, 7.567750819e-03f,
+        -7.184697150e-03f, 5.560190640e-03f, -3.685605615e-03f, 2.107700590e-03f,
+        -1.023371822e-03f, 4.042380193e-04f, -1.179721612e-04f, 1.941617009e-05f,
+    },
+};
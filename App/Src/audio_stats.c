@@ -0,0 +1,99 @@
+// SPDX-License-Identifier: GPL-3.0-only
+// Copyright (c) 2026 Elia Chiarucci
+
+/*
+ * Audio pipeline telemetry (see audio_stats.h)
+ */
+
+#include "audio_stats.h"
+#include <string.h>
+
+// Single core: the writer preempts the reader but never runs alongside it,
+// so ordering against the compiler is all the sequence count needs
+#define BARRIER() __atomic_signal_fence(__ATOMIC_SEQ_CST)
+
+// Host tests run the writer from here to land in the middle of a copy
+#ifdef AUDIO_STATS_READ_HOOK
+void AUDIO_STATS_READ_HOOK(void);
+#endif
+
+#define COUNTER_WORDS (sizeof(audio_stats_counters_t) / sizeof(uint32_t))
+_Static_assert(sizeof(audio_stats_counters_t) % sizeof(uint32_t) == 0,
+               "counters are all 32-bit words");
+
+void audio_stats_init(audio_stats_t *s) {
+    memset(s, 0, sizeof(*s));
+}
+
+static void write_begin(audio_stats_t *s) {
+    s->seq++;
+    BARRIER();
+}
+
+static void write_end(audio_stats_t *s) {
+    BARRIER();
+    s->seq++;
+}
+
+void audio_stats_period(audio_stats_t *s, uint16_t fifo_level,
+                        uint16_t frames, uint16_t frames_read) {
+    uint16_t bin = fifo_level / AUDIO_STATS_LEVEL_STEP;
+    if (bin >= AUDIO_STATS_LEVEL_BINS)
+        bin = AUDIO_STATS_LEVEL_BINS - 1;
+
+    write_begin(s);
+    s->c.periods++;
+    s->c.level_hist[bin]++;
+    if (frames_read == 0)
+        s->c.underruns++;
+    else if (frames_read < frames)
+        s->c.partial_fills++;
+    s->c.concealed_frames += frames - frames_read;
+    write_end(s);
+}
+
+void audio_stats_dropped(audio_stats_t *s, uint16_t bytes) {
+    write_begin(s);
+    s->c.dropped_bytes += bytes;
+    write_end(s);
+}
+
+void audio_stats_stream(audio_stats_t *s, bool start) {
+    write_begin(s);
+    if (start)
+        s->c.stream_starts++;
+    else
+        s->c.stream_stops++;
+    write_end(s);
+}
+
+void audio_stats_dma_error(audio_stats_t *s) {
+    write_begin(s);
+    s->c.dma_errors++;
+    write_end(s);
+}
+
+void audio_stats_snapshot(audio_stats_t *s, audio_stats_counters_t *out,
+                          bool reset) {
+    audio_stats_counters_t now;
+    uint32_t seq;
+    do {
+        seq = s->seq;
+        BARRIER();
+        memcpy(&now, &s->c, sizeof(now));
+#ifdef AUDIO_STATS_READ_HOOK
+        AUDIO_STATS_READ_HOOK();
+#endif
+        BARRIER();
+    } while ((seq & 1U) || seq != s->seq);
+
+    // Counters wrap; the difference is still right
+    const uint32_t *n = (const uint32_t *)&now;
+    const uint32_t *b = (const uint32_t *)&s->base;
+    uint32_t *o = (uint32_t *)out;
+    for (uint32_t i = 0; i < COUNTER_WORDS; i++)
+        o[i] = n[i] - b[i];
+
+    if (reset)
+        s->base = now;
+}
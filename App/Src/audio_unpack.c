@@ -0,0 +1,152 @@
+// SPDX-License-Identifier: GPL-3.0-only
+// Copyright (c) 2026 Elia Chiarucci
+
+/*
+ * USB sample unpacking (CPU kernels + GPDMA transfer plan/model)
+ */
+
+#include "audio_unpack.h"
+#include <string.h>
+
+//--------------------------------------------------------------------+
+// CPU kernels
+//--------------------------------------------------------------------+
+
+void audio_unpack_s24(const uint8_t *src, int32_t *dst, uint16_t count) {
+    for (uint16_t i = 0; i < count; i++, src += 3) {
+        uint32_t raw = src[0] | ((uint32_t)src[1] << 8) | ((uint32_t)src[2] << 16);
+        // Sign-extend from 24-bit
+        if (raw & 0x800000)
+            raw |= 0xFF000000;
+        dst[i] = (int32_t)raw;
+    }
+}
+
+void audio_unpack_s16(const uint8_t *src, int32_t *dst, uint16_t count) {
+    // Pairs: one (unaligned-capable) word load, the low half shifted to the
+    // top and both arithmetic-shifted down into 24-bit position
+    uint16_t i = 0;
+    for (; i + 1U < count; i += 2, src += 4) {
+        uint32_t w;
+        memcpy(&w, src, sizeof(w));
+        dst[i] = (int32_t)(w << 16) >> 8;
+        dst[i + 1] = (int32_t)(w & 0xFFFF0000u) >> 8;
+    }
+    if (i < count)
+        dst[i] = (int32_t)((uint32_t)(int16_t)(src[0] | (src[1] << 8)) << 8);
+}
+
+// With the current FIFO depth (a multiple of 6 and of 4) a sample never
+// straddles the ring end, but the depth is a tusb_config knob and must not
+// silently corrupt the stream if it changes.
+static void unpack_regions(const usb_audio_regions_t *rgn, int32_t *dst,
+                           uint16_t sample_count, uint8_t size,
+                           void (*unpack)(const uint8_t *, int32_t *,
+                                          uint16_t)) {
+    uint16_t done = rgn->len[0] / size;
+    if (done > sample_count)
+        done = sample_count;
+    unpack(rgn->ptr[0], dst, done);
+    if (done == sample_count)
+        return;
+
+    const uint8_t *src = rgn->ptr[1];
+    uint16_t split = (uint16_t)(rgn->len[0] - done * size); // 0..size-1 bytes
+    if (split) {
+        uint8_t tmp[3];
+        memcpy(tmp, rgn->ptr[0] + done * size, split);
+        memcpy(tmp + split, src, (size_t)(size - split));
+        unpack(tmp, &dst[done], 1);
+        src += size - split;
+        done++;
+    }
+    unpack(src, &dst[done], (uint16_t)(sample_count - done));
+}
+
+void audio_unpack_s24_regions(const usb_audio_regions_t *rgn, int32_t *dst,
+                              uint16_t sample_count) {
+    unpack_regions(rgn, dst, sample_count, 3, audio_unpack_s24);
+}
+
+void audio_unpack_s16_regions(const usb_audio_regions_t *rgn, int32_t *dst,
+                              uint16_t sample_count) {
+    unpack_regions(rgn, dst, sample_count, 2, audio_unpack_s16);
+}
+
+//--------------------------------------------------------------------+
+// GPDMA plan
+//
+// Per channel, one 2D transfer walks the packed stream in 3-byte bursts:
+//   source:      burst 3 bytes, then skip the other channel's 3 bytes
+//   destination: burst into bytes 1..3 of the word, then skip 5 bytes
+//                (byte 0 of the next word + the other channel's word)
+// Byte 0 of every I2S word stays 0 because every CPU writer of the buffer
+// stores (sample << 8) too.
+//--------------------------------------------------------------------+
+
+#define SAMPLE_BYTES 3U
+#define I2S_WORD_BYTES 4U
+#define I2S_FRAME_BYTES (2U * I2S_WORD_BYTES)
+
+static void plan_region(const uint8_t *src, uint16_t frames,
+                        uint16_t dst_frame, bool swap,
+                        audio_unpack_xfer_t out[2]) {
+    for (uint8_t ch = 0; ch < 2; ch++) {
+        uint8_t dst_word = swap ? (uint8_t)(1U - ch) : ch;
+        out[ch].src = src + ch * SAMPLE_BYTES;
+        out[ch].dst_offset = (uint32_t)dst_frame * I2S_FRAME_BYTES +
+                             dst_word * I2S_WORD_BYTES + 1U;
+        out[ch].bytes = (uint16_t)(frames * SAMPLE_BYTES);
+        out[ch].burst = SAMPLE_BYTES;
+        out[ch].src_gap = SAMPLE_BYTES;
+        out[ch].dst_gap = I2S_FRAME_BYTES - SAMPLE_BYTES;
+    }
+}
+
+uint8_t audio_unpack_dma_plan(const usb_audio_regions_t *rgn, uint16_t frames,
+                              bool swap,
+                              audio_unpack_xfer_t out[AUDIO_UNPACK_MAX_XFERS]) {
+    uint16_t first = rgn->len[0] / AUDIO_UNPACK_FRAME_BYTES;
+    if (first >= frames) {
+        plan_region(rgn->ptr[0], frames, 0, swap, out);
+        return 2;
+    }
+
+    // A frame split across the ring end cannot be expressed as bursts
+    if (rgn->len[0] % AUDIO_UNPACK_FRAME_BYTES != 0)
+        return 0;
+
+    uint16_t second = (uint16_t)(frames - first);
+    if (rgn->len[1] < second * AUDIO_UNPACK_FRAME_BYTES)
+        return 0;
+
+    uint8_t n = 0;
+    if (first > 0) {
+        plan_region(rgn->ptr[0], first, 0, swap, &out[n]);
+        n += 2;
+    }
+    plan_region(rgn->ptr[1], second, first, swap, &out[n]);
+    return (uint8_t)(n + 2);
+}
+
+//--------------------------------------------------------------------+
+// Host model of the GPDMA 2D addressing: after each burst, both address
+// pointers advance by the burst length plus their offset (CxTR3.SAO/DAO)
+//--------------------------------------------------------------------+
+
+void audio_unpack_dma_model(const audio_unpack_xfer_t *xfers, uint8_t count,
+                            uint8_t *dst) {
+    for (uint8_t x = 0; x < count; x++) {
+        const audio_unpack_xfer_t *t = &xfers[x];
+        const uint8_t *s = t->src;
+        uint8_t *d = dst + t->dst_offset;
+        uint16_t remaining = t->bytes;
+        while (remaining > 0) {
+            uint16_t n = remaining < t->burst ? remaining : t->burst;
+            memcpy(d, s, n);
+            s += n + t->src_gap;
+            d += n + t->dst_gap;
+            remaining = (uint16_t)(remaining - n);
+        }
+    }
+}
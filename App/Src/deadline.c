@@ -0,0 +1,63 @@
+// SPDX-License-Identifier: GPL-3.0-only
+// Copyright (c) 2026 Elia Chiarucci
+
+/*
+ * Audio deadline monitor (see deadline.h)
+ */
+
+#include "deadline.h"
+#include <stddef.h>
+#include <string.h>
+
+static deadline_state_t state;
+
+static uint8_t hist_bin(uint32_t us) {
+    uint8_t bin = 0;
+    while (us && bin < DEADLINE_HIST_BINS - 1) {
+        us >>= 1;
+        bin++;
+    }
+    return bin;
+}
+
+void deadline_hist_add(deadline_hist_t *h, uint32_t us) {
+    if (h->count == 0 || us < h->min_us)
+        h->min_us = us;
+    if (us > h->max_us)
+        h->max_us = us;
+    if (h->count != UINT32_MAX)
+        h->count++;
+    uint32_t *b = &h->bins[hist_bin(us)];
+    if (*b != UINT32_MAX)
+        (*b)++;
+}
+
+void deadline_loop_pass(uint32_t us) {
+    deadline_hist_add(&state.loop, us);
+}
+
+void deadline_slack(uint32_t us) {
+    deadline_hist_add(&state.slack, us);
+}
+
+void deadline_miss(const deadline_miss_t *miss) {
+    state.log[state.misses % DEADLINE_MISS_LOG] = *miss;
+    state.misses++;
+}
+
+const deadline_state_t *deadline_state(void) {
+    return &state;
+}
+
+const deadline_miss_t *deadline_logged(uint32_t seq) {
+    if (seq >= state.misses || seq < state.log_start ||
+        state.misses - seq > DEADLINE_MISS_LOG)
+        return NULL;
+    return &state.log[seq % DEADLINE_MISS_LOG];
+}
+
+void deadline_reset(void) {
+    memset(&state.loop, 0, sizeof(state.loop));
+    memset(&state.slack, 0, sizeof(state.slack));
+    state.log_start = state.misses;
+}
@@ -0,0 +1,137 @@
+// SPDX-License-Identifier: GPL-3.0-only
+// Copyright (c) 2026 Elia Chiarucci
+
+/*
+ * On-target DSP kernel benchmark (see dsp_bench.h)
+ */
+
+#include "dsp_bench.h"
+#include "audio_eq.h"
+#include "audio_pcm.h"
+#include "audio_resample.h"
+#include "audio_unpack.h"
+#include "eq_profile.h"
+#include <stdbool.h>
+#include <string.h>
+
+// Host tests supply the cycle counter
+#ifdef DSP_BENCH_CYCLES
+uint32_t DSP_BENCH_CYCLES(void);
+#else
+#include "stm32h5xx.h"
+#define DSP_BENCH_CYCLES() (DWT->CYCCNT) // enabled in app_init
+#endif
+
+#define SAMPLES (DSP_BENCH_FRAMES * 2)
+
+static const char *const kernel_names[DSP_BENCH_COUNT] = {
+    [DSP_BENCH_UNPACK16] = "unpack16",
+    [DSP_BENCH_UNPACK] = "unpack",      [DSP_BENCH_RESAMPLE] = "resample",
+    [DSP_BENCH_SWAP] = "swap",
+    [DSP_BENCH_EQ_BT] = "eq_bt",        [DSP_BENCH_EQ_PROFILE] = "eq_prof",
+    [DSP_BENCH_VOLUME] = "volume",      [DSP_BENCH_PACK] = "pack",
+};
+
+// The canned input, as it arrives from USB, and the buffer the chain runs
+// on in place (as the I2S period buffer is used by read_audio_data)
+static uint8_t packed[DSP_BENCH_FRAMES * AUDIO_UNPACK_FRAME_BYTES];
+static int32_t work[SAMPLES];
+static audio_resample_t resampler;
+
+const char *dsp_bench_name(uint8_t id) {
+    return id < DSP_BENCH_COUNT ? kernel_names[id] : "";
+}
+
+// Pseudo-random samples at about -6dBFS, the same on every run
+static void make_input(void) {
+    uint32_t lcg = 1;
+    for (uint32_t i = 0; i < SAMPLES; i++) {
+        lcg = lcg * 1664525U + 1013904223U;
+        int32_t s = (int32_t)lcg >> 9; // 23 bits signed
+        packed[i * 3] = (uint8_t)s;
+        packed[i * 3 + 1] = (uint8_t)(s >> 8);
+        packed[i * 3 + 2] = (uint8_t)(s >> 16);
+    }
+}
+
+static uint8_t active_filters(void) {
+    uint8_t id = eq_profile_get_active();
+    const eq_profile_t *p = id != EQ_PROFILE_OFF ? eq_profile_get(id) : NULL;
+    uint8_t n = 0;
+    if (!p)
+        return 0;
+    for (uint8_t f = 0; f < p->filter_count && f < EQ_MAX_FILTERS; f++)
+        if (p->filters[f].enabled && p->filters[f].type != FILTER_OFF)
+            n++;
+    return n;
+}
+
+static void record(dsp_bench_result_t *r, uint32_t cycles, uint64_t *total) {
+    if (!r->runs || cycles < r->min)
+        r->min = cycles;
+    if (cycles > r->max)
+        r->max = cycles;
+    r->runs++;
+    *total += cycles;
+}
+
+void dsp_bench_run(dsp_bench_report_t *out) {
+    uint64_t total[DSP_BENCH_COUNT] = {0};
+    memset(out, 0, sizeof(*out));
+    out->buffer = (uintptr_t)work;
+    out->filter_count = active_filters();
+    out->bass = audio_eq_get_band(EQ_BAND_BASS);
+    out->treble = audio_eq_get_band(EQ_BAND_TREBLE);
+    bool profile = out->filter_count != 0;
+
+    make_input();
+    audio_eq_reset_state();
+    eq_profile_reset_state();
+    audio_resample_reset(&resampler);
+
+    for (uint32_t run = 0; run < DSP_BENCH_RUNS; run++) {
+        // The resampler takes the last frames unpacked, as the audio stage
+        // unpacks a 44.1kHz fill into the tail of the period
+        // (the 16-bit kernel reads the first two thirds of the same bytes)
+        uint16_t in = audio_resample_needed(&resampler, DSP_BENCH_FRAMES);
+        uint32_t t0u = DSP_BENCH_CYCLES();
+        audio_unpack_s16(packed, work, SAMPLES);
+        uint32_t t0 = DSP_BENCH_CYCLES();
+        audio_unpack_s24(packed, work, SAMPLES);
+        uint32_t t1 = DSP_BENCH_CYCLES();
+        audio_resample_process(&resampler, &work[2 * (DSP_BENCH_FRAMES - in)],
+                               work, DSP_BENCH_FRAMES);
+        uint32_t t1r = DSP_BENCH_CYCLES();
+        audio_pcm_swap(work, SAMPLES);
+        uint32_t t2 = DSP_BENCH_CYCLES();
+        audio_eq_process(work, SAMPLES, AUDIO_PCM_UNITY);
+        uint32_t t3 = DSP_BENCH_CYCLES();
+        if (profile)
+            eq_profile_process(work, SAMPLES, AUDIO_PCM_UNITY);
+        uint32_t t4 = DSP_BENCH_CYCLES();
+        audio_pcm_volume(work, SAMPLES, AUDIO_PCM_UNITY, AUDIO_PCM_UNITY / 2);
+        uint32_t t5 = DSP_BENCH_CYCLES();
+        audio_pcm_pack(work, SAMPLES);
+        uint32_t t6 = DSP_BENCH_CYCLES();
+
+        dsp_bench_result_t *k = out->kernel;
+        record(&k[DSP_BENCH_UNPACK16], t0 - t0u, &total[DSP_BENCH_UNPACK16]);
+        record(&k[DSP_BENCH_UNPACK], t1 - t0, &total[DSP_BENCH_UNPACK]);
+        record(&k[DSP_BENCH_RESAMPLE], t1r - t1, &total[DSP_BENCH_RESAMPLE]);
+        record(&k[DSP_BENCH_SWAP], t2 - t1r, &total[DSP_BENCH_SWAP]);
+        record(&k[DSP_BENCH_EQ_BT], t3 - t2, &total[DSP_BENCH_EQ_BT]);
+        if (profile)
+            record(&k[DSP_BENCH_EQ_PROFILE], t4 - t3,
+                   &total[DSP_BENCH_EQ_PROFILE]);
+        record(&k[DSP_BENCH_VOLUME], t5 - t4, &total[DSP_BENCH_VOLUME]);
+        record(&k[DSP_BENCH_PACK], t6 - t5, &total[DSP_BENCH_PACK]);
+    }
+
+    for (uint8_t i = 0; i < DSP_BENCH_COUNT; i++)
+        if (out->kernel[i].runs)
+            out->kernel[i].mean = (uint32_t)(total[i] / out->kernel[i].runs);
+
+    // Leave no trace of the canned signal in the filters
+    audio_eq_reset_state();
+    eq_profile_reset_state();
+}
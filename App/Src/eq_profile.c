@@ -11,11 +11,18 @@
  *
  * Audio processing: Direct Form II Transposed biquad cascade using
  * the Cortex-M33 single-precision FPU.
+ *
+ * Stored coefficients are designed by the PC app for 48kHz. At any other
+ * stream rate the active profile is redesigned here from its freq/gain/Q
+ * (RBJ cookbook, as the app does) into a RAM copy, refreshed whenever the
+ * rate, the active profile or its contents change.
  */
 
 #include "eq_profile.h"
 #include "SEGGER_RTT.h"
+#include "integrity.h"
 #include "stm32h5xx_hal.h"
+#include "trace.h"
 #include <math.h>
 #include <string.h>
 
@@ -62,6 +69,12 @@ static biquad_state_t filter_state[EQ_MAX_FILTERS][2]; // [filter][channel]
 // Cached pre-attenuation for the active profile
 static float profile_preatt = 1.0f;
 
+// Stream rate, and the active profile's filters redesigned for it when it
+// isn't PROFILE_DESIGN_RATE (process uses the stored ones otherwise)
+#define PROFILE_DESIGN_RATE 48000U
+static uint32_t profile_rate = PROFILE_DESIGN_RATE;
+static eq_filter_t rate_filters[EQ_MAX_FILTERS];
+
 // Compute pre-attenuation from the sum of positive filter gains
 // Conservative: assumes all boosting filters could overlap at one frequency
 static float compute_profile_preatt(const eq_profile_t *prof) {
@@ -91,23 +104,6 @@ static uint32_t flash_write_offset;
 static uint32_t flash_write_total;
 static uint8_t  flash_pad_buf[16]; // For partial last quad-word
 
-// ---------------------------------------------------------------------------
-// CRC32 (same polynomial as zlib, computed in software)
-// ---------------------------------------------------------------------------
-static uint32_t crc32_update(uint32_t crc, const uint8_t *data, uint32_t len) {
-    crc = ~crc;
-    for (uint32_t i = 0; i < len; i++) {
-        crc ^= data[i];
-        for (uint8_t bit = 0; bit < 8; bit++) {
-            if (crc & 1)
-                crc = (crc >> 1) ^ 0xEDB88320U;
-            else
-                crc >>= 1;
-        }
-    }
-    return ~crc;
-}
-
 // ---------------------------------------------------------------------------
 // Profile management
 // ---------------------------------------------------------------------------
@@ -156,8 +152,8 @@ void eq_profile_init(void) {
 
     // Try to load from flash
     if (flash->magic == PROFILE_MAGIC && flash->version == PROFILE_VERSION) {
-        uint32_t crc = crc32_update(
-            0, (const uint8_t *)flash->profiles, sizeof(flash->profiles));
+        uint32_t crc = integrity_crc32(0, flash->profiles,
+                                       sizeof(flash->profiles));
         if (crc == flash->checksum) {
             memcpy(&store, flash, sizeof(store));
 
@@ -207,6 +203,91 @@ const eq_profile_t *eq_profile_get(uint8_t id) {
     return &store.profiles[id];
 }
 
+// RBJ cookbook biquad for filt's type/freq/gain/Q at fs, normalized to a0=1.
+// False when the parameters don't give a usable filter at this rate.
+static bool design_filter(eq_filter_t *filt, float fs) {
+    if (!(filt->freq > 0.0f) || !(filt->freq < 0.5f * fs) || !(filt->q > 0.0f))
+        return false;
+
+    const float pi = 3.14159265358979f;
+    float a = powf(10.0f, filt->gain * 0.025f);
+    float w0 = 2.0f * pi * filt->freq / fs;
+    float cw = cosf(w0);
+    float alpha = sinf(w0) / (2.0f * filt->q);
+    float sa = 2.0f * sqrtf(a) * alpha;
+    float b0, b1, b2, a0, a1, a2;
+
+    switch (filt->type) {
+    case FILTER_BELL:
+        b0 = 1.0f + alpha * a;
+        b1 = -2.0f * cw;
+        b2 = 1.0f - alpha * a;
+        a0 = 1.0f + alpha / a;
+        a1 = -2.0f * cw;
+        a2 = 1.0f - alpha / a;
+        break;
+    case FILTER_LOW_SHELF:
+        b0 = a * ((a + 1.0f) - (a - 1.0f) * cw + sa);
+        b1 = 2.0f * a * ((a - 1.0f) - (a + 1.0f) * cw);
+        b2 = a * ((a + 1.0f) - (a - 1.0f) * cw - sa);
+        a0 = (a + 1.0f) + (a - 1.0f) * cw + sa;
+        a1 = -2.0f * ((a - 1.0f) + (a + 1.0f) * cw);
+        a2 = (a + 1.0f) + (a - 1.0f) * cw - sa;
+        break;
+    case FILTER_HIGH_SHELF:
+        b0 = a * ((a + 1.0f) + (a - 1.0f) * cw + sa);
+        b1 = -2.0f * a * ((a - 1.0f) + (a + 1.0f) * cw);
+        b2 = a * ((a + 1.0f) + (a - 1.0f) * cw - sa);
+        a0 = (a + 1.0f) - (a - 1.0f) * cw + sa;
+        a1 = 2.0f * ((a - 1.0f) - (a + 1.0f) * cw);
+        a2 = (a + 1.0f) - (a - 1.0f) * cw - sa;
+        break;
+    case FILTER_LOW_PASS:
+        b0 = b2 = (1.0f - cw) * 0.5f;
+        b1 = 1.0f - cw;
+        a0 = 1.0f + alpha;
+        a1 = -2.0f * cw;
+        a2 = 1.0f - alpha;
+        break;
+    case FILTER_HIGH_PASS:
+        b0 = b2 = (1.0f + cw) * 0.5f;
+        b1 = -(1.0f + cw);
+        a0 = 1.0f + alpha;
+        a1 = -2.0f * cw;
+        a2 = 1.0f - alpha;
+        break;
+    default:
+        return false;
+    }
+
+    filt->b0 = b0 / a0;
+    filt->b1 = b1 / a0;
+    filt->b2 = b2 / a0;
+    filt->a1 = a1 / a0;
+    filt->a2 = a2 / a0;
+    return filter_is_sane(filt);
+}
+
+// Redesign the active profile for profile_rate (no-op at the design rate).
+// A filter that can't be redesigned (corner at or above Nyquist, bad Q) is
+// bypassed rather than run with coefficients for the wrong rate.
+static void refresh_rate_filters(void) {
+    if (profile_rate == PROFILE_DESIGN_RATE ||
+        active_profile >= EQ_MAX_PROFILES)
+        return;
+
+    const eq_profile_t *prof = &store.profiles[active_profile];
+    for (uint8_t f = 0; f < EQ_MAX_FILTERS; f++) {
+        eq_filter_t *filt = &rate_filters[f];
+        *filt = prof->filters[f];
+        if (f >= prof->filter_count || !filt->enabled ||
+            filt->type == FILTER_OFF)
+            continue;
+        if (!design_filter(filt, (float)profile_rate))
+            filt->enabled = 0;
+    }
+}
+
 bool eq_profile_set(uint8_t id, const eq_profile_t *p) {
     if (id >= EQ_MAX_PROFILES || p == NULL)
         return false;
@@ -223,8 +304,10 @@ bool eq_profile_set(uint8_t id, const eq_profile_t *p) {
         store.profiles[id].filter_count = EQ_MAX_FILTERS;
 
     // Recalculate pre-attenuation if this is the active profile
-    if (id == active_profile)
+    if (id == active_profile) {
         profile_preatt = compute_profile_preatt(&store.profiles[id]);
+        refresh_rate_filters();
+    }
 
     // Recount
     store.profile_count = 0;
@@ -268,8 +351,7 @@ bool eq_profile_start_flash_save(void) {
         return false;
 
     // Update checksum
-    store.checksum = crc32_update(
-        0, (const uint8_t *)store.profiles, sizeof(store.profiles));
+    store.checksum = integrity_crc32(0, store.profiles, sizeof(store.profiles));
 
     // Start the sector erase WITHOUT waiting for completion: the sector is
     // in bank 2 while code executes from bank 1 (read-while-write), so the
@@ -278,6 +360,7 @@ bool eq_profile_start_flash_save(void) {
     HAL_FLASH_Unlock();
     __HAL_FLASH_CLEAR_FLAG(FLASH_FLAG_ALL_ERRORS);
     FLASH_Erase_Sector(PROFILES_SECTOR, PROFILES_BANK);
+    TRACE(TRACE_FLASH_ERASE_BEGIN, TRACE_FLASH_PROFILES, 0);
     flash_op = EQ_FLASH_ERASING;
     return true;
 }
@@ -291,6 +374,7 @@ void eq_profile_flash_task(void) {
         if ((FLASH_NS->NSSR &
              (FLASH_FLAG_BSY | FLASH_FLAG_WBNE | FLASH_FLAG_DBNE)) != 0U)
             return;
+        TRACE(TRACE_FLASH_ERASE_END, TRACE_FLASH_PROFILES, 0);
 
         // Deassert the erase request (mirrors the tail of HAL_FLASHEx_Erase)
         CLEAR_BIT(FLASH_NS->NSCR, FLASH_CR_SER | FLASH_CR_SNB | FLASH_CR_BKSEL);
@@ -316,7 +400,9 @@ void eq_profile_flash_task(void) {
     const uint8_t *src = (const uint8_t *)&store;
     uint32_t total = sizeof(eq_profile_store_t);
 
-    // Write up to FLASH_WRITES_PER_TICK quad-words per call
+    // Write up to FLASH_WRITES_PER_TICK quad-words per call (a failed write
+    // leaves the span open: the trace decoder closes it)
+    TRACE(TRACE_FLASH_PROGRAM_BEGIN, TRACE_FLASH_PROFILES, flash_write_offset);
     for (uint8_t n = 0; n < FLASH_WRITES_PER_TICK && flash_write_offset < flash_write_total; n++) {
         uint32_t addr = PROFILES_ADDR + flash_write_offset;
 
@@ -346,6 +432,7 @@ void eq_profile_flash_task(void) {
         }
         flash_write_offset += 16;
     }
+    TRACE(TRACE_FLASH_PROGRAM_END, TRACE_FLASH_PROFILES, 0);
 
     if (flash_write_offset >= flash_write_total) {
         HAL_FLASH_Lock();
@@ -382,6 +469,7 @@ void eq_profile_set_active(uint8_t id) {
         profile_preatt = compute_profile_preatt(&store.profiles[id]);
     else
         profile_preatt = 1.0f;
+    refresh_rate_filters();
 }
 
 uint8_t eq_profile_get_active(void) {
@@ -405,6 +493,19 @@ void eq_profile_reset_state(void) {
     memset(filter_state, 0, sizeof(filter_state));
 }
 
+bool eq_profile_set_rate(uint32_t rate) {
+    if (rate < 8000U || rate > 192000U)
+        return false;
+    profile_rate = rate;
+    refresh_rate_filters();
+    eq_profile_reset_state();
+    return true;
+}
+
+uint32_t eq_profile_get_rate(void) {
+    return profile_rate;
+}
+
 // 24-bit range limits
 #define SAMPLE_MAX  8388607.0f
 #define SAMPLE_MIN -8388608.0f
@@ -419,6 +520,9 @@ void eq_profile_process(int32_t *buffer, uint16_t sample_count,
     if (is_profile_empty(prof))
         return;
 
+    const eq_filter_t *filters = profile_rate == PROFILE_DESIGN_RATE
+                                     ? prof->filters
+                                     : rate_filters;
     const float vol = (float)volume_scale * (1.0f / 65536.0f);
     const float pre_scale = profile_preatt * (1.0f / SAMPLE_SCALE);
 
@@ -433,7 +537,7 @@ void eq_profile_process(int32_t *buffer, uint16_t sample_count,
 
         // Run biquad cascade for each enabled filter
         for (uint8_t f = 0; f < prof->filter_count; f++) {
-            const eq_filter_t *filt = &prof->filters[f];
+            const eq_filter_t *filt = &filters[f];
             if (!filt->enabled || filt->type == FILTER_OFF)
                 continue;
 
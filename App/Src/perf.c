@@ -0,0 +1,68 @@
+// SPDX-License-Identifier: GPL-3.0-only
+// Copyright (c) 2026 Elia Chiarucci
+
+/*
+ * Cycle-count profiler (see perf.h)
+ */
+
+#include "perf.h"
+#include <string.h>
+
+static const char *const stage_names[PERF_STAGE_COUNT] = {
+    [PERF_AUDIO] = "audio",   [PERF_UNPACK] = "unpack",
+    [PERF_RESAMPLE] = "resample", [PERF_ASRC] = "asrc",
+    [PERF_SWAP] = "swap",     [PERF_EQ] = "eq",
+    [PERF_VOLUME] = "volume", [PERF_PACK] = "pack",
+    [PERF_USB] = "usb",       [PERF_DISPLAY] = "display",
+    [PERF_FLASH] = "flash",
+};
+
+const char *perf_stage_name(uint8_t id) {
+    return id < PERF_STAGE_COUNT ? stage_names[id] : "";
+}
+
+#if PERF_PROFILE
+
+static perf_stage_t stages[PERF_STAGE_COUNT];
+
+static uint8_t hist_bin(uint32_t cycles) {
+    uint32_t v = cycles >> PERF_HIST_SHIFT;
+    uint8_t bin = 0;
+    while (v && bin < PERF_HIST_BINS - 1) {
+        v >>= 1;
+        bin++;
+    }
+    return bin;
+}
+
+void perf_record(uint8_t id, uint32_t cycles) {
+    perf_stage_t *s = &stages[id];
+    if (s->count == UINT32_MAX)
+        return;
+    if (s->count == 0 || cycles < s->min)
+        s->min = cycles;
+    if (cycles > s->max)
+        s->max = cycles;
+    s->count++;
+    s->total += cycles;
+    uint16_t *h = &s->hist[hist_bin(cycles)];
+    if (*h != UINT16_MAX)
+        (*h)++;
+}
+
+const perf_stage_t *perf_stage(uint8_t id) {
+    return id < PERF_STAGE_COUNT ? &stages[id] : NULL;
+}
+
+void perf_reset(void) {
+    memset(stages, 0, sizeof(stages));
+}
+
+uint16_t perf_load(const perf_stage_t *s, uint64_t window_cycles) {
+    if (!window_cycles)
+        return 0;
+    uint64_t load = s->total * 10000U / window_cycles;
+    return load > UINT16_MAX ? UINT16_MAX : (uint16_t)load;
+}
+
+#endif
@@ -0,0 +1,167 @@
+// SPDX-License-Identifier: GPL-3.0-only
+// Copyright (c) 2026 Elia Chiarucci
+
+/*
+ * Cooperative main-loop scheduler (see sched.h)
+ */
+
+#include "sched.h"
+#include <string.h>
+
+typedef struct {
+    uint32_t release;   // next release (periodic) / last start (poll)
+    uint32_t budget_us; // run time estimate used for deferral
+    bool continuing;    // returned true last run: sliced job in progress
+} task_rt_t;
+
+static const sched_task_t *task_table;
+static uint8_t task_count;
+static const sched_port_t *sched_port;
+
+static task_rt_t rt[SCHED_MAX_TASKS];
+static sched_stats_t stats[SCHED_MAX_TASKS];
+static uint32_t pass_count;
+static uint32_t idle_count;
+static volatile uint8_t current = SCHED_NO_TASK;
+
+static inline bool time_reached(uint32_t now, uint32_t t) {
+    return (int32_t)(now - t) >= 0;
+}
+
+static inline void sat_inc16(uint16_t *v) {
+    if (*v != UINT16_MAX)
+        (*v)++;
+}
+
+void sched_init(const sched_task_t *tasks, uint8_t count,
+                const sched_port_t *port) {
+    if (count > SCHED_MAX_TASKS)
+        count = SCHED_MAX_TASKS;
+    task_table = tasks;
+    task_count = count;
+    sched_port = port;
+
+    // Every task is released on the first pass
+    uint32_t now = port->now_ms();
+    for (uint8_t i = 0; i < count; i++) {
+        rt[i].release = now;
+        rt[i].budget_us = 0;
+        rt[i].continuing = false;
+    }
+    sched_reset_stats();
+}
+
+// Absolute time by which the current release must have started, or false
+// if the task has no deadline
+static bool task_deadline(const sched_task_t *t, const task_rt_t *r,
+                          uint32_t *deadline) {
+    uint16_t d = t->deadline_ms ? t->deadline_ms : t->period_ms;
+    if (d == 0)
+        return false;
+    *deadline = r->release + d;
+    return true;
+}
+
+static void record_run(task_rt_t *r, sched_stats_t *s, uint32_t cycles) {
+    uint32_t us = cycles / sched_port->cycles_per_us;
+    uint16_t us16 = us > UINT16_MAX ? UINT16_MAX : (uint16_t)us;
+
+    // Budget tracks the worst case but decays (1/8 per run) so a single run
+    // stretched by interrupts does not keep the task deferred forever
+    if (us >= r->budget_us)
+        r->budget_us = us;
+    else
+        r->budget_us -= (r->budget_us - us) / 8;
+
+    if (s->runs != UINT32_MAX)
+        s->runs++;
+    s->total_us += us;
+    s->last_us = us16;
+    if (us16 > s->max_us)
+        s->max_us = us16;
+}
+
+void sched_run(void) {
+    bool more_work = false;
+
+    for (uint8_t i = 0; i < task_count; i++) {
+        const sched_task_t *t = &task_table[i];
+        task_rt_t *r = &rt[i];
+        sched_stats_t *s = &stats[i];
+        uint32_t now = sched_port->now_ms();
+
+        if (!r->continuing && t->period_ms && !time_reached(now, r->release))
+            continue;
+
+        uint32_t deadline;
+        bool has_deadline = task_deadline(t, r, &deadline);
+        bool late = has_deadline && !time_reached(deadline, now);
+
+        // Not enough room before the audio stage: wait for the next pass,
+        // unless the deadline says this is the last chance
+        if ((t->flags & SCHED_DEFERRABLE) && sched_port->window_us) {
+            bool urgent = has_deadline && time_reached(now + 1, deadline);
+            if (!urgent && r->budget_us > sched_port->window_us()) {
+                sat_inc16(&s->deferred);
+                more_work = true;
+                continue;
+            }
+        }
+
+        // Slices of a job in progress are not new releases
+        if (!r->continuing) {
+            if (late)
+                sat_inc16(&s->missed);
+            if (t->period_ms == 0) {
+                r->release = now;
+            } else {
+                r->release += t->period_ms;
+                if (time_reached(now, r->release))
+                    r->release = now + t->period_ms; // a period behind: resync
+            }
+        }
+
+        uint32_t start = sched_port->cycles();
+        current = i;
+        r->continuing = t->run(now);
+        current = SCHED_NO_TASK;
+        record_run(r, s, sched_port->cycles() - start);
+        more_work |= r->continuing;
+    }
+
+    pass_count++;
+    if (!more_work && sched_port->idle) {
+        idle_count++;
+        sched_port->idle();
+    }
+}
+
+uint8_t sched_task_count(void) {
+    return task_count;
+}
+
+const sched_task_t *sched_task(uint8_t id) {
+    return id < task_count ? &task_table[id] : NULL;
+}
+
+const sched_stats_t *sched_stats(uint8_t id) {
+    return id < task_count ? &stats[id] : NULL;
+}
+
+uint8_t sched_current(void) {
+    return current;
+}
+
+uint32_t sched_pass_count(void) {
+    return pass_count;
+}
+
+uint32_t sched_idle_count(void) {
+    return idle_count;
+}
+
+void sched_reset_stats(void) {
+    memset(stats, 0, sizeof(stats));
+    pass_count = 0;
+    idle_count = 0;
+}
@@ -6,7 +6,12 @@
  *
  * Uses the last flash sector (8KB at 0x0801E000) for sequential record writing.
  * Each record is 16 bytes (quad-word aligned):
- *   [magic, volume, muted, bass, treble, brightness, timeout, profile, checksum, 0xFF x7]
+ *   [magic, volume, muted, bass, treble, brightness, timeout, profile, latency,
+ *    0xFF x3, crc32:4 LE]
+ * checked with the CRC-32 of bytes 0-11 (integrity.h). Records written by
+ * older firmware still load: magic RECORD_MAGIC_XOR, an XOR of bytes 0-7 in
+ * byte 8, then latency, ~latency (0xFF, 0xFF before the latency byte came,
+ * which loads the default profile).
  * Records are appended sequentially; when the sector is full it is erased.
  * On load, the last valid record is used.
  *
@@ -20,7 +25,10 @@
 
 #include "settings.h"
 #include "SEGGER_RTT.h"
+#include "audio_latency.h"
+#include "integrity.h"
 #include "stm32h5xx_hal.h"
+#include "trace.h"
 #include <string.h>
 
 #define SETTINGS_BANK        FLASH_BANK_2 // Bank 2 (0x08010000–0x0801FFFF)
@@ -29,12 +37,16 @@
 #define SETTINGS_PAGE_SIZE   8192U        // 8KB sector
 #define RECORD_SIZE          16U          // Quad-word aligned (16 bytes)
 #define MAX_RECORDS          (SETTINGS_PAGE_SIZE / RECORD_SIZE)
-#define RECORD_MAGIC         0xA6U
+#define RECORD_MAGIC         0xA7U
+#define RECORD_MAGIC_XOR     0xA6U        // older firmware's
+#define RECORD_CRC_OFFSET    12U          // bytes 0..11 covered by the CRC
 #define ERASED_BYTE          0xFFU
 
 // Strings record: 7 × 16 bytes = 112 bytes
-// Layout: [magic:1][manufacturer:32][product:32][audio_itf:32][checksum:1][pad:14]
-#define STRINGS_MAGIC        0xC3U
+// Layout: [magic:1][manufacturer:32][product:32][audio_itf:32][crc32:4][pad:11]
+// (older firmware's, STRINGS_MAGIC_XOR: an XOR checksum byte, then pad:14)
+#define STRINGS_MAGIC        0xC4U
+#define STRINGS_MAGIC_XOR    0xC3U
 #define STRINGS_RECORD_QUADS 7U
 #define STRINGS_RECORD_SIZE  (STRINGS_RECORD_QUADS * RECORD_SIZE) // 112 bytes
 #define STRINGS_CKSUM_LEN    97U  // bytes 0..96 covered by checksum
@@ -49,6 +61,26 @@ static uint8_t compute_checksum(const uint8_t *rec, uint8_t len) {
     return cksum;
 }
 
+static uint32_t read_le32(const uint8_t *p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) |
+           ((uint32_t)p[3] << 24);
+}
+
+static void write_le32(uint8_t *p, uint32_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+// A record's check: the CRC-32 of the first len bytes stored after them,
+// or for older firmware's records (legacy) an XOR of them in the byte after
+static bool record_valid(const uint8_t *rec, uint8_t len, bool legacy) {
+    if (legacy)
+        return compute_checksum(rec, len) == rec[len];
+    return integrity_crc32(0, rec, len) == read_le32(&rec[len]);
+}
+
 static bool erase_settings_page(void) {
     HAL_FLASH_Unlock();
 
@@ -59,7 +91,9 @@ static bool erase_settings_page(void) {
         .NbSectors = 1,
     };
     uint32_t sector_error = 0;
+    TRACE(TRACE_FLASH_ERASE_BEGIN, TRACE_FLASH_SETTINGS, 0);
     HAL_StatusTypeDef status = HAL_FLASHEx_Erase(&erase, &sector_error);
+    TRACE(TRACE_FLASH_ERASE_END, TRACE_FLASH_SETTINGS, 0);
 
     HAL_FLASH_Lock();
 
@@ -111,17 +145,20 @@ bool settings_load(settings_t *out) {
             return false;
         }
 
-        if (magic != RECORD_MAGIC) continue;
+        if (magic != RECORD_MAGIC && magic != RECORD_MAGIC_XOR) continue;
+        bool legacy = magic == RECORD_MAGIC_XOR;
 
-        // Checksum covers bytes 0-7, stored in byte 8
-        uint8_t cksum = compute_checksum(rec, 8);
+        // CRC over bytes 0-11 in bytes 12-15, or the XOR of bytes 0-7 in
+        // byte 8
+        bool valid = legacy ? record_valid(rec, 8, true)
+                         : record_valid(rec, RECORD_CRC_OFFSET, false);
         if (settings_ecc_error) {
             SEGGER_RTT_printf(0, "[settings] ECC error at record %d, erasing sector\n", i);
             erase_settings_page();
             settings_ecc_error = 0;
             return false;
         }
-        if (cksum != rec[8]) continue;
+        if (!valid) continue;
 
         out->local_volume    = rec[1];
         out->local_muted     = rec[2];
@@ -130,6 +167,10 @@ bool settings_load(settings_t *out) {
         out->brightness      = rec[5];
         out->display_timeout = rec[6];
         out->active_profile  = rec[7];
+        if (!legacy)
+            out->latency_profile = rec[8];
+        else
+            out->latency_profile = ((rec[9] ^ rec[10]) == 0xFF) ? rec[9] : AUDIO_LATENCY_DEFAULT;
         return true;
     }
 
@@ -162,7 +203,8 @@ bool settings_save(const settings_t *s) {
     uint32_t addr = SETTINGS_PAGE_ADDR + (uint32_t)slot * RECORD_SIZE;
 
     // Build 16-byte quad-word aligned record
-    // [magic, volume, muted, bass, treble, brightness, timeout, profile, checksum, pad x7]
+    // [magic, volume, muted, bass, treble, brightness, timeout, profile,
+    //  latency, pad x3, crc32 x4]
     uint8_t rec[RECORD_SIZE];
     rec[0] = RECORD_MAGIC;
     rec[1] = s->local_volume;
@@ -172,16 +214,21 @@ bool settings_save(const settings_t *s) {
     rec[5] = s->brightness;
     rec[6] = s->display_timeout;
     rec[7] = s->active_profile;
-    rec[8] = compute_checksum(rec, 8);
-    // Pad remaining bytes with 0xFF (erased state)
-    for (uint8_t i = 9; i < RECORD_SIZE; i++)
+    rec[8] = s->latency_profile;
+    // Pad with 0xFF (erased state) up to the CRC
+    for (uint8_t i = 9; i < RECORD_CRC_OFFSET; i++)
         rec[i] = ERASED_BYTE;
+    write_le32(&rec[RECORD_CRC_OFFSET],
+               integrity_crc32(0, rec, RECORD_CRC_OFFSET));
 
     // STM32H5 programs in quad-words (128 bits = 16 bytes)
     HAL_FLASH_Unlock();
 
+    TRACE(TRACE_FLASH_PROGRAM_BEGIN, TRACE_FLASH_SETTINGS,
+          addr - SETTINGS_PAGE_ADDR);
     HAL_StatusTypeDef status = HAL_FLASH_Program(
         FLASH_TYPEPROGRAM_QUADWORD, addr, (uint32_t)rec);
+    TRACE(TRACE_FLASH_PROGRAM_END, TRACE_FLASH_SETTINGS, 0);
     if (status != HAL_OK) {
         HAL_FLASH_Lock();
         return false;
@@ -206,19 +253,18 @@ bool settings_load_strings(char manufacturer[33], char product[33], char audio_i
             settings_ecc_error = 0;
             return false;
         }
-        if (magic != STRINGS_MAGIC) continue;
+        if (magic != STRINGS_MAGIC && magic != STRINGS_MAGIC_XOR) continue;
 
         // Verify checksum over bytes 0..96
-        uint8_t cksum = 0;
-        for (uint8_t j = 0; j < STRINGS_CKSUM_LEN; j++)
-            cksum ^= rec[j];
+        bool valid = record_valid(rec, STRINGS_CKSUM_LEN,
+                                  magic == STRINGS_MAGIC_XOR);
 
         if (settings_ecc_error) {
             erase_settings_page();
             settings_ecc_error = 0;
             return false;
         }
-        if (cksum != rec[STRINGS_CKSUM_LEN]) continue;
+        if (!valid) continue;
 
         memcpy(manufacturer, &rec[1],  32);
         manufacturer[32] = '\0';
@@ -262,19 +308,20 @@ bool settings_save_strings(const char *manufacturer, const char *product, const
     strncpy((char *)&rec[33], product,       32);
     strncpy((char *)&rec[65], audio_itf,     32);
 
-    uint8_t cksum = 0;
-    for (uint8_t i = 0; i < STRINGS_CKSUM_LEN; i++)
-        cksum ^= rec[i];
-    rec[STRINGS_CKSUM_LEN] = cksum;
+    write_le32(&rec[STRINGS_CKSUM_LEN],
+               integrity_crc32(0, rec, STRINGS_CKSUM_LEN));
 
     HAL_FLASH_Unlock();
 
     uint32_t addr = SETTINGS_PAGE_ADDR + (uint32_t)slot * RECORD_SIZE;
     for (uint8_t q = 0; q < STRINGS_RECORD_QUADS; q++) {
+        TRACE(TRACE_FLASH_PROGRAM_BEGIN, TRACE_FLASH_SETTINGS,
+              addr + q * RECORD_SIZE - SETTINGS_PAGE_ADDR);
         HAL_StatusTypeDef status = HAL_FLASH_Program(
             FLASH_TYPEPROGRAM_QUADWORD,
             addr + q * RECORD_SIZE,
             (uint32_t)&rec[q * RECORD_SIZE]);
+        TRACE(TRACE_FLASH_PROGRAM_END, TRACE_FLASH_SETTINGS, 0);
         if (status != HAL_OK) {
             HAL_FLASH_Lock();
             return false;
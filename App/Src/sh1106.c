@@ -2,6 +2,7 @@
 // Copyright (c) 2026 Elia Chiarucci
 
 #include "sh1106.h"
+#include "trace.h"
 #include <string.h>
 
 #define FB_SIZE (SH1106_WIDTH * SH1106_HEIGHT / 8)
@@ -138,6 +139,7 @@ static void sh1106_send_page(uint8_t page) {
     page_buf[6] = 0x40;                                            // data follows
 
     memcpy(&page_buf[PAGE_HDR_SIZE], &framebuffer[page * SH1106_WIDTH], SH1106_WIDTH);
+    TRACE(TRACE_DISPLAY_PAGE_BEGIN, page, 0);
     if (HAL_I2C_Master_Transmit_DMA(sh1106_i2c, SH1106_I2C_ADDR, page_buf, PAGE_BUF_SIZE) != HAL_OK) {
         sh1106_dma_busy = 0; // Prevent lockup if DMA fails to start
     }
@@ -401,6 +403,7 @@ void sh1106_write_string_centered(const char *str, uint8_t y) {
 
 void HAL_I2C_MasterTxCpltCallback(I2C_HandleTypeDef *hi2c) {
     if (hi2c == sh1106_i2c) {
+        TRACE(TRACE_DISPLAY_PAGE_END, current_page, 0);
         dirty_pages &= ~(1 << current_page);  // mark sent page clean
         // Rescan from page 0, not from current_page+1: pages dirtied behind
         // the cursor while this transfer was in flight must not be stranded
@@ -0,0 +1,71 @@
+// SPDX-License-Identifier: GPL-3.0-only
+// Copyright (c) 2026 Elia Chiarucci
+
+/*
+ * Binary event trace over RTT (see trace.h)
+ */
+
+#include "trace.h"
+
+#if TRACE_RTT
+
+#include "SEGGER_RTT.h"
+#include <stdbool.h>
+
+_Static_assert(sizeof(trace_record_t) == 8, "trace records are 8 bytes");
+
+// Host tests supply the cycle counter and run single-threaded
+#ifdef TRACE_CYCLES
+uint32_t TRACE_CYCLES(void);
+#define TRACE_LOCK() 0U
+#define TRACE_UNLOCK(key) (void)(key)
+#else
+#include "stm32h5xx.h"
+#define TRACE_CYCLES() (DWT->CYCCNT) // enabled in app_init
+// Every priority: the I2S DMA interrupt traces too
+#define TRACE_LOCK() trace_lock()
+#define TRACE_UNLOCK(key) __set_PRIMASK(key)
+
+static inline uint32_t trace_lock(void) {
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    return primask;
+}
+#endif
+
+static uint8_t buffer[TRACE_BUFFER_SIZE];
+static uint32_t lost; // records dropped since the last one written
+
+// Skip mode: the record goes in whole or not at all
+static bool put(uint32_t cycles, uint8_t event, uint8_t arg8,
+                uint16_t arg16) {
+    trace_record_t r = {cycles, event, arg8, arg16};
+    return SEGGER_RTT_WriteNoLock(TRACE_CHANNEL, &r, sizeof(r)) == sizeof(r);
+}
+
+void trace_init(uint32_t cpu_hz) {
+    SEGGER_RTT_ConfigUpBuffer(TRACE_CHANNEL, "Trace", buffer, sizeof(buffer),
+                              SEGGER_RTT_MODE_NO_BLOCK_SKIP);
+    lost = 0;
+    trace_event(TRACE_START, TRACE_VERSION, (uint16_t)(cpu_hz / 1000000U));
+}
+
+void trace_event(uint8_t event, uint8_t arg8, uint16_t arg16) {
+    uint32_t key = TRACE_LOCK();
+    // Stamped under the lock, so records are in timestamp order
+    uint32_t now = TRACE_CYCLES();
+    if (lost) {
+        uint16_t n = lost > UINT16_MAX ? UINT16_MAX : (uint16_t)lost;
+        if (!put(now, TRACE_LOST, 0, n)) {
+            lost++;
+            TRACE_UNLOCK(key);
+            return;
+        }
+        lost = 0;
+    }
+    if (!put(now, event, arg8, arg16))
+        lost++;
+    TRACE_UNLOCK(key);
+}
+
+#endif
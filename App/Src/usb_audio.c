@@ -2,12 +2,31 @@
 // Copyright (c) 2026 Elia Chiarucci
 
 /*
- * TinyUSB Audio Class Callbacks for UAC1 Speaker
+ * TinyUSB Audio Class Callbacks for the UAC1 or UAC2 Speaker
+ *
+ * UAC1 sets the rate on the streaming endpoint, UAC2 on the clock source
+ * entity (USB_AUDIO_UAC2, tusb_config.h); mute and volume are the same
+ * feature unit controls in either. The clock is synchronised through the
+ * feedback endpoint, or with AUDIO_ADAPTIVE_CLOCK by steering the I2S clock
+ * to the packets (audio_adaptive.h). With feedback, a converter between the
+ * FIFO and the DSP chain takes over from it when the FIFO drifts anyway
+ * (audio_asrc.h): the host or a hub ignores it. With USB_AUDIO_LOOPBACK,
+ * UAC1 only, a capture interface streams what the DAC plays back to the
+ * host (audio_output.h), at the fixed I2S rate.
  */
 
 #include "tusb.h"
+#include "device/usbd_pvt.h"
 #include "usb_descriptors.h"
+#include "audio_adaptive.h"
+#include "audio_asrc.h"
+#include "audio_delay.h"
+#include "audio_feedback.h"
 #include "audio_output.h"
+#include "audio_pll.h"
+#include "usb_audio.h"
+#include "trace.h"
+#include "stm32h5xx_hal.h"
 
 //--------------------------------------------------------------------+
 // Audio State
@@ -21,6 +40,27 @@ static uint32_t current_sample_rate = 48000;
 // Streaming state
 static volatile bool audio_streaming = false;
 
+#if AUDIO_ADAPTIVE_CLOCK
+// Adaptive clock (audio_adaptive.h): stepped as each packet lands. The
+// correction carries over to the next stream, the oscillator's offset
+// already learnt.
+static audio_adaptive_t adaptive;
+#else
+// Explicit feedback (audio_feedback.h): updated from the USB interrupt,
+// packet levels in tud_audio_rx_done_isr and the I2S clock at every SOF
+static audio_feedback_t feedback;
+static volatile bool feedback_sof = false; // SOF interrupt on for this stream
+#endif
+
+#if AUDIO_OUTPUT_ASRC
+// Converter monitor (audio_asrc.h): stepped as each packet lands, the
+// verdict passed on to the audio stage
+static audio_asrc_ctl_t asrc;
+#endif
+
+// Output delay (audio_delay.h), estimated as each packet lands
+static audio_delay_t delay;
+
 //--------------------------------------------------------------------+
 // Public API
 //--------------------------------------------------------------------+
@@ -33,14 +73,110 @@ bool usb_audio_is_streaming(void) {
     return audio_streaming;
 }
 
-uint16_t usb_audio_read(uint8_t* buffer, uint16_t max_length) {
-    return tud_audio_read(buffer, max_length);
+uint16_t usb_audio_peek(usb_audio_regions_t* regions, uint16_t max_length) {
+    tu_fifo_buffer_info_t info;
+    tu_fifo_get_read_info(tud_audio_get_ep_out_ff(), &info);
+
+    uint16_t first = tu_min16(info.linear.len, max_length);
+    uint16_t second = tu_min16(info.wrapped.len, (uint16_t)(max_length - first));
+
+    regions->ptr[0] = info.linear.ptr;
+    regions->len[0] = first;
+    regions->ptr[1] = info.wrapped.ptr;
+    regions->len[1] = second;
+    return (uint16_t)(first + second);
+}
+
+// A packet cut short by a full FIFO keeps whole frames, 24 or 16-bit
+_Static_assert(CFG_TUD_AUDIO_FUNC_1_EP_OUT_SW_BUF_SZ % 12 == 0,
+               "EP OUT FIFO depth in whole 6 and 4-byte frames");
+
+void usb_audio_consume(uint16_t length) {
+    // Only the ISR writes (wr_idx) and only the fill path reads (rd_idx).
+    // The FIFO doesn't overwrite (tud_audio_set_itf_cb): the ISR never
+    // touches the bytes being read in place, and advancing the read index
+    // needs no locking.
+    tu_fifo_advance_read_pointer(tud_audio_get_ep_out_ff(), length);
 }
 
 uint16_t usb_audio_available(void) {
     return tud_audio_available();
 }
 
+uint16_t usb_audio_free(void) {
+    return tu_fifo_remaining(tud_audio_get_ep_out_ff());
+}
+
+#if USB_AUDIO_LOOPBACK
+
+uint16_t usb_audio_capture_reserve(usb_audio_space_t* space, uint16_t max_length) {
+    tu_fifo_buffer_info_t info;
+    tu_fifo_get_write_info(tud_audio_get_ep_in_ff(), &info);
+
+    uint16_t first = tu_min16(info.linear.len, max_length);
+    uint16_t second = tu_min16(info.wrapped.len, (uint16_t)(max_length - first));
+
+    space->ptr[0] = info.linear.ptr;
+    space->len[0] = first;
+    space->ptr[1] = info.wrapped.ptr;
+    space->len[1] = second;
+    return (uint16_t)(first + second);
+}
+
+void usb_audio_capture_commit(uint16_t length) {
+    // Only the audio stage writes (wr_idx) and only the ISR reads (rd_idx)
+    tu_fifo_advance_write_pointer(tud_audio_get_ep_in_ff(), length);
+}
+
+#endif // USB_AUDIO_LOOPBACK
+
+void usb_audio_get_feedback_stats(audio_fb_stats_t* stats) {
+#if AUDIO_ADAPTIVE_CLOCK
+    memset(stats, 0, sizeof(*stats)); // no feedback endpoint
+#else
+    // Consistent snapshot: the USB interrupt updates it every SOF
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    *stats = feedback.stats;
+    __set_PRIMASK(primask);
+#endif
+}
+
+bool usb_audio_get_adaptive_stats(audio_ad_stats_t* stats) {
+#if AUDIO_ADAPTIVE_CLOCK
+    // Consistent snapshot: the USB interrupt updates it every packet
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    *stats = adaptive.stats;
+    __set_PRIMASK(primask);
+    return true;
+#else
+    (void) stats;
+    return false;
+#endif
+}
+
+bool usb_audio_get_asrc_stats(audio_asrc_stats_t* stats) {
+#if AUDIO_OUTPUT_ASRC
+    // Consistent snapshot: the USB interrupt updates it every packet
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    *stats = asrc.stats;
+    __set_PRIMASK(primask);
+    return true;
+#else
+    (void) stats;
+    return false;
+#endif
+}
+
+void usb_audio_get_delay_stats(audio_delay_stats_t* stats) {
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    *stats = delay.stats;
+    __set_PRIMASK(primask);
+}
+
 int8_t usb_audio_get_volume(void) {
     // Return master volume (channel 0), clamped to int8_t range
     int16_t vol = volume[0];
@@ -61,6 +197,43 @@ bool usb_audio_is_muted(void) {
     return mute[0] != 0;
 }
 
+// Restart the clock sync and delay estimate for the current rate and
+// format: the stream opened or its rate changed
+static void sync_restart(uint8_t func_id) {
+#if AUDIO_ADAPTIVE_CLOCK
+    (void) func_id;
+    // Against tud_audio_rx_done_isr; the PLL keeps the last correction
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    audio_adaptive_init(&adaptive, current_sample_rate, audio_output_get_frame_bytes(),
+                        audio_adaptive_ppm_q8(&adaptive), AUDIO_PLL_MIN_Q8, AUDIO_PLL_MAX_Q8);
+    __set_PRIMASK(primask);
+#else
+    // TinyUSB only enables the SOF interrupt for its own frequency methods;
+    // it is turned on by the first packet (tud_audio_rx_done_isr), once the
+    // control request handling that calls this is over. Off until then, so
+    // the SOF handler never sees the state half reset.
+    usbd_sof_enable(BOARD_TUD_RHPORT, SOF_CONSUMER_AUDIO, false);
+    feedback_sof = false;
+    audio_feedback_init(&feedback, current_sample_rate, audio_output_fifo_target());
+    audio_feedback_set_clock_rate(&feedback, audio_output_get_i2s_rate());
+    audio_feedback_set_frame_bytes(&feedback, audio_output_get_frame_bytes());
+    tud_audio_n_fb_set(func_id, audio_feedback_value(&feedback));
+#endif
+#if AUDIO_OUTPUT_ASRC
+    // Against tud_audio_rx_done_isr
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    audio_asrc_ctl_init(&asrc, current_sample_rate, audio_output_get_frame_bytes(),
+                        audio_output_fifo_target());
+    audio_output_set_asrc(false, 0);
+    __set_PRIMASK(primask);
+#endif
+    audio_delay_init(&delay, current_sample_rate, audio_output_get_frame_bytes());
+}
+
+#if !USB_AUDIO_UAC2
+
 //--------------------------------------------------------------------+
 // UAC1 Helper Functions
 //--------------------------------------------------------------------+
@@ -74,13 +247,27 @@ static bool audio10_set_req_ep(tusb_control_request_t const* p_request, uint8_t*
                 // Request uses 3 bytes
                 TU_VERIFY(p_request->wLength == 3);
 
-                // Only 48kHz is advertised in the descriptor. Reject anything
-                // else (STALL) so a nonconforming host can never configure the
-                // feedback loop for a rate the fixed I2S clock cannot produce.
+#if USB_AUDIO_LOOPBACK
+                // The capture runs at the I2S rate, its only one: the
+                // playback is left alone
+                if (TU_U16_LOW(p_request->wIndex) == EPNUM_AUDIO_IN)
+                    return (tu_unaligned_read32(pBuff) & 0x00FFFFFF) == USB_AUDIO_CAPTURE_RATE;
+#endif
+
+                // 44.1, 48, 88.2 and 96kHz are advertised in the
+                // descriptor (the 44.1kHz family resampled). Anything else,
+                // or a rate the I2S can't be switched to, is rejected
+                // (STALL) so the feedback loop is never configured for a rate
+                // the DAC isn't running at. TinyUSB re-reads the feedback
+                // parameters right after.
                 uint32_t freq = tu_unaligned_read32(pBuff) & 0x00FFFFFF;
-                TU_VERIFY(freq == 48000);
+                TU_VERIFY(audio_output_set_rate(freq));
 
                 current_sample_rate = freq;
+#if AUDIO_ADAPTIVE_CLOCK
+                // No feedback parameters to re-read
+                sync_restart(0);
+#endif
                 return true;
             }
             break;
@@ -98,10 +285,15 @@ static bool audio10_get_req_ep(uint8_t rhport, tusb_control_request_t const* p_r
     switch (ctrlSel) {
         case AUDIO10_EP_CTRL_SAMPLING_FREQ:
             if (p_request->bRequest == AUDIO10_CS_REQ_GET_CUR) {
+                uint32_t rate = current_sample_rate;
+#if USB_AUDIO_LOOPBACK
+                if (TU_U16_LOW(p_request->wIndex) == EPNUM_AUDIO_IN)
+                    rate = USB_AUDIO_CAPTURE_RATE;
+#endif
                 uint8_t freq[3];
-                freq[0] = (uint8_t)(current_sample_rate & 0xFF);
-                freq[1] = (uint8_t)((current_sample_rate >> 8) & 0xFF);
-                freq[2] = (uint8_t)((current_sample_rate >> 16) & 0xFF);
+                freq[0] = (uint8_t)(rate & 0xFF);
+                freq[1] = (uint8_t)((rate >> 8) & 0xFF);
+                freq[2] = (uint8_t)((rate >> 16) & 0xFF);
                 return tud_audio_buffer_and_schedule_control_xfer(rhport, p_request, freq, sizeof(freq));
             }
             break;
@@ -194,10 +386,145 @@ static bool audio10_get_req_entity(uint8_t rhport, tusb_control_request_t const*
     return false;
 }
 
+#else // USB_AUDIO_UAC2
+
+//--------------------------------------------------------------------+
+// UAC2 Helper Functions
+//--------------------------------------------------------------------+
+
+static const uint32_t sample_rates[] = {USB_AUDIO_SAMPLE_RATES};
+
+// Volume range in 1/256 dB, as UAC1's MIN/MAX/RES
+#define VOLUME_MIN  (-90 * 256)
+#define VOLUME_MAX  0
+#define VOLUME_RES  256
+
+static bool audio20_set_req_entity(tusb_control_request_t const* p_request, uint8_t* pBuff) {
+    uint8_t channelNum = TU_U16_LOW(p_request->wValue);
+    uint8_t ctrlSel = TU_U16_HIGH(p_request->wValue);
+    uint8_t entityID = TU_U16_HIGH(p_request->wIndex);
+
+    // Only CUR is settable
+    TU_VERIFY(p_request->bRequest == AUDIO20_CS_REQ_CUR);
+
+    if (entityID == UAC2_ENTITY_CLOCK_SOURCE) {
+        if (ctrlSel == AUDIO20_CS_CTRL_SAM_FREQ) {
+            TU_VERIFY(p_request->wLength == 4);
+
+            // Only the rates of the RANGE answer; anything else, or a rate
+            // the I2S can't be switched to, is rejected (STALL) as in UAC1
+            uint32_t freq = tu_unaligned_read32(pBuff);
+            TU_VERIFY(audio_output_set_rate(freq));
+
+            current_sample_rate = freq;
+
+            // TinyUSB only re-reads the feedback parameters on UAC1's
+            // endpoint request: restart it here, whether streaming or not
+            // (set_interface restarts it again on open)
+            sync_restart(0);
+            return true;
+        }
+        return false;
+    }
+
+    if (entityID == UAC1_ENTITY_FEATURE_UNIT) {
+        TU_VERIFY(channelNum <= CFG_TUD_AUDIO_FUNC_1_N_CHANNELS_RX);
+        switch (ctrlSel) {
+            case AUDIO20_FU_CTRL_MUTE:
+                TU_VERIFY(p_request->wLength == 1);
+                mute[channelNum] = pBuff[0];
+
+                // Apply mute to DAC
+                audio_output_set_mute(mute[0] || mute[1] || mute[2]);
+                return true;
+
+            case AUDIO20_FU_CTRL_VOLUME:
+                TU_VERIFY(p_request->wLength == 2);
+                volume[channelNum] = (int16_t)tu_unaligned_read16(pBuff) / 256;
+                return true;
+
+            default:
+                return false;
+        }
+    }
+
+    return false;
+}
+
+static bool audio20_get_req_entity(uint8_t rhport, tusb_control_request_t const* p_request) {
+    uint8_t channelNum = TU_U16_LOW(p_request->wValue);
+    uint8_t ctrlSel = TU_U16_HIGH(p_request->wValue);
+    uint8_t entityID = TU_U16_HIGH(p_request->wIndex);
+
+    if (entityID == UAC2_ENTITY_CLOCK_SOURCE) {
+        switch (ctrlSel) {
+            case AUDIO20_CS_CTRL_SAM_FREQ:
+                if (p_request->bRequest == AUDIO20_CS_REQ_CUR) {
+                    uint32_t freq = current_sample_rate;
+                    return tud_audio_buffer_and_schedule_control_xfer(rhport, p_request, &freq, sizeof(freq));
+                }
+                if (p_request->bRequest == AUDIO20_CS_REQ_RANGE) {
+                    // Each rate a discrete subrange (MIN = MAX, RES 0)
+                    audio20_control_range_4_n_t(USB_AUDIO_SAMPLE_RATE_COUNT) range;
+                    range.wNumSubRanges = USB_AUDIO_SAMPLE_RATE_COUNT;
+                    for (uint8_t i = 0; i < USB_AUDIO_SAMPLE_RATE_COUNT; i++) {
+                        range.subrange[i].bMin = sample_rates[i];
+                        range.subrange[i].bMax = sample_rates[i];
+                        range.subrange[i].bRes = 0;
+                    }
+                    return tud_audio_buffer_and_schedule_control_xfer(rhport, p_request, &range, sizeof(range));
+                }
+                return false;
+
+            case AUDIO20_CS_CTRL_CLK_VALID:
+                if (p_request->bRequest == AUDIO20_CS_REQ_CUR) {
+                    uint8_t valid = 1;  // the I2S clock always runs
+                    return tud_audio_buffer_and_schedule_control_xfer(rhport, p_request, &valid, sizeof(valid));
+                }
+                return false;
+
+            default:
+                return false;
+        }
+    }
+
+    if (entityID == UAC1_ENTITY_FEATURE_UNIT) {
+        TU_VERIFY(channelNum <= CFG_TUD_AUDIO_FUNC_1_N_CHANNELS_RX);
+        switch (ctrlSel) {
+            case AUDIO20_FU_CTRL_MUTE:
+                TU_VERIFY(p_request->bRequest == AUDIO20_CS_REQ_CUR);
+                return tud_audio_buffer_and_schedule_control_xfer(rhport, p_request, &mute[channelNum], 1);
+
+            case AUDIO20_FU_CTRL_VOLUME:
+                if (p_request->bRequest == AUDIO20_CS_REQ_CUR) {
+                    int16_t vol = volume[channelNum] * 256;  // Convert to 1/256 dB units
+                    return tud_audio_buffer_and_schedule_control_xfer(rhport, p_request, &vol, sizeof(vol));
+                }
+                if (p_request->bRequest == AUDIO20_CS_REQ_RANGE) {
+                    audio20_control_range_2_n_t(1) range = {
+                        .wNumSubRanges = 1,
+                        .subrange[0] = {.bMin = VOLUME_MIN, .bMax = VOLUME_MAX, .bRes = VOLUME_RES},
+                    };
+                    return tud_audio_buffer_and_schedule_control_xfer(rhport, p_request, &range, sizeof(range));
+                }
+                return false;
+
+            default:
+                return false;
+        }
+    }
+
+    return false;
+}
+
+#endif // USB_AUDIO_UAC2
+
 //--------------------------------------------------------------------+
 // TinyUSB Audio Callbacks
 //--------------------------------------------------------------------+
 
+#if !USB_AUDIO_UAC2
+
 // Invoked when audio class specific set request received for an EP
 bool tud_audio_set_req_ep_cb(uint8_t rhport, tusb_control_request_t const* p_request, uint8_t* pBuff) {
     (void) rhport;
@@ -220,6 +547,21 @@ bool tud_audio_get_req_entity_cb(uint8_t rhport, tusb_control_request_t const* p
     return audio10_get_req_entity(rhport, p_request);
 }
 
+#else // USB_AUDIO_UAC2: no endpoint controls (TinyUSB's weak defaults stall)
+
+// Invoked when audio class specific set request received for an entity
+bool tud_audio_set_req_entity_cb(uint8_t rhport, tusb_control_request_t const* p_request, uint8_t* buf) {
+    (void) rhport;
+    return audio20_set_req_entity(p_request, buf);
+}
+
+// Invoked when audio class specific get request received for an entity
+bool tud_audio_get_req_entity_cb(uint8_t rhport, tusb_control_request_t const* p_request) {
+    return audio20_get_req_entity(rhport, p_request);
+}
+
+#endif // USB_AUDIO_UAC2
+
 // Invoked when interface is set
 bool tud_audio_set_itf_cb(uint8_t rhport, tusb_control_request_t const* p_request) {
     (void) rhport;
@@ -228,44 +570,129 @@ bool tud_audio_set_itf_cb(uint8_t rhport, tusb_control_request_t const* p_reques
 
     if (itf == ITF_NUM_AUDIO_STREAMING) {
         if (alt != 0) {
+            // The format follows the alternate setting: 24-bit on 1, 16-bit
+            // on 2. Set before the feedback parameters are read (right
+            // after this), which take the FIFO target in its frames.
+            TU_VERIFY(audio_output_set_format(alt == USB_AUDIO_ALT_16
+                                                  ? CFG_TUD_AUDIO_FUNC_1_N_BYTES_PER_SAMPLE_RX_16
+                                                  : CFG_TUD_AUDIO_FUNC_1_N_BYTES_PER_SAMPLE_RX));
+
+            // Read in place (usb_audio_peek): a packet that doesn't fit
+            // is cut to the frames that do, never written over unread ones
+            tu_fifo_set_overwritable(tud_audio_get_ep_out_ff(), false);
+
             // Start streaming
             audio_streaming = true;
             audio_output_start_streaming();
+#if AUDIO_ADAPTIVE_CLOCK
+            // No feedback parameters to read
+            sync_restart(0);
+#endif
         }
     }
+#if USB_AUDIO_LOOPBACK
+    else if (itf == ITF_NUM_AUDIO_CAPTURE) {
+        // The FIFO was cleared as the endpoint closed: capture from the
+        // next period played
+        audio_output_set_capture(alt != 0);
+    }
+#endif
 
     return true;
 }
 
-// Invoked when interface is closed (alt setting 0)
+// Invoked when the streaming endpoint is closed: alt setting 0, or before
+// the host switches straight to the other format (reopened by
+// tud_audio_set_itf_cb, with the FIFO cleared)
 bool tud_audio_set_itf_close_ep_cb(uint8_t rhport, tusb_control_request_t const* p_request) {
     (void) rhport;
     uint8_t const itf = tu_u16_low(tu_le16toh(p_request->wIndex));
-    uint8_t const alt = tu_u16_low(tu_le16toh(p_request->wValue));
 
-    if (itf == ITF_NUM_AUDIO_STREAMING && alt == 0) {
+    if (itf == ITF_NUM_AUDIO_STREAMING) {
         // Stop streaming
         audio_streaming = false;
         audio_output_stop_streaming();
     }
+#if USB_AUDIO_LOOPBACK
+    else if (itf == ITF_NUM_AUDIO_CAPTURE) {
+        audio_output_set_capture(false);
+    }
+#endif
 
     return true;
 }
 
-// Invoked when feedback parameters are requested
+#if !AUDIO_ADAPTIVE_CLOCK
+
+// Invoked when feedback parameters are requested (the host opened the
+// stream or changed its rate)
 void tud_audio_feedback_params_cb(uint8_t func_id, uint8_t alt_itf, audio_feedback_params_t* feedback_param) {
-    (void) func_id;
     (void) alt_itf;
 
-    // Use FIFO count method for feedback - TinyUSB calculates feedback based on FIFO fill level
-    feedback_param->method = AUDIO_FEEDBACK_METHOD_FIFO_COUNT;
+    // The value is computed here, not by TinyUSB: the I2S clock measured
+    // against SOF, trimmed toward the latency profile's FIFO target (the
+    // level the output prebuffers to). FIFO_COUNT would steer on the level
+    // alone.
+    feedback_param->method = AUDIO_FEEDBACK_METHOD_DISABLED;
     feedback_param->sample_freq = current_sample_rate;
 
-    // Set explicit threshold at half the FIFO size for stable feedback
-    // This gives the feedback algorithm a clear target to maintain
-    feedback_param->fifo_count.fifo_threshold = CFG_TUD_AUDIO_FUNC_1_EP_OUT_SW_BUF_SZ / 2;
+    sync_restart(func_id);
+}
+
+#endif // !AUDIO_ADAPTIVE_CLOCK
+
+// Invoked from the USB interrupt for every audio packet written to the FIFO
+bool tud_audio_rx_done_isr(uint8_t rhport, uint16_t n_bytes_received, uint8_t func_id, uint8_t ep_out, uint8_t cur_alt_setting) {
+    (void) ep_out;
+    (void) cur_alt_setting;
+
+    TRACE(TRACE_USB_AUDIO_RX, 0, n_bytes_received);
+    uint16_t level = tud_audio_n_available(func_id);
+#if !AUDIO_ADAPTIVE_CLOCK
+    audio_feedback_packet(&feedback, level);
+#endif
+
+    // Not while the output prebuffers: nothing drains the FIFO yet
+    uint32_t ring_q8 = 0;
+    bool playing = audio_output_queued(&ring_q8);
+    if (playing)
+        audio_delay_packet(&delay, level, n_bytes_received, ring_q8);
+
+#if AUDIO_ADAPTIVE_CLOCK
+    (void) rhport;
+    if (audio_adaptive_packet(&adaptive, level, ring_q8, playing))
+        audio_pll_set_ppm(audio_adaptive_ppm_q8(&adaptive));
+#else
+    if (!feedback_sof) {
+        // Cleared again by TinyUSB when the stream closes
+        usbd_sof_enable(rhport, SOF_CONSUMER_AUDIO, true);
+        feedback_sof = true;
+    }
+#endif
+#if AUDIO_OUTPUT_ASRC
+    if (audio_asrc_ctl_packet(&asrc, n_bytes_received, audio_feedback_value(&feedback),
+                              level, ring_q8, playing, audio_output_ran_short()))
+        audio_output_set_asrc(true, audio_asrc_ctl_ppm_q8(&asrc));
+#endif
+    return true;
+}
+
+#if !AUDIO_ADAPTIVE_CLOCK
+
+// Invoked from the USB interrupt at every SOF while the SOF interrupt is on
+// (the feedback endpoint's bInterval is one frame)
+void tud_audio_feedback_interval_isr(uint8_t func_id, uint32_t frame_number, uint8_t interval_shift) {
+    (void) interval_shift;
+
+    TRACE(TRACE_USB_SOF, 0, frame_number);
+    uint8_t epoch;
+    uint32_t clock = audio_output_clock(&epoch);
+    if (audio_feedback_sof(&feedback, frame_number, clock, epoch))
+        tud_audio_n_fb_set(func_id, audio_feedback_value(&feedback));
 }
 
+#endif // !AUDIO_ADAPTIVE_CLOCK
+
 //--------------------------------------------------------------------+
 // Device Callbacks
 //--------------------------------------------------------------------+
@@ -4,17 +4,26 @@
 /*
  * USB CDC Communication Protocol for EQ Profile Management
  *
- * State machine assembles frames from CDC byte stream, dispatches
- * commands to the eq_profile module, and sends responses.
+ * State machine assembles frames from the CDC byte stream (payloads read
+ * straight into rx_buf), dispatches commands to the eq_profile module, and
+ * sends responses.
  */
 
 #include "usb_comm.h"
 #include "app.h"
+#include "audio_latency.h"
 #include "audio_output.h"
+#include "deadline.h"
 #include "display.h"
+#include "dsp_bench.h"
 #include "eq_profile.h"
 #include "fault.h"
+#include "integrity.h"
+#include "perf.h"
+#include "sched.h"
 #include "settings.h"
+#include "trace.h"
+#include "usb_audio.h"
 #include "usb_descriptors.h"
 #include "stm32h5xx_hal.h"
 #include "tusb.h"
@@ -24,46 +33,24 @@
 // ---------------------------------------------------------------------------
 // Frame limits
 // ---------------------------------------------------------------------------
-#define MAX_PAYLOAD_SIZE  512  // Largest payload: SET_PROFILE (~384 bytes)
+#define MAX_PAYLOAD_SIZE  576  // Largest payload: GET_PERF (562 bytes)
 #define FRAME_HEADER_SIZE 3   // CMD + LEN(2)
 #define FRAME_CRC_SIZE    1
 
-// ---------------------------------------------------------------------------
-// CRC8 (polynomial 0x07, same as SMBus)
-// ---------------------------------------------------------------------------
-static uint8_t crc8_update(uint8_t crc, const uint8_t *data, uint32_t len) {
-    for (uint32_t i = 0; i < len; i++) {
-        crc ^= data[i];
-        for (uint8_t bit = 0; bit < 8; bit++) {
-            if (crc & 0x80)
-                crc = (crc << 1) ^ 0x07;
-            else
-                crc <<= 1;
-        }
-    }
-    return crc;
-}
-
-static uint8_t crc8(const uint8_t *data, uint32_t len) {
-    return crc8_update(0x00, data, len);
-}
-
 // ---------------------------------------------------------------------------
 // Frame assembly state machine
 // ---------------------------------------------------------------------------
 typedef enum {
-    RX_WAIT_CMD,
-    RX_WAIT_LEN_LO,
-    RX_WAIT_LEN_HI,
-    RX_WAIT_PAYLOAD,
-    RX_WAIT_CRC,
+    RX_WAIT_HEADER,
+    RX_WAIT_PAYLOAD, // and the CRC byte after it
 } rx_state_t;
 
 static rx_state_t rx_state;
 static uint8_t rx_cmd;
 static uint16_t rx_len;
-static uint16_t rx_pos;
-static uint8_t rx_buf[MAX_PAYLOAD_SIZE];
+static uint16_t rx_pos;  // bytes of the header or payload received so far
+static uint8_t rx_hdr[FRAME_HEADER_SIZE];
+static uint8_t rx_buf[MAX_PAYLOAD_SIZE + FRAME_CRC_SIZE];
 
 // TX buffer (reuse for responses)
 static uint8_t tx_buf[FRAME_HEADER_SIZE + 1 + MAX_PAYLOAD_SIZE + FRAME_CRC_SIZE];
@@ -130,9 +117,10 @@ static void send_response(uint8_t cmd, uint8_t status,
         memcpy(&tx_buf[4], payload, payload_len);
 
     uint16_t frame_len = FRAME_HEADER_SIZE + total_payload;
-    tx_buf[frame_len] = crc8(tx_buf, frame_len);
+    tx_buf[frame_len] = integrity_crc8(0, tx_buf, frame_len);
     frame_len += FRAME_CRC_SIZE;
 
+    TRACE(TRACE_CDC_TX, tx_buf[0], frame_len);
     tx_len = frame_len;
     tx_pos = 0;
     tx_progress_tick = HAL_GetTick();
@@ -214,7 +202,10 @@ static void handle_set_profile(void) {
     eq_profile_t profile;
     memcpy(&profile, &rx_buf[1], sizeof(eq_profile_t));
 
-    if (!eq_profile_set(id, &profile)) {
+    uint32_t key = audio_output_lock();
+    bool ok = eq_profile_set(id, &profile);
+    audio_output_unlock(key);
+    if (!ok) {
         send_error(CMD_SET_PROFILE, STATUS_ERR_INVALID_PARAM);
         return;
     }
@@ -229,7 +220,10 @@ static void handle_delete_profile(void) {
     }
 
     uint8_t id = rx_buf[0];
-    if (!eq_profile_delete(id)) {
+    uint32_t key = audio_output_lock();
+    bool ok = eq_profile_delete(id);
+    audio_output_unlock(key);
+    if (!ok) {
         send_error(CMD_DELETE_PROFILE, STATUS_ERR_INVALID_PARAM);
         return;
     }
@@ -244,7 +238,9 @@ static void handle_set_active(void) {
     }
 
     uint8_t id = rx_buf[0];
+    uint32_t key = audio_output_lock();
     eq_profile_set_active(id);
+    audio_output_unlock(key);
     app_save_settings();
     display_set_dirty();
     send_ok(CMD_SET_ACTIVE, NULL, 0);
@@ -374,6 +370,357 @@ static void handle_get_fault_info(void) {
     send_ok(CMD_GET_FAULT_INFO, resp, sizeof(resp));
 }
 
+// Request: [reset:1] (optional, nonzero = clear the stats after reading)
+// Response: [passes:4][idle_passes:4][count:1], then per task
+//           [name:8][runs:4][mean_us:2][max_us:2][last_us:2]
+//           [deferred:2][missed:2] (LE)
+#define TASK_STATS_ENTRY_SIZE (SCHED_NAME_LEN + 14)
+
+static void handle_get_task_stats(void) {
+    uint8_t resp[9 + SCHED_MAX_TASKS * TASK_STATS_ENTRY_SIZE];
+    uint32_t passes = sched_pass_count();
+    uint32_t idle = sched_idle_count();
+    uint8_t count = sched_task_count();
+
+    memcpy(&resp[0], &passes, 4);
+    memcpy(&resp[4], &idle, 4);
+    resp[8] = count;
+
+    uint8_t *p = &resp[9];
+    for (uint8_t i = 0; i < count; i++, p += TASK_STATS_ENTRY_SIZE) {
+        const char *name = sched_task(i)->name;
+        const sched_stats_t *st = sched_stats(i);
+        uint32_t mean = st->runs ? st->total_us / st->runs : 0;
+        uint16_t mean16 = mean > UINT16_MAX ? UINT16_MAX : (uint16_t)mean;
+
+        memset(p, 0, SCHED_NAME_LEN);
+        memcpy(p, name, strnlen(name, SCHED_NAME_LEN));
+        memcpy(&p[8], &st->runs, 4);
+        memcpy(&p[12], &mean16, 2);
+        memcpy(&p[14], &st->max_us, 2);
+        memcpy(&p[16], &st->last_us, 2);
+        memcpy(&p[18], &st->deferred, 2);
+        memcpy(&p[20], &st->missed, 2);
+    }
+
+    if (rx_len >= 1 && rx_buf[0])
+        sched_reset_stats();
+    send_ok(CMD_GET_TASK_STATS, resp, (uint16_t)(p - resp));
+}
+
+// Response: [active:1][requested:1][count:1], then per preset
+//           [name:8][period_frames:2][periods:1][fifo_target:2]
+//           [jitter_us:2][latency_us:4] (LE)
+#define LATENCY_NAME_LEN 8
+#define LATENCY_ENTRY_SIZE (LATENCY_NAME_LEN + 11)
+
+static void handle_get_latency(void) {
+    uint8_t resp[3 + AUDIO_LATENCY_COUNT * LATENCY_ENTRY_SIZE];
+    resp[0] = audio_output_get_latency();
+    resp[1] = audio_output_get_latency_request();
+    resp[2] = AUDIO_LATENCY_COUNT;
+
+    uint8_t *p = &resp[3];
+    for (uint8_t i = 0; i < AUDIO_LATENCY_COUNT; i++, p += LATENCY_ENTRY_SIZE) {
+        const audio_latency_preset_t *lp = audio_latency_preset(i);
+        uint32_t total_us = audio_latency_total_us(lp);
+
+        memset(p, 0, LATENCY_NAME_LEN);
+        memcpy(p, lp->name, strnlen(lp->name, LATENCY_NAME_LEN));
+        memcpy(&p[8], &lp->period_frames, 2);
+        p[10] = lp->periods;
+        memcpy(&p[11], &lp->fifo_target, 2);
+        memcpy(&p[13], &lp->jitter_us, 2);
+        memcpy(&p[15], &total_us, 4);
+    }
+
+    send_ok(CMD_GET_LATENCY, resp, (uint16_t)(p - resp));
+}
+
+// Request: [id:1]. Response: [active:1][requested:1]
+static void handle_set_latency(void) {
+    if (rx_len < 1 || !audio_output_set_latency(rx_buf[0])) {
+        send_error(CMD_SET_LATENCY, STATUS_ERR_INVALID_PARAM);
+        return;
+    }
+
+    app_save_settings();
+    uint8_t resp[2] = {audio_output_get_latency(),
+                       audio_output_get_latency_request()};
+    send_ok(CMD_SET_LATENCY, resp, 2);
+}
+
+// Response: [state:1][lock_ms:4][rate:4][value:4][trim:4][rate_min:4]
+//           [rate_max:4][step_max:4][level:2][target:2][resyncs:2] (LE,
+//           rates 16.16 frames per USB frame)
+static void handle_get_feedback(void) {
+    audio_fb_stats_t st;
+    usb_audio_get_feedback_stats(&st);
+
+    uint8_t resp[35];
+    resp[0] = st.state;
+    memcpy(&resp[1], &st.lock_ms, 4);
+    memcpy(&resp[5], &st.rate, 4);
+    memcpy(&resp[9], &st.value, 4);
+    memcpy(&resp[13], &st.trim, 4);
+    memcpy(&resp[17], &st.rate_min, 4);
+    memcpy(&resp[21], &st.rate_max, 4);
+    memcpy(&resp[25], &st.step_max, 4);
+    memcpy(&resp[29], &st.level, 2);
+    memcpy(&resp[31], &st.target, 2);
+    memcpy(&resp[33], &st.resyncs, 2);
+    send_ok(CMD_GET_FEEDBACK, resp, sizeof(resp));
+}
+
+// Response: [enabled:1][state:1][lock_ms:4][ppm_q8:4][error_us:4]
+//           [error_min_us:4][error_max_us:4][saturated:2][slewed:2]
+//           [unlocks:2] (LE, ppm in 1/256). Only [enabled:1] = 0 when built
+//           without AUDIO_ADAPTIVE_CLOCK.
+static void handle_get_adaptive(void) {
+    audio_ad_stats_t st;
+    if (!usb_audio_get_adaptive_stats(&st)) {
+        uint8_t off = 0;
+        send_ok(CMD_GET_ADAPTIVE, &off, 1);
+        return;
+    }
+
+    uint8_t resp[28];
+    resp[0] = 1;
+    resp[1] = st.state;
+    memcpy(&resp[2], &st.lock_ms, 4);
+    memcpy(&resp[6], &st.ppm_q8, 4);
+    memcpy(&resp[10], &st.error_us, 4);
+    memcpy(&resp[14], &st.error_min_us, 4);
+    memcpy(&resp[18], &st.error_max_us, 4);
+    memcpy(&resp[22], &st.saturated, 2);
+    memcpy(&resp[24], &st.slewed, 2);
+    memcpy(&resp[26], &st.unlocks, 2);
+    send_ok(CMD_GET_ADAPTIVE, resp, sizeof(resp));
+}
+
+// Response: [enabled:1][reason:1][engage_ms:4][engage_drift_us:4]
+//           [owed_us:4][drift_us:4][state:1][ppm_q8:4][error_min_us:4]
+//           [error_max_us:4][saturated:2][slewed:2] (LE, ppm in 1/256).
+//           Only [enabled:1] = 0 when built with AUDIO_ADAPTIVE_CLOCK.
+static void handle_get_asrc(void) {
+    audio_asrc_stats_t st;
+    if (!usb_audio_get_asrc_stats(&st)) {
+        uint8_t off = 0;
+        send_ok(CMD_GET_ASRC, &off, 1);
+        return;
+    }
+
+    uint8_t resp[35];
+    resp[0] = 1;
+    resp[1] = st.reason;
+    memcpy(&resp[2], &st.engage_ms, 4);
+    memcpy(&resp[6], &st.engage_drift_us, 4);
+    memcpy(&resp[10], &st.owed_us, 4);
+    memcpy(&resp[14], &st.drift_us, 4);
+    resp[18] = st.loop.state;
+    memcpy(&resp[19], &st.loop.ppm_q8, 4);
+    memcpy(&resp[23], &st.loop.error_min_us, 4);
+    memcpy(&resp[27], &st.loop.error_max_us, 4);
+    memcpy(&resp[31], &st.loop.saturated, 2);
+    memcpy(&resp[33], &st.loop.slewed, 2);
+    send_ok(CMD_GET_ASRC, resp, sizeof(resp));
+}
+
+// Response: [streaming:1][windows:4][now_us:4][min_us:4][avg_us:4][max_us:4]
+//           [fixed_us:4] (LE; min/avg/max over the last complete window,
+//           fixed_us the DSP and DAC part included in all of them)
+static void handle_get_delay(void) {
+    audio_delay_stats_t st;
+    usb_audio_get_delay_stats(&st);
+    uint32_t fixed_us = (AUDIO_DELAY_DSP_FRAMES + AUDIO_DELAY_DAC_FRAMES) *
+                        1000000U / usb_audio_get_sample_rate();
+
+    uint8_t resp[25];
+    resp[0] = usb_audio_is_streaming() ? 1 : 0;
+    memcpy(&resp[1], &st.windows, 4);
+    memcpy(&resp[5], &st.now_us, 4);
+    memcpy(&resp[9], &st.min_us, 4);
+    memcpy(&resp[13], &st.avg_us, 4);
+    memcpy(&resp[17], &st.max_us, 4);
+    memcpy(&resp[21], &fixed_us, 4);
+    send_ok(CMD_GET_DELAY, resp, sizeof(resp));
+}
+
+// Request: [reset:1] (optional, nonzero = clear the stats after reading)
+// Response: [elapsed_ms:4][periods:4][underruns:4][partial_fills:4]
+//           [concealed_frames:4][dropped_bytes:4][stream_starts:4]
+//           [stream_stops:4][dma_errors:4][level_hist:16x4]
+//           [fb_value:4][fifo_level:2] (LE)
+static void handle_get_audio_stats(void) {
+    audio_stats_counters_t c;
+    uint32_t elapsed = audio_output_get_stats(&c, rx_len >= 1 && rx_buf[0]);
+    audio_fb_stats_t fb;
+    usb_audio_get_feedback_stats(&fb);
+    uint16_t level = usb_audio_available();
+
+    uint8_t resp[4 + sizeof(c) + 6];
+    memcpy(&resp[0], &elapsed, 4);
+    memcpy(&resp[4], &c, sizeof(c)); // all uint32, in wire order
+    memcpy(&resp[4 + sizeof(c)], &fb.value, 4);
+    memcpy(&resp[8 + sizeof(c)], &level, 2);
+    send_ok(CMD_GET_AUDIO_STATS, resp, sizeof(resp));
+}
+
+// Request: [reset:1] (optional, nonzero = clear the profile after reading)
+// Response: [enabled:1][cpu_mhz:2][elapsed_ms:4][period_cycles:4][count:1],
+//           then per stage [name:8][runs:4][min:4][max:4][mean:4][load:2]
+//           [hist:12x2] (LE; cycles, load in 0.01% of elapsed). Only
+//           [enabled:1] = 0 when built without PERF_PROFILE.
+#define PERF_ENTRY_SIZE (PERF_NAME_LEN + 18 + PERF_HIST_BINS * 2)
+_Static_assert(12 + PERF_STAGE_COUNT * PERF_ENTRY_SIZE <= MAX_PAYLOAD_SIZE,
+               "GET_PERF response must fit one frame");
+
+static void handle_get_perf(void) {
+#if PERF_PROFILE
+    static uint32_t reset_tick = 0;
+    uint8_t resp[12 + PERF_STAGE_COUNT * PERF_ENTRY_SIZE];
+    uint16_t mhz = (uint16_t)(SystemCoreClock / 1000000U);
+    uint32_t now = HAL_GetTick();
+    uint32_t elapsed = now - reset_tick;
+    uint64_t window = (uint64_t)elapsed * (SystemCoreClock / 1000U);
+    uint32_t period_cycles = audio_latency_period_us(audio_latency_preset(
+                                 audio_output_get_latency())) * mhz;
+
+    resp[0] = 1;
+    memcpy(&resp[1], &mhz, 2);
+    memcpy(&resp[3], &elapsed, 4);
+    memcpy(&resp[7], &period_cycles, 4);
+    resp[11] = PERF_STAGE_COUNT;
+
+    uint8_t *p = &resp[12];
+    for (uint8_t i = 0; i < PERF_STAGE_COUNT; i++, p += PERF_ENTRY_SIZE) {
+        // The audio stage records its stages: hold it off for the copy
+        uint32_t key = audio_output_lock();
+        perf_stage_t st = *perf_stage(i);
+        audio_output_unlock(key);
+
+        const char *name = perf_stage_name(i);
+        uint32_t mean = st.count ? (uint32_t)(st.total / st.count) : 0;
+        uint16_t load = perf_load(&st, window);
+
+        memset(p, 0, PERF_NAME_LEN);
+        memcpy(p, name, strnlen(name, PERF_NAME_LEN));
+        memcpy(&p[8], &st.count, 4);
+        memcpy(&p[12], &st.min, 4);
+        memcpy(&p[16], &st.max, 4);
+        memcpy(&p[20], &mean, 4);
+        memcpy(&p[24], &load, 2);
+        memcpy(&p[26], st.hist, PERF_HIST_BINS * 2);
+    }
+
+    if (rx_len >= 1 && rx_buf[0]) {
+        uint32_t key = audio_output_lock();
+        perf_reset();
+        audio_output_unlock(key);
+        reset_tick = now;
+    }
+    send_ok(CMD_GET_PERF, resp, (uint16_t)(p - resp));
+#else
+    uint8_t enabled = 0;
+    send_ok(CMD_GET_PERF, &enabled, 1);
+#endif
+}
+
+// Request: [reset:1] (optional, nonzero = clear histograms and log after
+//          reading; the miss total keeps counting)
+// Response: [misses:4][loop:hist][slack:hist][count:1], then per logged miss,
+//           oldest first, [tick_ms:4][late_us:4][task:1][latency:1] (LE);
+//           hist = [count:4][min_us:4][max_us:4][bins:16x4]
+#define DEADLINE_HIST_SIZE (12 + DEADLINE_HIST_BINS * 4)
+#define DEADLINE_MISS_SIZE 10
+
+static uint8_t *put_deadline_hist(uint8_t *p, const deadline_hist_t *h) {
+    memcpy(&p[0], &h->count, 4);
+    memcpy(&p[4], &h->min_us, 4);
+    memcpy(&p[8], &h->max_us, 4);
+    memcpy(&p[12], h->bins, DEADLINE_HIST_BINS * 4);
+    return p + DEADLINE_HIST_SIZE;
+}
+
+static void handle_get_deadline(void) {
+    static deadline_state_t st; // too large for the stack
+    uint8_t resp[5 + 2 * DEADLINE_HIST_SIZE +
+                 DEADLINE_MISS_LOG * DEADLINE_MISS_SIZE];
+
+    // The audio stage records slack and misses: hold it off for the copy
+    uint32_t key = audio_output_lock();
+    st = *deadline_state();
+    if (rx_len >= 1 && rx_buf[0])
+        deadline_reset();
+    audio_output_unlock(key);
+
+    memcpy(&resp[0], &st.misses, 4);
+    uint8_t *p = put_deadline_hist(&resp[4], &st.loop);
+    p = put_deadline_hist(p, &st.slack);
+
+    uint32_t first = st.log_start;
+    if (st.misses - first > DEADLINE_MISS_LOG)
+        first = st.misses - DEADLINE_MISS_LOG;
+    *p++ = (uint8_t)(st.misses - first);
+    for (uint32_t seq = first; seq != st.misses; seq++) {
+        const deadline_miss_t *m = &st.log[seq % DEADLINE_MISS_LOG];
+        memcpy(&p[0], &m->tick_ms, 4);
+        memcpy(&p[4], &m->late_us, 4);
+        p[8] = m->task;
+        p[9] = m->latency;
+        p += DEADLINE_MISS_SIZE;
+    }
+    send_ok(CMD_GET_DEADLINE, resp, (uint16_t)(p - resp));
+}
+
+// Response: [cpu_mhz:2][frames:2][runs:1][layout:1][buffer:4][filters:1]
+//           [bass:1][treble:1][count:1], then per kernel [name:8][runs:4]
+//           [min:4][max:4][mean:4][cps:4] (LE; cycles per run, cps = min
+//           cycles per mono sample in 0.01 units). STATUS_ERR_BUSY while
+//           streaming: the EQ kernels would disturb the stream's filters.
+#define BENCH_ENTRY_SIZE (DSP_BENCH_NAME_LEN + 20)
+
+static void handle_run_benchmark(void) {
+    static dsp_bench_report_t report;
+    uint8_t resp[14 + DSP_BENCH_COUNT * BENCH_ENTRY_SIZE];
+
+    if (usb_audio_is_streaming()) {
+        send_error(CMD_RUN_BENCHMARK, STATUS_ERR_BUSY);
+        return;
+    }
+    dsp_bench_run(&report);
+
+    uint16_t mhz = (uint16_t)(SystemCoreClock / 1000000U);
+    uint16_t frames = DSP_BENCH_FRAMES;
+    uint32_t buffer = (uint32_t)report.buffer;
+    memcpy(&resp[0], &mhz, 2);
+    memcpy(&resp[2], &frames, 2);
+    resp[4] = DSP_BENCH_RUNS;
+    resp[5] = DSP_BENCH_LAYOUT_S24_IN_S32;
+    memcpy(&resp[6], &buffer, 4);
+    resp[10] = report.filter_count;
+    resp[11] = (uint8_t)report.bass;
+    resp[12] = (uint8_t)report.treble;
+    resp[13] = DSP_BENCH_COUNT;
+
+    uint8_t *p = &resp[14];
+    for (uint8_t i = 0; i < DSP_BENCH_COUNT; i++, p += BENCH_ENTRY_SIZE) {
+        const dsp_bench_result_t *r = &report.kernel[i];
+        const char *name = dsp_bench_name(i);
+        uint32_t cps = (uint32_t)((uint64_t)r->min * 100U /
+                                  (DSP_BENCH_FRAMES * 2));
+
+        memset(p, 0, DSP_BENCH_NAME_LEN);
+        memcpy(p, name, strnlen(name, DSP_BENCH_NAME_LEN));
+        memcpy(&p[8], &r->runs, 4);
+        memcpy(&p[12], &r->min, 4);
+        memcpy(&p[16], &r->max, 4);
+        memcpy(&p[20], &r->mean, 4);
+        memcpy(&p[24], &cps, 4);
+    }
+    send_ok(CMD_RUN_BENCHMARK, resp, (uint16_t)(p - resp));
+}
+
 static void handle_clear_fault(void) {
     fault_clear();
     send_ok(CMD_CLEAR_FAULT, NULL, 0);
@@ -407,6 +754,7 @@ static void handle_save_to_flash(void) {
 // Frame dispatch
 // ---------------------------------------------------------------------------
 static void dispatch_command(void) {
+    TRACE(TRACE_CDC_RX, rx_cmd, rx_len);
     switch (rx_cmd) {
     case CMD_GET_DEVICE_INFO:   handle_get_device_info();  break;
     case CMD_GET_PROFILE_LIST:  handle_get_profile_list(); break;
@@ -428,6 +776,17 @@ static void dispatch_command(void) {
     case CMD_SET_AMP:           handle_set_amp();          break;
     case CMD_GET_FAULT_INFO:    handle_get_fault_info();   break;
     case CMD_CLEAR_FAULT:       handle_clear_fault();      break;
+    case CMD_GET_TASK_STATS:    handle_get_task_stats();   break;
+    case CMD_GET_LATENCY:       handle_get_latency();      break;
+    case CMD_SET_LATENCY:       handle_set_latency();      break;
+    case CMD_GET_FEEDBACK:      handle_get_feedback();     break;
+    case CMD_GET_DELAY:         handle_get_delay();        break;
+    case CMD_GET_AUDIO_STATS:   handle_get_audio_stats();  break;
+    case CMD_GET_PERF:          handle_get_perf();         break;
+    case CMD_GET_DEADLINE:      handle_get_deadline();     break;
+    case CMD_RUN_BENCHMARK:     handle_run_benchmark();    break;
+    case CMD_GET_ADAPTIVE:      handle_get_adaptive();     break;
+    case CMD_GET_ASRC:          handle_get_asrc();         break;
     case CMD_ENTER_DFU:         handle_enter_dfu();        break;
     case CMD_GET_DFU_SERIAL:    handle_get_dfu_serial();   break;
     case CMD_REBOOT:            handle_reboot();           break;
@@ -441,10 +800,55 @@ static void dispatch_command(void) {
 // Public API
 // ---------------------------------------------------------------------------
 void usb_comm_init(void) {
-    rx_state = RX_WAIT_CMD;
+    rx_state = RX_WAIT_HEADER;
     rx_pos = 0;
 }
 
+// Parse what the CDC FIFO holds until it runs out or a response is left
+// pending. A frame takes two reads when it has arrived whole: the header,
+// then the payload with its CRC byte straight into rx_buf. Neither reads
+// past the frame, so the next command stays in the FIFO while a response
+// is pending.
+static void rx_parse(void) {
+    while (!tx_pending() && tud_cdc_available()) {
+        if (rx_state == RX_WAIT_HEADER) {
+            uint32_t n = tud_cdc_read(&rx_hdr[rx_pos],
+                                      FRAME_HEADER_SIZE - rx_pos);
+            if (!n)
+                break;
+            rx_pos += (uint16_t)n;
+            if (rx_pos < FRAME_HEADER_SIZE)
+                continue;
+            rx_cmd = rx_hdr[0];
+            rx_len = (uint16_t)(rx_hdr[1] | rx_hdr[2] << 8);
+            rx_pos = 0;
+            // Frame too large: dropped, the next byte starts a header
+            if (rx_len <= MAX_PAYLOAD_SIZE)
+                rx_state = RX_WAIT_PAYLOAD;
+            continue;
+        }
+
+        uint16_t frame_left = rx_len + FRAME_CRC_SIZE - rx_pos;
+        uint32_t n = tud_cdc_read(&rx_buf[rx_pos], frame_left);
+        if (!n)
+            break;
+        rx_pos += (uint16_t)n;
+        if (n < frame_left)
+            continue;
+
+        // CRC8 over header (cmd + len_lo + len_hi) then payload
+        uint8_t crc = integrity_crc8(0, rx_hdr, FRAME_HEADER_SIZE);
+        if (integrity_crc8(crc, rx_buf, rx_len) == rx_buf[rx_len])
+            dispatch_command();
+
+        // If the response didn't fit in the CDC FIFO in one go, the loop
+        // stops: further commands wait in the FIFO until it has fully
+        // drained
+        rx_state = RX_WAIT_HEADER;
+        rx_pos = 0;
+    }
+}
+
 void usb_comm_task(void) {
     // Finish sending any pending response before doing anything else.
     // While a response is pending, RX bytes stay buffered in the CDC FIFO
@@ -465,62 +869,5 @@ void usb_comm_task(void) {
         }
     }
 
-    if (!tud_cdc_available())
-        return;
-
-    while (tud_cdc_available()) {
-        uint8_t byte;
-        if (tud_cdc_read(&byte, 1) != 1)
-            break;
-
-        switch (rx_state) {
-        case RX_WAIT_CMD:
-            rx_cmd = byte;
-            rx_state = RX_WAIT_LEN_LO;
-            break;
-
-        case RX_WAIT_LEN_LO:
-            rx_len = byte;
-            rx_state = RX_WAIT_LEN_HI;
-            break;
-
-        case RX_WAIT_LEN_HI:
-            rx_len |= (uint16_t)byte << 8;
-            rx_pos = 0;
-            if (rx_len == 0) {
-                rx_state = RX_WAIT_CRC;
-            } else if (rx_len > MAX_PAYLOAD_SIZE) {
-                // Frame too large, reset
-                rx_state = RX_WAIT_CMD;
-            } else {
-                rx_state = RX_WAIT_PAYLOAD;
-            }
-            break;
-
-        case RX_WAIT_PAYLOAD:
-            rx_buf[rx_pos++] = byte;
-            if (rx_pos >= rx_len)
-                rx_state = RX_WAIT_CRC;
-            break;
-
-        case RX_WAIT_CRC: {
-            // CRC8 over header (cmd + len_lo + len_hi) then payload
-            uint8_t header[3] = {rx_cmd, (uint8_t)(rx_len & 0xFF),
-                                 (uint8_t)(rx_len >> 8)};
-            uint8_t expected = crc8_update(0x00, header, 3);
-            if (rx_len > 0)
-                expected = crc8_update(expected, rx_buf, rx_len);
-
-            if (expected == byte)
-                dispatch_command();
-
-            rx_state = RX_WAIT_CMD;
-
-            // If the response didn't fit in the CDC FIFO in one go, stop
-            // processing further commands until it has fully drained
-            if (tx_pending())
-                return;
-        } break;
-        }
-    }
+    rx_parse();
 }
@@ -2,7 +2,7 @@
 // Copyright (c) 2026 Elia Chiarucci
 
 /*
- * USB Descriptors for UAC1 Speaker with Feedback
+ * USB Descriptors for a UAC1 or UAC2 Speaker with Feedback
  */
 
 #include "tusb.h"
@@ -47,28 +47,52 @@ uint8_t const* tud_descriptor_device_cb(void) {
 //--------------------------------------------------------------------+
 
 // Total length of configuration descriptor
-// 1 sample rate: 48kHz only
+#if USB_AUDIO_UAC2
+// (the UAC2 descriptor has its own IAD)
+#define AUDIO_DESC_LEN      TUD_AUDIO20_SPEAKER_STEREO_FB_DESC_LEN
+#else
 #define TUD_AUDIO_DESC_IAD_LEN  8
-#define CONFIG_TOTAL_LEN    (TUD_CONFIG_DESC_LEN + TUD_AUDIO_DESC_IAD_LEN + TUD_AUDIO10_SPEAKER_STEREO_FB_DESC_LEN(1) + TUD_DFU_RT_DESC_LEN + TUD_CDC_DESC_LEN)
+#define AUDIO_DESC_LEN      (TUD_AUDIO_DESC_IAD_LEN + TUD_AUDIO10_SPEAKER_STEREO_FB_DESC_LEN(USB_AUDIO_SAMPLE_RATE_COUNT))
+#endif
+#define CONFIG_TOTAL_LEN    (TUD_CONFIG_DESC_LEN + AUDIO_DESC_LEN + TUD_DFU_RT_DESC_LEN + TUD_CDC_DESC_LEN)
 
 static uint8_t const desc_configuration[] = {
     // Config number, interface count, string index, total length, attribute, power in mA
     TUD_CONFIG_DESCRIPTOR(1, ITF_NUM_TOTAL, 0, CONFIG_TOTAL_LEN, 0x00, 100),
 
-    // Audio Interface Association Descriptor — groups Audio Control + Audio Streaming
-    TUD_AUDIO_DESC_IAD_LEN, TUSB_DESC_INTERFACE_ASSOCIATION, ITF_NUM_AUDIO_CONTROL, 2, TUSB_CLASS_AUDIO, 0x00, 0x00, 4,
+#if USB_AUDIO_UAC2
+    // Interface number, string index, byte per sample, bit per sample, EP size (24 and 16-bit settings), EP Out, EP feedback
+    TUD_AUDIO20_SPEAKER_STEREO_FB_DESCRIPTOR(
+        ITF_NUM_AUDIO_CONTROL,
+        4,  // String index for interface name
+        CFG_TUD_AUDIO_FUNC_1_N_BYTES_PER_SAMPLE_RX,
+        CFG_TUD_AUDIO_FUNC_1_RESOLUTION_RX,
+        CFG_TUD_AUDIO_FUNC_1_EP_OUT_SZ_FS,
+        CFG_TUD_AUDIO_FUNC_1_N_BYTES_PER_SAMPLE_RX_16,
+        CFG_TUD_AUDIO_FUNC_1_RESOLUTION_RX_16,
+        CFG_TUD_AUDIO_FUNC_1_EP_OUT_SZ_FS_16,
+        EPNUM_AUDIO_OUT,
+        EPNUM_AUDIO_FB
+    ),
+#else
+    // Audio Interface Association Descriptor — groups Audio Control + Audio Streaming (+ the loopback capture)
+    TUD_AUDIO_DESC_IAD_LEN, TUSB_DESC_INTERFACE_ASSOCIATION, ITF_NUM_AUDIO_CONTROL, 2 + USB_AUDIO_CAPTURE_ITFS, TUSB_CLASS_AUDIO, 0x00, 0x00, 4,
 
-    // Interface number, string index, byte per sample, bit per sample, EP Out, EP size, EP feedback, sample rates
+    // Interface number, string index, byte per sample, bit per sample, EP size (24 and 16-bit settings), EP Out, EP feedback, sample rates
     TUD_AUDIO10_SPEAKER_STEREO_FB_DESCRIPTOR(
         ITF_NUM_AUDIO_CONTROL,
         4,  // String index for interface name
         CFG_TUD_AUDIO_FUNC_1_N_BYTES_PER_SAMPLE_RX,
         CFG_TUD_AUDIO_FUNC_1_RESOLUTION_RX,
-        EPNUM_AUDIO_OUT,
         CFG_TUD_AUDIO_FUNC_1_EP_OUT_SZ_FS,
+        CFG_TUD_AUDIO_FUNC_1_N_BYTES_PER_SAMPLE_RX_16,
+        CFG_TUD_AUDIO_FUNC_1_RESOLUTION_RX_16,
+        CFG_TUD_AUDIO_FUNC_1_EP_OUT_SZ_FS_16,
+        EPNUM_AUDIO_OUT,
         EPNUM_AUDIO_FB,
-        48000  // Supported sample rate
+        USB_AUDIO_SAMPLE_RATES  // Supported sample rates (44.1k family resampled)
     ),
+#endif
 
     // DFU Runtime Interface
     TUD_DFU_RT_DESCRIPTOR(ITF_NUM_DFU, 5, DFU_ATTR_WILL_DETACH, 1000, 0),
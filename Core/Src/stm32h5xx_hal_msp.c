@@ -20,6 +20,7 @@
 /* Includes ------------------------------------------------------------------*/
 #include "main.h"
 /* USER CODE BEGIN Includes */
+#include "audio_pll.h"
 
 /* USER CODE END Includes */
 extern DMA_HandleTypeDef handle_GPDMA2_Channel0;
@@ -380,6 +381,9 @@ void HAL_I2S_MspInit(I2S_HandleTypeDef* hi2s)
     }
 
     /* USER CODE BEGIN SPI1_MspInit 1 */
+    // Adaptive clock builds: the kernel clock moves to PLL2P, at the same
+    // frequency, before HAL_I2S_Init reads it
+    audio_pll_init();
 
     /* USER CODE END SPI1_MspInit 1 */
 
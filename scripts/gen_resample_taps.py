@@ -0,0 +1,144 @@
+#!/usr/bin/env python3
+# SPDX-License-Identifier: GPL-3.0-only
+# Copyright (c) 2026 Elia Chiarucci
+"""Generate the polyphase filters of the 44.1 -> 48kHz resampler
+(App/Inc/audio_resample.h) into App/Src/audio_resample_taps.c, and of the
+asynchronous sample-rate converter (App/Inc/audio_asrc.h) into
+App/Src/audio_asrc_taps.c (--asrc).
+
+Each prototype is a Kaiser-windowed sinc at the upsampled rate (phases x
+the input rate), cut off halfway between the 20kHz passband edge and the
+28kHz stopband edge. The resampler's output is 48kHz: only content at 28kHz
+and up folds into 0-20kHz when it is decimated, so the transition band
+costs no audible aliasing. The converter runs 48kHz to (nearly) 48kHz, so
+an image at 48kHz - f folds back onto f: its stopband edge is at 28kHz of
+a 48kHz input, a narrower band than the resampler's (28kHz of 44.1kHz).
+Each phase is normalised to unity DC gain (the phases of a windowed sinc
+differ by the passband ripple, which would otherwise modulate DC at the
+phase rate).
+
+The prototypes are symmetric: phase p is phase L-1-p reversed, so only the
+first L/2 phases are stored.
+
+Usage: scripts/gen_resample_taps.py [--asrc] [-o OUTPUT]
+
+Pure Python (no numpy); the specs are measured on the firmware itself by
+tests/test_audio_resample.c and tests/test_audio_asrc.c.
+"""
+
+import argparse
+import math
+
+# Input rate x phases is the upsampled rate; ATTEN_DB is the Kaiser design
+# target for the length and transition
+DESIGNS = {
+    "resample": dict(L=160, TAPS=32, FS_IN=44100.0, PASS_HZ=20000.0,
+                     STOP_HZ=28000.0, ATTEN_DB=91.0,
+                     output="App/Src/audio_resample_taps.c"),
+    "asrc": dict(L=128, TAPS=32, FS_IN=48000.0, PASS_HZ=20000.0,
+                 STOP_HZ=28000.0, ATTEN_DB=85.0,
+                 output="App/Src/audio_asrc_taps.c"),
+}
+
+
+def bessel_i0(x):
+    s, term, k = 1.0, 1.0, 1
+    while term > 1e-20 * s:
+        term *= (x / (2.0 * k)) ** 2
+        s += term
+        k += 1
+    return s
+
+
+def prototype(d):
+    L = d["L"]
+    n_taps = L * d["TAPS"]
+    fs_up = d["FS_IN"] * L
+    fc = (d["PASS_HZ"] + d["STOP_HZ"]) / 2.0 / fs_up  # cycles per upsampled sample
+    beta = 0.1102 * (d["ATTEN_DB"] - 8.7)
+    mid = (n_taps - 1) / 2.0
+    i0_beta = bessel_i0(beta)
+    h = []
+    for n in range(n_taps):
+        t = n - mid
+        x = 2.0 * fc * t
+        sinc = 1.0 if t == 0 else math.sin(math.pi * x) / (math.pi * x)
+        r = t / mid
+        w = bessel_i0(beta * math.sqrt(max(0.0, 1.0 - r * r))) / i0_beta
+        h.append(2.0 * fc * L * sinc * w)
+    return h
+
+
+def phases(d, h):
+    L, TAPS = d["L"], d["TAPS"]
+    out = []
+    for p in range(L // 2):
+        taps = [h[k * L + p] for k in range(TAPS)]
+        dc = sum(taps)
+        out.append([c / dc for c in taps])
+    return out
+
+
+HEADERS = {"resample": """\
+// SPDX-License-Identifier: GPL-3.0-only
+// Copyright (c) 2026 Elia Chiarucci
+
+/*
+ * Polyphase filter of the 44.1 -> 48kHz resampler (see audio_resample.h)
+ *
+ * Generated by scripts/gen_resample_taps.py: {taps} taps x {phases} phases,
+ * Kaiser beta {beta:.3f}, passband {pass_hz:.0f}Hz, stopband {stop_hz:.0f}Hz
+ * at 48kHz out. Do not edit.
+ */
+
+#include "audio_resample.h"
+
+// [phase][tap]: tap k of phase p multiplies the input k frames back
+const float audio_resample_taps[AUDIO_RESAMPLE_PHASES / 2]
+                               [AUDIO_RESAMPLE_TAPS] = {{
+""", "asrc": """\
+// SPDX-License-Identifier: GPL-3.0-only
+// Copyright (c) 2026 Elia Chiarucci
+
+/*
+ * Polyphase filter of the asynchronous sample-rate converter (see
+ * audio_asrc.h)
+ *
+ * Generated by scripts/gen_resample_taps.py --asrc: {taps} taps x {phases}
+ * phases, Kaiser beta {beta:.3f}, passband {pass_hz:.0f}Hz, stopband
+ * {stop_hz:.0f}Hz at 48kHz in. Do not edit.
+ */
+
+#include "audio_asrc.h"
+
+// [phase][tap]: tap k of phase p multiplies the input k frames back
+const float audio_asrc_taps[AUDIO_ASRC_PHASES / 2][AUDIO_ASRC_TAPS] = {{
+"""}
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    ap.add_argument("--asrc", action="store_true",
+                    help="the converter's filter instead of the resampler's")
+    ap.add_argument("-o", "--output")
+    args = ap.parse_args()
+
+    name = "asrc" if args.asrc else "resample"
+    d = DESIGNS[name]
+    table = phases(d, prototype(d))
+    with open(args.output or d["output"], "w", newline="\n") as f:
+        f.write(HEADERS[name].format(taps=d["TAPS"], phases=d["L"],
+                                     beta=0.1102 * (d["ATTEN_DB"] - 8.7),
+                                     pass_hz=d["PASS_HZ"],
+                                     stop_hz=d["STOP_HZ"]))
+        for p, taps in enumerate(table):
+            f.write("    {  // phase %d\n" % p)
+            for i in range(0, d["TAPS"], 4):
+                f.write("        " + " ".join(
+                    "%.9ef," % c for c in taps[i:i + 4]) + "\n")
+            f.write("    },\n")
+        f.write("};\n")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,176 @@
+#!/usr/bin/env python3
+# SPDX-License-Identifier: GPL-3.0-only
+# Copyright (c) 2026 Elia Chiarucci
+"""Decode a capture of the RTT event trace (App/Inc/trace.h) into a Chrome
+trace, for chrome://tracing or https://ui.perfetto.dev.
+
+Build with -DTRACE_RTT=ON and capture RTT channel 1 to a file, e.g.
+
+  J-Link:   JLinkRTTLogger -Device STM32H503CB -If SWD -Speed 4000 \\
+                -RTTChannel 1 trace.bin
+  OpenOCD:  rtt setup 0x20000000 0x8000 "SEGGER RTT"; rtt start;
+            rtt server start 9091 1      then: nc localhost 9091 > trace.bin
+
+Usage: scripts/trace_decode.py trace.bin [-o trace.json] [--mhz 248]
+
+Records are 8 bytes: [cycles:4][event:1][arg8:1][arg16:2], little-endian.
+The 32-bit cycle count wraps every ~17 s at 248 MHz; gaps longer than that
+between two records cannot be told apart from shorter ones.
+"""
+
+import argparse
+import json
+import struct
+import sys
+
+RECORD = struct.Struct("<IBBH")
+
+# Tracks (one timeline row each)
+TRACKS = ["Trace", "I2S DMA", "Audio stage", "USB", "CDC", "Flash", "Display"]
+
+FLASH_AREAS = {0: "profiles", 1: "settings"}
+
+
+def _cmd(a8, a16):
+    return {"cmd": "0x%02X" % a8, "bytes": a16}
+
+
+def _flash(a8, a16):
+    return {"area": FLASH_AREAS.get(a8, a8), "offset": a16}
+
+
+# Event ID -> (name, track, kind, args). Keep in step with trace_event_t.
+# kind: "i" instant, "B"/"E" span begin/end (matched per track and name).
+EVENTS = {
+    0: ("start", "Trace", "i", lambda a8, a16: {"version": a8, "mhz": a16}),
+    1: ("lost", "Trace", "i", lambda a8, a16: {"records": a16}),
+    2: ("dma period", "I2S DMA", "i", lambda a8, a16: {"played": a16}),
+    3: ("dma error", "I2S DMA", "i", None),
+    4: ("fill", "Audio stage", "B",
+        lambda a8, a16: {"period": a8, "fifo_bytes": a16}),
+    5: ("fill", "Audio stage", "E", None),
+    6: ("sof", "USB", "i", lambda a8, a16: {"frame": a16}),
+    7: ("audio rx", "USB", "i", lambda a8, a16: {"bytes": a16}),
+    8: ("cdc rx", "CDC", "i", _cmd),
+    9: ("cdc tx", "CDC", "i", _cmd),
+    10: ("erase", "Flash", "B", _flash),
+    11: ("erase", "Flash", "E", None),
+    12: ("program", "Flash", "B", _flash),
+    13: ("program", "Flash", "E", None),
+    14: ("page", "Display", "B", lambda a8, a16: {"page": a8}),
+    15: ("page", "Display", "E", None),
+}
+
+
+def find_alignment(data):
+    """Byte offset of the first whole record: a capture started part-way
+    through the stream may begin mid-record."""
+    best, best_score = 0, -1
+    for offset in range(RECORD.size):
+        score, prev = 0, None
+        end = min(len(data), offset + 512 * RECORD.size)
+        for pos in range(offset, end - RECORD.size + 1, RECORD.size):
+            cycles, event, _, _ = RECORD.unpack_from(data, pos)
+            if event in EVENTS:
+                score += 1
+                # Timestamps rise, short of a wrap
+                if prev is not None and (cycles - prev) & 0xFFFFFFFF < 1 << 31:
+                    score += 1
+                prev = cycles
+        if score > best_score:
+            best, best_score = offset, score
+    return best
+
+
+def decode(data, mhz):
+    out = [{"name": "thread_name", "ph": "M", "pid": 1, "tid": tid,
+            "args": {"name": name}} for tid, name in enumerate(TRACKS)]
+    open_spans = {}  # (tid, name) -> True while a begin has no end
+    lost = unknown = 0
+    offset = find_alignment(data)
+    base = 0        # cycles added for wraps and restarts
+    prev = None
+    last_ts = 0.0
+
+    for pos in range(offset, len(data) - RECORD.size + 1, RECORD.size):
+        cycles, event, a8, a16 = RECORD.unpack_from(data, pos)
+        if event not in EVENTS:
+            unknown += 1
+            continue
+        name, track, kind, args = EVENTS[event]
+        tid = TRACKS.index(track)
+
+        if event == 0:
+            if a16:
+                mhz = a16
+            if prev is not None:
+                # Device restarted: carry on from the last record's time
+                for key in list(open_spans):
+                    out.append({"name": key[1], "ph": "E", "pid": 1,
+                                "tid": key[0], "ts": last_ts})
+                open_spans.clear()
+                base = int(last_ts * mhz) + 1
+                prev = None
+        if prev is not None and cycles < prev:
+            base += 1 << 32
+        prev = cycles
+        ts = (base + cycles) / mhz
+        last_ts = ts
+
+        if event == 1:
+            lost += a16
+
+        rec = {"name": name, "ph": kind, "pid": 1, "tid": tid, "ts": ts}
+        key = (tid, name)
+        if kind == "B":
+            if key in open_spans:
+                # The end was not traced (an error path or a dropped
+                # record): close the span where the next one starts
+                out.append({"name": name, "ph": "E", "pid": 1, "tid": tid,
+                            "ts": ts})
+            open_spans[key] = True
+        elif kind == "E":
+            if key not in open_spans:
+                continue  # its begin was before the capture or dropped
+            del open_spans[key]
+        else:
+            rec["s"] = "t"
+        if args:
+            rec["args"] = args(a8, a16)
+        out.append(rec)
+
+    for key in open_spans:
+        out.append({"name": key[1], "ph": "E", "pid": 1, "tid": key[0],
+                    "ts": last_ts})
+
+    return out, offset, lost, unknown
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("capture", help="raw dump of RTT channel 1")
+    parser.add_argument("-o", "--output", help="JSON file (default stdout)")
+    parser.add_argument("--mhz", type=int, default=248,
+                        help="CPU clock until a start record gives it")
+    opts = parser.parse_args()
+
+    with open(opts.capture, "rb") as f:
+        data = f.read()
+    events, offset, lost, unknown = decode(data, opts.mhz)
+
+    trace = {"traceEvents": events, "displayTimeUnit": "ns"}
+    if opts.output:
+        with open(opts.output, "w") as f:
+            json.dump(trace, f)
+    else:
+        json.dump(trace, sys.stdout)
+
+    records = (len(data) - offset) // RECORD.size
+    print("%d records, %d dropped on target, %d unknown%s" %
+          (records, lost, unknown,
+           ", skipped %d leading bytes" % offset if offset else ""),
+          file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,430 @@
+// SPDX-License-Identifier: GPL-3.0-only
+// Copyright (c) 2026 Elia Chiarucci
+
+/*
+ * Host-side benchmark of the audio-stage DSP kernels.
+ *
+ * Each kernel runs over one audio period at a time (96 stereo frames, the
+ * 2ms default) of a continuous multi-tone signal, for every variant: the
+ * bass/treble EQ across all band settings, the profile EQ with 1 to 10
+ * filters, the read_audio_data conversion loops (unpack, swap, volume,
+ * pack) and the 44.1kHz resampler. Reported as ns/sample (mono samples) and Msamples/s, best of
+ * BENCH_REPS runs.
+ *
+ * Absolute host timings depend on the machine, so the regression check
+ * works on each kernel's cost relative to a calibration loop timed in the
+ * same run (a serial float recurrence, like the biquads). A cost more than
+ * BENCH_TOLERANCE percent (environment, default 50) above the checked-in
+ * bench_baseline.txt fails the run. Kernels missing from the baseline, or
+ * too cheap to time reliably (a bypass), are reported but not checked.
+ *
+ *   bench_dsp [--baseline FILE] [--write FILE]
+ *
+ * --write regenerates the baseline. A new engine (a fixed-point or block
+ * variant of a kernel) is one more entry in kernels[].
+ */
+
+#include "audio_eq.h"
+#include "audio_pcm.h"
+#include "audio_resample.h"
+#include "audio_unpack.h"
+#include "eq_profile.h"
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define FRAMES       96
+#define SAMPLES      (FRAMES * 2)
+#define SIGNAL_FRAMES 4800 // 100ms, looped: cache-resident like the FIFO
+#define BENCH_REPS   9
+#define BENCH_RETRIES 5 // timings of a kernel over the tolerance
+#define BENCH_RETRY_PAUSE_MS 100
+#define BENCH_ITERS  500 // buffers per run
+#define DEFAULT_TOLERANCE 50
+#define MAX_RESULTS  64
+#define MIN_CHECKED_COST 0.05 // cheaper kernels are within timing noise
+
+// ---------------------------------------------------------------------------
+// Kernels
+// ---------------------------------------------------------------------------
+
+// One kernel under test. setup() selects variant v (and returns its label)
+// before the timed runs; run() processes one buffer in place.
+typedef struct {
+    const char *name;
+    uint8_t variants;
+    const char *(*setup)(uint8_t v);
+    void (*run)(int32_t *buf, uint16_t samples);
+    uint8_t packed_input; // reads the packed 24-bit signal, not int32_t
+} bench_kernel_t;
+
+static const uint8_t *packed_src; // current period of the packed signal
+
+static char label[16];
+
+static const char *label_int(uint8_t v) {
+    snprintf(label, sizeof(label), "%u", v);
+    return label;
+}
+
+static const char *setup_none(uint8_t v) {
+    (void)v;
+    return "";
+}
+
+// Bass/treble EQ: every band setting of the variant, one per buffer
+static int8_t eq_settings[169][2];
+static uint8_t eq_setting_count, eq_setting;
+
+static const char *setup_audio_eq(uint8_t v) {
+    static const char *const names[] = {"flat", "bass", "treble", "both"};
+    eq_setting_count = 0;
+    for (int8_t b = EQ_VALUE_MIN; b <= EQ_VALUE_MAX; b++) {
+        for (int8_t t = EQ_VALUE_MIN; t <= EQ_VALUE_MAX; t++) {
+            bool keep = (v == 0 && !b && !t) || (v == 1 && b && !t) ||
+                        (v == 2 && !b && t) || (v == 3 && b && t);
+            if (keep) {
+                eq_settings[eq_setting_count][0] = b;
+                eq_settings[eq_setting_count][1] = t;
+                eq_setting_count++;
+            }
+        }
+    }
+    eq_setting = 0;
+    audio_eq_init();
+    return names[v];
+}
+
+static void run_audio_eq(int32_t *buf, uint16_t samples) {
+    audio_eq_set_band(EQ_BAND_BASS, eq_settings[eq_setting][0]);
+    audio_eq_set_band(EQ_BAND_TREBLE, eq_settings[eq_setting][1]);
+    if (++eq_setting == eq_setting_count)
+        eq_setting = 0;
+    audio_eq_process(buf, samples, 65536);
+}
+
+// Profile EQ: v + 1 peaking filters (RBJ cookbook) spread over the band
+static const char *setup_eq_profile(uint8_t v) {
+    eq_profile_t p;
+    memset(&p, 0, sizeof(p));
+    strcpy(p.name, "bench");
+    p.filter_count = (uint8_t)(v + 1);
+    for (uint8_t f = 0; f < p.filter_count; f++) {
+        eq_filter_t *filt = &p.filters[f];
+        double freq = 40.0 * pow(2.0, f * 0.9);
+        double gain = (f & 1) ? -4.0 : 3.0;
+        double q = 1.0;
+        double a = pow(10.0, gain / 40.0);
+        double w0 = 2.0 * M_PI * freq / 48000.0;
+        double alpha = sin(w0) / (2.0 * q);
+        double a0 = 1.0 + alpha / a;
+        filt->b0 = (float)((1.0 + alpha * a) / a0);
+        filt->b1 = (float)(-2.0 * cos(w0) / a0);
+        filt->b2 = (float)((1.0 - alpha * a) / a0);
+        filt->a1 = filt->b1;
+        filt->a2 = (float)((1.0 - alpha / a) / a0);
+        filt->freq = (float)freq;
+        filt->gain = (float)gain;
+        filt->q = (float)q;
+        filt->type = FILTER_BELL;
+        filt->enabled = 1;
+    }
+    if (!eq_profile_set(0, &p)) {
+        fprintf(stderr, "bench profile rejected\n");
+        exit(2);
+    }
+    eq_profile_set_active(0);
+    eq_profile_reset_state();
+    return label_int(p.filter_count);
+}
+
+static void run_eq_profile(int32_t *buf, uint16_t samples) {
+    eq_profile_process(buf, samples, 65536);
+}
+
+static void run_unpack(int32_t *buf, uint16_t samples) {
+    audio_unpack_s24(packed_src, buf, samples);
+}
+
+// 16-bit: the first two thirds of the same bytes (the values don't matter)
+static void run_unpack16(int32_t *buf, uint16_t samples) {
+    audio_unpack_s16(packed_src, buf, samples);
+}
+
+// Resampler: a full period out of the frames it takes, read from the
+// buffer's tail as the audio stage does
+static audio_resample_t resampler;
+
+static const char *setup_resample(uint8_t v) {
+    (void)v;
+    audio_resample_reset(&resampler);
+    return "";
+}
+
+static void run_resample(int32_t *buf, uint16_t samples) {
+    uint16_t frames = samples / 2;
+    uint16_t in = audio_resample_needed(&resampler, frames);
+    audio_resample_process(&resampler, &buf[2 * (frames - in)], buf, frames);
+}
+
+static void run_swap(int32_t *buf, uint16_t samples) {
+    audio_pcm_swap(buf, samples);
+}
+
+// Volume: a steady -6dB, or a ramp to a new level every buffer
+static uint8_t volume_ramp, volume_up;
+
+static const char *setup_volume(uint8_t v) {
+    volume_ramp = v;
+    return v ? "ramp" : "flat";
+}
+
+static void run_volume(int32_t *buf, uint16_t samples) {
+    if (volume_ramp) {
+        volume_up ^= 1;
+        audio_pcm_volume(buf, samples, volume_up ? 20000 : 40000,
+                         volume_up ? 40000 : 20000);
+    } else {
+        audio_pcm_volume(buf, samples, 32768, 32768);
+    }
+}
+
+static void run_pack(int32_t *buf, uint16_t samples) {
+    audio_pcm_pack(buf, samples);
+}
+
+static const bench_kernel_t kernels[] = {
+    {"audio_eq", 4, setup_audio_eq, run_audio_eq, 0},
+    {"eq_profile", EQ_MAX_FILTERS, setup_eq_profile, run_eq_profile, 0},
+    {"unpack", 1, setup_none, run_unpack, 1},
+    {"unpack16", 1, setup_none, run_unpack16, 1},
+    {"resample", 1, setup_resample, run_resample, 0},
+    {"swap", 1, setup_none, run_swap, 0},
+    {"volume", 2, setup_volume, run_volume, 0},
+    {"pack", 1, setup_none, run_pack, 0},
+};
+
+// ---------------------------------------------------------------------------
+// Signal and timing
+// ---------------------------------------------------------------------------
+
+static int32_t signal_s32[SIGNAL_FRAMES * 2];
+static uint8_t signal_s24[SIGNAL_FRAMES * 2 * 3];
+static int32_t work[SAMPLES];
+
+// Tones from bass to treble at -18dBFS each plus a little noise: every
+// filter has something in band, nothing clips. Whole cycles in the loop.
+static void make_signal(void) {
+    static const double tones[] = {50.0, 220.0, 1000.0, 4400.0, 12000.0};
+    uint32_t lcg = 12345;
+    for (uint32_t n = 0; n < SIGNAL_FRAMES; n++) {
+        for (uint8_t ch = 0; ch < 2; ch++) {
+            double x = 0.0;
+            for (size_t t = 0; t < sizeof(tones) / sizeof(tones[0]); t++)
+                x += 0.25 / 2.0 * sin(2.0 * M_PI * tones[t] * n / 48000.0 +
+                                      ch * 0.5);
+            lcg = lcg * 1664525U + 1013904223U;
+            x += ((int32_t)(lcg >> 8) - (1 << 23)) / 8388608.0 * 0.001;
+            int32_t s = (int32_t)lrint(x * 8388607.0);
+            uint32_t i = n * 2 + ch;
+            signal_s32[i] = s;
+            signal_s24[i * 3] = (uint8_t)s;
+            signal_s24[i * 3 + 1] = (uint8_t)(s >> 8);
+            signal_s24[i * 3 + 2] = (uint8_t)(s >> 16);
+        }
+    }
+}
+
+static void pause_ms(long ms) {
+    struct timespec ts = {ms / 1000, (ms % 1000) * 1000000L};
+    nanosleep(&ts, NULL);
+}
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+// The calibration kernel, a little of each kind of work the kernels do: a
+// serial float recurrence (the biquads) and an integer multiply-and-store
+// pass (the conversion loops)
+static volatile float calib_sink;
+
+static void run_calibration(int32_t *buf, uint16_t samples) {
+    float y = 0.0f;
+    for (uint16_t i = 0; i < samples; i++) {
+        y = (float)buf[i] * 0.01f + y * 0.99f;
+        buf[i] = (int32_t)y;
+    }
+    calib_sink = y;
+    for (uint16_t i = 0; i < samples; i++)
+        buf[i] = (int32_t)(((int64_t)buf[i] * 40000) >> 16) | 1;
+}
+
+static void run_reload(int32_t *buf, uint16_t samples) {
+    (void)buf;
+    (void)samples;
+}
+
+// ns per mono sample of one run of BENCH_ITERS buffers. Every buffer is
+// reloaded from the next period of the signal first (in-place kernels must
+// not feed on their own output).
+static uint32_t signal_pos;
+
+static double time_run(void (*run)(int32_t *, uint16_t), uint8_t packed) {
+    double start = now_ns();
+    for (int it = 0; it < BENCH_ITERS; it++) {
+        if (packed)
+            packed_src = &signal_s24[signal_pos * 3];
+        else
+            memcpy(work, &signal_s32[signal_pos], sizeof(work));
+        run(work, SAMPLES);
+        signal_pos += SAMPLES;
+        if (signal_pos >= SIGNAL_FRAMES * 2)
+            signal_pos = 0;
+    }
+    return (now_ns() - start) / ((double)BENCH_ITERS * SAMPLES);
+}
+
+typedef struct {
+    double ns;    // kernel, reload subtracted
+    double calib; // calibration loop, reload subtracted
+} bench_timing_t;
+
+// Best of BENCH_REPS runs each of the kernel, the calibration loop and the
+// reload alone, interleaved so a slow spell of the host hits all three
+static bench_timing_t time_kernel(const bench_kernel_t *kern) {
+    double k = 1e30, c = 1e30, reload = 1e30;
+    for (int rep = 0; rep < BENCH_REPS; rep++) {
+        double t = time_run(kern->run, kern->packed_input);
+        if (t < k)
+            k = t;
+        t = time_run(run_calibration, 0);
+        if (t < c)
+            c = t;
+        t = time_run(run_reload, 0);
+        if (t < reload)
+            reload = t;
+    }
+    bench_timing_t r = {k, c - reload};
+    if (!kern->packed_input)
+        r.ns -= reload;
+    if (r.ns < 0.01)
+        r.ns = 0.01;
+    return r;
+}
+
+// ---------------------------------------------------------------------------
+// Baseline
+// ---------------------------------------------------------------------------
+
+typedef struct {
+    char key[40];
+    double cost; // relative to the calibration loop
+} bench_result_t;
+
+static bench_result_t baseline[MAX_RESULTS];
+static int baseline_count;
+
+static void load_baseline(const char *path) {
+    FILE *f = fopen(path, "r");
+    if (!f) {
+        fprintf(stderr, "cannot read baseline %s\n", path);
+        exit(2);
+    }
+    char line[128];
+    while (fgets(line, sizeof(line), f) && baseline_count < MAX_RESULTS) {
+        bench_result_t *b = &baseline[baseline_count];
+        if (line[0] == '#' || sscanf(line, "%39s %lf", b->key, &b->cost) != 2)
+            continue;
+        baseline_count++;
+    }
+    fclose(f);
+}
+
+static const bench_result_t *find_baseline(const char *key) {
+    for (int i = 0; i < baseline_count; i++)
+        if (strcmp(baseline[i].key, key) == 0)
+            return &baseline[i];
+    return NULL;
+}
+
+int main(int argc, char **argv) {
+    const char *baseline_path = NULL, *write_path = NULL;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (strcmp(argv[i], "--baseline") == 0)
+            baseline_path = argv[i + 1];
+        else if (strcmp(argv[i], "--write") == 0)
+            write_path = argv[i + 1];
+    }
+    if (baseline_path)
+        load_baseline(baseline_path);
+    const char *tol_env = getenv("BENCH_TOLERANCE");
+    double tolerance = tol_env ? atof(tol_env) : DEFAULT_TOLERANCE;
+
+    make_signal();
+
+    bench_result_t results[MAX_RESULTS];
+    int count = 0, failures = 0;
+    for (size_t k = 0; k < sizeof(kernels) / sizeof(kernels[0]); k++) {
+        const bench_kernel_t *kern = &kernels[k];
+        for (uint8_t v = 0; v < kern->variants && count < MAX_RESULTS; v++) {
+            bench_result_t *r = &results[count++];
+            const char *var = kern->setup(v);
+            snprintf(r->key, sizeof(r->key), "%s%s%s", kern->name,
+                     var[0] ? "/" : "", var);
+
+            // A kernel over the tolerance is timed again, after a pause,
+            // before it counts: host noise only ever makes a run slower
+            const bench_result_t *b = find_baseline(r->key);
+            bool checked = b && b->cost >= MIN_CHECKED_COST;
+            bench_timing_t t = time_kernel(kern);
+            r->cost = t.ns / t.calib;
+            for (int retry = 0; checked && retry < BENCH_RETRIES &&
+                                (r->cost / b->cost - 1.0) * 100.0 > tolerance;
+                 retry++) {
+                pause_ms(BENCH_RETRY_PAUSE_MS);
+                bench_timing_t again = time_kernel(kern);
+                if (again.ns / again.calib < r->cost) {
+                    t = again;
+                    r->cost = t.ns / t.calib;
+                }
+            }
+
+            printf("%-16s %8.2f ns/sample %9.1f Msamples/s  x%.3f", r->key,
+                   t.ns, 1e3 / t.ns, r->cost);
+            if (checked) {
+                double change = (r->cost / b->cost - 1.0) * 100.0;
+                bool slow = change > tolerance;
+                printf("  (baseline x%.3f, %+.0f%%)%s", b->cost, change,
+                       slow ? "  REGRESSION" : "");
+                failures += slow;
+            } else if (baseline_path) {
+                printf("  (no baseline)");
+            }
+            printf("\n");
+        }
+    }
+
+    if (write_path) {
+        FILE *f = fopen(write_path, "w");
+        if (!f) {
+            fprintf(stderr, "cannot write %s\n", write_path);
+            return 2;
+        }
+        fprintf(f, "# DSP benchmark baseline (tests/bench_dsp.c): cost per "
+                   "sample relative to\n# the calibration loop. Regenerate "
+                   "with bench_dsp --write <this file>.\n");
+        for (int i = 0; i < count; i++)
+            fprintf(f, "%s %.3f\n", results[i].key, results[i].cost);
+        fclose(f);
+    }
+
+    printf("bench_dsp: %d kernels, %d regressions (tolerance %.0f%%)\n",
+           count, failures, tolerance);
+    return failures ? 1 : 0;
+}
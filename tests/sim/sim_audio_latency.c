@@ -0,0 +1,7 @@
+// SPDX-License-Identifier: GPL-3.0-only
+// Copyright (c) 2026 Elia Chiarucci
+
+// App/Src/audio_latency.c with its preset lookup renamed, so the simulation
+// can substitute a tuned preset (sim_audio.c, audio_latency_preset)
+#define audio_latency_preset audio_latency_table
+#include "../../App/Src/audio_latency.c"
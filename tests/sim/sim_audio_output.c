@@ -0,0 +1,6 @@
+// SPDX-License-Identifier: GPL-3.0-only
+// Copyright (c) 2026 Elia Chiarucci
+
+// App/Src/audio_output.c on the simulated hardware (sim_hw.h)
+#include "sim_hw.h"
+#include "../../App/Src/audio_output.c"
@@ -0,0 +1,58 @@
+// SPDX-License-Identifier: GPL-3.0-only
+// Copyright (c) 2026 Elia Chiarucci
+
+/*
+ * Hardware shims for the host audio path simulation (tests/sim_audio.c).
+ *
+ * The firmware sources are compiled unmodified against the real HAL, CMSIS
+ * and TinyUSB headers. This header is included first by each wrapper
+ * translation unit (sim_audio_output.c, sim_usb_audio.c): it pulls those
+ * headers in, then points the peripherals the audio path touches at host
+ * objects and replaces the Cortex-M intrinsics, before the firmware source
+ * itself is included (its own #includes are then no-ops).
+ *
+ * The simulation runs every interrupt to completion at its simulated time,
+ * so masking only has to be tracked: a PendSV pended under BASEPRI runs
+ * when the mask drops, as on the target.
+ */
+
+#ifndef SIM_HW_H
+#define SIM_HW_H
+
+#include "main.h"
+#include "tusb.h"
+#include "device/usbd_pvt.h"
+#include <stdint.h>
+
+// Peripherals: GPDMA1 channel 0 plays the I2S ring, SCB takes the PendSV
+// request
+extern DMA_Channel_TypeDef sim_i2s_dma;
+extern SCB_Type sim_scb;
+
+#undef GPDMA1_Channel0
+#define GPDMA1_Channel0 (&sim_i2s_dma)
+#undef SCB
+#define SCB (&sim_scb)
+
+// DWT: the cycle counter at simulated time, read through a call so the
+// firmware's busy-waits on the DMA poll it (sim_audio.c)
+DWT_Type *sim_dwt(void);
+
+#undef DWT
+#define DWT (sim_dwt())
+
+uint32_t sim_get_primask(void);
+void sim_set_primask(uint32_t primask);
+void sim_disable_irq(void);
+uint32_t sim_get_basepri(void);
+void sim_set_basepri(uint32_t basepri);
+void sim_set_basepri_max(uint32_t basepri);
+
+#define __get_PRIMASK()        sim_get_primask()
+#define __set_PRIMASK(x)       sim_set_primask(x)
+#define __disable_irq()        sim_disable_irq()
+#define __get_BASEPRI()        sim_get_basepri()
+#define __set_BASEPRI(x)       sim_set_basepri(x)
+#define __set_BASEPRI_MAX(x)   sim_set_basepri_max(x)
+
+#endif // SIM_HW_H
@@ -0,0 +1,1278 @@
+// SPDX-License-Identifier: GPL-3.0-only
+// Copyright (c) 2026 Elia Chiarucci
+
+/*
+ * Host simulation of the USB audio path, running the firmware itself.
+ *
+ * App/Src/audio_output.c and App/Src/usb_audio.c are compiled unmodified
+ * (tests/sim) on a model of the hardware around them:
+ *
+ *  - GPDMA1 channel 0 plays the linked-list ring the firmware programs, at
+ *    the DAC clock (the rate HAL_I2S_Init was last given, offset by --ppm
+ *    from the host's frame clock):
+ *    BNDT counts down as it plays, each period end loads the next item,
+ *    raises TC and calls the DMA IRQ, and the PendSV it pends runs the
+ *    audio stage up to STAGE_MAX_NS later.
+ *  - TinyUSB's EP OUT FIFO is its real tu_fifo. The host sends one packet
+ *    per 1ms frame, sized from the feedback value it last read (every
+ *    FB_POLL_MS, as 10.14; 16.16 built as UAC2), landing late by up to --jitter us (in order)
+ *    or not at all (--drop per 10000); every SOF runs the feedback ISR.
+ *  - The DAC reads every period as the DMA loads it. Packets carry a frame
+ *    counter, so it sees exactly what the listener would: audio in order,
+ *    jumps (lost audio), held samples and silence.
+ *
+ * The stream opens once audio_output_init() is done, runs --ms and closes.
+ * With --rate 96000 the host sets the rate after opening it, as Windows
+ * does: the firmware stops the ring, reprograms the I2S and prebuffers
+ * again. At 44100 or 88200 the firmware resamples: the DAC sees the
+ * counter ramp interpolated, advancing 147/160 per frame, give or take the
+ * float rounding (a couple of LSBs once the counter is in the millions),
+ * so it takes steps of -2 to 3 as in order, and a value repeated more than
+ * DAC_MAX_REPEAT times as concealment (which holds whole periods). The
+ * filter smears a jump over AUDIO_RESAMPLE_TAPS frames: one jump.
+ * --bits 16 opens the 16-bit alternate setting instead: the counter is cut
+ * to 15 bits and wraps, which the resampler would smear, so native rates
+ * only.
+ * --ignore-feedback makes the host send at the nominal rate whatever the
+ * feedback says, as some hosts and hubs do: the firmware's converter
+ * (audio_asrc.h) has to engage and hold the FIFO. Its output is the ramp
+ * interpolated, checked as for the resampler (24-bit only) with one LSB
+ * more either way: its float sums round a little more at 96kHz's counts.
+ * Built with USB_AUDIO_UAC2 (sim_audio_uac2), the host reads the clock
+ * source's rate RANGE and sets the rate on it, as a UAC2 host does.
+ * Built with USB_AUDIO_LOOPBACK (sim_audio_loopback), the host opens the
+ * capture interface with the stream and reads a packet from TinyUSB's EP
+ * IN FIFO every frame, sized by its flow control (47 to 49 frames around
+ * half the FIFO, as audiod_tx_packet_size): lined up on the first audio
+ * frame, every captured frame must be the one the DAC played, L/R as sent.
+ * The report covers underruns and concealment (the firmware's own counters
+ * and the DAC's view), FIFO excursions, feedback convergence and accuracy,
+ * the delay estimate and the converter. Ring size, period and prebuffer
+ * threshold (the FIFO target) can be overridden to tune the latency presets:
+ *
+ *   sim_audio --latency low --jitter 500 --target 672 --periods 3
+ *
+ * --check exits non-zero unless the stream is clean: no underrun, partial
+ * fill, FIFO overflow or deadline miss, feedback locked, the level settled
+ * on the target (without drops), and no audio lost beyond the dropped
+ * packets; with --ignore-feedback, the converter engaged on the host
+ * ignoring the feedback and tracking by the end (in place of the level checks), and
+ * otherwise not engaged at all; with the loopback, the capture identical to
+ * the DAC's output and never short of a packet once it started.
+ */
+
+#include "sim/sim_hw.h"
+#include "audio_latency.h"
+#include "audio_output.h"
+#include "audio_pcm.h"
+#include "audio_resample.h"
+#include "audio_stats.h"
+#include "deadline.h"
+#include "eq_profile.h"
+#include "usb_audio.h"
+#include "usb_descriptors.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define FIFO_DEPTH   CFG_TUD_AUDIO_FUNC_1_EP_OUT_SW_BUF_SZ
+#define MAX_PACKET_BYTES CFG_TUD_AUDIO_FUNC_1_EP_OUT_SZ_MAX
+#define FB_POLL_MS   8      // host re-reads the feedback endpoint
+#define STAGE_MAX_NS 100000 // audio stage start latency after the DMA IRQ
+#define SOF_MAX_NS   5000   // SOF interrupt latency
+#define TASK_MS      10     // main loop pass (audio_output_task)
+#define WINDOW_MS    250    // level convergence window
+#define COUNTER_BASE 0x100000 // first frame counter (clear of the DC offset)
+#define COUNTER16_BASE 0x100  // 16-bit: the counter runs BASE .. BASE+SPAN-1
+#define COUNTER16_SPAN 0x7E00
+
+#define MS 1000000LL // ns
+
+//--------------------------------------------------------------------+
+// Options
+//--------------------------------------------------------------------+
+
+typedef struct {
+    uint8_t latency;
+    uint32_t rate;      // stream sample rate, Hz
+    uint8_t bits;       // sample format: 24 or 16 (alternate setting 2)
+    int32_t ppm;        // DAC clock offset from the host frame clock
+    uint32_t jitter_us; // packet arrival delay, 0..jitter_us
+    uint32_t drop;      // packets lost per 10000
+    uint32_t ms;        // stream length
+    uint32_t seed;
+    bool ignore_feedback; // host keeps the nominal rate
+    int32_t period_frames, periods, target; // preset overrides, -1 = keep
+    bool check;
+    bool expect_underruns;
+    bool verbose;
+} sim_opts_t;
+
+static sim_opts_t opt = {
+    .latency = AUDIO_LATENCY_DEFAULT,
+    .rate = AUDIO_LATENCY_RATE,
+    .bits = 24,
+    .ms = 20000,
+    .seed = 0x2545F491u,
+    .period_frames = -1,
+    .periods = -1,
+    .target = -1,
+};
+
+//--------------------------------------------------------------------+
+// Tuned preset
+//--------------------------------------------------------------------+
+
+// The firmware's table (tests/sim/sim_audio_latency.c)
+const audio_latency_preset_t *audio_latency_table(uint8_t id);
+
+static audio_latency_preset_t tuned;
+static bool tuned_on = false;
+
+const audio_latency_preset_t *audio_latency_preset(uint8_t id) {
+    if (tuned_on && id == opt.latency)
+        return &tuned;
+    return audio_latency_table(id);
+}
+
+//--------------------------------------------------------------------+
+// Simulated time and interrupts
+//--------------------------------------------------------------------+
+
+static int64_t now_ns = 0;
+static uint32_t rng_state;
+
+static uint32_t rng(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+static int64_t rng_range(int64_t max) {
+    return max > 0 ? (int64_t)(rng() % (uint32_t)(max + 1)) : 0;
+}
+
+DMA_Channel_TypeDef sim_i2s_dma;
+SCB_Type sim_scb;
+static SPI_TypeDef sim_spi1;
+I2S_HandleTypeDef hi2s1 = {.Instance = &sim_spi1,
+                           .Init.AudioFreq = I2S_AUDIOFREQ_48K};
+
+static uint32_t primask = 0;
+static uint32_t basepri = 0;
+static int64_t stage_at = -1; // audio stage run scheduled, ns
+
+static void pendsv_service(void);
+static void dma_poll_suspend(void);
+static void dma_set_rate(uint32_t rate);
+
+uint32_t sim_get_primask(void) { return primask; }
+void sim_set_primask(uint32_t v) { primask = v; }
+void sim_disable_irq(void) { primask = 1; }
+uint32_t sim_get_basepri(void) { return basepri; }
+
+void sim_set_basepri(uint32_t v) {
+    basepri = v;
+    if (!basepri)
+        pendsv_service(); // a fill pended under the lock runs on unlock
+}
+
+void sim_set_basepri_max(uint32_t v) {
+    if (v && (!basepri || v < basepri))
+        basepri = v;
+}
+
+uint32_t HAL_GetTick(void) {
+    return (uint32_t)(now_ns / MS);
+}
+
+// The firmware polls SUSPF against the DWT cycle counter (ring_stop): the
+// channel suspends there, at once
+uint32_t SystemCoreClock = 250000000U;
+static DWT_Type sim_dwt_regs;
+
+DWT_Type *sim_dwt(void) {
+    dma_poll_suspend();
+    sim_dwt_regs.CYCCNT = (uint32_t)(now_ns * (SystemCoreClock / 1000000U) /
+                                     1000U);
+    return &sim_dwt_regs;
+}
+
+HAL_StatusTypeDef HAL_I2S_Init(I2S_HandleTypeDef *hi2s) {
+    if (hi2s->Init.AudioFreq != I2S_AUDIOFREQ_48K &&
+        hi2s->Init.AudioFreq != I2S_AUDIOFREQ_96K)
+        return HAL_ERROR;
+    dma_set_rate(hi2s->Init.AudioFreq);
+    return HAL_OK;
+}
+
+//--------------------------------------------------------------------+
+// Board and firmware modules outside the audio path
+//--------------------------------------------------------------------+
+
+static GPIO_PinState dac_pin = GPIO_PIN_RESET;
+static GPIO_PinState amp_pin = GPIO_PIN_RESET;
+
+void HAL_GPIO_WritePin(GPIO_TypeDef *port, uint16_t pin, GPIO_PinState state) {
+    if (port == DAC_MUTE_GPIO_Port && pin == DAC_MUTE_Pin)
+        dac_pin = state;
+    if (port == AMP_EN_GPIO_Port && pin == AMP_EN_Pin)
+        amp_pin = state;
+}
+
+GPIO_PinState HAL_GPIO_ReadPin(const GPIO_TypeDef *port, uint16_t pin) {
+    if (port == DAC_MUTE_GPIO_Port && pin == DAC_MUTE_Pin)
+        return dac_pin;
+    if (port == AMP_EN_GPIO_Port && pin == AMP_EN_Pin)
+        return amp_pin;
+    return GPIO_PIN_RESET;
+}
+
+int SEGGER_RTT_printf(unsigned BufferIndex, const char *sFormat, ...) {
+    (void)BufferIndex;
+    if (!opt.verbose)
+        return 0;
+    va_list ap;
+    va_start(ap, sFormat);
+    printf("%9.3f ms  ", (double)now_ns / MS);
+    int n = vprintf(sFormat, ap);
+    va_end(ap);
+    return n;
+}
+
+uint8_t app_get_power_level(void) { return 2; } // 3A: unity
+
+// Profile EQ stays off (its flash storage is not simulated); the legacy
+// bass/treble EQ runs for real, flat
+uint8_t eq_profile_get_active(void) { return EQ_PROFILE_OFF; }
+void eq_profile_process(int32_t *buffer, uint16_t sample_count,
+                        uint32_t volume_scale) {
+    (void)buffer;
+    (void)sample_count;
+    (void)volume_scale;
+}
+void eq_profile_reset_state(void) {}
+bool eq_profile_set_rate(uint32_t rate) {
+    (void)rate;
+    return true;
+}
+
+//--------------------------------------------------------------------+
+// TinyUSB
+//--------------------------------------------------------------------+
+
+static uint8_t ep_out_buf[FIFO_DEPTH];
+static tu_fifo_t ep_out_ff;
+static bool sof_on = false;
+static uint32_t fb_value = 0; // last tud_audio_n_fb_set()
+
+tu_fifo_t *tud_audio_n_get_ep_out_ff(uint8_t func_id) {
+    (void)func_id;
+    return &ep_out_ff;
+}
+
+uint16_t tud_audio_n_available(uint8_t func_id) {
+    (void)func_id;
+    return tu_fifo_count(&ep_out_ff);
+}
+
+bool tud_audio_n_fb_set(uint8_t func_id, uint32_t feedback) {
+    (void)func_id;
+    fb_value = feedback;
+    return true;
+}
+
+void usbd_sof_enable(uint8_t rhport, sof_consumer_t consumer, bool en) {
+    (void)rhport;
+    (void)consumer;
+    sof_on = en;
+}
+
+#if USB_AUDIO_LOOPBACK
+// Capture FIFO, overwritable as TinyUSB configures it
+#define CAPTURE_DEPTH CFG_TUD_AUDIO_FUNC_1_EP_IN_SW_BUF_SZ
+static uint8_t ep_in_buf[CAPTURE_DEPTH];
+static tu_fifo_t ep_in_ff;
+
+tu_fifo_t *tud_audio_n_get_ep_in_ff(uint8_t func_id) {
+    (void)func_id;
+    return &ep_in_ff;
+}
+
+bool tud_audio_n_clear_ep_in_ff(uint8_t func_id) {
+    (void)func_id;
+    tu_fifo_clear(&ep_in_ff);
+    return true;
+}
+#endif
+
+// Last control IN data the firmware answered with (the ctrl buffer size)
+static uint8_t ctrl_data[64];
+static uint16_t ctrl_len = 0;
+
+bool tud_audio_buffer_and_schedule_control_xfer(
+    uint8_t rhport, tusb_control_request_t const *p_request, void *data,
+    uint16_t len) {
+    (void)rhport;
+    (void)p_request;
+    if (len > sizeof(ctrl_data))
+        return false;
+    memcpy(ctrl_data, data, len);
+    ctrl_len = len;
+    return true;
+}
+
+static void sim_run(int64_t until);
+
+// Only called by audio_output_init() while the DAC settles
+void tud_task_ext(uint32_t timeout_ms, bool in_isr) {
+    (void)timeout_ms;
+    (void)in_isr;
+    sim_run(now_ns + MS);
+}
+
+//--------------------------------------------------------------------+
+// I2S DMA
+//--------------------------------------------------------------------+
+
+// The firmware stores 32-bit bus addresses: on the host they are the low
+// half of pointers into this program's data, which all share the upper one
+static void *host_ptr(uint32_t addr) {
+    uintptr_t high = (uintptr_t)&sim_i2s_dma & ~(uintptr_t)UINT32_MAX;
+    return (void *)(high | addr);
+}
+
+static struct {
+    bool running;
+    double frame_ns; // DAC frame period
+    double start_ns; // current block
+    uint32_t bytes;
+    uint32_t src;
+} dma;
+
+static void dac_play(const uint32_t *words, uint32_t frames);
+
+static double dma_end(void) {
+    return dma.start_ns + dma.bytes / 8 * dma.frame_ns;
+}
+
+// BNDT as the firmware would read it now: one 32-bit word per half frame
+static void dma_sync(void) {
+    if (!dma.running)
+        return;
+    uint32_t words = (uint32_t)(((double)now_ns - dma.start_ns) /
+                                (dma.frame_ns / 2));
+    uint32_t played = words * 4 < dma.bytes ? words * 4 : dma.bytes;
+    sim_i2s_dma.CBR1 = (sim_i2s_dma.CBR1 & ~DMA_CBR1_BNDT) |
+                       (dma.bytes - played);
+}
+
+static void dma_block_start(double at) {
+    dma.start_ns = at;
+    dma.bytes = sim_i2s_dma.CBR1 & DMA_CBR1_BNDT;
+    dma.src = sim_i2s_dma.CSAR;
+    dac_play(host_ptr(dma.src), dma.bytes / 8);
+}
+
+// The firmware enabled the channel (ring_start)
+static void dma_poll_enable(void) {
+    if (dma.running || !(sim_i2s_dma.CCR & DMA_CCR_EN))
+        return;
+    sim_i2s_dma.CSR &= ~sim_i2s_dma.CFCR; // write-1-to-clear
+    sim_i2s_dma.CFCR = 0;
+    dma.running = true;
+    dma_block_start((double)now_ns);
+}
+
+// The firmware asked the channel to suspend (ring_stop); the reset that
+// follows is the new CCR ring_start writes
+static void dma_poll_suspend(void) {
+    if (!dma.running || !(sim_i2s_dma.CCR & DMA_CCR_SUSP))
+        return;
+    dma_sync();
+    dma.running = false;
+    sim_i2s_dma.CSR |= DMA_CSR_SUSPF;
+}
+
+// The clock the DMA plays at, against the host's 1ms frames
+static void dma_set_rate(uint32_t rate) {
+    dma.frame_ns = 1e9 / (rate * (1.0 + opt.ppm * 1e-6));
+}
+
+// Registers a linked-list item reloads, in the hardware load order
+static const uint32_t lli_fields[] = {
+    DMA_CLLR_UT1, DMA_CLLR_UT2, DMA_CLLR_UB1, DMA_CLLR_USA,
+    DMA_CLLR_UDA, DMA_CLLR_UT3, DMA_CLLR_UB2, DMA_CLLR_ULL,
+};
+
+static void dma_period_end(void) {
+    DMA_Channel_TypeDef *ch = &sim_i2s_dma;
+    double end = dma_end();
+    uint32_t llr = ch->CLLR;
+    if (!(llr & DMA_CLLR_LA)) {
+        dma.running = false; // end of list (the ring never has one)
+        ch->CCR &= ~DMA_CCR_EN;
+        return;
+    }
+
+    const uint32_t *item =
+        host_ptr((ch->CLBAR & DMA_CLBAR_LBA) | (llr & DMA_CLLR_LA));
+    volatile uint32_t *regs[] = {&ch->CTR1, &ch->CTR2, &ch->CBR1, &ch->CSAR,
+                                 &ch->CDAR, &ch->CTR3, &ch->CBR2, &ch->CLLR};
+    for (unsigned i = 0; i < sizeof(lli_fields) / sizeof(lli_fields[0]); i++)
+        if (llr & lli_fields[i])
+            *regs[i] = *item++;
+
+    ch->CSR |= DMA_CSR_TCF;
+    if (ch->CCR & DMA_CCR_TCIE) {
+        audio_output_dma_irq();
+        ch->CSR &= ~ch->CFCR; // write-1-to-clear
+        ch->CFCR = 0;
+    }
+    dma_block_start(end);
+}
+
+// PendSV: runs the audio stage once nothing masks it
+static void pendsv_pend_check(void) {
+    if ((sim_scb.ICSR & SCB_ICSR_PENDSVSET_Msk) && stage_at < 0)
+        stage_at = now_ns + rng_range(STAGE_MAX_NS);
+}
+
+static void pendsv_service(void) {
+    if (!(sim_scb.ICSR & SCB_ICSR_PENDSVSET_Msk) || basepri || primask ||
+        stage_at > now_ns)
+        return;
+    sim_scb.ICSR &= ~SCB_ICSR_PENDSVSET_Msk;
+    stage_at = -1;
+    audio_output_process();
+}
+
+//--------------------------------------------------------------------+
+// DAC: what the listener hears
+//--------------------------------------------------------------------+
+
+static struct {
+    bool synced;       // locked on the stream's frame counter
+    uint32_t run;      // consecutive in-order frames before sync
+    bool resampled;    // counter advances 147/160 per frame
+    int32_t prev_a, prev_b;
+    uint32_t same_run; // frames repeating the one before
+    uint32_t smear;    // frames left of a jump through the resampler
+    uint32_t expect;   // next counter value
+    uint32_t played;   // stream frames in order
+    uint32_t jumps;    // discontinuities: audio lost
+    uint32_t held;     // held-sample frames (concealment)
+    uint32_t silent;   // DC-offset silence frames
+    uint32_t corrupt;  // anything else
+} dac;
+
+static bool stream_open = false;
+
+#define DAC_MAX_REPEAT 3
+
+// USB bytes per stereo frame
+static uint32_t frame_bytes(void) { return opt.bits / 8U * 2U; }
+
+// Alternate setting of the --bits format
+static uint8_t stream_alt(void) {
+    return opt.bits == 16 ? USB_AUDIO_ALT_16 : USB_AUDIO_ALT_24;
+}
+
+// Counter value after v
+static uint32_t dac_next(uint32_t v) {
+    if (opt.bits == 16 && v == COUNTER16_BASE + COUNTER16_SPAN - 1)
+        return COUNTER16_BASE;
+    return v + 1;
+}
+
+// Counter value v continues the stream
+static bool dac_in_order(uint32_t v) {
+    if (!dac.resampled)
+        return v == dac.expect;
+    int32_t step = (int32_t)(v - (dac.expect - 1));
+    int32_t slack = opt.ignore_feedback ? 1 : 0;
+    return step >= -2 - slack && step <= 3 + slack;
+}
+
+#if USB_AUDIO_LOOPBACK
+// The DAC's last frames, for the capture to be checked against
+#define DAC_LOG 4096
+static struct {
+    int32_t a[DAC_LOG], b[DAC_LOG];
+    uint32_t frames;      // played since boot
+    uint32_t first_audio; // index of the stream's first audio frame
+    bool audio_seen;
+} dac_log;
+#endif
+
+static void dac_play(const uint32_t *words, uint32_t frames) {
+    for (uint32_t i = 0; i < frames; i++) {
+        int32_t a = (int32_t)words[2 * i] >> 8;
+        int32_t b = (int32_t)words[2 * i + 1] >> 8;
+#if USB_AUDIO_LOOPBACK
+        if (stream_open && !dac_log.audio_seen &&
+            (a != AUDIO_PCM_DC_OFFSET || b != AUDIO_PCM_DC_OFFSET)) {
+            dac_log.first_audio = dac_log.frames;
+            dac_log.audio_seen = true;
+        }
+        dac_log.a[dac_log.frames % DAC_LOG] = a;
+        dac_log.b[dac_log.frames % DAC_LOG] = b;
+        dac_log.frames++;
+#endif
+        bool audio = a == -b && a != 0 && (a > 1 || a < -1);
+        uint32_t v = (uint32_t)(a > 0 ? a : -a) >> (opt.bits == 16 ? 8 : 0);
+        bool same = a == dac.prev_a && b == dac.prev_b;
+        dac.same_run = same ? dac.same_run + 1 : 0;
+        dac.prev_a = a;
+        dac.prev_b = b;
+        if (dac.resampled && same && dac.same_run <= DAC_MAX_REPEAT)
+            same = false; // a step of 0
+
+        if (!dac.synced) {
+            // The first period after the prebuffer ramps the volume up
+            // from zero: lock on once the counter runs in order
+            if (stream_open && audio && dac_in_order(v)) {
+                if (++dac.run >= 16)
+                    dac.synced = true;
+            } else {
+                dac.run = 0;
+            }
+            dac.expect = dac_next(v);
+            continue;
+        }
+
+        if (dac.smear)
+            dac.smear--;
+        if (audio && !same) {
+            if (dac_in_order(v)) {
+                dac.played++;
+            } else if (!dac.smear) {
+                dac.jumps++;
+                if (dac.resampled)
+                    dac.smear = AUDIO_RESAMPLE_TAPS;
+            }
+            dac.expect = dac_next(v);
+        } else if (a == AUDIO_PCM_DC_OFFSET && b == AUDIO_PCM_DC_OFFSET) {
+            dac.silent++;
+        } else if (same) {
+            dac.held++;
+        } else {
+            dac.corrupt++;
+        }
+    }
+}
+
+//--------------------------------------------------------------------+
+// Host
+//--------------------------------------------------------------------+
+
+// Packets in flight, in arrival order (jitter is at most a few frames)
+#define IN_FLIGHT 64
+
+static struct {
+    uint32_t frame;   // next USB frame to send in
+    uint32_t fb;      // value read from the feedback endpoint (16.16)
+    uint32_t acc;     // fractional frames carried over (16.16)
+    uint32_t counter; // next audio frame's counter
+    int64_t arrival[IN_FLIGHT];
+    uint8_t frames[IN_FLIGHT];
+    uint32_t head, tail;
+    uint32_t sent, dropped, overflows;
+    int64_t last_arrival;
+} host;
+
+static int64_t host_next_arrival(void) {
+    return host.head != host.tail ? host.arrival[host.tail % IN_FLIGHT]
+                                  : INT64_MAX;
+}
+
+static void host_queue(void) {
+    if (host.frame % FB_POLL_MS == 0 && !opt.ignore_feedback)
+#if USB_AUDIO_UAC2
+        host.fb = fb_value; // sent as 16.16
+#else
+        host.fb = fb_value & ~3U; // sent as 10.14 on full speed
+#endif
+    host.acc += host.fb;
+    uint32_t frames = host.acc >> 16;
+    host.acc &= 0xFFFF;
+    uint32_t max_packet =
+        (opt.bits == 16 ? CFG_TUD_AUDIO_FUNC_1_EP_OUT_SZ_FS_16
+                        : CFG_TUD_AUDIO_FUNC_1_EP_OUT_SZ_FS) / frame_bytes();
+    if (frames > max_packet)
+        frames = max_packet;
+
+    int64_t sof = (int64_t)host.frame * MS;
+    int64_t t = sof + rng_range((int64_t)opt.jitter_us * 1000);
+    if (t < host.last_arrival)
+        t = host.last_arrival; // in order: a late packet delays the next
+    host.last_arrival = t;
+    if (host.head - host.tail < IN_FLIGHT) {
+        host.arrival[host.head % IN_FLIGHT] = t;
+        host.frames[host.head % IN_FLIGHT] = (uint8_t)frames;
+        host.head++;
+    }
+    host.frame++;
+}
+
+static void host_deliver(void) {
+    uint32_t frames = host.frames[host.tail % IN_FLIGHT];
+    host.tail++;
+    host.sent++;
+    uint8_t pkt[MAX_PACKET_BYTES] = {0};
+    uint32_t size = opt.bits / 8U;
+    for (uint32_t i = 0; i < frames; i++) {
+        uint32_t n = host.counter++;
+        int32_t v = opt.bits == 16
+                        ? (int32_t)(COUNTER16_BASE + n % COUNTER16_SPAN)
+                        : (int32_t)(n & 0x7FFFFF);
+        int32_t s[2] = {v, -v};
+        for (uint32_t c = 0; c < 2; c++)
+            for (uint32_t b = 0; b < size; b++)
+                pkt[(i * 2 + c) * size + b] = (uint8_t)(s[c] >> (8 * b));
+    }
+
+    if (opt.drop && rng() % 10000 < opt.drop) {
+        host.dropped++;
+        return; // CRC error on the bus: the frame's audio never arrives
+    }
+    uint16_t bytes = (uint16_t)(frames * frame_bytes());
+    if (tu_fifo_write_n(&ep_out_ff, pkt, bytes) < bytes)
+        host.overflows++;
+    tud_audio_rx_done_isr(BOARD_TUD_RHPORT, bytes, 0, 0x01, stream_alt());
+}
+
+#if USB_AUDIO_LOOPBACK
+//--------------------------------------------------------------------+
+// Host capture
+//--------------------------------------------------------------------+
+
+// L/R as the firmware swaps them on the way to the DAC
+#ifndef NO_SWAP_CHANNELS
+#define SIM_SWAP 1
+#else
+#define SIM_SWAP 0
+#endif
+
+#define CAPTURE_FRAME_BYTES 6
+#define CAPTURE_NOMINAL (USB_AUDIO_CAPTURE_RATE / 1000)
+
+static struct {
+    bool open;
+    int blackout;      // flow control's, as TinyUSB's
+    uint32_t frames;   // captured since open
+    bool synced;       // lined up on the DAC's first audio frame
+    int64_t offset;    // DAC index - capture index
+    uint32_t packets, checked, mismatches, missing;
+    uint32_t empty;    // zero-length packets once synced
+    uint32_t level_max;
+} cap;
+
+// TinyUSB's flow control (audiod_tx_packet_size) for a whole number of
+// frames per ms: one frame more or less per packet, 10 packets apart, to
+// hold the FIFO around half its depth
+static uint16_t capture_packet_size(uint16_t count) {
+    uint16_t nominal = CAPTURE_NOMINAL * CAPTURE_FRAME_BYTES;
+    uint16_t threshold = CAPTURE_DEPTH / 2;
+    if (count < nominal - CAPTURE_FRAME_BYTES)
+        return 0;
+    if (count < threshold - CAPTURE_FRAME_BYTES && !cap.blackout) {
+        cap.blackout = 10;
+        return nominal - CAPTURE_FRAME_BYTES;
+    }
+    if (count > threshold + CAPTURE_FRAME_BYTES && !cap.blackout) {
+        cap.blackout = 10;
+        return nominal + CAPTURE_FRAME_BYTES;
+    }
+    if (cap.blackout)
+        cap.blackout--;
+    return nominal;
+}
+
+static int32_t s24(const uint8_t *p) {
+    return (int32_t)((uint32_t)p[0] << 8 | (uint32_t)p[1] << 16 |
+                     (uint32_t)p[2] << 24) >> 8;
+}
+
+// One IN packet per frame, each captured frame checked against the DAC's
+static void capture_read(void) {
+    uint16_t count = tu_fifo_count(&ep_in_ff);
+    if (count > cap.level_max)
+        cap.level_max = count;
+    uint8_t pkt[CFG_TUD_AUDIO_FUNC_1_EP_IN_SZ_MAX];
+    uint16_t n = tu_fifo_read_n(&ep_in_ff, pkt, capture_packet_size(count));
+    cap.packets++;
+    if (!n && cap.synced)
+        cap.empty++;
+
+    for (uint16_t i = 0; i < n / CAPTURE_FRAME_BYTES; i++) {
+        uint32_t c = cap.frames++;
+        int32_t l = s24(&pkt[i * CAPTURE_FRAME_BYTES]);
+        int32_t r = s24(&pkt[i * CAPTURE_FRAME_BYTES + 3]);
+        if (!cap.synced) {
+            if (l == AUDIO_PCM_DC_OFFSET && r == AUDIO_PCM_DC_OFFSET)
+                continue; // silence before the stream's audio
+            if (!dac_log.audio_seen) {
+                cap.mismatches++;
+                continue;
+            }
+            cap.synced = true;
+            cap.offset = (int64_t)dac_log.first_audio - c;
+        }
+        int64_t d = (int64_t)c + cap.offset;
+        if (d < 0 || d >= dac_log.frames || dac_log.frames - d > DAC_LOG) {
+            cap.missing++; // not played yet, or long gone
+            continue;
+        }
+        int32_t a = dac_log.a[d % DAC_LOG], b = dac_log.b[d % DAC_LOG];
+        cap.checked++;
+        if (l != (SIM_SWAP ? b : a) || r != (SIM_SWAP ? a : b))
+            cap.mismatches++;
+    }
+}
+
+static void capture_set_itf(uint8_t alt) {
+    tusb_control_request_t req = {
+        .bmRequestType = 0x01,
+        .bRequest = TUSB_REQ_SET_INTERFACE,
+        .wValue = alt,
+        .wIndex = ITF_NUM_AUDIO_CAPTURE,
+    };
+    // audiod_set_interface(): a close clears the FIFO, then the callbacks
+    if (cap.open) {
+        tu_fifo_clear(&ep_in_ff);
+        tud_audio_set_itf_close_ep_cb(BOARD_TUD_RHPORT, &req);
+    }
+    cap.open = alt != 0;
+    cap.blackout = 0;
+    tud_audio_set_itf_cb(BOARD_TUD_RHPORT, &req);
+}
+
+// SET_CUR on the capture endpoint: its one rate, accepted without touching
+// the playback
+static bool capture_set_rate(uint32_t rate) {
+    tusb_control_request_t req = {
+        .bmRequestType = 0x22,
+        .bRequest = AUDIO10_CS_REQ_SET_CUR,
+        .wValue = AUDIO10_EP_CTRL_SAMPLING_FREQ << 8,
+        .wIndex = EPNUM_AUDIO_IN,
+        .wLength = 3,
+    };
+    uint8_t freq[4] = {(uint8_t)rate, (uint8_t)(rate >> 8),
+                       (uint8_t)(rate >> 16), 0};
+    uint32_t before = audio_output_get_rate();
+    return tud_audio_set_req_ep_cb(BOARD_TUD_RHPORT, &req, freq) &&
+           audio_output_get_rate() == before;
+}
+#endif
+
+#if USB_AUDIO_UAC2
+// SET CUR sampling frequency on the clock source, which restarts the
+// feedback itself (TinyUSB doesn't for UAC2); the rate must be one of the
+// RANGE answer, and read back by GET CUR
+static bool stream_set_rate(uint32_t rate) {
+    tusb_control_request_t req = {
+        .bmRequestType = 0xA1, // class, interface, IN
+        .bRequest = AUDIO20_CS_REQ_RANGE,
+        .wValue = AUDIO20_CS_CTRL_SAM_FREQ << 8,
+        .wIndex = UAC2_ENTITY_CLOCK_SOURCE << 8 | ITF_NUM_AUDIO_CONTROL,
+        .wLength = sizeof(ctrl_data),
+    };
+    if (!tud_audio_get_req_entity_cb(BOARD_TUD_RHPORT, &req))
+        return false;
+    uint16_t n = tu_unaligned_read16(ctrl_data);
+    bool listed = false;
+    for (uint16_t i = 0; i < n && 2 + 12 * (i + 1) <= ctrl_len; i++)
+        listed |= tu_unaligned_read32(&ctrl_data[2 + 12 * i]) == rate;
+    if (!listed)
+        return false;
+
+    req.bmRequestType = 0x21; // class, interface, OUT
+    req.bRequest = AUDIO20_CS_REQ_CUR;
+    req.wLength = 4;
+    uint8_t freq[4];
+    tu_unaligned_write32(freq, rate);
+    if (!tud_audio_set_req_entity_cb(BOARD_TUD_RHPORT, &req, freq))
+        return false;
+
+    req.bmRequestType = 0xA1;
+    if (!tud_audio_get_req_entity_cb(BOARD_TUD_RHPORT, &req))
+        return false;
+    return ctrl_len == 4 && tu_unaligned_read32(ctrl_data) == rate;
+}
+#else
+// SET_CUR sampling frequency on the data endpoint; TinyUSB re-reads the
+// feedback parameters after it
+static bool stream_set_rate(uint32_t rate) {
+    tusb_control_request_t req = {
+        .bmRequestType = 0x22,
+        .bRequest = AUDIO10_CS_REQ_SET_CUR,
+        .wValue = AUDIO10_EP_CTRL_SAMPLING_FREQ << 8,
+        .wIndex = EPNUM_AUDIO_OUT,
+        .wLength = 3,
+    };
+    uint8_t freq[4] = {(uint8_t)rate, (uint8_t)(rate >> 8),
+                       (uint8_t)(rate >> 16), 0};
+    if (!tud_audio_set_req_ep_cb(BOARD_TUD_RHPORT, &req, freq))
+        return false;
+    audio_feedback_params_t params = {0};
+    tud_audio_feedback_params_cb(0, stream_alt(), &params);
+    return true;
+}
+#endif
+
+static void stream_set_itf(uint8_t alt) {
+    tusb_control_request_t req = {
+        .bmRequestType = 0x01,
+        .bRequest = TUSB_REQ_SET_INTERFACE,
+        .wValue = alt,
+        .wIndex = ITF_NUM_AUDIO_STREAMING,
+    };
+    if (alt) {
+        // audiod_set_interface(): callback, then the feedback parameters
+        tud_audio_set_itf_cb(BOARD_TUD_RHPORT, &req);
+        audio_feedback_params_t params = {0};
+        tud_audio_feedback_params_cb(0, alt, &params);
+        usbd_sof_enable(BOARD_TUD_RHPORT, SOF_CONSUMER_AUDIO, false);
+    } else {
+        tu_fifo_clear(&ep_out_ff);
+        tud_audio_set_itf_close_ep_cb(BOARD_TUD_RHPORT, &req);
+        usbd_sof_enable(BOARD_TUD_RHPORT, SOF_CONSUMER_AUDIO, false);
+    }
+#if USB_AUDIO_LOOPBACK
+    // The capture opens and closes with the stream, as a recorder would
+    capture_set_itf(alt ? USB_AUDIO_ALT_24 : 0);
+#endif
+}
+
+//--------------------------------------------------------------------+
+// Measurements
+//--------------------------------------------------------------------+
+
+static struct {
+    int64_t open_ns;
+    int64_t first_audio_ns; // prebuffer done
+    uint32_t level_min, level_max; // after each packet, once streaming
+    uint32_t fill_min;             // before each refill, once streaming
+    uint64_t level_sum;
+    uint32_t levels;
+    uint64_t window_sum; // current convergence window
+    uint32_t window_n;
+    int64_t window_end;
+    int64_t unsettled_ns; // end of the last window off target
+} m;
+
+// The preset as the firmware runs it: at the stream rate, the FIFO target
+// in frames of the stream format
+static audio_latency_preset_t sim_preset(void) {
+    audio_latency_preset_t p;
+    audio_latency_at_rate(audio_latency_preset(opt.latency), opt.rate, &p);
+    p.fifo_target = (uint16_t)(p.fifo_target / AUDIO_LATENCY_FRAME_BYTES *
+                               frame_bytes());
+    return p;
+}
+
+static void measure_packet(void) {
+    uint32_t q8;
+    if (!audio_output_queued(&q8))
+        return;
+    if (!m.first_audio_ns)
+        m.first_audio_ns = now_ns;
+    uint32_t level = tu_fifo_count(&ep_out_ff);
+    if (level < m.level_min)
+        m.level_min = level;
+    if (level > m.level_max)
+        m.level_max = level;
+    m.level_sum += level;
+    m.levels++;
+
+    if (!m.window_end)
+        m.window_end = now_ns + WINDOW_MS * MS;
+    m.window_sum += level;
+    m.window_n++;
+    if (now_ns >= m.window_end) {
+        // Settled once the window mean stays within half a period of the
+        // target: with the clocks offset, the refills drift through the
+        // packet phase and the level seen by each packet beats by that
+        // much
+        audio_latency_preset_t p = sim_preset();
+        int32_t tol = (int32_t)(p.period_frames * frame_bytes() / 2);
+        int32_t err = (int32_t)(m.window_sum / m.window_n) - p.fifo_target;
+        if (err < -tol || err > tol)
+            m.unsettled_ns = now_ns;
+        m.window_sum = 0;
+        m.window_n = 0;
+        m.window_end = now_ns + WINDOW_MS * MS;
+    }
+}
+
+static void measure_fill(void) {
+    uint32_t q8;
+    if (m.first_audio_ns && audio_output_queued(&q8)) {
+        uint32_t level = tu_fifo_count(&ep_out_ff);
+        if (level < m.fill_min)
+            m.fill_min = level;
+    }
+}
+
+//--------------------------------------------------------------------+
+// Event loop
+//--------------------------------------------------------------------+
+
+static int64_t next_sof = MS;
+static int64_t next_task = TASK_MS * MS;
+static int64_t stream_end = -1;
+
+static void sim_run(int64_t until) {
+    for (;;) {
+        dma_poll_enable();
+        int64_t t_dma = dma.running ? (int64_t)dma_end() : INT64_MAX;
+        int64_t t_stage = stage_at >= 0 ? stage_at : INT64_MAX;
+        int64_t t_pkt = host_next_arrival();
+        int64_t t = until;
+        if (t_dma < t)
+            t = t_dma;
+        if (t_stage < t)
+            t = t_stage;
+        if (t_pkt < t)
+            t = t_pkt;
+        if (next_sof < t)
+            t = next_sof;
+        if (next_task < t)
+            t = next_task;
+        if (t >= until) {
+            now_ns = until;
+            dma_sync();
+            return;
+        }
+        now_ns = t;
+        dma_sync();
+
+        // Same instant: DMA IRQ (priority 0), USB (1), PendSV (4), thread
+        if (t == t_dma) {
+            dma_period_end();
+            pendsv_pend_check();
+        } else if (t == next_sof) {
+            uint32_t frame = (uint32_t)(next_sof / MS);
+            if (stream_open && stream_end < 0)
+                host_queue();
+#if USB_AUDIO_LOOPBACK
+            if (cap.open)
+                capture_read();
+#endif
+            if (sof_on) {
+                // The ISR samples the DMA position a little late
+                now_ns += rng_range(SOF_MAX_NS);
+                dma_sync();
+                tud_audio_feedback_interval_isr(0, frame & 0x7FF, 0);
+                now_ns = t;
+                dma_sync();
+            }
+            next_sof += MS;
+        } else if (t == t_pkt) {
+            host_deliver();
+            measure_packet();
+        } else if (t == t_stage) {
+            measure_fill();
+            pendsv_service();
+        } else {
+            audio_output_task();
+            next_task += TASK_MS * MS;
+        }
+    }
+}
+
+//--------------------------------------------------------------------+
+// Report
+//--------------------------------------------------------------------+
+
+static double ms_of(int64_t ns) { return (double)ns / MS; }
+
+static int report(void) {
+    audio_latency_preset_t at_rate = sim_preset();
+    const audio_latency_preset_t *p = &at_rate;
+    audio_stats_counters_t c;
+    audio_output_get_stats(&c, false);
+    audio_fb_stats_t fb;
+    usb_audio_get_feedback_stats(&fb);
+    audio_delay_stats_t dl;
+    usb_audio_get_delay_stats(&dl);
+    audio_asrc_stats_t as;
+    usb_audio_get_asrc_stats(&as);
+    uint32_t misses = deadline_state()->misses;
+
+    double ideal = opt.rate / 1000.0 * 65536.0 * (1.0 + opt.ppm * 1e-6);
+    double rate_ppm = (fb.rate - ideal) / ideal * 1e6;
+    double mean = m.levels ? (double)m.level_sum / m.levels : 0;
+    int64_t settle = m.unsettled_ns ? m.unsettled_ns - m.open_ns : 0;
+
+    printf("preset %s at %u Hz %u-bit: %u x %u frames, FIFO target %u bytes "
+           "(%u us nominal)\n",
+           p->name, (unsigned)audio_output_get_rate(), (unsigned)opt.bits,
+           (unsigned)p->periods,
+           (unsigned)p->period_frames, (unsigned)p->fifo_target,
+           (unsigned)audio_latency_total_us(audio_latency_preset(opt.latency)));
+    printf("host: %+d ppm, jitter %u us, %u packets, %u dropped, %u FIFO "
+           "overflows%s\n",
+           (int)opt.ppm, (unsigned)opt.jitter_us, (unsigned)host.sent,
+           (unsigned)host.dropped, (unsigned)host.overflows,
+           opt.ignore_feedback ? ", feedback ignored" : "");
+    printf("output: %u periods, %u underruns, %u partial, %u concealed "
+           "frames, %u prebuffer bytes dropped, %u deadline misses\n",
+           (unsigned)c.periods, (unsigned)c.underruns,
+           (unsigned)c.partial_fills, (unsigned)c.concealed_frames,
+           (unsigned)c.dropped_bytes, (unsigned)misses);
+    printf("dac: %u frames in order, %u jumps, %u held, %u silent, %u "
+           "corrupt\n",
+           (unsigned)dac.played, (unsigned)dac.jumps, (unsigned)dac.held,
+           (unsigned)dac.silent, (unsigned)dac.corrupt);
+    printf("fifo: first audio %.1f ms after open, level %u..%u mean %.0f "
+           "(target %u), lowest before a refill %u, settled %.0f ms after "
+           "open\n",
+           ms_of(m.first_audio_ns - m.open_ns), (unsigned)m.level_min,
+           (unsigned)m.level_max, mean, (unsigned)p->fifo_target,
+           (unsigned)m.fill_min, ms_of(settle));
+    printf("feedback: %s after %u ms, rate %+.1f ppm off the DAC clock, "
+           "value step %u, trim %d, %u resyncs\n",
+           fb.state == AUDIO_FB_LOCKED ? "locked" : "NOT locked",
+           (unsigned)fb.lock_ms, rate_ppm, (unsigned)fb.step_max,
+           (int)fb.trim, (unsigned)fb.resyncs);
+    printf("delay: %u us estimated (%u..%u)\n", (unsigned)dl.avg_us,
+           (unsigned)dl.min_us, (unsigned)dl.max_us);
+    static const char *const reasons[] = {"off", "feedback ignored",
+                                          "draining", "filling", "underrun"};
+    printf("asrc: %s", reasons[as.reason]);
+    if (as.reason)
+        printf(" after %u ms (owed %+d us, drift %+d us), ratio %+.1f ppm, "
+               "drift %+d us (%+d..%+d)",
+               (unsigned)as.engage_ms, (int)as.owed_us,
+               (int)as.engage_drift_us, as.loop.ppm_q8 / 256.0,
+               (int)as.drift_us, (int)as.loop.error_min_us,
+               (int)as.loop.error_max_us);
+    else
+        printf(", owed %+d us, drift %+d us", (int)as.owed_us,
+               (int)as.drift_us);
+    printf("\n");
+#if USB_AUDIO_LOOPBACK
+    printf("loopback: %u packets, %u frames captured, %u checked, %u "
+           "mismatches, %u missing, %u empty packets, FIFO peak %u of %u\n",
+           (unsigned)cap.packets, (unsigned)cap.frames, (unsigned)cap.checked,
+           (unsigned)cap.mismatches, (unsigned)cap.missing,
+           (unsigned)cap.empty, (unsigned)cap.level_max,
+           (unsigned)CAPTURE_DEPTH);
+#endif
+
+    if (opt.expect_underruns) {
+        // Model sanity: a preset pushed past its rating has to break
+        bool broke = c.underruns || c.partial_fills;
+        printf("%s\n", broke ? "underruns as expected" : "FAIL: no underrun");
+        return broke ? 0 : 1;
+    }
+    if (!opt.check)
+        return 0;
+
+    int failures = 0;
+#define SIM_CHECK(cond)                                                     \
+    do {                                                                    \
+        if (!(cond)) {                                                      \
+            printf("FAIL: %s\n", #cond);                                    \
+            failures++;                                                     \
+        }                                                                   \
+    } while (0)
+    SIM_CHECK(amp_pin == GPIO_PIN_SET && dac_pin == GPIO_PIN_SET);
+    SIM_CHECK(audio_output_fifo_target() == p->fifo_target);
+    SIM_CHECK(c.underruns == 0 && c.partial_fills == 0);
+    SIM_CHECK(host.overflows == 0);
+    SIM_CHECK(misses == 0);
+    SIM_CHECK(dac.synced && dac.corrupt == 0 && dac.held == 0);
+    SIM_CHECK(dac.jumps <= host.dropped);
+    SIM_CHECK(fb.state == AUDIO_FB_LOCKED);
+    SIM_CHECK(rate_ppm > -10.0 && rate_ppm < 10.0);
+    // A lost packet takes the level down by its size, and the trim only
+    // brings it back over seconds; ignored, the feedback doesn't hold it
+    if (!opt.drop && !opt.ignore_feedback) {
+        uint32_t period_bytes = p->period_frames * frame_bytes();
+        SIM_CHECK(mean > p->fifo_target - period_bytes &&
+                  mean < p->fifo_target + period_bytes);
+        SIM_CHECK(settle < (int64_t)opt.ms * MS / 2);
+    }
+    if (opt.ignore_feedback) {
+        SIM_CHECK(as.reason == AUDIO_ASRC_IGNORED);
+        SIM_CHECK(as.loop.state == AUDIO_AD_TRACKING);
+    } else {
+        SIM_CHECK(as.reason == AUDIO_ASRC_OFF);
+    }
+#if USB_AUDIO_LOOPBACK
+    // Everything from the first audio frame to the close, exactly
+    SIM_CHECK(cap.synced && cap.mismatches == 0 && cap.missing == 0);
+    SIM_CHECK(cap.checked >= (uint64_t)opt.ms * CAPTURE_NOMINAL * 9 / 10);
+    SIM_CHECK(cap.empty == 0);
+#endif
+#undef SIM_CHECK
+    printf("%s\n", failures ? "FAILED" : "ok");
+    return failures ? 1 : 0;
+}
+
+//--------------------------------------------------------------------+
+// Main
+//--------------------------------------------------------------------+
+
+static void usage(void) {
+    printf("usage: sim_audio [--latency low|balanced|standard|robust] "
+           "[--rate HZ] [--bits 24|16] [--ppm N]\n"
+           "         [--jitter US] [--drop PER_10000] [--ms MS] [--seed N]\n"
+           "         [--period FRAMES] [--periods N] [--target BYTES]\n"
+           "         [--ignore-feedback] [--check | --expect-underruns] "
+           "[--verbose]\n");
+}
+
+static bool parse_latency(const char *s) {
+    for (uint8_t id = 0; id < AUDIO_LATENCY_COUNT; id++) {
+        if (!strcmp(s, audio_latency_table(id)->name)) {
+            opt.latency = id;
+            return true;
+        }
+    }
+    char *end;
+    unsigned long id = strtoul(s, &end, 0);
+    if (*end || id >= AUDIO_LATENCY_COUNT)
+        return false;
+    opt.latency = (uint8_t)id;
+    return true;
+}
+
+static bool parse_args(int argc, char **argv) {
+    for (int i = 1; i < argc; i++) {
+        const char *a = argv[i];
+        const char *v = i + 1 < argc ? argv[i + 1] : NULL;
+        if (!strcmp(a, "--check")) {
+            opt.check = true;
+        } else if (!strcmp(a, "--expect-underruns")) {
+            opt.expect_underruns = true;
+        } else if (!strcmp(a, "--verbose")) {
+            opt.verbose = true;
+        } else if (!strcmp(a, "--ignore-feedback")) {
+            opt.ignore_feedback = true;
+        } else if (!v) {
+            return false;
+        } else if (!strcmp(a, "--latency")) {
+            if (!parse_latency(v))
+                return false;
+            i++;
+        } else {
+            long n = strtol(v, NULL, 0);
+            if (!strcmp(a, "--rate"))
+                opt.rate = (uint32_t)n;
+            else if (!strcmp(a, "--bits"))
+                opt.bits = (uint8_t)n;
+            else if (!strcmp(a, "--ppm"))
+                opt.ppm = (int32_t)n;
+            else if (!strcmp(a, "--jitter"))
+                opt.jitter_us = (uint32_t)n;
+            else if (!strcmp(a, "--drop"))
+                opt.drop = (uint32_t)n;
+            else if (!strcmp(a, "--ms"))
+                opt.ms = (uint32_t)n;
+            else if (!strcmp(a, "--seed"))
+                opt.seed = (uint32_t)n;
+            else if (!strcmp(a, "--period"))
+                opt.period_frames = (int32_t)n;
+            else if (!strcmp(a, "--periods"))
+                opt.periods = (int32_t)n;
+            else if (!strcmp(a, "--target"))
+                opt.target = (int32_t)n;
+            else
+                return false;
+            i++;
+        }
+    }
+    // 16-bit: native rates only, without the converter (see the top of the
+    // file)
+    return opt.bits == 24 ||
+           (opt.bits == 16 && audio_latency_i2s_rate(opt.rate) == opt.rate &&
+            !opt.ignore_feedback);
+}
+
+// Apply the preset overrides; false if the ring or FIFO can't hold them
+static bool tune_preset(void) {
+    tuned = *audio_latency_table(opt.latency);
+    if (opt.period_frames >= 0)
+        tuned.period_frames = (uint16_t)opt.period_frames;
+    if (opt.periods >= 0)
+        tuned.periods = (uint8_t)opt.periods;
+    if (opt.target >= 0)
+        tuned.fifo_target = (uint16_t)opt.target;
+    tuned_on = true;
+    return tuned.periods >= 2 && tuned.periods <= AUDIO_LATENCY_MAX_PERIODS &&
+           tuned.period_frames >= 8 &&
+           tuned.period_frames * tuned.periods <= AUDIO_LATENCY_MAX_RING_FRAMES &&
+           tuned.fifo_target % AUDIO_LATENCY_FRAME_BYTES == 0 &&
+           tuned.fifo_target < FIFO_DEPTH;
+}
+
+int main(int argc, char **argv) {
+    if (!parse_args(argc, argv)) {
+        usage();
+        return 2;
+    }
+    if (!tune_preset()) {
+        printf("preset override out of range: ring of 2..%d periods, up to "
+               "%d frames; FIFO target in whole frames below %d bytes\n",
+               AUDIO_LATENCY_MAX_PERIODS, AUDIO_LATENCY_MAX_RING_FRAMES,
+               FIFO_DEPTH);
+        return 2;
+    }
+    rng_state = opt.seed ? opt.seed : 1;
+    memset(&m, 0, sizeof(m));
+    m.level_min = UINT32_MAX;
+    m.fill_min = UINT32_MAX;
+    host.counter = COUNTER_BASE;
+    dac.expect = 0;
+    tu_fifo_config(&ep_out_ff, ep_out_buf, FIFO_DEPTH, false);
+#if USB_AUDIO_LOOPBACK
+    tu_fifo_config(&ep_in_ff, ep_in_buf, CAPTURE_DEPTH, true);
+#endif
+
+    dma_set_rate(hi2s1.Init.AudioFreq);
+
+    // Boot: profile requested before the ring runs (switched by the audio
+    // stage), then init runs the ring and settles the DAC for 500ms
+    audio_output_set_latency(opt.latency);
+    audio_output_init();
+    sim_run(now_ns + 100 * MS);
+    if (audio_output_get_latency() != opt.latency) {
+        printf("FAIL: ring did not switch to preset %u\n",
+               (unsigned)opt.latency);
+        return 1;
+    }
+
+    // Host opens the stream on the next frame
+    m.open_ns = now_ns;
+    host.frame = (uint32_t)(now_ns / MS) + 1;
+    host.fb = ((opt.rate / 100U) << 16) / 10U;
+    dac.resampled = audio_latency_i2s_rate(opt.rate) != opt.rate ||
+                    opt.ignore_feedback;
+    stream_open = true;
+    stream_set_itf(stream_alt());
+    if (opt.rate != AUDIO_LATENCY_RATE && !stream_set_rate(opt.rate)) {
+        printf("FAIL: rate %u rejected\n", (unsigned)opt.rate);
+        return 1;
+    }
+#if USB_AUDIO_LOOPBACK
+    if (!capture_set_rate(USB_AUDIO_CAPTURE_RATE) ||
+        capture_set_rate(44100)) {
+        printf("FAIL: capture rate handling\n");
+        return 1;
+    }
+#endif
+    sim_run(now_ns + (int64_t)opt.ms * MS);
+
+    // Close, and let the ring play out the tail
+    stream_end = now_ns;
+    stream_set_itf(0);
+    sim_run(now_ns + 50 * MS);
+
+    return report();
+}
@@ -1,7 +1,10 @@
 // SPDX-License-Identifier: GPL-3.0-only
 // Copyright (c) 2026 Elia Chiarucci
 
-/* SEGGER RTT stub for host-side unit tests: logging is a no-op. */
+/*
+ * SEGGER RTT stub for host-side unit tests: logging is a no-op. The
+ * up-buffer calls trace.c makes are left to its test to define.
+ */
 
 #ifndef SEGGER_RTT_STUB_H
 #define SEGGER_RTT_STUB_H
@@ -13,4 +16,12 @@ static inline int SEGGER_RTT_printf(unsigned buffer_index, const char *fmt,
     return 0;
 }
 
+#define SEGGER_RTT_MODE_NO_BLOCK_SKIP 0
+
+int SEGGER_RTT_ConfigUpBuffer(unsigned BufferIndex, const char *sName,
+                              void *pBuffer, unsigned BufferSize,
+                              unsigned Flags);
+unsigned SEGGER_RTT_WriteNoLock(unsigned BufferIndex, const void *pBuffer,
+                                unsigned NumBytes);
+
 #endif // SEGGER_RTT_STUB_H
@@ -0,0 +1,298 @@
+// SPDX-License-Identifier: GPL-3.0-only
+// Copyright (c) 2026 Elia Chiarucci
+
+/*
+ * Host-side simulation of the adaptive clock loop
+ * (App/Src/audio_adaptive.c).
+ *
+ * The host sends exactly rate / 1000 frames per 1ms frame, each packet
+ * landing late by a random 0..jitter_us. The DAC clock is the PLL2 model of
+ * audio_pll.h: nominal, off by the HSI's error, pulled by the loop's
+ * correction rounded to whole FRACN steps and held within their range. The
+ * output prebuffers to the target, then plays a ring of RING_PERIODS
+ * periods primed with silence, refilling each from the FIFO as the DMA
+ * finishes it; a period with too little in the FIFO is an underrun, a
+ * packet that doesn't fit an overflow.
+ *
+ * --verbose prints each run.
+ */
+
+#include "audio_adaptive.h"
+#include "audio_pll.h"
+#include "test_util.h"
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#define FIFO_BYTES    (16 * 294) // CFG_TUD_AUDIO_FUNC_1_EP_OUT_SW_BUF_SZ
+#define PERIOD_MS     2          // drained per DMA period
+#define TARGET_MS     4          // FIFO target: the "low" latency preset's depth
+#define RING_PERIODS  2
+
+static bool verbose = false;
+
+static uint32_t rng_state = 0x13579BDu;
+
+static uint32_t rng(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+typedef struct {
+    uint32_t rate;
+    uint8_t frame_bytes;
+    uint32_t jitter_us;
+    double hsi_ppm;    // oscillator error, may change mid-run
+    int32_t target;    // prebuffer, bytes
+    // State
+    audio_adaptive_t ad;
+    double clock_ppm;  // DAC clock off nominal: HSI + the applied steps
+    double t_us;       // last event
+    double dac_frames; // played since draining started
+    uint32_t periods;  // played
+    int32_t level;     // FIFO bytes
+    bool draining;
+    uint32_t ms;
+    // Results
+    uint32_t underruns, overflows;
+    int32_t slew_max_acq_q8, slew_max_track_q8;
+    int32_t level_min, level_max; // while tracking
+    uint32_t measure_from; // ms: residual averaged from here
+    double resid_sum;
+    uint32_t resid_n;
+} run_t;
+
+static void run_init(run_t *r, uint32_t rate, uint8_t frame_bytes,
+                     uint32_t jitter_us, double hsi_ppm, int32_t start_q8) {
+    memset(r, 0, sizeof(*r));
+    r->rate = rate;
+    r->frame_bytes = frame_bytes;
+    r->jitter_us = jitter_us;
+    r->hsi_ppm = hsi_ppm;
+    r->target = (int32_t)(rate / 1000 * TARGET_MS * frame_bytes);
+    audio_adaptive_init(&r->ad, rate, frame_bytes, start_q8, AUDIO_PLL_MIN_Q8,
+                        AUDIO_PLL_MAX_Q8);
+    r->level_min = INT32_MAX;
+    r->level_max = INT32_MIN;
+}
+
+// The DAC clock for a correction, as audio_pll_set_ppm() sets it
+static double pll_ppm(int32_t ppm_q8) {
+    double steps = round(ppm_q8 / 256.0 * AUDIO_PLL_STEPS / 1e6);
+    if (steps < -AUDIO_PLL_FRACN_CENTER)
+        steps = -AUDIO_PLL_FRACN_CENTER;
+    if (steps > AUDIO_PLL_FRACN_MAX - AUDIO_PLL_FRACN_CENTER)
+        steps = AUDIO_PLL_FRACN_MAX - AUDIO_PLL_FRACN_CENTER;
+    return steps * 1e6 / AUDIO_PLL_STEPS;
+}
+
+// Play up to t_us: every whole period the DMA finishes is refilled from the
+// FIFO
+static void dac_advance(run_t *r, double t_us) {
+    if (r->draining) {
+        double fps = r->rate * (1.0 + (r->hsi_ppm + r->clock_ppm) * 1e-6);
+        r->dac_frames += (t_us - r->t_us) * fps / 1e6;
+        int32_t period = (int32_t)(r->rate / 1000 * PERIOD_MS * r->frame_bytes);
+        while (r->dac_frames >= (double)(r->periods + 1) * r->rate / 1000 * PERIOD_MS) {
+            r->periods++;
+            if (r->level < period)
+                r->underruns++; // concealed; the FIFO keeps what it had
+            else
+                r->level -= period;
+        }
+    }
+    r->t_us = t_us;
+}
+
+static void run_ms(run_t *r, uint32_t ms) {
+    int32_t packet = (int32_t)(r->rate / 1000 * r->frame_bytes);
+    for (uint32_t end = r->ms + ms; r->ms < end; r->ms++) {
+        double t = r->ms * 1000.0 + (r->jitter_us ? rng() % r->jitter_us : 0);
+        dac_advance(r, t);
+
+        if (r->level + packet > FIFO_BYTES)
+            r->overflows++;
+        else
+            r->level += packet;
+        if (!r->draining && r->level >= r->target) {
+            r->draining = true; // prebuffered
+            r->dac_frames = 0;
+            r->periods = 0;
+        }
+
+        int32_t prev = audio_adaptive_ppm_q8(&r->ad);
+        bool tracking = r->ad.stats.state == AUDIO_AD_TRACKING;
+        // The ring ahead of the DMA: the rest of the period it plays and
+        // the others
+        double period_frames = (double)r->rate / 1000 * PERIOD_MS;
+        double ring = (r->periods + RING_PERIODS) * period_frames - r->dac_frames;
+        uint32_t ring_q8 = r->draining ? (uint32_t)(ring * 256) : 0;
+        if (audio_adaptive_packet(&r->ad, (uint16_t)r->level, ring_q8,
+                                  r->draining)) {
+            int32_t now = audio_adaptive_ppm_q8(&r->ad);
+            int32_t step = now > prev ? now - prev : prev - now;
+            int32_t *max = tracking ? &r->slew_max_track_q8 : &r->slew_max_acq_q8;
+            if (step > *max)
+                *max = step;
+            r->clock_ppm = pll_ppm(now);
+        }
+        if (r->ms >= r->measure_from) {
+            r->resid_sum += r->hsi_ppm + r->clock_ppm;
+            r->resid_n++;
+        }
+        if (r->ad.stats.state == AUDIO_AD_TRACKING) {
+            if (r->level < r->level_min)
+                r->level_min = r->level;
+            if (r->level > r->level_max)
+                r->level_max = r->level;
+        }
+    }
+}
+
+// Residual clock error since measure_from (DAC against host), ppm
+static double residual_ppm(const run_t *r) {
+    return r->resid_n ? r->resid_sum / r->resid_n : 0.0;
+}
+
+// Average the residual over the next ms
+static void measure_ms(run_t *r, uint32_t ms) {
+    r->measure_from = r->ms;
+    r->resid_sum = 0.0;
+    r->resid_n = 0;
+    run_ms(r, ms);
+}
+
+static void report(const char *name, const run_t *r) {
+    if (!verbose)
+        return;
+    printf("  %-10s %6u Hz %+6.0f ppm: lock %5u ms, residual %+.1f ppm, "
+           "level %d..%d (target %u), err %d..%d us, %u underruns, "
+           "%u overflows, slew %d/%d q8\n",
+           name, (unsigned)r->rate, r->hsi_ppm, (unsigned)r->ad.stats.lock_ms,
+           residual_ppm(r), r->level_min, r->level_max, r->target,
+           (int)r->ad.stats.error_min_us, (int)r->ad.stats.error_max_us,
+           (unsigned)r->underruns, (unsigned)r->overflows,
+           (int)r->slew_max_acq_q8, (int)r->slew_max_track_q8);
+}
+
+static void test_holds_while_prebuffering(void) {
+    audio_adaptive_t ad;
+    audio_adaptive_init(&ad, 48000, 6, 512, AUDIO_PLL_MIN_Q8,
+                        AUDIO_PLL_MAX_Q8);
+    CHECK_EQ_I32(audio_adaptive_ppm_q8(&ad), 512);
+    for (int i = 0; i < 100; i++)
+        CHECK(!audio_adaptive_packet(&ad, (uint16_t)(i * 288 % 4000), 0, false));
+    CHECK_EQ_I32(ad.stats.state, AUDIO_AD_IDLE);
+    CHECK_EQ_I32(audio_adaptive_ppm_q8(&ad), 512);
+
+    // The start is held within range
+    audio_adaptive_init(&ad, 48000, 6, INT32_MAX, AUDIO_PLL_MIN_Q8,
+                        AUDIO_PLL_MAX_Q8);
+    CHECK_EQ_I32(audio_adaptive_ppm_q8(&ad), AUDIO_PLL_MAX_Q8);
+}
+
+// From the PLL's nominal, across the HSI's error range: pulled in with no
+// underrun or overflow, then tracking with the clock matched
+static void test_pull_in(void) {
+    static const struct {
+        uint32_t rate;
+        uint8_t frame_bytes;
+        double hsi_ppm;
+    } cases[] = {
+        {48000, 6, 0},     {48000, 6, 2500},  {48000, 6, -2500},
+        {48000, 6, 7000},  {48000, 6, -7000}, {96000, 6, 5000},
+        {96000, 4, -5000}, {48000, 4, 1200},
+    };
+    for (unsigned i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        run_t r;
+        run_init(&r, cases[i].rate, cases[i].frame_bytes, 500,
+                 cases[i].hsi_ppm, 0);
+        run_ms(&r, 40000);
+        measure_ms(&r, 20000);
+        report("pull-in", &r);
+
+        CHECK_EQ_I32(r.underruns, 0);
+        CHECK_EQ_I32(r.overflows, 0);
+        CHECK_EQ_I32(r.ad.stats.state, AUDIO_AD_TRACKING);
+        CHECK(r.ad.stats.lock_ms > 0 && r.ad.stats.lock_ms < 10000);
+        CHECK_EQ_I32(r.ad.stats.unlocks, 0);
+
+        // Matched to a couple of FRACN steps, the queue within a packet or
+        // so of its target, and the slew within its limits
+        CHECK(fabs(residual_ppm(&r)) < 4.0);
+        CHECK(r.ad.stats.error_min_us > -1000 && r.ad.stats.error_max_us < 1000);
+        CHECK(r.slew_max_acq_q8 <= AUDIO_AD_SLEW_ACQUIRE);
+        CHECK(r.slew_max_track_q8 <= AUDIO_AD_SLEW_TRACK);
+    }
+}
+
+// The next stream starts from the last one's correction: tracking within
+// the lock window, the queue barely moving
+static void test_warm_start(void) {
+    run_t r;
+    run_init(&r, 48000, 6, 500, -6000, 0);
+    run_ms(&r, 30000);
+    int32_t learnt = audio_adaptive_ppm_q8(&r.ad);
+
+    run_init(&r, 48000, 6, 500, -6000, learnt);
+    r.clock_ppm = pll_ppm(learnt);
+    run_ms(&r, 2000);
+    measure_ms(&r, 10000);
+    report("warm", &r);
+    CHECK(r.ad.stats.lock_ms > 0 && r.ad.stats.lock_ms < 2000);
+    CHECK_EQ_I32(r.underruns, 0);
+    CHECK(fabs(residual_ppm(&r)) < 4.0);
+}
+
+// Beyond the range (an oscillator far off) the output saturates; with the
+// integrator held it recovers as soon as the error is in range again,
+// rather than unwinding what it would have accumulated
+static void test_saturation_recovers(void) {
+    run_t r;
+    run_init(&r, 48000, 6, 500, -9000, 0); // needs +9000: max is ~+7560
+    run_ms(&r, 5000);
+    CHECK(r.ad.stats.saturated > 0);
+    CHECK_EQ_I32(audio_adaptive_ppm_q8(&r.ad), AUDIO_PLL_MAX_Q8);
+    CHECK(r.ad.integ_q16 <= (int64_t)AUDIO_PLL_MAX_Q8 << 8);
+
+    // The FIFO ran dry meanwhile; it is refilled, and the oscillator is
+    // back within range
+    r.hsi_ppm = -6000;
+    r.level = r.target;
+    uint32_t underruns = r.underruns;
+    run_ms(&r, 20000);
+    measure_ms(&r, 10000);
+    report("saturated", &r);
+    CHECK_EQ_I32(r.ad.stats.state, AUDIO_AD_TRACKING);
+    CHECK_EQ_I32(r.underruns, underruns);
+    CHECK(fabs(residual_ppm(&r)) < 4.0);
+}
+
+// A step of the oscillator (temperature) while tracking: followed without
+// an underrun, within the slow gear if small
+static void test_tracks_drift(void) {
+    run_t r;
+    run_init(&r, 48000, 6, 500, 1500, 0);
+    run_ms(&r, 20000);
+    CHECK_EQ_I32(r.ad.stats.state, AUDIO_AD_TRACKING);
+    r.hsi_ppm += 20;
+    run_ms(&r, 20000);
+    measure_ms(&r, 20000);
+    report("drift", &r);
+    CHECK_EQ_I32(r.ad.stats.unlocks, 0);
+    CHECK_EQ_I32(r.underruns, 0);
+    CHECK(fabs(residual_ppm(&r)) < 4.0);
+}
+
+int main(int argc, char **argv) {
+    verbose = argc > 1 && strcmp(argv[1], "--verbose") == 0;
+    test_holds_while_prebuffering();
+    test_pull_in();
+    test_warm_start();
+    test_saturation_recovers();
+    test_tracks_drift();
+    return test_summary("audio_adaptive");
+}
@@ -0,0 +1,467 @@
+// SPDX-License-Identifier: GPL-3.0-only
+// Copyright (c) 2026 Elia Chiarucci
+
+/*
+ * Host-side tests for the asynchronous sample-rate converter
+ * (App/Src/audio_asrc.c)
+ *
+ * The converter: frame accounting at any position and ratio, the in-place
+ * layouts the audio stage uses, a seamless start from the direct path, and
+ * the error across the band at the ends of the ratio range, measured as in
+ * tests/test_audio_resample.c (tones on FFT bins of the output,
+ * Blackman-Harris windowed, everything else below 20kHz summed). The
+ * monitor: no engaging on a host that obeys the feedback, however it rounds
+ * its packets, with the level wandering around the target; each reason on
+ * its own; and the loop holding the queue of a host that ignores feedback.
+ *
+ * --verbose prints the figures per tone.
+ */
+
+#include "audio_asrc.h"
+#include "test_util.h"
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define FS      48000.0
+#define N       8192   // output frames analysed
+#define PREROLL 256    // output frames before them (the history fills)
+#define AMP     4194304.0 // -6dBFS in 24 bits
+#define CHUNK   96     // output frames per call, as a standard period
+
+#define TONE_BINS 8 // either side of the tone: the window's main lobe
+
+#define ERROR_DB_MAX -88.0
+
+#define FRAME_BYTES 6
+#define TARGET       144.0 // FIFO target, frames: 3ms
+#define TARGET_BYTES (144 * FRAME_BYTES)
+
+static bool verbose = false;
+
+static uint32_t rng_state = 0x2545F491u;
+
+static uint32_t rng(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+static int32_t rng_ppm_q8(void) {
+    return (int32_t)(rng() % (2 * AUDIO_ASRC_RANGE_Q8 + 1)) -
+           AUDIO_ASRC_RANGE_Q8;
+}
+
+//--------------------------------------------------------------------+
+// Converter
+//--------------------------------------------------------------------+
+
+static void test_frame_accounting(void) {
+    audio_asrc_t as;
+    audio_asrc_reset(&as);
+    CHECK_EQ_I32(audio_asrc_needed(&as, CHUNK), CHUNK);
+    CHECK_EQ_I32(audio_asrc_possible(&as, CHUNK), CHUNK);
+
+    // From anywhere in the range: possible() is the most outputs needed()
+    // allows
+    for (int i = 0; i < 2000; i++) {
+        audio_asrc_set_ppm(&as, rng_ppm_q8());
+        as.ahead_q32 = ((uint64_t)rng() << 32 | rng()) %
+                       ((uint64_t)(AUDIO_ASRC_TAPS / 2 + 1) << 32);
+        uint16_t in = (uint16_t)(rng() % 240);
+        uint16_t n = audio_asrc_possible(&as, in);
+        CHECK(audio_asrc_needed(&as, n) <= in);
+        CHECK(audio_asrc_needed(&as, (uint16_t)(n + 1)) > in);
+        // The start and the top of the range stay within the spill
+        CHECK(audio_asrc_needed(&as, 192) <= 192 + AUDIO_ASRC_EXTRA_FRAMES);
+    }
+
+    // Runs take exactly what needed() said: 10s at +1000ppm takes 480
+    // frames more than it plays (less the step's rounding)
+    static int32_t in[2 * (CHUNK + AUDIO_ASRC_EXTRA_FRAMES)], out[2 * CHUNK];
+    memset(in, 0, sizeof(in));
+    audio_asrc_reset(&as);
+    audio_asrc_set_ppm(&as, AUDIO_ASRC_RANGE_Q8);
+    uint32_t taken = 0;
+    for (int i = 0; i < 5000; i++) {
+        uint16_t need = audio_asrc_needed(&as, CHUNK);
+        taken += need;
+        audio_asrc_process(&as, in, need, NULL, out, CHUNK);
+    }
+    CHECK(taken == 480000 + 480 || taken == 480000 + 479);
+}
+
+static void fill_source(int32_t *src, uint32_t frames) {
+    for (uint32_t i = 0; i < frames; i++) {
+        src[2 * i] = (int32_t)(AMP * sin(i * 0.37));
+        src[2 * i + 1] = (int32_t)(AMP * cos(i * 0.11));
+    }
+}
+
+static void test_in_place_matches(void) {
+    static int32_t src[2 * 8192];
+    static int32_t a[2 * CHUNK], b[2 * CHUNK];
+    static int32_t spill[2 * AUDIO_ASRC_EXTRA_FRAMES];
+    fill_source(src, 8192);
+
+    const int32_t ppm[] = {0, AUDIO_ASRC_RANGE_Q8, -AUDIO_ASRC_RANGE_Q8,
+                           333 * 256};
+    for (unsigned k = 0; k < sizeof(ppm) / sizeof(ppm[0]); k++) {
+        audio_asrc_t ra, rb;
+        audio_asrc_reset(&ra);
+        audio_asrc_prime(&ra, src, 64);
+        audio_asrc_set_ppm(&ra, ppm[k]);
+        audio_asrc_start(&ra);
+        rb = ra;
+        uint32_t pos = 64;
+        for (int chunk = 0; chunk < 60; chunk++) {
+            uint16_t out = (uint16_t)(CHUNK - chunk % 5 * 9); // partial too
+            uint16_t need = audio_asrc_needed(&ra, out);
+            audio_asrc_process(&ra, &src[2 * pos], need, NULL, a, out);
+
+            // As the audio stage lays it out: in the tail if the inputs
+            // fit, else from the start with the rest in the spill
+            if (need <= out) {
+                int32_t *tail = &b[2 * (out - need)];
+                memcpy(tail, &src[2 * pos], need * 2 * sizeof(int32_t));
+                audio_asrc_process(&rb, tail, need, NULL, b, out);
+            } else {
+                CHECK(need - out <= (int)AUDIO_ASRC_EXTRA_FRAMES);
+                memcpy(b, &src[2 * pos], out * 2 * sizeof(int32_t));
+                memcpy(spill, &src[2 * (pos + out)],
+                       (need - out) * 2 * sizeof(int32_t));
+                audio_asrc_process(&rb, b, out, spill, b, out);
+            }
+            CHECK(memcmp(a, b, out * 2 * sizeof(int32_t)) == 0);
+            pos += need;
+        }
+    }
+}
+
+static void test_seamless_start(void) {
+    // The direct path played frames 0 .. 299 of a 1kHz tone; the converter
+    // takes over at ratio 1 and carries on from frame 300, to within the
+    // filter's error
+    static int32_t src[2 * 1024], out[2 * CHUNK];
+    for (int i = 0; i < 1024; i++) {
+        src[2 * i] = (int32_t)lrint(AMP * sin(2.0 * M_PI * 1000.0 * i / FS));
+        src[2 * i + 1] = -src[2 * i];
+    }
+    audio_asrc_t as;
+    audio_asrc_reset(&as);
+    audio_asrc_prime(&as, src, 300);
+    audio_asrc_start(&as);
+    uint16_t need = audio_asrc_needed(&as, CHUNK);
+    CHECK_EQ_I32(need, CHUNK + AUDIO_ASRC_TAPS / 2 - 1);
+    audio_asrc_process(&as, &src[600], need, NULL, out, CHUNK);
+
+    double worst = 0.0;
+    for (int i = 0; i < CHUNK; i++) {
+        double err = fabs((double)out[2 * i] - src[2 * (300 + i)]);
+        if (err > worst)
+            worst = err;
+    }
+    if (verbose)
+        printf("  start: worst error %.1f LSB\n", worst);
+    CHECK(worst < AMP * 1e-4);
+}
+
+// --- Spectral measurement ---
+
+static double fft_re[N], fft_im[N];
+
+// 4-term Blackman-Harris: sidelobes below -92dB
+static double window(uint32_t i) {
+    double x = 2.0 * M_PI * i / N;
+    return 0.35875 - 0.48829 * cos(x) + 0.14128 * cos(2.0 * x) -
+           0.01168 * cos(3.0 * x);
+}
+
+// In place, radix 2
+static void fft(double *re, double *im) {
+    for (uint32_t i = 1, j = 0; i < N; i++) {
+        uint32_t bit = N >> 1;
+        for (; j & bit; bit >>= 1)
+            j ^= bit;
+        j |= bit;
+        if (i < j) {
+            double t = re[i];
+            re[i] = re[j];
+            re[j] = t;
+            t = im[i];
+            im[i] = im[j];
+            im[j] = t;
+        }
+    }
+    for (uint32_t len = 2; len <= N; len <<= 1) {
+        double ang = -2.0 * M_PI / len;
+        for (uint32_t i = 0; i < N; i += len) {
+            for (uint32_t k = 0; k < len / 2; k++) {
+                double wr = cos(ang * k), wi = sin(ang * k);
+                uint32_t a = i + k, b = a + len / 2;
+                double xr = re[b] * wr - im[b] * wi;
+                double xi = re[b] * wi + im[b] * wr;
+                re[b] = re[a] - xr;
+                im[b] = im[a] - xi;
+                re[a] += xr;
+                im[a] += xi;
+            }
+        }
+    }
+}
+
+// Convert a tone landing on output bin `bin` at ratio 1 + ppm_q8; the
+// power of all other bins up to 20kHz, dB relative to the tone
+static double measure_tone(uint32_t bin, int32_t ppm_q8) {
+    static int32_t in[2 * (N + PREROLL + 64)], out[2 * CHUNK];
+    double ratio = 1.0 + ppm_q8 / 256e6;
+    double f = bin * FS / N / ratio; // input Hz
+    audio_asrc_t as;
+    audio_asrc_reset(&as);
+    audio_asrc_set_ppm(&as, ppm_q8);
+
+    uint32_t frames_in = (uint32_t)((N + PREROLL) * ratio) + 32;
+    for (uint32_t i = 0; i < frames_in; i++) {
+        double x = AMP * sin(2.0 * M_PI * f * i / FS);
+        in[2 * i] = (int32_t)lrint(x);
+        in[2 * i + 1] = -in[2 * i];
+    }
+
+    uint32_t pos = 0, done = 0;
+    while (done < N + PREROLL) {
+        uint16_t need = audio_asrc_needed(&as, CHUNK);
+        audio_asrc_process(&as, &in[2 * pos], need, NULL, out, CHUNK);
+        pos += need;
+        for (uint16_t i = 0; i < CHUNK; i++, done++) {
+            if (done >= PREROLL && done < N + PREROLL) {
+                fft_re[done - PREROLL] = out[2 * i] * window(done - PREROLL);
+                fft_im[done - PREROLL] = 0.0;
+                CHECK_EQ_I32(out[2 * i + 1], -out[2 * i]);
+            }
+        }
+    }
+    fft(fft_re, fft_im);
+
+    double tone = 0.0, rest = 0.0;
+    uint32_t top = (uint32_t)(20000.0 * N / FS);
+    for (uint32_t k = 1; k <= top + TONE_BINS; k++) {
+        double p = fft_re[k] * fft_re[k] + fft_im[k] * fft_im[k];
+        if (k + TONE_BINS >= bin && k <= bin + TONE_BINS)
+            tone += p;
+        else if (k <= top)
+            rest += p;
+    }
+    return 10.0 * log10((rest + 1e-30) / tone);
+}
+
+static void test_error_across_band(void) {
+    // 20Hz .. 20kHz (bins of 5.86Hz), at the ends of the range and between
+    const uint32_t bins[] = {4, 171, 853, 1707, 2560, 3072, 3413};
+    const int32_t ppm[] = {AUDIO_ASRC_RANGE_Q8, -AUDIO_ASRC_RANGE_Q8,
+                           77 * 256 + 19};
+    double worst = -200.0;
+    for (unsigned r = 0; r < sizeof(ppm) / sizeof(ppm[0]); r++) {
+        for (unsigned i = 0; i < sizeof(bins) / sizeof(bins[0]); i++) {
+            double e = measure_tone(bins[i], ppm[r]);
+            if (verbose)
+                printf("  %+8.2f ppm %8.1f Hz: error %.1f dB\n",
+                       ppm[r] / 256.0, bins[i] * FS / N, e);
+            if (e > worst)
+                worst = e;
+        }
+    }
+    printf("error into 0-20kHz %.1f dB\n", worst);
+    CHECK(worst < ERROR_DB_MAX);
+}
+
+//--------------------------------------------------------------------+
+// Monitor and ratio loop
+//--------------------------------------------------------------------+
+
+// A packet of sent frames, asked for at asked frames per packet, leaving
+// the queue all in the FIFO
+static bool packet_sent(audio_asrc_ctl_t *ctl, uint16_t sent, double asked,
+                        double queue_frames, bool underrun) {
+    uint16_t bytes = (uint16_t)(queue_frames > 0 ? queue_frames : 0) *
+                     FRAME_BYTES;
+    uint32_t ring_q8 =
+        (uint32_t)((queue_frames - floor(queue_frames)) * 256.0);
+    return audio_asrc_ctl_packet(ctl, sent * FRAME_BYTES,
+                                 (uint32_t)lrint(asked * 65536.0), bytes,
+                                 ring_q8, true, underrun);
+}
+
+// ... from a host sending what the feedback asks, 48 frames
+static bool packet(audio_asrc_ctl_t *ctl, double queue_frames, bool underrun) {
+    return packet_sent(ctl, 48, 48.0, queue_frames, underrun);
+}
+
+static void test_monitor_steady(void) {
+    // The level wandering +-0.5ms around the target, for a minute: never
+    // engages
+    audio_asrc_ctl_t ctl;
+    audio_asrc_ctl_init(&ctl, 48000, FRAME_BYTES, TARGET_BYTES);
+    CHECK(!audio_asrc_ctl_packet(&ctl, 288, 48 << 16, 600, 0, false,
+                                 true)); // prebuffering
+    for (int i = 0; i < 60000; i++)
+        CHECK(!packet(&ctl, TARGET + 24.0 * sin(i * 0.013) + (rng() % 8) - 4,
+                      false));
+    CHECK(!audio_asrc_ctl_engaged(&ctl));
+    CHECK_EQ_I32(audio_asrc_ctl_ppm_q8(&ctl), 0);
+    CHECK_EQ_I32(ctl.stats.reason, AUDIO_ASRC_OFF);
+
+    // Obeying a feedback 300ppm either way of 48 and changing, rounding
+    // each packet to whole frames (48 or 49, 47 or 48), from the start
+    const double off[] = {300e-6, -300e-6};
+    for (unsigned k = 0; k < 2; k++) {
+        audio_asrc_ctl_init(&ctl, 48000, FRAME_BYTES, TARGET_BYTES);
+        double acc = 0.0;
+        for (int i = 0; i < 60000; i++) {
+            double asked = 48.0 * (1.0 + off[k] + 50e-6 * sin(i * 0.001));
+            acc += asked;
+            uint16_t sent = (uint16_t)floor(acc);
+            acc -= sent;
+            CHECK(!packet_sent(&ctl, sent, asked, TARGET, false));
+        }
+        CHECK(!audio_asrc_ctl_engaged(&ctl));
+        CHECK(abs(ctl.stats.owed_us) < 25);
+    }
+}
+
+static void test_monitor_reasons(void) {
+    audio_asrc_ctl_t ctl;
+
+    // Ignored: 7.2 frames owed after the settling, 500 packets at 300ppm,
+    // either way, long before the level moves
+    const double off[] = {300e-6, -300e-6};
+    for (unsigned k = 0; k < 2; k++) {
+        audio_asrc_ctl_init(&ctl, 48000, FRAME_BYTES, TARGET_BYTES);
+        int engaged_at = -1;
+        for (int i = 0; i < 10000 && engaged_at < 0; i++) {
+            if (packet_sent(&ctl, 48, 48.0 * (1.0 + off[k]), TARGET, false))
+                engaged_at = i;
+        }
+        CHECK_EQ_I32(ctl.stats.reason, AUDIO_ASRC_IGNORED);
+        CHECK(engaged_at >= AUDIO_ASRC_SETTLE_PACKETS + 495 &&
+              engaged_at <= AUDIO_ASRC_SETTLE_PACKETS + 505);
+        CHECK(k == 0 ? ctl.stats.owed_us >= AUDIO_ASRC_OWED_US - 1
+                     : ctl.stats.owed_us <= -AUDIO_ASRC_OWED_US + 1);
+        CHECK(abs(ctl.stats.engage_drift_us) < 10);
+    }
+
+    // The backstops, for a level that moves with the packets obeying:
+    // draining at 300ppm, a third of the 3ms target is 48 frames, 3.3s in
+    audio_asrc_ctl_init(&ctl, 48000, FRAME_BYTES, TARGET_BYTES);
+    double q = TARGET;
+    int engaged_at = -1;
+    for (int i = 0; i < 10000 && engaged_at < 0; i++) {
+        if (packet(&ctl, q, false))
+            engaged_at = i;
+        q -= 48.0 * 300e-6;
+    }
+    CHECK(audio_asrc_ctl_engaged(&ctl));
+    CHECK_EQ_I32(ctl.stats.reason, AUDIO_ASRC_DRAINING);
+    CHECK(engaged_at > 3300 && engaged_at < 3700);
+    CHECK(ctl.stats.engage_drift_us <= -1000);
+    CHECK_EQ_I32(ctl.stats.engage_ms, engaged_at + 1);
+
+    // Filling: half the target, 1.5ms, 5s in
+    audio_asrc_ctl_init(&ctl, 48000, FRAME_BYTES, TARGET_BYTES);
+    q = TARGET;
+    engaged_at = -1;
+    for (int i = 0; i < 10000 && engaged_at < 0; i++) {
+        if (packet(&ctl, q, false))
+            engaged_at = i;
+        q += 48.0 * 300e-6;
+    }
+    CHECK_EQ_I32(ctl.stats.reason, AUDIO_ASRC_FILLING);
+    CHECK(engaged_at > 5000 && engaged_at < 5400);
+    CHECK(ctl.stats.engage_drift_us >= 1500);
+
+    // A small target still leaves AUDIO_ASRC_FILL_MIN_US of room to fill
+    // (72 frames)
+    audio_asrc_ctl_init(&ctl, 48000, FRAME_BYTES, 48 * FRAME_BYTES);
+    for (int i = 0; i < 1000; i++)
+        CHECK(!packet(&ctl, 48.0 + 71.0, false));
+    engaged_at = -1;
+    for (int i = 0; i < 1000 && engaged_at < 0; i++) {
+        if (packet(&ctl, 48.0 + 74.0, false))
+            engaged_at = i;
+    }
+    CHECK(engaged_at > 0);
+    CHECK_EQ_I32(ctl.stats.reason, AUDIO_ASRC_FILLING);
+
+    // A short fill while settling is the start's; after, it engages
+    audio_asrc_ctl_init(&ctl, 48000, FRAME_BYTES, TARGET_BYTES);
+    for (int i = 0; i < AUDIO_ASRC_SETTLE_PACKETS - 1; i++)
+        CHECK(!packet(&ctl, TARGET, i == 10));
+    CHECK(!packet(&ctl, TARGET, false));
+    CHECK(packet(&ctl, TARGET, true));
+    CHECK_EQ_I32(ctl.stats.reason, AUDIO_ASRC_UNDERRUN);
+    CHECK_EQ_I32(ctl.stats.engage_ms, AUDIO_ASRC_SETTLE_PACKETS + 1);
+}
+
+// A host ignoring feedback, sending 48 frames per ms, against a DAC
+// ppm off, which the feedback asks for: the converter engages on it, its
+// ratio makes up the difference and the queue settles back on the target
+// (and the converter's delay, which the queue here doesn't hold)
+static void run_loop(int32_t dac_ppm) {
+    audio_asrc_ctl_t ctl;
+    audio_asrc_ctl_init(&ctl, 48000, FRAME_BYTES, TARGET_BYTES);
+    // Level after the DAC's share: packets land on the target
+    double q = TARGET - 48.0, q_min = TARGET, q_max = TARGET, settled_q = 0.0;
+    int settled_n = 0;
+    double rate = 48.0 * (1.0 + dac_ppm * 1e-6); // DAC frames per ms
+    for (int ms = 0; ms < 30000; ms++) {
+        q += 48.0;
+        packet_sent(&ctl, 48, 48.0 * (1.0 + dac_ppm * 1e-6), q, false);
+        if (q < q_min)
+            q_min = q;
+        if (q > q_max)
+            q_max = q;
+        if (ms >= 25000) {
+            settled_q += q;
+            settled_n++;
+        }
+        double ratio = 1.0 + audio_asrc_ctl_ppm_q8(&ctl) / 256e6;
+        q -= rate * ratio;
+    }
+    double ppm = audio_asrc_ctl_ppm_q8(&ctl) / 256.0;
+    double held = settled_q / settled_n - TARGET -
+                  AUDIO_ASRC_DELAY_Q8 / 256.0;
+    if (verbose)
+        printf("  DAC %+d ppm: engaged after %u ms, ratio %+.1f ppm, "
+               "held %+.2f frames off, queue %.1f..%.1f frames\n",
+               (int)dac_ppm, (unsigned)ctl.stats.engage_ms, ppm, held,
+               q_min, q_max);
+    CHECK_EQ_I32(ctl.stats.reason, AUDIO_ASRC_IGNORED);
+    // The ratio undoes the DAC's offset
+    CHECK(fabs(ppm + dac_ppm) < 3.0);
+    CHECK(fabs(held) < 2.0);
+    CHECK_EQ_I32(ctl.stats.loop.state, AUDIO_AD_TRACKING);
+    // Engaged a few frames off, so the queue stays within half a period
+    CHECK(q_min > TARGET - 24.0);
+    CHECK(q_max < TARGET + 8.0 + AUDIO_ASRC_DELAY_Q8 / 256.0);
+}
+
+static void test_loop_holds_queue(void) {
+    run_loop(300);
+    run_loop(-300);
+    run_loop(80);
+    run_loop(-700);
+}
+
+int main(int argc, char **argv) {
+    verbose = argc > 1 && strcmp(argv[1], "--verbose") == 0;
+    test_frame_accounting();
+    test_in_place_matches();
+    test_seamless_start();
+    test_error_across_band();
+    test_monitor_steady();
+    test_monitor_reasons();
+    test_loop_holds_queue();
+    return test_summary("audio_asrc");
+}
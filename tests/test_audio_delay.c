@@ -0,0 +1,99 @@
+// SPDX-License-Identifier: GPL-3.0-only
+// Copyright (c) 2026 Elia Chiarucci
+
+/*
+ * Host-side unit tests for the output delay estimator
+ * (App/Src/audio_delay.c). tests/test_audio_latency.c checks its average
+ * against the delay of the simulated stream.
+ */
+
+#include "audio_delay.h"
+#include "test_util.h"
+#include <stdint.h>
+
+#define RATE        48000U
+#define FRAME_BYTES 6
+#define PACKET      (48 * FRAME_BYTES)
+
+static uint32_t frames_us(double frames) {
+    return (uint32_t)(frames * 1e6 / RATE + 0.5);
+}
+
+static void test_components_add_up(void) {
+    audio_delay_t d;
+    audio_delay_init(&d, RATE, FRAME_BYTES);
+
+    // The middle of a packet that just landed in an otherwise empty FIFO
+    // waits for half of it, then a 96-frame ring and the DAC
+    uint32_t us = audio_delay_packet(&d, PACKET, PACKET, 96U << 8);
+    CHECK_EQ_I32(us, frames_us(24 + 96 + AUDIO_DELAY_DSP_FRAMES +
+                               AUDIO_DELAY_DAC_FRAMES));
+    CHECK_EQ_I32(d.stats.now_us, us);
+    CHECK_EQ_I32(d.stats.windows, 0);
+
+    // Half-frame ring resolution, one more packet queued ahead
+    us = audio_delay_packet(&d, 2 * PACKET, PACKET, (96U << 8) + 128);
+    CHECK_EQ_I32(us, frames_us(72 + 96.5 + AUDIO_DELAY_DSP_FRAMES +
+                               AUDIO_DELAY_DAC_FRAMES));
+}
+
+static void test_short_fifo_clamps(void) {
+    // Part of the packet already drained (the audio stage ran in between):
+    // never a negative FIFO share
+    audio_delay_t d;
+    audio_delay_init(&d, RATE, FRAME_BYTES);
+    uint32_t us = audio_delay_packet(&d, 60, PACKET, 0);
+    CHECK_EQ_I32(us, frames_us(AUDIO_DELAY_DSP_FRAMES + AUDIO_DELAY_DAC_FRAMES));
+}
+
+static void test_window_min_avg_max(void) {
+    audio_delay_t d;
+    audio_delay_init(&d, RATE, FRAME_BYTES);
+    const double fixed = AUDIO_DELAY_DSP_FRAMES + AUDIO_DELAY_DAC_FRAMES;
+
+    // Ring from 0 to 999 frames over one window
+    for (uint32_t i = 0; i < AUDIO_DELAY_WINDOW - 1; i++)
+        audio_delay_packet(&d, 0, 0, i << 8);
+    CHECK_EQ_I32(d.stats.windows, 0);
+    CHECK_EQ_I32(d.stats.avg_us, 0);
+
+    audio_delay_packet(&d, 0, 0, (AUDIO_DELAY_WINDOW - 1U) << 8);
+    CHECK_EQ_I32(d.stats.windows, 1);
+    CHECK_EQ_I32(d.stats.min_us, frames_us(fixed));
+    CHECK_EQ_I32(d.stats.max_us, frames_us(AUDIO_DELAY_WINDOW - 1 + fixed));
+    CHECK_EQ_I32(d.stats.avg_us,
+                 frames_us((AUDIO_DELAY_WINDOW - 1) / 2.0 + fixed));
+
+    // The next window starts afresh; the reported one holds until it ends
+    for (uint32_t i = 0; i < AUDIO_DELAY_WINDOW - 1; i++)
+        audio_delay_packet(&d, 0, 0, 100U << 8);
+    CHECK_EQ_I32(d.stats.windows, 1);
+    CHECK_EQ_I32(d.stats.min_us, frames_us(fixed));
+
+    audio_delay_packet(&d, 0, 0, 100U << 8);
+    CHECK_EQ_I32(d.stats.windows, 2);
+    CHECK_EQ_I32(d.stats.min_us, frames_us(100 + fixed));
+    CHECK_EQ_I32(d.stats.avg_us, frames_us(100 + fixed));
+    CHECK_EQ_I32(d.stats.max_us, frames_us(100 + fixed));
+}
+
+static void test_init_resets(void) {
+    audio_delay_t d;
+    audio_delay_init(&d, RATE, FRAME_BYTES);
+    for (uint32_t i = 0; i < AUDIO_DELAY_WINDOW; i++)
+        audio_delay_packet(&d, PACKET, PACKET, 0);
+    CHECK_EQ_I32(d.stats.windows, 1);
+
+    audio_delay_init(&d, RATE, FRAME_BYTES);
+    CHECK_EQ_I32(d.stats.windows, 0);
+    CHECK_EQ_I32(d.stats.now_us, 0);
+    CHECK_EQ_I32(d.stats.avg_us, 0);
+}
+
+int main(void) {
+    test_components_add_up();
+    test_short_fifo_clamps();
+    test_window_min_avg_max();
+    test_init_resets();
+    return test_summary("audio_delay");
+}
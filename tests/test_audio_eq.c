@@ -9,6 +9,7 @@
 
 #include "audio_eq.h"
 #include "test_util.h"
+#include <math.h>
 #include <stdint.h>
 #include <string.h>
 
@@ -147,6 +148,54 @@ static void test_disable_bypasses_eq(void) {
     CHECK(audio_eq_is_enabled());
 }
 
+// Steady-state peak gain for a tone at f Hz, with bass at max, at rate
+static double bass_tone_gain(uint32_t rate, double f) {
+    int32_t buf[BUF_SAMPLES];
+    double peak = 0.0;
+    uint32_t frames = rate / 5; // 200ms: the 50Hz highpass settles
+    audio_eq_init();
+    audio_eq_set_band(EQ_BAND_BASS, EQ_VALUE_MAX);
+    CHECK(audio_eq_set_rate(rate));
+    for (uint32_t n = 0; n < frames; n += BUF_SAMPLES / 2) {
+        for (uint16_t i = 0; i < BUF_SAMPLES; i += 2) {
+            double x = sin(2.0 * M_PI * f * (n + i / 2) / rate);
+            buf[i] = buf[i + 1] = (int32_t)(1000000.0 * x);
+        }
+        audio_eq_process(buf, BUF_SAMPLES, 65536);
+        if (n >= frames / 2)
+            for (uint16_t i = 0; i < BUF_SAMPLES; i++)
+                if (fabs((double)buf[i]) > peak)
+                    peak = fabs((double)buf[i]);
+    }
+    return peak / 1000000.0;
+}
+
+static void test_rate_keeps_corner_frequencies(void) {
+    CHECK(!audio_eq_set_rate(44100));
+    CHECK(!audio_eq_set_rate(192000));
+
+    // Same response at 96kHz as at 48kHz, to a fraction of a dB
+    const double freqs[] = {60.0, 150.0, 400.0, 2000.0};
+    for (unsigned i = 0; i < sizeof(freqs) / sizeof(freqs[0]); i++) {
+        double g48 = bass_tone_gain(48000, freqs[i]);
+        double g96 = bass_tone_gain(96000, freqs[i]);
+        CHECK(fabs(20.0 * log10(g96 / g48)) < 0.5);
+    }
+
+    // Back at 48kHz: bit-identical to a fresh EQ
+    int32_t a[BUF_SAMPLES], b[BUF_SAMPLES];
+    audio_eq_init();
+    audio_eq_set_band(EQ_BAND_BASS, 6);
+    CHECK(audio_eq_set_rate(48000));
+    fill_ramp(a, BUF_SAMPLES);
+    audio_eq_process(a, BUF_SAMPLES, 65536);
+    CHECK(audio_eq_set_rate(96000));
+    CHECK(audio_eq_set_rate(48000));
+    fill_ramp(b, BUF_SAMPLES);
+    audio_eq_process(b, BUF_SAMPLES, 65536);
+    CHECK(memcmp(a, b, sizeof(a)) == 0);
+}
+
 int main(void) {
     test_flat_unity_is_identity();
     test_flat_applies_volume();
@@ -156,5 +205,6 @@ int main(void) {
     test_boost_actually_changes_signal();
     test_reset_state_gives_zero_output_for_zero_input();
     test_disable_bypasses_eq();
+    test_rate_keeps_corner_frequencies();
     return test_summary("audio_eq");
 }
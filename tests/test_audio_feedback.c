@@ -0,0 +1,237 @@
+// SPDX-License-Identifier: GPL-3.0-only
+// Copyright (c) 2026 Elia Chiarucci
+
+/*
+ * Host-side unit tests for the measured-clock feedback
+ * (App/Src/audio_feedback.c).
+ *
+ * The I2S clock is modelled as the firmware reads it: the DMA position in
+ * whole 32-bit words (half a stereo frame), sampled by the SOF interrupt a
+ * random few microseconds late, running at a ppm offset from the USB frame
+ * clock.
+ */
+
+#include "audio_feedback.h"
+#include "test_util.h"
+#include <stdint.h>
+#include <string.h>
+
+#define RATE       48000U
+#define TARGET     2352
+#define SOF_MAX_NS 5000 // SOF interrupt latency
+
+static uint32_t rng_state = 0x2468ACEu;
+
+static uint32_t rng(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+typedef struct {
+    double ppm;
+    double phase;      // frames played at t = 0
+    uint32_t base;     // clock counter offset (wrap tests)
+    uint32_t frame;    // USB frame number
+    uint8_t epoch;
+} clock_model_t;
+
+// Clock reading at the SOF of the current frame: half-frame resolution,
+// 1/256 frame units
+static uint32_t clock_at_sof(const clock_model_t *c) {
+    double t_ns = (double)c->frame * 1e6 + (double)(rng() % SOF_MAX_NS);
+    double frames = c->phase + t_ns * RATE * (1.0 + c->ppm * 1e-6) / 1e9;
+    uint32_t half_frames = (uint32_t)(uint64_t)(frames * 2.0);
+    return c->base + half_frames * 128U;
+}
+
+// True feedback for the model, 16.16
+static double true_rate(const clock_model_t *c) {
+    return RATE / 1000.0 * (1.0 + c->ppm * 1e-6) * 65536.0;
+}
+
+static void run_ms(audio_feedback_t *fb, clock_model_t *c, uint32_t ms,
+                   uint16_t level) {
+    for (uint32_t i = 0; i < ms; i++) {
+        audio_feedback_packet(fb, level);
+        audio_feedback_sof(fb, c->frame, clock_at_sof(c), c->epoch);
+        c->frame++;
+    }
+}
+
+static void test_init_is_nominal(void) {
+    audio_feedback_t fb;
+    audio_feedback_init(&fb, RATE, TARGET);
+    CHECK_EQ_I32(audio_feedback_value(&fb), 48U << 16);
+    CHECK_EQ_I32(fb.stats.state, AUDIO_FB_IDLE);
+    CHECK_EQ_I32(fb.stats.trim, 0);
+    CHECK_EQ_I32(fb.stats.target, TARGET);
+}
+
+static void test_converges_to_measured_rate(void) {
+    static const double ppm[] = {-500, -100, 0, 37, 250, 500};
+    for (unsigned i = 0; i < sizeof(ppm) / sizeof(ppm[0]); i++) {
+        audio_feedback_t fb;
+        clock_model_t c = {ppm[i], (rng() % 1000) / 10.0, 0, rng() & 0x7FF,
+                           0};
+        audio_feedback_init(&fb, RATE, TARGET);
+
+        // Held at nominal while the window is short
+        run_ms(&fb, &c, AUDIO_FB_MIN_SAMPLES * AUDIO_FB_STRIDE_MS - 16, TARGET);
+        CHECK_EQ_I32(audio_feedback_value(&fb), 48U << 16);
+
+        // Locked well inside the first window
+        run_ms(&fb, &c, 1000, TARGET);
+        CHECK_EQ_I32(fb.stats.state, AUDIO_FB_LOCKED);
+        CHECK(fb.stats.lock_ms > 0 && fb.stats.lock_ms < 800);
+
+        // Then tracks the true rate to a few ppm, with the level on target
+        // (no trim)
+        run_ms(&fb, &c, 3000, TARGET);
+        double err = (double)audio_feedback_value(&fb) - true_rate(&c);
+        if (err < -20 || err > 20)
+            printf("  %+.0f ppm: value off by %.1f\n", ppm[i], err);
+        CHECK(err >= -20 && err <= 20); // 20 = 6ppm
+        CHECK_EQ_I32(fb.stats.trim, 0);
+
+        // Jitter: since lock, the rate spread and the step between values
+        // stay within a few 10.14 LSBs (4 in 16.16)
+        CHECK(fb.stats.rate_max - fb.stats.rate_min <= 64);
+        CHECK(fb.stats.step_max <= 16);
+        CHECK_EQ_I32(fb.stats.resyncs, 0);
+    }
+}
+
+static void test_trim_follows_fifo_level(void) {
+    audio_feedback_t fb;
+    clock_model_t c = {0, 0, 0, 0, 0};
+    audio_feedback_init(&fb, RATE, TARGET);
+    run_ms(&fb, &c, 1000, TARGET);
+    uint32_t rate = fb.stats.rate;
+
+    // One packet short: the host is asked for more
+    run_ms(&fb, &c, 1000, TARGET - 288);
+    CHECK(fb.stats.trim >= 288 * AUDIO_FB_TRIM_GAIN - 1 &&
+          fb.stats.trim <= 288 * AUDIO_FB_TRIM_GAIN);
+    CHECK(audio_feedback_value(&fb) > rate);
+
+    // Far over the target: less, but never beyond the trim limit
+    run_ms(&fb, &c, 1000, TARGET + 2000);
+    CHECK_EQ_I32(fb.stats.trim, -AUDIO_FB_TRIM_MAX);
+    CHECK_EQ_I32(audio_feedback_value(&fb), fb.stats.rate - AUDIO_FB_TRIM_MAX);
+    CHECK_EQ_I32(fb.stats.level, TARGET + 2000);
+}
+
+// Same limit in ppm at 96kHz: twice the 16.16 value
+static void test_trim_limit_scales_with_rate(void) {
+    audio_feedback_t fb;
+    clock_model_t c = {0, 0, 0, 0, 0};
+    audio_feedback_init(&fb, 96000, TARGET);
+    CHECK_EQ_I32(audio_feedback_value(&fb), 96U << 16);
+    run_ms(&fb, &c, 1000, TARGET + 2000);
+    CHECK_EQ_I32(fb.stats.trim, -2 * AUDIO_FB_TRIM_MAX);
+}
+
+// A 44.1kHz stream resampled onto the 48kHz clock: the host is asked for
+// 147 frames per 160 the clock plays, offset included
+static void test_resampled_clock_rate(void) {
+    audio_feedback_t fb;
+    clock_model_t c = {200, 0, 0, 0, 0};
+    audio_feedback_init(&fb, 44100, TARGET);
+    audio_feedback_set_clock_rate(&fb, RATE);
+    CHECK_EQ_I32(audio_feedback_value(&fb), (441U << 16) / 10);
+    run_ms(&fb, &c, 3000, TARGET);
+    CHECK_EQ_I32(fb.stats.state, AUDIO_FB_LOCKED);
+    double err = (double)audio_feedback_value(&fb) - true_rate(&c) * 147 / 160;
+    CHECK(err >= -20 && err <= 20);
+}
+
+// 16-bit frames: the same error in frames trims the same, in bytes 2/3
+static void test_trim_per_frame(void) {
+    audio_feedback_t fb24, fb16;
+    clock_model_t c24 = {0, 0, 0, 0, 0}, c16 = c24;
+    audio_feedback_init(&fb24, RATE, TARGET);
+    audio_feedback_init(&fb16, RATE, TARGET / 6 * 4);
+    audio_feedback_set_frame_bytes(&fb16, 4);
+    run_ms(&fb24, &c24, 100, TARGET - 60);
+    run_ms(&fb16, &c16, 100, TARGET / 6 * 4 - 40);
+    CHECK(fb24.stats.trim > 0);
+    CHECK_EQ_I32(fb16.stats.trim, fb24.stats.trim);
+}
+
+static void test_value_clamped_to_one_frame(void) {
+    audio_feedback_t fb;
+    clock_model_t c = {30000, 0, 0, 0, 0}; // a DAC clock 3% fast
+    audio_feedback_init(&fb, RATE, TARGET);
+    run_ms(&fb, &c, 2000, 0);
+    CHECK_EQ_I32(audio_feedback_value(&fb), 49U << 16);
+}
+
+static void test_clock_wrap(void) {
+    // The counter wraps every 2^24 frames: a window across it must not
+    // notice
+    audio_feedback_t fb;
+    clock_model_t c = {100, 0, 0xFFFFFFFFu - 48U * 256U * 500U, 0, 0};
+    audio_feedback_init(&fb, RATE, TARGET);
+    run_ms(&fb, &c, 3000, TARGET);
+    double err = (double)audio_feedback_value(&fb) - true_rate(&c);
+    CHECK(err >= -20 && err <= 20);
+    CHECK_EQ_I32(fb.stats.resyncs, 0);
+}
+
+static void test_epoch_change_restarts_window(void) {
+    audio_feedback_t fb;
+    clock_model_t c = {200, 0, 0, 0, 0};
+    audio_feedback_init(&fb, RATE, TARGET);
+    run_ms(&fb, &c, 2000, TARGET);
+    CHECK_EQ_I32(fb.stats.state, AUDIO_FB_LOCKED);
+    uint32_t lock_ms = fb.stats.lock_ms;
+    uint32_t value = audio_feedback_value(&fb);
+
+    // The ring restarted: the count jumps and the epoch moves on. The value
+    // holds instead of measuring the jump.
+    c.base += 12345678U;
+    c.epoch++;
+    run_ms(&fb, &c, AUDIO_FB_STRIDE_MS, TARGET);
+    CHECK_EQ_I32(fb.stats.resyncs, 1);
+    CHECK_EQ_I32(fb.stats.state, AUDIO_FB_MEASURING);
+    CHECK_EQ_I32(audio_feedback_value(&fb), value);
+
+    run_ms(&fb, &c, 2000, TARGET);
+    CHECK_EQ_I32(fb.stats.state, AUDIO_FB_LOCKED);
+    CHECK_EQ_I32(fb.stats.lock_ms, lock_ms); // first lock is reported
+    double err = (double)audio_feedback_value(&fb) - true_rate(&c);
+    CHECK(err >= -20 && err <= 20);
+}
+
+static void test_missed_sof_restarts_window(void) {
+    audio_feedback_t fb;
+    clock_model_t c = {0, 0, 0, 0, 0};
+    audio_feedback_init(&fb, RATE, TARGET);
+    run_ms(&fb, &c, 1000, TARGET);
+
+    // The SOFs of a whole stride were lost (interrupts held off): the
+    // frame numbers skip a sample
+    c.frame += AUDIO_FB_STRIDE_MS;
+    run_ms(&fb, &c, AUDIO_FB_STRIDE_MS, TARGET);
+    CHECK_EQ_I32(fb.stats.resyncs, 1);
+
+    // Frame number wrap alone is not a gap
+    run_ms(&fb, &c, 3000, TARGET);
+    CHECK_EQ_I32(fb.stats.resyncs, 1);
+}
+
+int main(void) {
+    test_init_is_nominal();
+    test_converges_to_measured_rate();
+    test_trim_follows_fifo_level();
+    test_trim_limit_scales_with_rate();
+    test_resampled_clock_rate();
+    test_trim_per_frame();
+    test_value_clamped_to_one_frame();
+    test_clock_wrap();
+    test_epoch_change_restarts_window();
+    test_missed_sof_restarts_window();
+    return test_summary("audio_feedback");
+}
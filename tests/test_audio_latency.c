@@ -0,0 +1,385 @@
+// SPDX-License-Identifier: GPL-3.0-only
+// Copyright (c) 2026 Elia Chiarucci
+
+/*
+ * Host-side simulation of the latency presets (App/Src/audio_latency.c).
+ *
+ * Models the USB OUT path end to end with the firmware's parameters: the
+ * host sends one packet per 1ms frame sized from the last feedback value it
+ * read, packets reach the FIFO late by a random 0..jitter_us (in order, so
+ * large jitter delivers them in bursts), the firmware's feedback
+ * (audio_feedback.c: the I2S clock measured at each SOF, trimmed on the
+ * FIFO level) regulates the FIFO to the preset's target, and the I2S ring
+ * drains one period per audio stage run, at a device clock offset from the
+ * USB frame clock. Every preset must run a minute of stream at its rated
+ * jitter with no underrun and no FIFO overflow, and settle near its
+ * target. TinyUSB's FIFO_COUNT method is modelled for comparison. The
+ * delay estimate reported over CDC (audio_delay.c) is checked against the
+ * delay the simulation actually sees.
+ */
+
+#include "audio_delay.h"
+#include "audio_feedback.h"
+#include "audio_latency.h"
+#include "test_util.h"
+#include <stdint.h>
+#include <string.h>
+
+#define FIFO_DEPTH   (16 * 294) // CFG_TUD_AUDIO_FUNC_1_EP_OUT_SW_BUF_SZ at 48kHz
+#define FB_POLL_MS   8          // host re-reads the feedback endpoint
+#define STAGE_MAX_NS 100000     // audio stage start latency after the DMA IRQ
+#define SOF_MAX_NS   5000       // SOF interrupt latency (clock sample)
+#define SIM_MS       60000
+#define SETTLE_MS    20000
+
+typedef enum {
+    FB_MEASURED,   // the firmware's: measured I2S clock + FIFO trim
+    FB_FIFO_COUNT, // TinyUSB's FIFO level method, for comparison
+} fb_method_t;
+
+typedef struct {
+    uint32_t underruns;
+    uint32_t overflows;
+    int64_t arrival_sum;      // settled level right after each packet
+    uint32_t arrivals;
+    double level_area;        // settled level integrated over time (byte*ns)
+    int64_t settled_ns;
+    uint32_t level_min;       // settled level right after a packet
+    uint32_t level_max;
+    uint32_t fb_min;          // settled feedback values the host read
+    uint32_t fb_max;
+    double delay_sum_us;      // settled audio_delay estimates
+    uint32_t delays;
+} sim_result_t;
+
+static uint32_t rng_state;
+
+static uint32_t rng(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+static int64_t rng_range(int64_t max) {
+    return max > 0 ? (int64_t)(rng() % (uint32_t)(max + 1)) : 0;
+}
+
+// TinyUSB audiod_fb_fifo_count_update(), full speed (16.16 frames per ms)
+typedef struct {
+    uint32_t avg, thr, nom, min, max, rate_up, rate_down, value;
+} fb_model_t;
+
+static void fb_init(fb_model_t *fb, uint16_t thr) {
+    fb->min = (AUDIO_LATENCY_RATE - 1) / 1000 << 16;
+    fb->max = (AUDIO_LATENCY_RATE / 1000 + 1) << 16;
+    fb->nom = ((AUDIO_LATENCY_RATE / 100) << 16) / 10;
+    fb->thr = thr;
+    fb->avg = (uint32_t)thr << 16;
+    fb->rate_up = (fb->max - fb->nom) / thr;
+    fb->rate_down = (fb->nom - fb->min) / thr;
+    fb->value = fb->nom;
+}
+
+static void fb_update(fb_model_t *fb, uint32_t level) {
+    fb->avg = (uint32_t)(((uint64_t)fb->avg * 63 + (level << 16)) >> 6);
+    uint32_t lvl = fb->avg >> 16;
+    uint32_t v = lvl < fb->thr ? fb->nom + (fb->thr - lvl) * fb->rate_up
+                               : fb->nom - (lvl - fb->thr) * fb->rate_down;
+    if (v > fb->max)
+        v = fb->max;
+    if (v < fb->min)
+        v = fb->min;
+    fb->value = v;
+}
+
+static sim_result_t simulate(const audio_latency_preset_t *p, int32_t ppm,
+                             uint32_t jitter_us, uint32_t seed,
+                             fb_method_t method) {
+    sim_result_t r;
+    memset(&r, 0, sizeof(r));
+    r.level_min = UINT32_MAX;
+    r.fb_min = UINT32_MAX;
+    rng_state = seed;
+
+    fb_model_t fb_count;
+    fb_init(&fb_count, p->fifo_target);
+    audio_feedback_t fb_meas;
+    audio_feedback_init(&fb_meas, AUDIO_LATENCY_RATE, p->fifo_target);
+    audio_delay_t delay;
+    audio_delay_init(&delay, AUDIO_LATENCY_RATE, AUDIO_LATENCY_FRAME_BYTES);
+
+    const uint32_t period_bytes = p->period_frames * AUDIO_LATENCY_FRAME_BYTES;
+    // Device clock at its offset: frame and period length in ns
+    const double rate = AUDIO_LATENCY_RATE * (1.0 + ppm * 1e-6);
+    const double period_ns = (double)p->period_frames * 1e9 / rate;
+
+    uint32_t level = 0;
+    int prebuffering = 1;
+
+    // Host side
+    uint32_t host_fb = fb_count.nom; // value the host last read
+    uint32_t host_acc = 0;           // fractional frames carried over (16.16)
+    int64_t last_arrival = 0;
+    uint32_t frame = 0;
+    int64_t now = 0;
+    const int64_t settle = (int64_t)SETTLE_MS * 1000000;
+
+    // Device side: the ring was already running when the stream opened
+    double next_period = (double)rng_range((int64_t)period_ns);
+    const double ring_start = next_period - period_ns;
+    int64_t next_fill = (int64_t)next_period + rng_range(STAGE_MAX_NS);
+    uint32_t sof_frame = 1;
+
+    int64_t packet_time = rng_range((int64_t)jitter_us * 1000);
+
+    const int64_t end = (int64_t)SIM_MS * 1000000;
+    while (packet_time < end || next_fill < end) {
+        int64_t sof_time = (int64_t)sof_frame * 1000000;
+        int64_t t = packet_time <= next_fill ? packet_time : next_fill;
+        if (sof_time < t) {
+            // SOF interrupt: the DMA position, in whole words
+            double ns = (double)(sof_time + rng_range(SOF_MAX_NS)) - ring_start;
+            uint32_t half_frames = (uint32_t)(int64_t)(ns * rate * 2 / 1e9);
+            audio_feedback_sof(&fb_meas, sof_frame, half_frames * 128U, 0);
+            sof_frame++;
+            continue;
+        }
+        if (!prebuffering && t > settle) {
+            r.level_area += (double)level * (double)(t - now);
+            r.settled_ns += t - now;
+        }
+        now = t;
+
+        if (packet_time <= next_fill) {
+            // Packet for this frame lands in the FIFO
+            if (frame % FB_POLL_MS == 0)
+                host_fb = method == FB_MEASURED ? audio_feedback_value(&fb_meas)
+                                                : fb_count.value;
+            if (!prebuffering && now > settle) {
+                if (host_fb < r.fb_min)
+                    r.fb_min = host_fb;
+                if (host_fb > r.fb_max)
+                    r.fb_max = host_fb;
+            }
+            host_acc += host_fb;
+            uint32_t bytes = (host_acc >> 16) * AUDIO_LATENCY_FRAME_BYTES;
+            host_acc &= 0xFFFF;
+
+            if (level + bytes > FIFO_DEPTH)
+                r.overflows++;
+            else
+                level += bytes;
+            fb_update(&fb_count, level);
+            audio_feedback_packet(&fb_meas, (uint16_t)level);
+            if (!prebuffering && now > settle) {
+                // Ring ahead of the DMA as audio_output_queued() reads it:
+                // the rest of the period playing and the other periods,
+                // less one played but not yet refilled
+                double ends = next_period;
+                uint32_t full = p->periods - 1U;
+                if (now >= next_period) {
+                    ends += period_ns;
+                    full--;
+                }
+                double left = (ends - (double)now) / period_ns;
+                uint32_t ring_q8 =
+                    (uint32_t)((full + left) * p->period_frames * 256.0);
+                r.delay_sum_us += audio_delay_packet(&delay, (uint16_t)level,
+                                                     (uint16_t)bytes, ring_q8);
+                r.delays++;
+
+                r.arrival_sum += level;
+                r.arrivals++;
+                if (level < r.level_min)
+                    r.level_min = level;
+                if (level > r.level_max)
+                    r.level_max = level;
+            }
+
+            frame++;
+            last_arrival = packet_time;
+            int64_t sof = (int64_t)frame * 1000000;
+            packet_time = sof + rng_range((int64_t)jitter_us * 1000);
+            if (packet_time < last_arrival)
+                packet_time = last_arrival; // in order: bursts after a late one
+        } else {
+            // Audio stage refills the period the DMA just played
+            if (prebuffering) {
+                // Starts exactly on target: a burst that overshot it
+                // during the prebuffer is dropped
+                if (level >= p->fifo_target) {
+                    level = p->fifo_target;
+                    prebuffering = 0;
+                }
+            } else if (level >= period_bytes) {
+                level -= period_bytes;
+            } else {
+                r.underruns++;
+                level -= level - level % AUDIO_LATENCY_FRAME_BYTES;
+            }
+            next_period += period_ns;
+            next_fill = (int64_t)next_period + rng_range(STAGE_MAX_NS);
+        }
+    }
+    return r;
+}
+
+static void check_preset(uint8_t id) {
+    const audio_latency_preset_t *p = audio_latency_preset(id);
+    static const int32_t ppm[] = {-300, 0, 300};
+    const uint32_t period_bytes = p->period_frames * AUDIO_LATENCY_FRAME_BYTES;
+
+    for (uint8_t i = 0; i < sizeof(ppm) / sizeof(ppm[0]); i++) {
+        sim_result_t r = simulate(p, ppm[i], p->jitter_us, 0x1234567u + id,
+                                  FB_MEASURED);
+        if (r.underruns || r.overflows)
+            printf("  %s @ %+d ppm: %u underruns, %u overflows\n", p->name,
+                   (int)ppm[i], (unsigned)r.underruns, (unsigned)r.overflows);
+        CHECK_EQ_I32(r.underruns, 0);
+        CHECK_EQ_I32(r.overflows, 0);
+
+        // The feedback settles the packet-time level on the target...
+        CHECK(r.arrivals > 0 && r.settled_ns > 0);
+        if (!r.arrivals || !r.settled_ns)
+            continue;
+        int32_t err = (int32_t)(r.arrival_sum / r.arrivals) - p->fifo_target;
+        CHECK(err >= -(int32_t)period_bytes && err <= (int32_t)period_bytes);
+
+        // ...and the delay through FIFO and ring matches the estimate
+        // reported over CDC (Little's law on the mean FIFO level)
+        double bytes_per_us = AUDIO_LATENCY_RATE * AUDIO_LATENCY_FRAME_BYTES / 1e6;
+        double fifo_us = r.level_area / (double)r.settled_ns / bytes_per_us;
+        double period_us = p->period_frames * 1e6 / AUDIO_LATENCY_RATE;
+        double total_us = fifo_us + (p->periods - 0.5) * period_us;
+        double diff = total_us - (double)audio_latency_total_us(p);
+        CHECK(diff > -250.0 && diff < 250.0);
+
+        // The estimator, averaged, finds the same delay plus the DAC's. A
+        // period leaves the FIFO for the ring when the audio stage runs,
+        // on average STAGE_MAX_NS / 2 after the period end, so its ring
+        // time is that much shorter than the estimate above assumes.
+        double ring_us = total_us - fifo_us - STAGE_MAX_NS / 2 / 1e3;
+        double est_us = r.delay_sum_us / r.delays -
+                        AUDIO_DELAY_DAC_FRAMES * 1e6 / AUDIO_LATENCY_RATE;
+        double est_diff = est_us - (fifo_us + ring_us);
+        if (est_diff < -20.0 || est_diff > 20.0)
+            printf("  %s @ %+d ppm: estimated %.0f us, simulated %.0f us\n",
+                   p->name, (int)ppm[i], est_us, fifo_us + ring_us);
+        CHECK(est_diff > -20.0 && est_diff < 20.0);
+    }
+}
+
+static void test_presets_underrun_free(void) {
+    for (uint8_t id = 0; id < AUDIO_LATENCY_COUNT; id++)
+        check_preset(id);
+}
+
+static void test_low_preset_breaks_beyond_rating(void) {
+    // Sanity check of the model: the low preset must fail at a jitter well
+    // beyond its rating, or the simulation proves nothing
+    const audio_latency_preset_t *p = audio_latency_preset(AUDIO_LATENCY_LOW);
+    sim_result_t r = simulate(p, 0, 3000, 42, FB_MEASURED);
+    CHECK(r.underruns > 0);
+}
+
+static void test_measured_feedback_vs_fifo_count(void) {
+    // The measured rate leaves the trim only the level noise to follow: the
+    // level settles on the target whatever the clock offset, and the value
+    // the host reads moves far less than FIFO_COUNT's, which swings with
+    // every packet's level
+    for (uint8_t id = 0; id < AUDIO_LATENCY_COUNT; id++) {
+        const audio_latency_preset_t *p = audio_latency_preset(id);
+        sim_result_t m = simulate(p, 300, p->jitter_us, 77, FB_MEASURED);
+        sim_result_t c = simulate(p, 300, p->jitter_us, 77, FB_FIFO_COUNT);
+        CHECK(m.arrivals > 0 && c.arrivals > 0);
+        if (!m.arrivals || !c.arrivals)
+            continue;
+        int32_t err = (int32_t)(m.arrival_sum / m.arrivals) - p->fifo_target;
+        CHECK(err >= -(int32_t)AUDIO_LATENCY_FRAME_BYTES &&
+              err <= (int32_t)AUDIO_LATENCY_FRAME_BYTES);
+        CHECK((m.fb_max - m.fb_min) * 4 < c.fb_max - c.fb_min);
+    }
+}
+
+static void test_preset_table(void) {
+    CHECK(audio_latency_preset(AUDIO_LATENCY_COUNT) == NULL);
+    CHECK(audio_latency_preset(AUDIO_LATENCY_DEFAULT) != NULL);
+
+    // The standard preset is the original fixed configuration
+    const audio_latency_preset_t *s =
+        audio_latency_preset(AUDIO_LATENCY_STANDARD);
+    CHECK_EQ_I32(s->period_frames, 96);
+    CHECK_EQ_I32(s->periods, 2);
+    CHECK_EQ_I32(s->fifo_target, FIFO_DEPTH / 2);
+
+    uint32_t prev_us = 0;
+    for (uint8_t id = 0; id < AUDIO_LATENCY_COUNT; id++) {
+        const audio_latency_preset_t *p = audio_latency_preset(id);
+        CHECK(p->periods >= 2 && p->periods <= AUDIO_LATENCY_MAX_PERIODS);
+        CHECK(p->period_frames * p->periods <= AUDIO_LATENCY_MAX_RING_FRAMES);
+        CHECK(p->fifo_target % AUDIO_LATENCY_FRAME_BYTES == 0);
+        CHECK(p->fifo_target < FIFO_DEPTH);
+
+        // Ordered from lowest latency to most robust
+        uint32_t us = audio_latency_total_us(p);
+        CHECK(us > prev_us);
+        prev_us = us;
+    }
+
+    // "Low latency" is about 3ms end to end
+    CHECK(audio_latency_total_us(audio_latency_preset(AUDIO_LATENCY_LOW)) <=
+          3500);
+}
+
+static void test_presets_at_rate(void) {
+    audio_latency_preset_t r = {0};
+    const audio_latency_preset_t *s =
+        audio_latency_preset(AUDIO_LATENCY_STANDARD);
+    CHECK(!audio_latency_at_rate(s, 32000, &r));
+    CHECK(!audio_latency_at_rate(s, 22050, &r));
+    CHECK(!audio_latency_at_rate(s, 2 * AUDIO_LATENCY_MAX_RATE, &r));
+    CHECK(r.name == NULL); // untouched
+
+    CHECK(audio_latency_at_rate(s, AUDIO_LATENCY_RATE, &r));
+    CHECK_EQ_I32(r.period_frames, s->period_frames);
+    CHECK_EQ_I32(r.fifo_target, s->fifo_target);
+
+    // Same times at the highest rate: twice the frames and bytes, whole
+    // frames still, and the ring fits the buffer sized for it
+    uint32_t k = AUDIO_LATENCY_MAX_RATE / AUDIO_LATENCY_RATE;
+    for (uint8_t id = 0; id < AUDIO_LATENCY_COUNT; id++) {
+        const audio_latency_preset_t *p = audio_latency_preset(id);
+        CHECK(audio_latency_at_rate(p, AUDIO_LATENCY_MAX_RATE, &r));
+        CHECK_EQ_I32(r.period_frames, p->period_frames * k);
+        CHECK_EQ_I32(r.fifo_target, p->fifo_target * k);
+        CHECK_EQ_I32(r.periods, p->periods);
+        CHECK(r.fifo_target % AUDIO_LATENCY_FRAME_BYTES == 0);
+        CHECK(r.fifo_target < FIFO_DEPTH * k);
+        CHECK(r.period_frames * r.periods <=
+              AUDIO_LATENCY_MAX_RING_FRAMES * k);
+    }
+
+    // 44.1kHz family: the ring runs at the 48kHz family rate, the FIFO
+    // target holds the same time in whole 44.1kHz frames
+    CHECK_EQ_I32(audio_latency_i2s_rate(44100), 48000);
+    CHECK_EQ_I32(audio_latency_i2s_rate(88200), 96000);
+    CHECK_EQ_I32(audio_latency_i2s_rate(96000), 96000);
+    CHECK_EQ_I32(audio_latency_i2s_rate(176400), 0);
+    CHECK_EQ_I32(audio_latency_i2s_rate(11025), 0);
+    CHECK(audio_latency_at_rate(s, 44100, &r));
+    CHECK_EQ_I32(r.period_frames, s->period_frames);
+    CHECK_EQ_I32(r.fifo_target, 2160); // 392 -> 360 frames
+    CHECK(audio_latency_at_rate(s, 88200, &r));
+    CHECK_EQ_I32(r.period_frames, s->period_frames * 2);
+    CHECK_EQ_I32(r.fifo_target, 4320);
+}
+
+int main(void) {
+    test_preset_table();
+    test_presets_at_rate();
+    test_presets_underrun_free();
+    test_measured_feedback_vs_fifo_count();
+    test_low_preset_breaks_beyond_rating();
+    return test_summary("audio_latency");
+}
@@ -0,0 +1,114 @@
+// SPDX-License-Identifier: GPL-3.0-only
+// Copyright (c) 2026 Elia Chiarucci
+
+/*
+ * Host-side unit tests for the PCM conversion kernels (App/Src/audio_pcm.c).
+ */
+
+#include "audio_pcm.h"
+#include "test_util.h"
+#include <stdint.h>
+
+#define FRAMES 48
+#define SAMPLES (FRAMES * 2)
+#define LEVEL   (1 << 20)
+#define GAIN_LSB (LEVEL >> 16) // one step of the 16-bit gain at LEVEL
+
+static int32_t buf[SAMPLES];
+
+static void fill(int32_t value) {
+    for (int i = 0; i < SAMPLES; i++)
+        buf[i] = value;
+}
+
+static void test_swap(void) {
+    for (int i = 0; i < SAMPLES; i++)
+        buf[i] = i;
+    audio_pcm_swap(buf, SAMPLES);
+    CHECK_EQ_I32(buf[0], 1);
+    CHECK_EQ_I32(buf[1], 0);
+    CHECK_EQ_I32(buf[SAMPLES - 2], SAMPLES - 1);
+    CHECK_EQ_I32(buf[SAMPLES - 1], SAMPLES - 2);
+}
+
+static void test_volume_flat(void) {
+    fill(-8388608);
+    audio_pcm_volume(buf, SAMPLES, AUDIO_PCM_UNITY, AUDIO_PCM_UNITY);
+    CHECK_EQ_I32(buf[0], -8388608); // unity: untouched
+
+    fill(1 << 20);
+    audio_pcm_volume(buf, SAMPLES, 32768, 32768);
+    CHECK_EQ_I32(buf[0], 1 << 19);
+    CHECK_EQ_I32(buf[SAMPLES - 1], 1 << 19);
+
+    fill(1 << 20);
+    audio_pcm_volume(buf, SAMPLES, 0, 0);
+    CHECK_EQ_I32(buf[SAMPLES / 2], 0);
+}
+
+static void test_volume_ramp(void) {
+    // Starts on the old gain, ends one step short of the new one, no step
+    // larger than the ramp increment anywhere
+    fill(LEVEL);
+    audio_pcm_volume(buf, SAMPLES, AUDIO_PCM_UNITY, 0);
+    CHECK_EQ_I32(buf[0], LEVEL);
+    CHECK(buf[SAMPLES - 1] > 0);
+    CHECK(buf[SAMPLES - 1] <= LEVEL / SAMPLES + GAIN_LSB);
+    int32_t max_step = 0;
+    for (int i = 1; i < SAMPLES; i++) {
+        int32_t d = buf[i - 1] - buf[i];
+        CHECK(d >= 0);
+        if (d > max_step)
+            max_step = d;
+    }
+    CHECK(max_step <= LEVEL / SAMPLES + GAIN_LSB);
+
+    fill(LEVEL);
+    audio_pcm_volume(buf, SAMPLES, 0, AUDIO_PCM_UNITY);
+    CHECK_EQ_I32(buf[0], 0);
+    CHECK(buf[SAMPLES - 1] < LEVEL);
+    CHECK(buf[SAMPLES - 1] >= LEVEL - LEVEL / SAMPLES - GAIN_LSB);
+}
+
+static void test_pack(void) {
+    buf[0] = 0;
+    buf[1] = 1;
+    buf[2] = -1;
+    buf[3] = 8388607;
+    buf[4] = -8388608;
+    audio_pcm_pack(buf, 5);
+    const uint32_t *out = (const uint32_t *)buf;
+    CHECK_EQ_I32(out[0], (uint32_t)AUDIO_PCM_DC_OFFSET << 8);
+    CHECK_EQ_I32(out[1], 0x00000100);
+    CHECK_EQ_I32(out[2], 0xFFFFFF00);
+    CHECK_EQ_I32(out[3], 0x7FFFFF00);
+    CHECK_EQ_I32(out[4], 0x80000000);
+}
+
+// Round trip: pack then unpack_i2s gives the USB samples back, swapped back
+static void test_unpack_i2s(void) {
+    static const int32_t in[6] = {-8388608, 8388607, -1, 0x123456, 0, 1};
+    uint8_t out[18];
+    for (int swap = 0; swap <= 1; swap++) {
+        for (int i = 0; i < 6; i++)
+            buf[i] = in[i ^ swap];
+        audio_pcm_pack(buf, 6);
+        audio_pcm_unpack_i2s((const uint32_t *)buf, out, 6, swap);
+        for (int i = 0; i < 6; i++) {
+            int32_t s = (int32_t)((uint32_t)out[3 * i] << 8 |
+                                  (uint32_t)out[3 * i + 1] << 16 |
+                                  (uint32_t)out[3 * i + 2] << 24) >> 8;
+            // Zero was played as the DC offset
+            CHECK_EQ_I32(s, in[i] ? in[i] : AUDIO_PCM_DC_OFFSET);
+        }
+    }
+}
+
+int main(void) {
+    test_swap();
+    test_volume_flat();
+    test_volume_ramp();
+    test_pack();
+    test_unpack_i2s();
+    return test_summary("audio_pcm");
+}
@@ -0,0 +1,148 @@
+// SPDX-License-Identifier: GPL-3.0-only
+// Copyright (c) 2026 Elia Chiarucci
+
+/*
+ * Host-side unit tests for the audio pipeline telemetry
+ * (App/Src/audio_stats.c).
+ *
+ * Built with AUDIO_STATS_READ_HOOK=test_read_hook: the hook runs writer
+ * calls in the middle of a reader's copy, as the audio stage preempting
+ * the CDC task would.
+ */
+
+#include "audio_stats.h"
+#include "test_util.h"
+#include <stdint.h>
+#include <string.h>
+
+static audio_stats_t stats;
+static int hook_writes;    // writer calls to run inside the next copies
+static int hook_calls;
+
+void test_read_hook(void);
+void test_read_hook(void) {
+    hook_calls++;
+    if (hook_writes > 0) {
+        hook_writes--;
+        audio_stats_period(&stats, 0, 96, 0);
+    }
+}
+
+static void test_period_outcomes(void) {
+    audio_stats_counters_t c;
+    audio_stats_init(&stats);
+
+    audio_stats_period(&stats, 2352, 96, 96); // full
+    audio_stats_period(&stats, 300, 96, 50);  // partial
+    audio_stats_period(&stats, 0, 96, 0);     // underrun
+    audio_stats_snapshot(&stats, &c, false);
+
+    CHECK_EQ_I32(c.periods, 3);
+    CHECK_EQ_I32(c.partial_fills, 1);
+    CHECK_EQ_I32(c.underruns, 1);
+    CHECK_EQ_I32(c.concealed_frames, 46 + 96);
+}
+
+static void test_level_histogram(void) {
+    audio_stats_counters_t c;
+    audio_stats_init(&stats);
+
+    audio_stats_period(&stats, 0, 96, 96);
+    audio_stats_period(&stats, AUDIO_STATS_LEVEL_STEP - 1, 96, 96);
+    audio_stats_period(&stats, AUDIO_STATS_LEVEL_STEP, 96, 96);
+    audio_stats_period(&stats, 2352, 96, 96); // 8 packets
+    audio_stats_period(&stats, UINT16_MAX, 96, 96); // clamps to the last
+    audio_stats_snapshot(&stats, &c, false);
+
+    CHECK_EQ_I32(c.level_hist[0], 2);
+    CHECK_EQ_I32(c.level_hist[1], 1);
+    CHECK_EQ_I32(c.level_hist[8], 1);
+    CHECK_EQ_I32(c.level_hist[AUDIO_STATS_LEVEL_BINS - 1], 1);
+    uint32_t sum = 0;
+    for (int i = 0; i < AUDIO_STATS_LEVEL_BINS; i++)
+        sum += c.level_hist[i];
+    CHECK_EQ_I32(sum, c.periods);
+}
+
+static void test_stream_and_errors(void) {
+    audio_stats_counters_t c;
+    audio_stats_init(&stats);
+
+    audio_stats_stream(&stats, true);
+    audio_stats_dropped(&stats, 588);
+    audio_stats_stream(&stats, false);
+    audio_stats_stream(&stats, true);
+    audio_stats_dma_error(&stats);
+    audio_stats_snapshot(&stats, &c, false);
+
+    CHECK_EQ_I32(c.stream_starts, 2);
+    CHECK_EQ_I32(c.stream_stops, 1);
+    CHECK_EQ_I32(c.dropped_bytes, 588);
+    CHECK_EQ_I32(c.dma_errors, 1);
+}
+
+static void test_reset_moves_baseline(void) {
+    audio_stats_counters_t c;
+    audio_stats_init(&stats);
+
+    for (int i = 0; i < 5; i++)
+        audio_stats_period(&stats, 0, 96, 0);
+    audio_stats_snapshot(&stats, &c, true);
+    CHECK_EQ_I32(c.underruns, 5);
+
+    audio_stats_period(&stats, 0, 96, 0);
+    audio_stats_snapshot(&stats, &c, false);
+    CHECK_EQ_I32(c.underruns, 1);
+    CHECK_EQ_I32(c.level_hist[0], 1);
+    // Without reset the count keeps running
+    audio_stats_snapshot(&stats, &c, false);
+    CHECK_EQ_I32(c.underruns, 1);
+
+    // The writer never sees the reset: its counters keep counting
+    CHECK_EQ_I32(stats.c.underruns, 6);
+}
+
+static void test_counters_wrap(void) {
+    audio_stats_counters_t c;
+    audio_stats_init(&stats);
+    stats.c.periods = UINT32_MAX - 1;
+    audio_stats_snapshot(&stats, &c, true);
+
+    for (int i = 0; i < 4; i++)
+        audio_stats_period(&stats, 0, 96, 96);
+    audio_stats_snapshot(&stats, &c, false);
+    CHECK_EQ_I32(c.periods, 4);
+}
+
+static void test_writer_preempts_copy(void) {
+    audio_stats_counters_t c;
+    audio_stats_init(&stats);
+    audio_stats_period(&stats, 0, 96, 96);
+
+    // Two writes land inside the copy: the torn copies are retried, and
+    // the result includes both (periods and underruns agree)
+    hook_calls = 0;
+    hook_writes = 2;
+    audio_stats_snapshot(&stats, &c, true);
+    CHECK_EQ_I32(hook_calls, 3);
+    CHECK_EQ_I32(c.periods, 3);
+    CHECK_EQ_I32(c.underruns, 2);
+    CHECK_EQ_I32(c.concealed_frames, 2 * 96);
+
+    // A reset snapshot loses nothing that lands during it
+    hook_writes = 1;
+    audio_stats_snapshot(&stats, &c, true);
+    CHECK_EQ_I32(c.periods, 1);
+    audio_stats_snapshot(&stats, &c, false);
+    CHECK_EQ_I32(c.periods, 0);
+}
+
+int main(void) {
+    test_period_outcomes();
+    test_level_histogram();
+    test_stream_and_errors();
+    test_reset_moves_baseline();
+    test_counters_wrap();
+    test_writer_preempts_copy();
+    return test_summary("audio_stats");
+}
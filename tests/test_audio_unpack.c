@@ -0,0 +1,192 @@
+// SPDX-License-Identifier: GPL-3.0-only
+// Copyright (c) 2026 Elia Chiarucci
+
+/*
+ * Host-side unit tests for the 24 and 16-bit unpack kernels and the GPDMA
+ * passthrough transfer plan (App/Src/audio_unpack.c). The GPDMA is
+ * replaced by audio_unpack_dma_model(), which must produce exactly the
+ * words the CPU path packs for a flat, unity-gain stream.
+ */
+
+#include "audio_unpack.h"
+#include "test_util.h"
+#include <stdint.h>
+#include <string.h>
+
+#define FRAMES 96 // one I2S half-buffer
+#define FIFO_DEPTH (16 * 294)
+
+static int32_t test_sample(uint32_t i) {
+    // Covers both signs and the full 24-bit range, distinct per position
+    return (int32_t)((i * 2654435761u) >> 8) - 8388608;
+}
+
+static void pack_s24(uint8_t *dst, int32_t v) {
+    dst[0] = (uint8_t)v;
+    dst[1] = (uint8_t)(v >> 8);
+    dst[2] = (uint8_t)(v >> 16);
+}
+
+// Fill a FIFO ring with frames starting at byte position rd, return regions
+static void fill_ring(uint8_t *ring, uint16_t rd, uint16_t frames,
+                      usb_audio_regions_t *rgn) {
+    for (uint32_t i = 0; i < (uint32_t)frames * 2; i++) {
+        uint8_t tmp[3];
+        pack_s24(tmp, test_sample(i));
+        for (uint8_t b = 0; b < 3; b++)
+            ring[(rd + i * 3 + b) % FIFO_DEPTH] = tmp[b];
+    }
+    uint16_t bytes = (uint16_t)(frames * 6);
+    uint16_t linear = (uint16_t)(FIFO_DEPTH - rd);
+    rgn->ptr[0] = &ring[rd];
+    rgn->len[0] = bytes < linear ? bytes : linear;
+    rgn->ptr[1] = ring;
+    rgn->len[1] = (uint16_t)(bytes - rgn->len[0]);
+}
+
+// What the CPU path writes to the I2S buffer in passthrough
+static uint32_t ref_word(uint32_t frame, uint8_t slot, int swap) {
+    uint8_t ch = swap ? (uint8_t)(1 - slot) : slot;
+    return (uint32_t)test_sample(frame * 2 + ch) << 8;
+}
+
+static void test_cpu_unpack_sign_extends(void) {
+    uint8_t src[4 * 3];
+    int32_t out[4];
+    pack_s24(&src[0], 0);
+    pack_s24(&src[3], 8388607);
+    pack_s24(&src[6], -8388608);
+    pack_s24(&src[9], -1);
+    audio_unpack_s24(src, out, 4);
+    CHECK_EQ_I32(out[0], 0);
+    CHECK_EQ_I32(out[1], 8388607);
+    CHECK_EQ_I32(out[2], -8388608);
+    CHECK_EQ_I32(out[3], -1);
+}
+
+static void test_cpu_unpack_across_wrap(void) {
+    static uint8_t ring[FIFO_DEPTH];
+    int32_t out[FRAMES * 2];
+    // Every byte offset around the ring end, including split samples
+    for (uint16_t back = 1; back <= 12; back++) {
+        usb_audio_regions_t rgn;
+        fill_ring(ring, (uint16_t)(FIFO_DEPTH - back), FRAMES, &rgn);
+        memset(out, 0, sizeof(out));
+        audio_unpack_s24_regions(&rgn, out, FRAMES * 2);
+        int ok = 1;
+        for (uint32_t i = 0; i < FRAMES * 2; i++)
+            ok &= out[i] == test_sample(i);
+        CHECK(ok);
+    }
+}
+
+static void run_dma_model(uint16_t rd, int swap) {
+    static uint8_t ring[FIFO_DEPTH];
+    uint32_t i2s[FRAMES * 2];
+    usb_audio_regions_t rgn;
+    audio_unpack_xfer_t x[AUDIO_UNPACK_MAX_XFERS];
+
+    fill_ring(ring, rd, FRAMES, &rgn);
+    uint8_t n = audio_unpack_dma_plan(&rgn, FRAMES, swap, x);
+    CHECK(n == (rgn.len[1] ? 4 : 2));
+
+    // Buffer as left behind by the silence/hold writers: pad byte 0 is 0
+    for (uint32_t i = 0; i < FRAMES * 2; i++)
+        i2s[i] = 0x7F7F7F00u;
+    audio_unpack_dma_model(x, n, (uint8_t *)i2s);
+
+    int ok = 1;
+    for (uint32_t f = 0; f < FRAMES; f++)
+        for (uint8_t slot = 0; slot < 2; slot++)
+            ok &= i2s[f * 2 + slot] == ref_word(f, slot, swap);
+    CHECK(ok);
+}
+
+static void test_s16_unpack_left_justifies(void) {
+    const int16_t in[5] = {0, 32767, -32768, -1, 0x1234};
+    uint8_t src[sizeof(in)];
+    for (int i = 0; i < 5; i++) {
+        src[2 * i] = (uint8_t)in[i];
+        src[2 * i + 1] = (uint8_t)((uint16_t)in[i] >> 8);
+    }
+    // Pairs and the odd tail, from every count
+    for (uint16_t count = 0; count <= 5; count++) {
+        int32_t out[6] = {0, 0, 0, 0, 0, 0x55};
+        audio_unpack_s16(src, out, count);
+        for (uint16_t i = 0; i < count; i++)
+            CHECK_EQ_I32(out[i], in[i] * 256);
+        CHECK_EQ_I32(out[5], 0x55);
+    }
+}
+
+static void test_s16_unpack_across_wrap(void) {
+    static uint8_t ring[FIFO_DEPTH];
+    int32_t out[FRAMES * 2];
+    for (uint16_t back = 1; back <= 8; back++) {
+        uint16_t rd = (uint16_t)(FIFO_DEPTH - back);
+        for (uint32_t i = 0; i < FRAMES * 2; i++) {
+            uint16_t v = (uint16_t)(test_sample(i) >> 8);
+            ring[(rd + i * 2) % FIFO_DEPTH] = (uint8_t)v;
+            ring[(rd + i * 2 + 1) % FIFO_DEPTH] = (uint8_t)(v >> 8);
+        }
+        usb_audio_regions_t rgn = {{&ring[rd], ring}, {back, FRAMES * 4 - back}};
+        memset(out, 0, sizeof(out));
+        audio_unpack_s16_regions(&rgn, out, FRAMES * 2);
+        int ok = 1;
+        for (uint32_t i = 0; i < FRAMES * 2; i++)
+            ok &= out[i] == (test_sample(i) >> 8) * 256;
+        CHECK(ok);
+    }
+}
+
+static void test_dma_model_matches_cpu_linear(void) {
+    run_dma_model(0, 0);
+    run_dma_model(0, 1);
+    run_dma_model(600, 1);
+}
+
+static void test_dma_model_matches_cpu_wrapped(void) {
+    // Frame-aligned wrap points: 1 frame and 50 frames before the ring end
+    run_dma_model(FIFO_DEPTH - 6, 0);
+    run_dma_model(FIFO_DEPTH - 6, 1);
+    run_dma_model(FIFO_DEPTH - 300, 1);
+}
+
+static void test_dma_plan_transfer_shape(void) {
+    static uint8_t ring[FIFO_DEPTH];
+    usb_audio_regions_t rgn;
+    audio_unpack_xfer_t x[AUDIO_UNPACK_MAX_XFERS];
+    fill_ring(ring, 0, FRAMES, &rgn);
+
+    CHECK_EQ_I32(audio_unpack_dma_plan(&rgn, FRAMES, 1, x), 2);
+    for (uint8_t i = 0; i < 2; i++) {
+        CHECK_EQ_I32(x[i].burst, 3);
+        CHECK_EQ_I32(x[i].src_gap, 3);
+        CHECK_EQ_I32(x[i].dst_gap, 5);
+        CHECK_EQ_I32(x[i].bytes, FRAMES * 3);
+        CHECK_EQ_I32(x[i].dst_offset % 4, 1); // never the pad byte
+    }
+    // Swapped: USB left lands in the right I2S slot and vice versa
+    CHECK_EQ_I32(x[0].dst_offset, 5);
+    CHECK_EQ_I32(x[1].dst_offset, 1);
+}
+
+static void test_dma_plan_rejects_split_frame(void) {
+    static uint8_t ring[FIFO_DEPTH];
+    usb_audio_regions_t rgn;
+    audio_unpack_xfer_t x[AUDIO_UNPACK_MAX_XFERS];
+    fill_ring(ring, FIFO_DEPTH - 9, FRAMES, &rgn); // 1.5 frames before end
+    CHECK_EQ_I32(audio_unpack_dma_plan(&rgn, FRAMES, 0, x), 0);
+}
+
+int main(void) {
+    test_cpu_unpack_sign_extends();
+    test_cpu_unpack_across_wrap();
+    test_s16_unpack_left_justifies();
+    test_s16_unpack_across_wrap();
+    test_dma_model_matches_cpu_linear();
+    test_dma_model_matches_cpu_wrapped();
+    test_dma_plan_transfer_shape();
+    test_dma_plan_rejects_split_frame();
+    return test_summary("audio_unpack");
+}
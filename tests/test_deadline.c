@@ -0,0 +1,98 @@
+// SPDX-License-Identifier: GPL-3.0-only
+// Copyright (c) 2026 Elia Chiarucci
+
+/*
+ * Host-side unit tests for the audio deadline monitor
+ * (App/Src/deadline.c).
+ */
+
+#include "deadline.h"
+#include "test_util.h"
+#include <stdint.h>
+#include <string.h>
+
+static void test_log2_bins(void) {
+    deadline_hist_t h;
+    memset(&h, 0, sizeof(h));
+
+    deadline_hist_add(&h, 0);    // bin 0
+    deadline_hist_add(&h, 1);    // bin 1: [1, 2)
+    deadline_hist_add(&h, 1000); // bin 10: [512, 1024)
+    deadline_hist_add(&h, 1024); // bin 11
+    deadline_hist_add(&h, 1u << 14); // last bin
+    deadline_hist_add(&h, UINT32_MAX);
+
+    CHECK_EQ_I32(h.bins[0], 1);
+    CHECK_EQ_I32(h.bins[1], 1);
+    CHECK_EQ_I32(h.bins[10], 1);
+    CHECK_EQ_I32(h.bins[11], 1);
+    CHECK_EQ_I32(h.bins[DEADLINE_HIST_BINS - 1], 2);
+    CHECK_EQ_I32(h.count, 6);
+    CHECK_EQ_I32(h.min_us, 0);
+    CHECK_EQ_I32(h.max_us, UINT32_MAX);
+}
+
+static void test_loop_and_slack(void) {
+    deadline_reset();
+    deadline_loop_pass(1000);
+    deadline_loop_pass(40);
+    deadline_slack(2500);
+
+    const deadline_state_t *st = deadline_state();
+    CHECK_EQ_I32(st->loop.count, 2);
+    CHECK_EQ_I32(st->loop.min_us, 40);
+    CHECK_EQ_I32(st->loop.max_us, 1000);
+    CHECK_EQ_I32(st->slack.count, 1);
+    CHECK_EQ_I32(st->slack.min_us, 2500);
+}
+
+static void test_miss_log_keeps_the_last(void) {
+    deadline_reset();
+    uint32_t base = deadline_state()->misses;
+
+    for (uint32_t i = 0; i < DEADLINE_MISS_LOG + 3; i++) {
+        deadline_miss_t m = {1000 + i, 10 * i, (uint8_t)i, 1};
+        deadline_miss(&m);
+    }
+    const deadline_state_t *st = deadline_state();
+    CHECK_EQ_I32(st->misses - base, DEADLINE_MISS_LOG + 3);
+
+    // The oldest three were overwritten
+    CHECK(deadline_logged(base + 2) == NULL);
+    const deadline_miss_t *m = deadline_logged(base + 3);
+    CHECK(m != NULL);
+    if (m) {
+        CHECK_EQ_I32(m->tick_ms, 1003);
+        CHECK_EQ_I32(m->late_us, 30);
+        CHECK_EQ_I32(m->task, 3);
+    }
+    m = deadline_logged(st->misses - 1);
+    CHECK(m != NULL && m->tick_ms == 1000 + DEADLINE_MISS_LOG + 2);
+    CHECK(deadline_logged(st->misses) == NULL);
+}
+
+static void test_reset_clears_but_keeps_total(void) {
+    deadline_miss_t m = {5, 6, 0, 0};
+    deadline_miss(&m);
+    deadline_slack(10);
+    uint32_t total = deadline_state()->misses;
+
+    deadline_reset();
+    const deadline_state_t *st = deadline_state();
+    CHECK_EQ_I32(st->misses, total);
+    CHECK_EQ_I32(st->log_start, total);
+    CHECK_EQ_I32(st->slack.count, 0);
+    CHECK_EQ_I32(st->loop.count, 0);
+    CHECK(deadline_logged(total - 1) == NULL);
+
+    deadline_miss(&m);
+    CHECK(deadline_logged(total) != NULL);
+}
+
+int main(void) {
+    test_log2_bins();
+    test_loop_and_slack();
+    test_miss_log_keeps_the_last();
+    test_reset_clears_but_keeps_total();
+    return test_summary("deadline");
+}
@@ -0,0 +1,119 @@
+// SPDX-License-Identifier: GPL-3.0-only
+// Copyright (c) 2026 Elia Chiarucci
+
+/*
+ * Host-side unit tests for the on-target DSP benchmark
+ * (App/Src/dsp_bench.c), built with DSP_BENCH_CYCLES=test_cycles: every
+ * read of the counter advances it 100 cycles, and the first kernel timed
+ * (unpack16) is made 1000 cycles slower (a cold cache).
+ */
+
+#include "audio_eq.h"
+#include "dsp_bench.h"
+#include "eq_profile.h"
+#include "test_util.h"
+#include <stdint.h>
+#include <string.h>
+
+#define READS_PER_RUN 9
+
+static uint32_t reads;
+
+uint32_t test_cycles(void) {
+    uint32_t c = reads * 100 + (reads >= 1 ? 1000 : 0);
+    reads++;
+    return c;
+}
+
+static eq_profile_t make_profile(void) {
+    eq_profile_t p;
+    memset(&p, 0, sizeof(p));
+    strcpy(p.name, "bench");
+    p.filter_count = 3;
+    for (uint8_t f = 0; f < 3; f++) {
+        p.filters[f].b0 = 1.0f;
+        p.filters[f].type = FILTER_BELL;
+        p.filters[f].enabled = 1;
+        p.filters[f].freq = 1000.0f;
+        p.filters[f].q = 0.707f;
+    }
+    p.filters[1].enabled = 0;
+    return p;
+}
+
+static void test_timings(void) {
+    static dsp_bench_report_t r;
+    reads = 0;
+    dsp_bench_run(&r);
+    CHECK_EQ_I32(reads, DSP_BENCH_RUNS * READS_PER_RUN);
+
+    const dsp_bench_result_t *u = &r.kernel[DSP_BENCH_UNPACK16];
+    CHECK_EQ_I32(u->runs, DSP_BENCH_RUNS);
+    CHECK_EQ_I32(u->min, 100);
+    CHECK_EQ_I32(u->max, 1100);
+    CHECK_EQ_I32(u->mean, 100 + 1000 / DSP_BENCH_RUNS);
+
+    const dsp_bench_result_t *v = &r.kernel[DSP_BENCH_VOLUME];
+    CHECK_EQ_I32(v->runs, DSP_BENCH_RUNS);
+    CHECK_EQ_I32(v->min, 100);
+    CHECK_EQ_I32(v->max, 100);
+    CHECK_EQ_I32(v->mean, 100);
+}
+
+static void test_profile_off_not_run(void) {
+    static dsp_bench_report_t r;
+    eq_profile_set_active(EQ_PROFILE_OFF);
+    audio_eq_set_band(EQ_BAND_BASS, 3);
+    audio_eq_set_band(EQ_BAND_TREBLE, -2);
+    dsp_bench_run(&r);
+    CHECK_EQ_I32(r.filter_count, 0);
+    CHECK_EQ_I32(r.kernel[DSP_BENCH_EQ_PROFILE].runs, 0);
+    CHECK_EQ_I32(r.kernel[DSP_BENCH_EQ_BT].runs, DSP_BENCH_RUNS);
+    CHECK_EQ_I32(r.bass, 3);
+    CHECK_EQ_I32(r.treble, -2);
+    CHECK(r.buffer != 0);
+}
+
+static void test_profile_counts_enabled_filters(void) {
+    static dsp_bench_report_t r;
+    eq_profile_t p = make_profile();
+    CHECK(eq_profile_set(0, &p));
+    eq_profile_set_active(0);
+    dsp_bench_run(&r);
+    CHECK_EQ_I32(r.filter_count, 2);
+    CHECK_EQ_I32(r.kernel[DSP_BENCH_EQ_PROFILE].runs, DSP_BENCH_RUNS);
+    eq_profile_set_active(EQ_PROFILE_OFF);
+}
+
+// The stream must not start on the benchmark's filter state
+static void test_filter_state_cleared(void) {
+    static dsp_bench_report_t r;
+    int32_t fresh[8] = {4000000, -4000000}, after[8] = {4000000, -4000000};
+    audio_eq_set_band(EQ_BAND_BASS, 6);
+    audio_eq_set_band(EQ_BAND_TREBLE, 6);
+    audio_eq_reset_state();
+    audio_eq_process(fresh, 8, 65536);
+
+    dsp_bench_run(&r);
+    audio_eq_process(after, 8, 65536);
+    CHECK(memcmp(fresh, after, sizeof(fresh)) == 0);
+}
+
+static void test_names(void) {
+    for (uint8_t i = 0; i < DSP_BENCH_COUNT; i++) {
+        const char *name = dsp_bench_name(i);
+        CHECK(name[0] != '\0');
+        CHECK(strlen(name) <= DSP_BENCH_NAME_LEN);
+    }
+    CHECK(strcmp(dsp_bench_name(DSP_BENCH_COUNT), "") == 0);
+}
+
+int main(void) {
+    audio_eq_init();
+    test_timings();
+    test_profile_off_not_run();
+    test_profile_counts_enabled_filters();
+    test_filter_state_cleared();
+    test_names();
+    return test_summary("dsp_bench");
+}
@@ -0,0 +1,737 @@
+// SPDX-License-Identifier: GPL-3.0-only
+// Copyright (c) 2026 Elia Chiarucci
+
+/*
+ * Audio quality gate for the DSP kernels (App/Src/audio_eq.c,
+ * App/Src/eq_profile.c).
+ *
+ * Every bass/treble setting of the 2-band EQ and a set of profile filters
+ * (each type over the band, plus a full 10-filter cascade) process:
+ *
+ *  - a multi-tone (31 log-spaced tones at -36dBFS each)
+ *  - full-scale tones (-1dBFS at 100Hz, 1kHz and 10kHz)
+ *  - a -60dBFS 1kHz tone
+ *  - a log sweep, 20Hz-20kHz at -6dBFS
+ *
+ * in periods of 96 frames, as the audio stage does, next to a reference
+ * in double precision with the same coefficients (coefficient rounding is
+ * part of the design and covered by the kernels' own tests; this measures
+ * what the arithmetic adds). Tones sit on FFT bins and are analysed after
+ * a settling pre-roll, unwindowed. Per setting:
+ *
+ *   err   RMS difference from the reference over all signals, dBFS
+ *   peak  largest difference from the reference, LSB
+ *   resp  largest magnitude response difference on the multi-tone, dB
+ *   thdn  THD+N of the worst full-scale tone, dB (clipping shows here:
+ *         pre-attenuation covers boost gains, not Q resonance or shelf
+ *         overshoot, so a -1dBFS tone near a Q4 corner clips)
+ *   noise noise and distortion under the -60dBFS tone, dBFS
+ *
+ * dsp_golden.txt holds the values of the current kernels. A setting whose
+ * metric gets worse than its golden value (by more than GOLDEN_DB_TOL for
+ * the dB figures), or whose fixed-point output is no longer bit-identical
+ * (hash), fails, as does anything past the absolute limits below. Float
+ * output is not hashed: it may differ in the last bit between compilers.
+ *
+ *   test_dsp_quality [--golden FILE] [--write FILE] [--verbose]
+ *
+ * --write regenerates the golden file after an intended change.
+ */
+
+#include "audio_eq.h"
+#include "eq_profile.h"
+#include <inttypes.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define FS          48000.0
+#define N           8192 // FFT frames (5.9Hz bins)
+#define PREROLL     (4 * N) // settles a Q4 filter at 30Hz to below -130dB
+#define PERIOD      96   // frames per process call
+#define FULL_SCALE  8388608.0
+#define MAX_SETTINGS 256
+
+#define GOLDEN_DB_TOL   0.5  // dB figures may drift by this much
+#define GOLDEN_RESP_TOL 0.001 // dB
+
+// Absolute limits: what the kernels must do whatever the golden file says.
+// The error limit is per kernel: Q12 truncation in audio_eq sits near
+// -99dBFS, single-precision DF2T in eq_profile loses ~25dB more on filters
+// far below fs/4 (30Hz at Q4 reaches -73dBFS).
+#define LIMIT_ERR_EQ_DBFS      (-95.0)
+#define LIMIT_ERR_PROFILE_DBFS (-70.0)
+#define LIMIT_RESP_DB          0.05   // same cause: 0.04dB at 30Hz, Q4
+#define LIMIT_NOISE_DBFS       (-120.0)
+
+// Tones the reference attenuates by more than this are in a stopband: the
+// response and THD+N there only measure the error, which err already does
+#define STOPBAND_DB (-40.0)
+
+// ---------------------------------------------------------------------------
+// FFT
+// ---------------------------------------------------------------------------
+
+static double fft_re[N], fft_im[N];
+
+// In place, radix 2
+static void fft(double *re, double *im) {
+    for (uint32_t i = 1, j = 0; i < N; i++) {
+        uint32_t bit = N >> 1;
+        for (; j & bit; bit >>= 1)
+            j ^= bit;
+        j |= bit;
+        if (i < j) {
+            double t = re[i];
+            re[i] = re[j];
+            re[j] = t;
+            t = im[i];
+            im[i] = im[j];
+            im[j] = t;
+        }
+    }
+    for (uint32_t len = 2; len <= N; len <<= 1) {
+        double ang = -2.0 * M_PI / len;
+        for (uint32_t i = 0; i < N; i += len) {
+            for (uint32_t k = 0; k < len / 2; k++) {
+                double wr = cos(ang * k), wi = sin(ang * k);
+                uint32_t a = i + k, b = a + len / 2;
+                double xr = re[b] * wr - im[b] * wi;
+                double xi = re[b] * wi + im[b] * wr;
+                re[b] = re[a] - xr;
+                im[b] = im[a] - xi;
+                re[a] += xr;
+                im[a] += xi;
+            }
+        }
+    }
+}
+
+// Power per bin 0..N/2 of one channel of an interleaved capture
+static double spectrum[N / 2 + 1];
+static double spectrum_ph[N / 2 + 1]; // phase, for the response
+
+static void analyse(const double *x) {
+    for (uint32_t i = 0; i < N; i++) {
+        fft_re[i] = x[2 * i];
+        fft_im[i] = 0.0;
+    }
+    fft(fft_re, fft_im);
+    for (uint32_t k = 0; k <= N / 2; k++) {
+        spectrum[k] = fft_re[k] * fft_re[k] + fft_im[k] * fft_im[k];
+        spectrum_ph[k] = atan2(fft_im[k], fft_re[k]);
+    }
+}
+
+// Everything but DC and the fundamental (the DAC output is AC coupled)
+static double residual_power(uint32_t bin) {
+    double p = 0.0;
+    for (uint32_t k = 1; k <= N / 2; k++)
+        if (k != bin)
+            p += spectrum[k];
+    return p;
+}
+
+static uint32_t bin_of(double hz) { return (uint32_t)lrint(hz * N / FS); }
+
+static double bin_hz(uint32_t bin) { return bin * FS / N; }
+
+// ---------------------------------------------------------------------------
+// Kernels and their references
+// ---------------------------------------------------------------------------
+
+// One kernel at one setting. The reference works on interleaved stereo in
+// double, in LSB, and clamps like the kernel but never rounds.
+typedef struct {
+    const char *kernel;
+    char setting[48];
+    bool exact; // fixed point: output hashed
+    double limit_err; // dBFS
+    void (*dut_reset)(void);
+    void (*dut)(int32_t *buf, uint16_t samples);
+    void (*ref_reset)(void);
+    void (*ref)(double *buf, uint32_t samples);
+} quality_kernel_t;
+
+static double clamp24(double x) {
+    if (x > 8388607.0)
+        return 8388607.0;
+    if (x < -8388608.0)
+        return -8388608.0;
+    return x;
+}
+
+// --- Bass/treble EQ: the firmware's Q12 design values ---
+
+#define EQ_BASS_LP_ALPHA   (95.0 / 4096.0)
+#define EQ_BASS_HP_ALPHA   (27.0 / 4096.0)
+#define EQ_TREBLE_LP_ALPHA (817.0 / 4096.0)
+
+static const double eq_gain[7] = {0, 500, 1061, 1690, 2396, 3188, 4077};
+static const double eq_preatt[7] = {4096, 3652, 3254, 2900, 2585, 2303, 2053};
+
+static int8_t eq_bass, eq_treble;
+static double eq_hp[2], eq_lp1[2], eq_lp2[2], eq_tlp[2];
+
+static void eq_dut_reset(void) {
+    audio_eq_init();
+    audio_eq_set_band(EQ_BAND_BASS, eq_bass);
+    audio_eq_set_band(EQ_BAND_TREBLE, eq_treble);
+}
+
+static void eq_dut(int32_t *buf, uint16_t samples) {
+    audio_eq_process(buf, samples, 65536);
+}
+
+static void eq_ref_reset(void) {
+    for (int ch = 0; ch < 2; ch++)
+        eq_hp[ch] = eq_lp1[ch] = eq_lp2[ch] = eq_tlp[ch] = 0.0;
+}
+
+static void eq_ref(double *buf, uint32_t samples) {
+    if (!eq_bass && !eq_treble)
+        return;
+    int boost = eq_bass > eq_treble ? eq_bass : eq_treble;
+    double preatt = eq_preatt[boost > 0 ? boost : 0] / 4096.0;
+    double bg = eq_gain[abs(eq_bass)] / 4096.0 * (eq_bass < 0 ? -1 : 1);
+    double tg = eq_gain[abs(eq_treble)] / 4096.0 * (eq_treble < 0 ? -1 : 1);
+
+    for (uint32_t i = 0; i < samples; i++) {
+        int ch = i & 1;
+        double x = buf[i] * preatt;
+        if (eq_bass) {
+            eq_hp[ch] += EQ_BASS_HP_ALPHA * (x - eq_hp[ch]);
+            double hp = x - eq_hp[ch];
+            eq_lp1[ch] += EQ_BASS_LP_ALPHA * (hp - eq_lp1[ch]);
+            eq_lp2[ch] += EQ_BASS_LP_ALPHA * (eq_lp1[ch] - eq_lp2[ch]);
+            x += bg * eq_lp2[ch];
+        }
+        if (eq_treble) {
+            eq_tlp[ch] += EQ_TREBLE_LP_ALPHA * (x - eq_tlp[ch]);
+            x += tg * (x - eq_tlp[ch]);
+        }
+        buf[i] = clamp24(x);
+    }
+}
+
+// --- Profile EQ: RBJ cookbook filters, as the PC app designs them ---
+
+typedef struct {
+    uint8_t type;
+    double freq, gain, q;
+} profile_filter_t;
+
+static eq_profile_t profile;
+static double prof_preatt;
+static double prof_s[EQ_MAX_FILTERS][2][2];
+
+static void design(eq_filter_t *f, const profile_filter_t *p) {
+    double a = pow(10.0, p->gain / 40.0);
+    double w0 = 2.0 * M_PI * p->freq / FS;
+    double cw = cos(w0), alpha = sin(w0) / (2.0 * p->q);
+    double sa = 2.0 * sqrt(a) * alpha;
+    double b0, b1, b2, a0, a1, a2;
+    switch (p->type) {
+    case FILTER_LOW_SHELF:
+        b0 = a * ((a + 1) - (a - 1) * cw + sa);
+        b1 = 2 * a * ((a - 1) - (a + 1) * cw);
+        b2 = a * ((a + 1) - (a - 1) * cw - sa);
+        a0 = (a + 1) + (a - 1) * cw + sa;
+        a1 = -2 * ((a - 1) + (a + 1) * cw);
+        a2 = (a + 1) + (a - 1) * cw - sa;
+        break;
+    case FILTER_HIGH_SHELF:
+        b0 = a * ((a + 1) + (a - 1) * cw + sa);
+        b1 = -2 * a * ((a - 1) + (a + 1) * cw);
+        b2 = a * ((a + 1) + (a - 1) * cw - sa);
+        a0 = (a + 1) - (a - 1) * cw + sa;
+        a1 = 2 * ((a - 1) - (a + 1) * cw);
+        a2 = (a + 1) - (a - 1) * cw - sa;
+        break;
+    case FILTER_LOW_PASS:
+        b0 = b2 = (1 - cw) / 2;
+        b1 = 1 - cw;
+        a0 = 1 + alpha;
+        a1 = -2 * cw;
+        a2 = 1 - alpha;
+        break;
+    case FILTER_HIGH_PASS:
+        b0 = b2 = (1 + cw) / 2;
+        b1 = -(1 + cw);
+        a0 = 1 + alpha;
+        a1 = -2 * cw;
+        a2 = 1 - alpha;
+        break;
+    default: // bell
+        b0 = 1 + alpha * a;
+        b1 = -2 * cw;
+        b2 = 1 - alpha * a;
+        a0 = 1 + alpha / a;
+        a1 = -2 * cw;
+        a2 = 1 - alpha / a;
+        break;
+    }
+    f->b0 = (float)(b0 / a0);
+    f->b1 = (float)(b1 / a0);
+    f->b2 = (float)(b2 / a0);
+    f->a1 = (float)(a1 / a0);
+    f->a2 = (float)(a2 / a0);
+    f->freq = (float)p->freq;
+    f->gain = (float)p->gain;
+    f->q = (float)p->q;
+    f->type = p->type;
+    f->enabled = 1;
+}
+
+static void profile_build(const profile_filter_t *filters, uint8_t count) {
+    memset(&profile, 0, sizeof(profile));
+    strcpy(profile.name, "quality");
+    profile.filter_count = count;
+    float sum_db = 0.0f;
+    for (uint8_t f = 0; f < count; f++) {
+        design(&profile.filters[f], &filters[f]);
+        if (profile.filters[f].gain > 0.0f)
+            sum_db += profile.filters[f].gain;
+    }
+    // The firmware's pre-attenuation (compute_profile_preatt), same value
+    float lin = sum_db > 0.0f ? powf(10.0f, -sum_db * 0.05f) : 1.0f;
+    prof_preatt = lin < 0.01f ? 0.01f : lin;
+}
+
+static void prof_dut_reset(void) {
+    if (!eq_profile_set(0, &profile)) {
+        fprintf(stderr, "profile rejected\n");
+        exit(2);
+    }
+    eq_profile_set_active(0);
+    eq_profile_reset_state();
+}
+
+static void prof_dut(int32_t *buf, uint16_t samples) {
+    eq_profile_process(buf, samples, 65536);
+}
+
+static void prof_ref_reset(void) { memset(prof_s, 0, sizeof(prof_s)); }
+
+static void prof_ref(double *buf, uint32_t samples) {
+    for (uint32_t i = 0; i < samples; i++) {
+        int ch = i & 1;
+        double x = buf[i] * prof_preatt;
+        for (uint8_t f = 0; f < profile.filter_count; f++) {
+            const eq_filter_t *c = &profile.filters[f];
+            double *s = prof_s[f][ch];
+            double y = c->b0 * x + s[0];
+            s[0] = c->b1 * x - c->a1 * y + s[1];
+            s[1] = c->b2 * x - c->a2 * y;
+            x = y;
+        }
+        buf[i] = clamp24(x);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Signals and measurement
+// ---------------------------------------------------------------------------
+
+#define MULTITONES 31
+
+typedef struct {
+    uint64_t hash; // FNV-1a over every output sample
+    double err_sq; // sum of squared differences from the reference
+    uint32_t err_n;
+    double peak;
+    double resp, thdn, noise;
+} quality_result_t;
+
+static int32_t dut_buf[(PREROLL + N) * 2];
+static double in_buf[(PREROLL + N) * 2];
+static double ref_buf[(PREROLL + N) * 2];
+static double cap[N * 2];
+
+static uint32_t multitone_bins[MULTITONES];
+
+static void hash_add(uint64_t *h, int32_t v) {
+    for (int b = 0; b < 4; b++) {
+        *h ^= (uint8_t)((uint32_t)v >> (8 * b));
+        *h *= 0x100000001B3ULL;
+    }
+}
+
+// Run `frames` frames of in_buf through both from reset; returns through
+// dut_buf and ref_buf. Differences are counted from frame `from` on.
+static void run(const quality_kernel_t *k, uint32_t frames, uint32_t from,
+                quality_result_t *r) {
+    k->dut_reset();
+    k->ref_reset();
+    for (uint32_t i = 0; i < frames * 2; i++) {
+        dut_buf[i] = (int32_t)in_buf[i];
+        ref_buf[i] = in_buf[i];
+    }
+    for (uint32_t f = 0; f < frames; f += PERIOD) {
+        uint32_t n = frames - f < PERIOD ? frames - f : PERIOD;
+        k->dut(&dut_buf[f * 2], (uint16_t)(n * 2));
+        k->ref(&ref_buf[f * 2], n * 2);
+    }
+    for (uint32_t i = 0; i < frames * 2; i++) {
+        hash_add(&r->hash, dut_buf[i]);
+        if (i < from * 2)
+            continue;
+        double d = dut_buf[i] - ref_buf[i];
+        r->err_sq += d * d;
+        r->err_n++;
+        if (fabs(d) > r->peak)
+            r->peak = fabs(d);
+    }
+}
+
+// Periodic signal of N frames, tiled over the pre-roll and the capture
+static void tile(void) {
+    for (uint32_t i = N * 2; i < (PREROLL + N) * 2; i++)
+        in_buf[i] = in_buf[i % (N * 2)];
+}
+
+static void make_tone(double hz, double dbfs) {
+    double amp = (FULL_SCALE - 1) * pow(10.0, dbfs / 20.0);
+    double w = 2.0 * M_PI * bin_hz(bin_of(hz)) / FS;
+    for (uint32_t n = 0; n < N; n++)
+        in_buf[2 * n] = in_buf[2 * n + 1] = lrint(amp * sin(w * n));
+    tile();
+}
+
+static void capture(const void *buf, bool dut) {
+    for (uint32_t i = 0; i < N * 2; i++)
+        cap[i] = dut ? ((const int32_t *)buf)[PREROLL * 2 + i]
+                     : ((const double *)buf)[PREROLL * 2 + i];
+}
+
+static void measure(const quality_kernel_t *k, quality_result_t *r) {
+    memset(r, 0, sizeof(*r));
+    r->hash = 0xCBF29CE484222325ULL;
+    r->thdn = -300.0;
+
+    // Multi-tone: response of the kernel against the reference, per tone
+    uint32_t lcg = 1;
+    for (uint32_t n = 0; n < N; n++)
+        in_buf[2 * n] = 0.0;
+    double amp = (FULL_SCALE - 1) * pow(10.0, -36.0 / 20.0);
+    for (int t = 0; t < MULTITONES; t++) {
+        lcg = lcg * 1664525U + 1013904223U;
+        double phase = lcg / 4294967296.0 * 2.0 * M_PI;
+        double w = 2.0 * M_PI * bin_hz(multitone_bins[t]) / FS;
+        for (uint32_t n = 0; n < N; n++)
+            in_buf[2 * n] += amp * sin(w * n + phase);
+    }
+    for (uint32_t n = 0; n < N; n++)
+        in_buf[2 * n] = in_buf[2 * n + 1] = lrint(in_buf[2 * n]);
+    tile();
+    run(k, PREROLL + N, PREROLL, r);
+    static double ref_mag[MULTITONES];
+    capture(ref_buf, false);
+    analyse(cap);
+    for (int t = 0; t < MULTITONES; t++)
+        ref_mag[t] = spectrum[multitone_bins[t]];
+    double tone_power = (amp * N / 2) * (amp * N / 2);
+    capture(dut_buf, true);
+    analyse(cap);
+    for (int t = 0; t < MULTITONES; t++) {
+        if (10.0 * log10(ref_mag[t] / tone_power) < STOPBAND_DB)
+            continue;
+        double db = 10.0 * log10(spectrum[multitone_bins[t]] / ref_mag[t]);
+        if (fabs(db) > r->resp)
+            r->resp = fabs(db);
+    }
+
+    // Full-scale tones: THD+N
+    static const double fs_tones[] = {100.0, 1000.0, 10000.0};
+    for (size_t t = 0; t < sizeof(fs_tones) / sizeof(fs_tones[0]); t++) {
+        make_tone(fs_tones[t], -1.0);
+        run(k, PREROLL + N, PREROLL, r);
+        uint32_t bin = bin_of(fs_tones[t]);
+        capture(ref_buf, false);
+        analyse(cap);
+        double in_power = pow((FULL_SCALE - 1) * pow(10.0, -1.0 / 20.0) *
+                              N / 2, 2.0);
+        if (10.0 * log10(spectrum[bin] / in_power) < STOPBAND_DB)
+            continue;
+        capture(dut_buf, true);
+        analyse(cap);
+        double thdn = 10.0 * log10(residual_power(bin) / spectrum[bin] + 1e-30);
+        if (thdn > r->thdn)
+            r->thdn = thdn;
+    }
+
+    // Low-level tone: the noise floor, against a full-scale sine's power
+    make_tone(1000.0, -60.0);
+    run(k, PREROLL + N, PREROLL, r);
+    capture(dut_buf, true);
+    analyse(cap);
+    double fs_power = (FULL_SCALE * N / 2) * (FULL_SCALE * N / 2);
+    r->noise = 10.0 * log10(residual_power(bin_of(1000.0)) / fs_power + 1e-30);
+
+    // Log sweep from silence, compared sample by sample
+    double amp6 = (FULL_SCALE - 1) * pow(10.0, -6.0 / 20.0);
+    double k_sweep = log(20000.0 / 20.0);
+    uint32_t frames = PREROLL + N;
+    for (uint32_t n = 0; n < frames; n++) {
+        double ph = 2.0 * M_PI * 20.0 * frames / FS / k_sweep *
+                    (exp(k_sweep * n / frames) - 1.0);
+        in_buf[2 * n] = in_buf[2 * n + 1] = lrint(amp6 * sin(ph));
+    }
+    run(k, frames, 0, r);
+}
+
+static double err_dbfs(const quality_result_t *r) {
+    double rms = sqrt(r->err_sq / (r->err_n ? r->err_n : 1));
+    return 20.0 * log10(rms / (FULL_SCALE / sqrt(2.0)) + 1e-30);
+}
+
+// ---------------------------------------------------------------------------
+// Settings
+// ---------------------------------------------------------------------------
+
+static quality_kernel_t settings[MAX_SETTINGS];
+static profile_filter_t setting_filters[MAX_SETTINGS][EQ_MAX_FILTERS];
+static uint8_t setting_filter_count[MAX_SETTINGS];
+static int setting_count;
+
+static void add_eq(int8_t bass, int8_t treble) {
+    quality_kernel_t *k = &settings[setting_count++];
+    k->kernel = "audio_eq";
+    snprintf(k->setting, sizeof(k->setting), "bass%+d/treble%+d", bass,
+             treble);
+    k->exact = true;
+    k->limit_err = LIMIT_ERR_EQ_DBFS;
+    k->dut_reset = eq_dut_reset;
+    k->dut = eq_dut;
+    k->ref_reset = eq_ref_reset;
+    k->ref = eq_ref;
+}
+
+static void add_profile(const char *name, const profile_filter_t *f,
+                        uint8_t count) {
+    int i = setting_count++;
+    quality_kernel_t *k = &settings[i];
+    k->kernel = "eq_profile";
+    snprintf(k->setting, sizeof(k->setting), "%s", name);
+    k->exact = false;
+    k->limit_err = LIMIT_ERR_PROFILE_DBFS;
+    k->dut_reset = prof_dut_reset;
+    k->dut = prof_dut;
+    k->ref_reset = prof_ref_reset;
+    k->ref = prof_ref;
+    memcpy(setting_filters[i], f, count * sizeof(*f));
+    setting_filter_count[i] = count;
+}
+
+static void make_settings(void) {
+    for (int8_t b = EQ_VALUE_MIN; b <= EQ_VALUE_MAX; b++)
+        for (int8_t t = EQ_VALUE_MIN; t <= EQ_VALUE_MAX; t++)
+            add_eq(b, t);
+
+    // Each filter type low, mid and high in the band, boost and cut
+    static const struct {
+        uint8_t type;
+        const char *name;
+        bool gain;
+    } types[] = {
+        {FILTER_BELL, "bell", true},
+        {FILTER_LOW_SHELF, "lowshelf", true},
+        {FILTER_HIGH_SHELF, "highshelf", true},
+        {FILTER_LOW_PASS, "lowpass", false},
+        {FILTER_HIGH_PASS, "highpass", false},
+    };
+    static const double freqs[] = {30.0, 1000.0, 15000.0};
+    static const double gains[] = {-12.0, 12.0};
+    static const double qs[] = {0.707, 4.0};
+    for (size_t t = 0; t < sizeof(types) / sizeof(types[0]); t++) {
+        for (size_t f = 0; f < sizeof(freqs) / sizeof(freqs[0]); f++) {
+            for (size_t g = 0; g < (types[t].gain ? 2u : 1u); g++) {
+                for (size_t q = 0; q < sizeof(qs) / sizeof(qs[0]); q++) {
+                    profile_filter_t pf = {types[t].type, freqs[f],
+                                           types[t].gain ? gains[g] : 0.0,
+                                           qs[q]};
+                    char name[48];
+                    if (types[t].gain)
+                        snprintf(name, sizeof(name), "%s/%g/%+g/q%g",
+                                 types[t].name, freqs[f], gains[g], qs[q]);
+                    else
+                        snprintf(name, sizeof(name), "%s/%g/q%g",
+                                 types[t].name, freqs[f], qs[q]);
+                    add_profile(name, &pf, 1);
+                }
+            }
+        }
+    }
+
+    // A full headphone-style correction: every filter slot in use
+    static const profile_filter_t cascade[EQ_MAX_FILTERS] = {
+        {FILTER_HIGH_PASS, 15.0, 0.0, 0.707},
+        {FILTER_LOW_SHELF, 105.0, 5.5, 0.707},
+        {FILTER_BELL, 200.0, -2.0, 0.9},
+        {FILTER_BELL, 1100.0, 1.5, 1.4},
+        {FILTER_BELL, 2800.0, -3.0, 2.5},
+        {FILTER_BELL, 3500.0, 2.0, 4.0},
+        {FILTER_BELL, 5800.0, -4.5, 5.0},
+        {FILTER_BELL, 8200.0, 3.0, 3.0},
+        {FILTER_HIGH_SHELF, 10000.0, -2.5, 0.707},
+        {FILTER_LOW_PASS, 21000.0, 0.0, 0.707},
+    };
+    add_profile("cascade10", cascade, EQ_MAX_FILTERS);
+}
+
+// ---------------------------------------------------------------------------
+// Golden file
+// ---------------------------------------------------------------------------
+
+typedef struct {
+    char key[64];
+    char hash[20];
+    double err, peak, resp, thdn, noise;
+} golden_t;
+
+static golden_t golden[MAX_SETTINGS];
+static int golden_count;
+
+static void load_golden(const char *path) {
+    FILE *f = fopen(path, "r");
+    if (!f) {
+        fprintf(stderr, "cannot read golden file %s\n", path);
+        exit(2);
+    }
+    char line[256];
+    while (fgets(line, sizeof(line), f) && golden_count < MAX_SETTINGS) {
+        golden_t *g = &golden[golden_count];
+        if (line[0] == '#' ||
+            sscanf(line, "%63s %19s %lf %lf %lf %lf %lf", g->key, g->hash,
+                   &g->err, &g->peak, &g->resp, &g->thdn, &g->noise) != 7)
+            continue;
+        golden_count++;
+    }
+    fclose(f);
+}
+
+static const golden_t *find_golden(const char *key) {
+    for (int i = 0; i < golden_count; i++)
+        if (strcmp(golden[i].key, key) == 0)
+            return &golden[i];
+    return NULL;
+}
+
+int main(int argc, char **argv) {
+    const char *golden_path = NULL, *write_path = NULL;
+    bool verbose = false;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--verbose") == 0)
+            verbose = true;
+        else if (i + 1 < argc && strcmp(argv[i], "--golden") == 0)
+            golden_path = argv[++i];
+        else if (i + 1 < argc && strcmp(argv[i], "--write") == 0)
+            write_path = argv[++i];
+    }
+    if (golden_path)
+        load_golden(golden_path);
+
+    // Multi-tone bins, log-spaced 20Hz..20kHz
+    for (int t = 0; t < MULTITONES; t++)
+        multitone_bins[t] =
+            bin_of(20.0 * pow(1000.0, (double)t / (MULTITONES - 1)));
+
+    make_settings();
+
+    FILE *out = NULL;
+    if (write_path) {
+        out = fopen(write_path, "w");
+        if (!out) {
+            fprintf(stderr, "cannot write %s\n", write_path);
+            return 2;
+        }
+        fprintf(out, "# DSP quality golden values (tests/test_dsp_quality.c)."
+                     " Regenerate with\n# test_dsp_quality --write <this "
+                     "file> after an intended change.\n"
+                     "# setting hash err_dbfs peak_lsb resp_db thdn_db "
+                     "noise_dbfs\n");
+    }
+
+    int failures = 0;
+    double worst_err = -300.0, worst_noise = -300.0, worst_resp = 0.0;
+    for (int i = 0; i < setting_count; i++) {
+        quality_kernel_t *k = &settings[i];
+        if (!k->exact)
+            profile_build(setting_filters[i], setting_filter_count[i]);
+        else
+            sscanf(k->setting, "bass%hhd/treble%hhd", &eq_bass, &eq_treble);
+
+        quality_result_t r;
+        measure(k, &r);
+        double err = err_dbfs(&r);
+
+        char key[64], hash[20];
+        snprintf(key, sizeof(key), "%s/%s", k->kernel, k->setting);
+        if (k->exact)
+            snprintf(hash, sizeof(hash), "%016" PRIx64, r.hash);
+        else
+            strcpy(hash, "-");
+        if (out)
+            fprintf(out, "%s %s %.1f %.0f %.4f %.1f %.1f\n", key, hash, err,
+                    r.peak, r.resp, r.thdn, r.noise);
+
+        // Absolute limits
+        char why[160] = "";
+        if (err > k->limit_err)
+            snprintf(why, sizeof(why), "error %.1f dBFS", err);
+        else if (r.resp > LIMIT_RESP_DB)
+            snprintf(why, sizeof(why), "response off by %.4f dB", r.resp);
+        else if (r.noise > LIMIT_NOISE_DBFS)
+            snprintf(why, sizeof(why), "noise %.1f dBFS", r.noise);
+
+        // Golden values
+        const golden_t *g = find_golden(key);
+        if (!why[0] && g) {
+            if (strcmp(g->hash, hash) != 0)
+                snprintf(why, sizeof(why), "output changed (hash %s, golden "
+                         "%s)", hash, g->hash);
+            else if (err > g->err + GOLDEN_DB_TOL)
+                snprintf(why, sizeof(why), "error %.1f dBFS, golden %.1f",
+                         err, g->err);
+            else if (r.peak > g->peak * 2.0 + 2.0)
+                snprintf(why, sizeof(why), "peak error %.0f LSB, golden %.0f",
+                         r.peak, g->peak);
+            else if (r.resp > g->resp + GOLDEN_RESP_TOL)
+                snprintf(why, sizeof(why), "response off by %.4f dB, golden "
+                         "%.4f", r.resp, g->resp);
+            else if (r.thdn > g->thdn + GOLDEN_DB_TOL)
+                snprintf(why, sizeof(why), "THD+N %.1f dB, golden %.1f",
+                         r.thdn, g->thdn);
+            else if (r.noise > g->noise + GOLDEN_DB_TOL)
+                snprintf(why, sizeof(why), "noise %.1f dBFS, golden %.1f",
+                         r.noise, g->noise);
+        } else if (!why[0] && golden_path) {
+            snprintf(why, sizeof(why), "no golden value");
+        }
+
+        if (why[0]) {
+            printf("FAIL %s: %s\n", key, why);
+            failures++;
+        } else if (verbose) {
+            printf("%-36s err %6.1f dBFS  peak %4.0f LSB  resp %.4f dB  "
+                   "THD+N %6.1f dB  noise %6.1f dBFS\n",
+                   key, err, r.peak, r.resp, r.thdn, r.noise);
+        }
+        if (err > worst_err)
+            worst_err = err;
+        if (r.noise > worst_noise)
+            worst_noise = r.noise;
+        if (r.resp > worst_resp)
+            worst_resp = r.resp;
+    }
+    if (out)
+        fclose(out);
+
+    printf("dsp_quality: %d settings, %d failures (worst error %.1f dBFS, "
+           "response %.4f dB, noise %.1f dBFS)\n",
+           setting_count, failures, worst_err, worst_resp, worst_noise);
+    return failures ? 1 : 0;
+}
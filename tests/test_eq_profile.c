@@ -183,6 +183,79 @@ static void test_filter_count_clamped(void) {
     CHECK(eq_profile_delete(0));
 }
 
+// RBJ bell at fs, as the PC app designs it
+static eq_profile_t make_bell_profile(float freq, float gain, float q,
+                                      double fs) {
+    eq_profile_t p = make_passthrough_profile();
+    eq_filter_t *f = &p.filters[0];
+    double a = pow(10.0, gain / 40.0);
+    double w0 = 2.0 * M_PI * freq / fs;
+    double alpha = sin(w0) / (2.0 * q);
+    double a0 = 1.0 + alpha / a;
+    f->b0 = (float)((1.0 + alpha * a) / a0);
+    f->b1 = (float)(-2.0 * cos(w0) / a0);
+    f->b2 = (float)((1.0 - alpha * a) / a0);
+    f->a1 = f->b1;
+    f->a2 = (float)((1.0 - alpha / a) / a0);
+    f->freq = freq;
+    f->gain = gain;
+    f->q = q;
+    return p;
+}
+
+// Steady-state peak gain in dB for a tone at f Hz through the active
+// profile at rate
+static double tone_gain_db(double f, uint32_t rate) {
+    int32_t buf[BUF_SAMPLES];
+    double peak = 0.0;
+    uint32_t frames = rate / 10;
+    eq_profile_reset_state();
+    for (uint32_t n = 0; n < frames; n += BUF_SAMPLES / 2) {
+        for (int i = 0; i < BUF_SAMPLES; i += 2) {
+            double x = sin(2.0 * M_PI * f * (n + i / 2) / rate);
+            buf[i] = buf[i + 1] = (int32_t)(1000000.0 * x);
+        }
+        eq_profile_process(buf, BUF_SAMPLES, 65536);
+        if (n >= frames / 2)
+            for (int i = 0; i < BUF_SAMPLES; i++)
+                if (fabs((double)buf[i]) > peak)
+                    peak = fabs((double)buf[i]);
+    }
+    return 20.0 * log10(peak / 1000000.0);
+}
+
+static void test_profile_redesigned_at_rate(void) {
+    CHECK(!eq_profile_set_rate(4000));
+    CHECK_EQ_I32(eq_profile_get_rate(), 48000);
+
+    // +6dB bell at 1kHz: the pre-attenuation takes the peak back to 0dB
+    eq_profile_t p = make_bell_profile(1000.0f, 6.0f, 1.0f, 48000.0);
+    CHECK(eq_profile_set(0, &p));
+    eq_profile_set_active(0);
+    CHECK(fabs(tone_gain_db(1000.0, 48000)) < 0.1);
+
+    // At 96kHz the stored 48kHz coefficients would peak at 2kHz; the
+    // redesign keeps the peak where the profile says
+    CHECK(eq_profile_set_rate(96000));
+    CHECK_EQ_I32(eq_profile_get_rate(), 96000);
+    CHECK(fabs(tone_gain_db(1000.0, 96000)) < 0.1);
+    CHECK(tone_gain_db(2000.0, 96000) < -1.0);
+
+    // Edited while active at 96kHz: the redesign follows
+    p = make_bell_profile(4000.0f, 6.0f, 1.0f, 48000.0);
+    CHECK(eq_profile_set(0, &p));
+    CHECK(fabs(tone_gain_db(4000.0, 96000)) < 0.1);
+    CHECK(tone_gain_db(1000.0, 96000) < -1.0);
+
+    // Stored coefficients untouched; back at 48kHz they run again
+    CHECK(eq_profile_get(0)->filters[0].b0 == p.filters[0].b0);
+    CHECK(eq_profile_set_rate(48000));
+    CHECK(fabs(tone_gain_db(4000.0, 48000)) < 0.1);
+
+    CHECK(eq_profile_delete(0));
+    eq_profile_set_active(EQ_PROFILE_OFF);
+}
+
 int main(void) {
     test_valid_profile_accepted();
     test_nan_and_inf_coefficients_rejected();
@@ -194,5 +267,6 @@ int main(void) {
     test_processing_applies_volume();
     test_off_profile_leaves_buffer_untouched();
     test_filter_count_clamped();
+    test_profile_redesigned_at_rate();
     return test_summary("eq_profile");
 }
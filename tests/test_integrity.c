@@ -0,0 +1,62 @@
+// SPDX-License-Identifier: GPL-3.0-only
+// Copyright (c) 2026 Elia Chiarucci
+
+/*
+ * Host-side unit tests for the checksums (App/Src/integrity.c), built with
+ * the software CRC-32.
+ */
+
+#include "integrity.h"
+#include "test_util.h"
+#include <stdint.h>
+#include <string.h>
+
+static const char check[] = "123456789";
+
+static void test_crc32(void) {
+    // No peripheral to check: nothing to disagree with
+    CHECK(integrity_init());
+
+    // zlib's check value, as the EQ profile stores carry
+    CHECK_EQ_I32(integrity_crc32(0, check, 9), 0xCBF43926U);
+    CHECK_EQ_I32(integrity_crc32(0, check, 0), 0);
+
+    // In pieces, from any offset: the same
+    uint32_t crc = integrity_crc32(0, check, 1);
+    crc = integrity_crc32(crc, check + 1, 5);
+    crc = integrity_crc32(crc, check + 6, 3);
+    CHECK_EQ_I32(crc, 0xCBF43926U);
+
+    // Any single bit flipped changes it
+    uint8_t buf[16];
+    memset(buf, 0xFF, sizeof(buf));
+    uint32_t ref = integrity_crc32(0, buf, sizeof(buf));
+    int same = 0;
+    for (uint32_t bit = 0; bit < sizeof(buf) * 8; bit++) {
+        buf[bit / 8] ^= (uint8_t)(1U << (bit % 8));
+        same += integrity_crc32(0, buf, sizeof(buf)) == ref;
+        buf[bit / 8] ^= (uint8_t)(1U << (bit % 8));
+    }
+    CHECK_EQ_I32(same, 0);
+}
+
+static void test_crc8(void) {
+    // SMBus PEC check value, as the CDC frames carry
+    CHECK_EQ_I32(integrity_crc8(0, check, 9), 0xF4);
+
+    uint8_t crc = 0;
+    for (int i = 0; i < 9; i++)
+        crc = integrity_crc8(crc, &check[i], 1);
+    CHECK_EQ_I32(crc, 0xF4);
+
+    // A frame with its CRC appended checks to 0
+    uint8_t frame[4] = {0x01, 0x00, 0x00, 0};
+    frame[3] = integrity_crc8(0, frame, 3);
+    CHECK_EQ_I32(integrity_crc8(0, frame, 4), 0);
+}
+
+int main(void) {
+    test_crc32();
+    test_crc8();
+    return test_summary("integrity");
+}
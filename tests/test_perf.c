@@ -0,0 +1,89 @@
+// SPDX-License-Identifier: GPL-3.0-only
+// Copyright (c) 2026 Elia Chiarucci
+
+/*
+ * Host-side unit tests for the cycle-count profiler (App/Src/perf.c),
+ * built with PERF_PROFILE=1 and a fake cycle counter.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+static uint32_t fake_cycles;
+#define PERF_CYCLES() fake_cycles
+
+#include "perf.h"
+#include "test_util.h"
+
+static void test_min_max_mean(void) {
+    perf_reset();
+    perf_record(PERF_EQ, 1000);
+    perf_record(PERF_EQ, 3000);
+    perf_record(PERF_EQ, 2000);
+
+    const perf_stage_t *s = perf_stage(PERF_EQ);
+    CHECK_EQ_I32(s->count, 3);
+    CHECK_EQ_I32(s->min, 1000);
+    CHECK_EQ_I32(s->max, 3000);
+    CHECK_EQ_I32(s->total, 6000);
+
+    // Other stages untouched
+    CHECK_EQ_I32(perf_stage(PERF_PACK)->count, 0);
+    CHECK(perf_stage(PERF_STAGE_COUNT) == NULL);
+}
+
+static void test_histogram_bins(void) {
+    perf_reset();
+    perf_record(PERF_USB, 0);
+    perf_record(PERF_USB, 255);     // bin 0: under 2^8
+    perf_record(PERF_USB, 256);     // bin 1: [2^8, 2^9)
+    perf_record(PERF_USB, 511);
+    perf_record(PERF_USB, 1u << 17); // bin 10: [2^17, 2^18)
+    perf_record(PERF_USB, 1u << 18); // last bin
+    perf_record(PERF_USB, UINT32_MAX);
+
+    const perf_stage_t *s = perf_stage(PERF_USB);
+    CHECK_EQ_I32(s->hist[0], 2);
+    CHECK_EQ_I32(s->hist[1], 2);
+    CHECK_EQ_I32(s->hist[10], 1);
+    CHECK_EQ_I32(s->hist[PERF_HIST_BINS - 1], 2);
+    CHECK_EQ_I32(s->min, 0);
+}
+
+static void test_load(void) {
+    perf_reset();
+    // 50 runs of 2480 cycles in a 1s window at 248MHz: 0.05%
+    for (int i = 0; i < 50; i++)
+        perf_record(PERF_AUDIO, 2480);
+    const perf_stage_t *s = perf_stage(PERF_AUDIO);
+    CHECK_EQ_I32(perf_load(s, 248000000ull), 5);
+    CHECK_EQ_I32(perf_load(s, 0), 0);
+    CHECK_EQ_I32(perf_load(s, 1), UINT16_MAX); // saturates
+}
+
+static void test_markers(void) {
+    perf_reset();
+    fake_cycles = UINT32_MAX - 10; // the counter wraps inside the stage
+    PERF_BEGIN(PERF_DISPLAY);
+    fake_cycles += 500;
+    PERF_END(PERF_DISPLAY);
+    CHECK_EQ_I32(perf_stage(PERF_DISPLAY)->max, 500);
+}
+
+static void test_names(void) {
+    for (uint8_t i = 0; i < PERF_STAGE_COUNT; i++) {
+        const char *name = perf_stage_name(i);
+        CHECK(name != NULL && name[0] != '\0');
+        CHECK(strlen(name) <= PERF_NAME_LEN);
+    }
+    CHECK(strcmp(perf_stage_name(PERF_AUDIO), "audio") == 0);
+}
+
+int main(void) {
+    test_min_max_mean();
+    test_histogram_bins();
+    test_load();
+    test_markers();
+    test_names();
+    return test_summary("perf");
+}
@@ -0,0 +1,302 @@
+// SPDX-License-Identifier: GPL-3.0-only
+// Copyright (c) 2026 Elia Chiarucci
+
+/*
+ * Host-side unit tests for the main-loop scheduler (App/Src/sched.c).
+ * Time is fully simulated: tasks advance a fake cycle counter by their
+ * configured cost, the test advances the millisecond clock between passes.
+ */
+
+#include "sched.h"
+#include "test_util.h"
+#include <stdint.h>
+#include <string.h>
+
+#define CYCLES_PER_US 100
+
+static uint32_t fake_ms;
+static uint32_t fake_cycles;
+static uint32_t fake_window_us = UINT32_MAX;
+static int idle_calls;
+
+static uint32_t port_now_ms(void) { return fake_ms; }
+static uint32_t port_cycles(void) { return fake_cycles; }
+static uint32_t port_window_us(void) { return fake_window_us; }
+static void port_idle(void) { idle_calls++; }
+
+static const sched_port_t port = {
+    .now_ms = port_now_ms,
+    .cycles = port_cycles,
+    .cycles_per_us = CYCLES_PER_US,
+    .window_us = port_window_us,
+    .idle = port_idle,
+};
+
+// Per-task behaviour: run cost, how many more slices to report, run log
+#define MAX_LOG 64
+static uint32_t cost_us[4];
+static int slices_left[4];
+static char run_log[MAX_LOG];
+static int log_len;
+
+static bool run_task(int id) {
+    if (log_len < MAX_LOG - 1)
+        run_log[log_len++] = (char)('a' + id);
+    fake_cycles += cost_us[id] * CYCLES_PER_US;
+    if (slices_left[id] > 0) {
+        slices_left[id]--;
+        return true;
+    }
+    return false;
+}
+
+static bool task_a(uint32_t now) { (void)now; return run_task(0); }
+static bool task_b(uint32_t now) { (void)now; return run_task(1); }
+static bool task_c(uint32_t now) { (void)now; return run_task(2); }
+
+// sched_current() as each task saw it
+static uint8_t seen_current[2];
+static bool task_cur_a(uint32_t now) {
+    seen_current[0] = sched_current();
+    return task_a(now);
+}
+static bool task_cur_b(uint32_t now) {
+    seen_current[1] = sched_current();
+    return task_b(now);
+}
+
+static void reset_world(void) {
+    fake_ms = 1000;
+    fake_cycles = 0;
+    fake_window_us = UINT32_MAX;
+    idle_calls = 0;
+    memset(cost_us, 0, sizeof(cost_us));
+    memset(slices_left, 0, sizeof(slices_left));
+    memset(run_log, 0, sizeof(run_log));
+    log_len = 0;
+}
+
+static void clear_log(void) {
+    memset(run_log, 0, sizeof(run_log));
+    log_len = 0;
+}
+
+static void test_priority_order_and_periods(void) {
+    static const sched_task_t tasks[] = {
+        {"poll", task_a, 0, 0, 0},
+        {"p10", task_b, 10, 0, 0},
+        {"p25", task_c, 25, 0, 0},
+    };
+    reset_world();
+    sched_init(tasks, 3, &port);
+
+    // Everything is released on the first pass, in table order
+    sched_run();
+    CHECK(strcmp(run_log, "abc") == 0);
+
+    // Only the poll task until the 10ms release
+    clear_log();
+    for (int i = 0; i < 9; i++) {
+        fake_ms++;
+        sched_run();
+    }
+    CHECK(strcmp(run_log, "aaaaaaaaa") == 0);
+
+    clear_log();
+    fake_ms++; // t = +10
+    sched_run();
+    CHECK(strcmp(run_log, "ab") == 0);
+
+    // 100ms: b runs 10 times in total, c 4 times (0, 25, 50, 75, 100)
+    for (int i = 0; i < 90; i++) {
+        fake_ms++;
+        sched_run();
+    }
+    CHECK_EQ_I32(sched_stats(0)->runs, 101);
+    CHECK_EQ_I32(sched_stats(1)->runs, 11);
+    CHECK_EQ_I32(sched_stats(2)->runs, 5);
+    CHECK_EQ_I32(sched_stats(1)->missed, 0);
+    CHECK_EQ_I32(sched_pass_count(), 101);
+}
+
+static void test_resync_after_stall(void) {
+    static const sched_task_t tasks[] = {
+        {"p10", task_a, 10, 0, 0},
+    };
+    reset_world();
+    sched_init(tasks, 1, &port);
+    sched_run(); // released at 1000, next at 1010
+
+    // Main loop stalled for 35ms: one late run, counted as a miss, then
+    // back on a 10ms grid from the late start (no burst of catch-up runs)
+    fake_ms += 35;
+    sched_run();
+    CHECK_EQ_I32(sched_stats(0)->runs, 2);
+    CHECK_EQ_I32(sched_stats(0)->missed, 1);
+
+    fake_ms += 1;
+    sched_run();
+    CHECK_EQ_I32(sched_stats(0)->runs, 2);
+    fake_ms += 9;
+    sched_run();
+    CHECK_EQ_I32(sched_stats(0)->runs, 3);
+    CHECK_EQ_I32(sched_stats(0)->missed, 1);
+}
+
+static void test_poll_deadline_counts_gaps(void) {
+    static const sched_task_t tasks[] = {
+        {"usb", task_a, 0, 2, 0},
+    };
+    reset_world();
+    sched_init(tasks, 1, &port);
+    sched_run();
+    fake_ms += 2;
+    sched_run(); // gap == deadline: on time
+    CHECK_EQ_I32(sched_stats(0)->missed, 0);
+    fake_ms += 3;
+    sched_run(); // gap > deadline
+    CHECK_EQ_I32(sched_stats(0)->missed, 1);
+}
+
+static void test_sliced_task_runs_every_pass(void) {
+    static const sched_task_t tasks[] = {
+        {"flash", task_a, 100, 0, 0},
+    };
+    reset_world();
+    sched_init(tasks, 1, &port);
+
+    // Released once, then three continuation slices despite the period;
+    // the idle hook only runs once the job is done
+    slices_left[0] = 3;
+    for (int i = 0; i < 3; i++) {
+        fake_ms++;
+        sched_run();
+    }
+    CHECK_EQ_I32(idle_calls, 0);
+    for (int i = 0; i < 2; i++) {
+        fake_ms++;
+        sched_run();
+    }
+    CHECK(strcmp(run_log, "aaaa") == 0);
+    CHECK_EQ_I32(idle_calls, 2);
+    CHECK_EQ_I32(sched_idle_count(), 2);
+}
+
+static void test_run_time_stats(void) {
+    static const sched_task_t tasks[] = {
+        {"t", task_a, 0, 0, 0},
+    };
+    reset_world();
+    sched_init(tasks, 1, &port);
+
+    static const uint32_t costs[] = {100, 300, 200};
+    for (int i = 0; i < 3; i++) {
+        cost_us[0] = costs[i];
+        sched_run();
+    }
+    const sched_stats_t *s = sched_stats(0);
+    CHECK_EQ_I32(s->runs, 3);
+    CHECK_EQ_I32(s->total_us, 600);
+    CHECK_EQ_I32(s->max_us, 300);
+    CHECK_EQ_I32(s->last_us, 200);
+
+    sched_reset_stats();
+    CHECK_EQ_I32(sched_stats(0)->runs, 0);
+    CHECK_EQ_I32(sched_stats(0)->max_us, 0);
+    CHECK_EQ_I32(sched_pass_count(), 0);
+}
+
+static void test_deferral_until_deadline(void) {
+    static const sched_task_t tasks[] = {
+        {"usb", task_a, 0, 0, 0},
+        {"disp", task_b, 10, 5, SCHED_DEFERRABLE},
+    };
+    reset_world();
+    sched_init(tasks, 2, &port);
+
+    // First run measures the display at 1500us
+    cost_us[1] = 1500;
+    sched_run();
+    CHECK_EQ_I32(sched_stats(1)->runs, 1);
+
+    // Next release with only 400us before the audio half: deferred
+    fake_window_us = 400;
+    fake_ms += 10;
+    clear_log();
+    sched_run();
+    CHECK(strcmp(run_log, "a") == 0);
+    CHECK_EQ_I32(sched_stats(1)->deferred, 1);
+    CHECK_EQ_I32(idle_calls, 1); // first pass only: a deferral is pending work
+
+    // Window opens: runs on time
+    fake_window_us = 1800;
+    fake_ms += 1;
+    sched_run();
+    CHECK_EQ_I32(sched_stats(1)->runs, 2);
+    CHECK_EQ_I32(sched_stats(1)->missed, 0);
+
+    // Window never opens: deferred until the deadline forces it through
+    fake_window_us = 100;
+    fake_ms += 9; // next release
+    for (int i = 0; i < 4; i++) {
+        sched_run();
+        fake_ms++;
+    }
+    CHECK_EQ_I32(sched_stats(1)->runs, 2);
+    sched_run(); // one tick before the deadline
+    CHECK_EQ_I32(sched_stats(1)->runs, 3);
+    CHECK_EQ_I32(sched_stats(1)->missed, 0);
+    CHECK_EQ_I32(sched_stats(1)->deferred, 5);
+}
+
+static void test_budget_decays_after_outlier(void) {
+    static const sched_task_t tasks[] = {
+        {"disp", task_a, 0, 0, SCHED_DEFERRABLE},
+    };
+    reset_world();
+    sched_init(tasks, 1, &port);
+
+    // One run stretched to 2000us by interrupts, then steady 100us runs
+    cost_us[0] = 2000;
+    sched_run();
+    cost_us[0] = 100;
+    fake_window_us = 2500;
+    for (int i = 0; i < 40; i++)
+        sched_run();
+
+    // The estimate must have come back under a 500us window
+    fake_window_us = 500;
+    uint32_t runs = sched_stats(0)->runs;
+    sched_run();
+    CHECK_EQ_I32(sched_stats(0)->runs, runs + 1);
+    CHECK_EQ_I32(sched_stats(0)->max_us, 2000); // the report keeps the peak
+}
+
+static void test_current_task(void) {
+    static const sched_task_t tasks[] = {
+        {"a", task_cur_a, 0, 0, 0},
+        {"b", task_cur_b, 0, 0, 0},
+    };
+    reset_world();
+    CHECK_EQ_I32(sched_current(), SCHED_NO_TASK);
+    sched_init(tasks, 2, &port);
+    sched_run();
+
+    // Each task saw its own index; none is current between passes
+    CHECK_EQ_I32(log_len, 2);
+    CHECK_EQ_I32(seen_current[0], 0);
+    CHECK_EQ_I32(seen_current[1], 1);
+    CHECK_EQ_I32(sched_current(), SCHED_NO_TASK);
+}
+
+int main(void) {
+    test_priority_order_and_periods();
+    test_resync_after_stall();
+    test_poll_deadline_counts_gaps();
+    test_sliced_task_runs_every_pass();
+    test_run_time_stats();
+    test_deferral_until_deadline();
+    test_budget_decays_after_outlier();
+    test_current_task();
+    return test_summary("sched");
+}
@@ -0,0 +1,163 @@
+// SPDX-License-Identifier: GPL-3.0-only
+// Copyright (c) 2026 Elia Chiarucci
+
+/*
+ * Host-side unit tests for the RTT event trace (App/Src/trace.c).
+ *
+ * Built with TRACE_CYCLES=test_cycles; the RTT up-buffer is replaced by a
+ * capture with a settable amount of free space.
+ */
+
+#include "trace.h"
+#include "SEGGER_RTT.h"
+#include "test_util.h"
+#include <stdint.h>
+#include <string.h>
+
+#define CAPTURE_RECORDS 16
+
+static uint32_t cycles;
+static uint8_t capture[CAPTURE_RECORDS * sizeof(trace_record_t)];
+static unsigned captured;  // bytes
+static unsigned room;      // bytes the buffer can still take
+static unsigned config_index, config_size, config_flags;
+
+uint32_t test_cycles(void);
+uint32_t test_cycles(void) {
+    return cycles;
+}
+
+int SEGGER_RTT_ConfigUpBuffer(unsigned BufferIndex, const char *sName,
+                              void *pBuffer, unsigned BufferSize,
+                              unsigned Flags) {
+    (void)sName;
+    (void)pBuffer;
+    config_index = BufferIndex;
+    config_size = BufferSize;
+    config_flags = Flags;
+    return 0;
+}
+
+// Skip mode: all or nothing
+unsigned SEGGER_RTT_WriteNoLock(unsigned BufferIndex, const void *pBuffer,
+                                unsigned NumBytes) {
+    if (BufferIndex != TRACE_CHANNEL || NumBytes > room ||
+        captured + NumBytes > sizeof(capture))
+        return 0;
+    memcpy(&capture[captured], pBuffer, NumBytes);
+    captured += NumBytes;
+    room -= NumBytes;
+    return NumBytes;
+}
+
+static trace_record_t record(unsigned n) {
+    trace_record_t r;
+    memcpy(&r, &capture[n * sizeof(r)], sizeof(r));
+    return r;
+}
+
+static void start(unsigned room_records) {
+    captured = 0;
+    room = room_records * sizeof(trace_record_t);
+    cycles = 1000;
+    trace_init(248000000U);
+}
+
+static void test_init_writes_start(void) {
+    start(CAPTURE_RECORDS);
+    CHECK_EQ_I32(config_index, TRACE_CHANNEL);
+    CHECK_EQ_I32(config_size, TRACE_BUFFER_SIZE);
+    CHECK_EQ_I32(config_flags, SEGGER_RTT_MODE_NO_BLOCK_SKIP);
+
+    CHECK_EQ_I32(captured, sizeof(trace_record_t));
+    trace_record_t r = record(0);
+    CHECK_EQ_I32(r.cycles, 1000);
+    CHECK_EQ_I32(r.event, TRACE_START);
+    CHECK_EQ_I32(r.arg8, TRACE_VERSION);
+    CHECK_EQ_I32(r.arg16, 248);
+}
+
+static void test_record_layout(void) {
+    start(CAPTURE_RECORDS);
+    cycles = 0x12345678;
+    TRACE(TRACE_CDC_TX, 0x81, 0x0203);
+
+    // [cycles:4][event:1][arg8:1][arg16:2], little-endian
+    const uint8_t expected[8] = {0x78, 0x56, 0x34, 0x12,
+                                 TRACE_CDC_TX, 0x81, 0x03, 0x02};
+    CHECK_EQ_I32(captured, 16);
+    CHECK(memcmp(&capture[8], expected, sizeof(expected)) == 0);
+}
+
+static void test_arguments_truncate(void) {
+    start(CAPTURE_RECORDS);
+    TRACE(TRACE_DMA_PERIOD, 0x1FF, 0x12345);
+    trace_record_t r = record(1);
+    CHECK_EQ_I32(r.arg8, 0xFF);
+    CHECK_EQ_I32(r.arg16, 0x2345);
+}
+
+static void test_full_buffer_reports_lost(void) {
+    start(1); // room for the start record only
+    for (int i = 0; i < 3; i++)
+        TRACE(TRACE_USB_SOF, 0, i);
+    CHECK_EQ_I32(captured, sizeof(trace_record_t));
+
+    // The host reads: the count goes ahead of the next record
+    room = 2 * sizeof(trace_record_t);
+    cycles = 5000;
+    TRACE(TRACE_USB_SOF, 0, 3);
+    CHECK_EQ_I32(captured, 3 * sizeof(trace_record_t));
+    trace_record_t lost = record(1);
+    CHECK_EQ_I32(lost.event, TRACE_LOST);
+    CHECK_EQ_I32(lost.arg16, 3);
+    CHECK_EQ_I32(lost.cycles, 5000);
+    trace_record_t sof = record(2);
+    CHECK_EQ_I32(sof.event, TRACE_USB_SOF);
+    CHECK_EQ_I32(sof.arg16, 3);
+
+    // Counted again from zero
+    TRACE(TRACE_USB_SOF, 0, 4);
+    room = 2 * sizeof(trace_record_t);
+    TRACE(TRACE_USB_SOF, 0, 5);
+    CHECK_EQ_I32(record(3).event, TRACE_LOST);
+    CHECK_EQ_I32(record(3).arg16, 1);
+    CHECK_EQ_I32(record(4).arg16, 5);
+}
+
+static void test_lost_record_without_room_for_event(void) {
+    start(1);
+    TRACE(TRACE_USB_SOF, 0, 0);
+
+    // Only the lost record fits: the event is the next one counted
+    room = sizeof(trace_record_t);
+    TRACE(TRACE_USB_SOF, 0, 1);
+    CHECK_EQ_I32(record(1).event, TRACE_LOST);
+    CHECK_EQ_I32(record(1).arg16, 1);
+
+    room = 2 * sizeof(trace_record_t);
+    TRACE(TRACE_USB_SOF, 0, 2);
+    CHECK_EQ_I32(record(2).event, TRACE_LOST);
+    CHECK_EQ_I32(record(2).arg16, 1);
+    CHECK_EQ_I32(record(3).arg16, 2);
+}
+
+static void test_lost_count_saturates(void) {
+    start(1);
+    for (uint32_t i = 0; i < 70000; i++)
+        TRACE(TRACE_USB_SOF, 0, i);
+    room = 2 * sizeof(trace_record_t);
+    TRACE(TRACE_USB_SOF, 0, 0);
+    CHECK_EQ_I32(record(1).event, TRACE_LOST);
+    CHECK_EQ_I32(record(1).arg16, UINT16_MAX);
+}
+
+int main(void) {
+    test_init_writes_start();
+    test_record_layout();
+    test_arguments_truncate();
+    test_full_buffer_reports_lost();
+    test_lost_record_without_room_for_event();
+    test_lost_count_saturates();
+    return test_summary("trace");
+}
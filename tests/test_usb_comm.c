@@ -0,0 +1,333 @@
+// SPDX-License-Identifier: GPL-3.0-only
+// Copyright (c) 2026 Elia Chiarucci
+
+/*
+ * Host-side CDC framing test (App/Src/usb_comm.c)
+ *
+ * usb_comm.c is compiled unmodified against the real HAL and TinyUSB
+ * headers, on a fake CDC FIFO pair: frames split across reads or read two
+ * calls each, a bad CRC followed by a good frame, and a response that
+ * doesn't fit the TX FIFO leaving the next command unread. The handlers' dependencies are stubs.
+ */
+
+#include "main.h"
+#include "tusb.h"
+#include "test_util.h"
+#include <stdint.h>
+#include <string.h>
+
+void test_system_reset(void);
+#undef NVIC_SystemReset
+#define NVIC_SystemReset() test_system_reset()
+
+#include "../App/Src/usb_comm.c"
+
+// ---------------------------------------------------------------------------
+// Fake CDC FIFOs: host -> device bytes in rx, device -> host in tx
+// ---------------------------------------------------------------------------
+static uint8_t rx_fifo[4096];
+static uint32_t rx_rd, rx_wr;
+static uint32_t rx_reads;
+static uint8_t tx_stream[4096];
+static uint32_t tx_count;
+static uint32_t tx_space = CFG_TUD_CDC_TX_BUFSIZE;
+
+uint32_t tud_cdc_n_available(uint8_t itf) {
+    (void)itf;
+    return rx_wr - rx_rd;
+}
+
+uint32_t tud_cdc_n_read(uint8_t itf, void *buffer, uint32_t bufsize) {
+    (void)itf;
+    uint32_t n = rx_wr - rx_rd;
+    if (n > bufsize)
+        n = bufsize;
+    memcpy(buffer, &rx_fifo[rx_rd], n);
+    rx_rd += n;
+    rx_reads++;
+    return n;
+}
+
+uint32_t tud_cdc_n_write(uint8_t itf, void const *buffer, uint32_t bufsize) {
+    (void)itf;
+    uint32_t n = bufsize < tx_space ? bufsize : tx_space;
+    memcpy(&tx_stream[tx_count], buffer, n);
+    tx_count += n;
+    tx_space -= n;
+    return n;
+}
+
+uint32_t tud_cdc_n_write_flush(uint8_t itf) {
+    (void)itf;
+    return 0;
+}
+
+uint32_t tud_cdc_n_write_available(uint8_t itf) {
+    (void)itf;
+    return tx_space;
+}
+
+void tud_task_ext(uint32_t timeout_ms, bool in_isr) {
+    (void)timeout_ms;
+    (void)in_isr;
+}
+
+static void host_send(const uint8_t *data, uint32_t len) {
+    memcpy(&rx_fifo[rx_wr], data, len);
+    rx_wr += len;
+}
+
+static void cdc_reset(void) {
+    rx_rd = rx_wr = rx_reads = 0;
+    tx_count = 0;
+    tx_space = CFG_TUD_CDC_TX_BUFSIZE;
+    usb_comm_init();
+}
+
+static uint16_t frame(uint8_t *out, uint8_t cmd, const void *payload,
+                      uint16_t len) {
+    out[0] = cmd;
+    out[1] = (uint8_t)len;
+    out[2] = (uint8_t)(len >> 8);
+    if (len)
+        memcpy(&out[3], payload, len);
+    out[3 + len] = integrity_crc8(0, out, 3U + len);
+    return (uint16_t)(4 + len);
+}
+
+// Responses in tx_stream: count the well-formed ones, and the status of the
+// last one for cmd
+static int responses(uint8_t cmd, int *status) {
+    int count = 0;
+    *status = -1;
+    for (uint32_t pos = 0; pos + 5 <= tx_count;) {
+        uint16_t len = (uint16_t)(tx_stream[pos + 1] | tx_stream[pos + 2] << 8);
+        if (pos + 4 + len > tx_count)
+            break;
+        if (integrity_crc8(0, &tx_stream[pos], 3U + len) ==
+            tx_stream[pos + 3 + len]) {
+            count++;
+            if (tx_stream[pos] == (cmd | 0x80))
+                *status = tx_stream[pos + 3];
+        }
+        pos += 4U + len;
+    }
+    return count;
+}
+
+// ---------------------------------------------------------------------------
+// usb_comm.c's dependencies
+// ---------------------------------------------------------------------------
+uint32_t SystemCoreClock = 250000000U;
+static uint32_t tick;
+static uint8_t active;
+static eq_profile_t stored;
+static int stores;
+
+uint32_t HAL_GetTick(void) { return tick; }
+uint32_t HAL_GetUIDw0(void) { return 0; }
+uint32_t HAL_GetUIDw1(void) { return 0; }
+uint32_t HAL_GetUIDw2(void) { return 0; }
+void test_system_reset(void) {}
+
+void app_reboot_to_dfu(void) {}
+void app_save_settings(void) {}
+void display_set_dirty(void) {}
+
+uint32_t audio_output_lock(void) { return 0; }
+void audio_output_unlock(uint32_t key) { (void)key; }
+uint8_t audio_output_get_amp(void) { return 0; }
+uint8_t audio_output_get_dac(void) { return 0; }
+void audio_output_set_amp(uint8_t enable) { (void)enable; }
+void audio_output_set_dac(uint8_t enable) { (void)enable; }
+uint8_t audio_output_get_latency(void) { return 0; }
+uint8_t audio_output_get_latency_request(void) { return 0; }
+bool audio_output_set_latency(uint8_t id) { return id == 0; }
+uint32_t audio_output_get_stats(audio_stats_counters_t *counters, bool reset) {
+    (void)reset;
+    memset(counters, 0, sizeof(*counters));
+    return 0;
+}
+
+const char *dsp_bench_name(uint8_t id) { (void)id; return "resample"; }
+void dsp_bench_run(dsp_bench_report_t *out) { memset(out, 0, sizeof(*out)); }
+
+const eq_profile_t *eq_profile_get(uint8_t id) { return id ? NULL : &stored; }
+uint8_t eq_profile_get_active(void) { return active; }
+void eq_profile_set_active(uint8_t id) { active = id; }
+bool eq_profile_delete(uint8_t id) { (void)id; return true; }
+bool eq_profile_start_flash_save(void) { return true; }
+eq_flash_status_t eq_profile_flash_status(void) { return EQ_FLASH_IDLE; }
+bool eq_profile_set(uint8_t id, const eq_profile_t *p) {
+    if (id >= EQ_MAX_PROFILES)
+        return false;
+    stored = *p;
+    stores++;
+    return true;
+}
+
+void fault_clear(void) {}
+bool fault_get_last(fault_record_t *out) { (void)out; return false; }
+uint8_t fault_get_reset_cause(void) { return 0; }
+
+bool settings_save_strings(const char *manufacturer, const char *product,
+                           const char *audio_itf) {
+    (void)manufacturer;
+    (void)product;
+    (void)audio_itf;
+    return true;
+}
+
+const char *usb_desc_get_manufacturer(void) { return "DA15"; }
+const char *usb_desc_get_product(void) { return "DA15"; }
+const char *usb_desc_get_audio_itf(void) { return "DA15"; }
+void usb_desc_set_manufacturer(const char *str) { (void)str; }
+void usb_desc_set_product(const char *str) { (void)str; }
+void usb_desc_set_audio_itf(const char *str) { (void)str; }
+
+uint16_t usb_audio_available(void) { return 0; }
+uint32_t usb_audio_get_sample_rate(void) { return 48000; }
+bool usb_audio_is_streaming(void) { return false; }
+bool usb_audio_get_adaptive_stats(audio_ad_stats_t *stats) {
+    (void)stats;
+    return false;
+}
+bool usb_audio_get_asrc_stats(audio_asrc_stats_t *stats) {
+    (void)stats;
+    return false;
+}
+void usb_audio_get_delay_stats(audio_delay_stats_t *stats) {
+    memset(stats, 0, sizeof(*stats));
+}
+void usb_audio_get_feedback_stats(audio_fb_stats_t *stats) {
+    memset(stats, 0, sizeof(*stats));
+}
+
+// ---------------------------------------------------------------------------
+// Tests
+// ---------------------------------------------------------------------------
+
+// A SET_PROFILE frame (381-byte payload) then GET_ACTIVE, split at every
+// byte: the payload lands whole, both are answered once
+static void test_split(void) {
+    static uint8_t buf[2 * (4 + MAX_PAYLOAD_SIZE)];
+    uint8_t payload[1 + sizeof(eq_profile_t)];
+    payload[0] = 2;
+    for (uint16_t i = 1; i < sizeof(payload); i++)
+        payload[i] = (uint8_t)(i * 13U + 5U);
+    uint16_t len = frame(buf, CMD_SET_PROFILE, payload, sizeof(payload));
+    len += frame(&buf[len], CMD_GET_ACTIVE, NULL, 0);
+
+    int bad = 0;
+    for (uint16_t split = 1; split < len; split++) {
+        cdc_reset();
+        memset(&stored, 0, sizeof(stored));
+        stores = 0;
+        host_send(buf, split);
+        usb_comm_task();
+        host_send(&buf[split], len - split);
+        usb_comm_task();
+
+        int status_set, status_get;
+        bad += responses(CMD_SET_PROFILE, &status_set) != 2;
+        responses(CMD_GET_ACTIVE, &status_get);
+        bad += status_set != STATUS_OK || status_get != STATUS_OK;
+        bad += stores != 1 || memcmp(&stored, &payload[1], sizeof(stored));
+        bad += rx_rd != rx_wr;
+    }
+    CHECK_EQ_I32(bad, 0);
+
+    // A byte per read
+    cdc_reset();
+    stores = 0;
+    for (uint16_t i = 0; i < len; i++) {
+        host_send(&buf[i], 1);
+        usb_comm_task();
+    }
+    int status;
+    CHECK_EQ_I32(responses(CMD_SET_PROFILE, &status), 2);
+    CHECK_EQ_I32(status, STATUS_OK);
+    CHECK_EQ_I32(stores, 1);
+
+    // Both at once: two reads per frame, header then payload and CRC
+    cdc_reset();
+    host_send(buf, len);
+    usb_comm_task();
+    CHECK_EQ_I32(responses(CMD_SET_PROFILE, &status), 2);
+    CHECK_EQ_I32(rx_reads, 4);
+}
+
+// A frame with a bad CRC is dropped without a response; the frame after it
+// in the same read is parsed from its first byte
+static void test_bad_crc(void) {
+    uint8_t buf[32];
+    uint8_t id = 3;
+
+    cdc_reset();
+    active = 0;
+    uint16_t len = frame(buf, CMD_SET_ACTIVE, &id, 1);
+    buf[len - 1] ^= 0x01;
+    len += frame(&buf[len], CMD_GET_ACTIVE, NULL, 0);
+    host_send(buf, len);
+    usb_comm_task();
+    int status;
+    CHECK_EQ_I32(responses(CMD_GET_ACTIVE, &status), 1);
+    CHECK_EQ_I32(status, STATUS_OK);
+    CHECK_EQ_I32(active, 0);
+
+    // Corrupt payload: same, and the next SET_ACTIVE goes through
+    cdc_reset();
+    len = frame(buf, CMD_SET_ACTIVE, &id, 1);
+    buf[3] ^= 0x40;
+    len += frame(&buf[len], CMD_SET_ACTIVE, &id, 1);
+    host_send(buf, len);
+    usb_comm_task();
+    CHECK_EQ_I32(responses(CMD_SET_ACTIVE, &status), 1);
+    CHECK_EQ_I32(status, STATUS_OK);
+    CHECK_EQ_I32(active, 3);
+    CHECK_EQ_I32(rx_wr - rx_rd, 0);
+}
+
+// A response bigger than the free TX space stays pending: the rest of the
+// read is left in the CDC FIFO until it has drained, then parsed in order
+static void test_backpressure(void) {
+    uint8_t buf[32];
+    uint8_t id = 5;
+
+    cdc_reset();
+    active = 0;
+    tx_space = 8; // GET_DEVICE_INFO's response is 14 bytes
+    uint16_t first = frame(buf, CMD_GET_DEVICE_INFO, NULL, 0);
+    uint16_t len = first + frame(&buf[first], CMD_SET_ACTIVE, &id, 1);
+    host_send(buf, len);
+    usb_comm_task();
+    CHECK_EQ_I32(rx_rd, first);
+    CHECK_EQ_I32(tx_count, 8);
+    CHECK_EQ_I32(active, 0);
+
+    // Still full: nothing more is read
+    usb_comm_task();
+    CHECK_EQ_I32(rx_rd, first);
+
+    // The host drains
+    for (int i = 0; i < 4 && rx_rd != rx_wr; i++) {
+        tx_space = 8;
+        usb_comm_task();
+    }
+    tx_space = CFG_TUD_CDC_TX_BUFSIZE;
+    usb_comm_task();
+    int status;
+    CHECK_EQ_I32(responses(CMD_GET_DEVICE_INFO, &status), 2);
+    CHECK_EQ_I32(status, STATUS_OK);
+    CHECK_EQ_I32(tx_stream[0], CMD_GET_DEVICE_INFO | 0x80);
+    CHECK_EQ_I32(tx_stream[14], CMD_SET_ACTIVE | 0x80);
+    CHECK_EQ_I32(active, id);
+    CHECK_EQ_I32(rx_wr - rx_rd, 0);
+}
+
+int main(void) {
+    test_split();
+    test_bad_crc();
+    test_backpressure();
+    return test_summary("usb_comm");
+}
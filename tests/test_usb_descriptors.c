@@ -0,0 +1,398 @@
+// SPDX-License-Identifier: GPL-3.0-only
+// Copyright (c) 2026 Elia Chiarucci
+
+/*
+ * Host-side descriptor parser test (App/Src/usb_descriptors.c)
+ *
+ * Walks the configuration descriptor as a host would enumerate it and
+ * checks what the audio driver relies on: the lengths add up, the IAD
+ * groups the control and streaming interfaces, the audio control topology
+ * is connected (input terminal -> feature unit -> output terminal, each on
+ * the clock source in UAC2), and both streaming settings carry the format,
+ * endpoint sizes and feedback endpoint of the class version (or, with
+ * AUDIO_ADAPTIVE_CLOCK=1, an adaptive endpoint and none). Built as UAC1 and
+ * with USB_AUDIO_UAC2=1, each asynchronous and adaptive; and as UAC1 with
+ * USB_AUDIO_LOOPBACK=1, whose capture interface (input terminal -> output
+ * terminal, an asynchronous IN endpoint at the I2S rate) joins the function.
+ */
+
+#include "tusb.h"
+#include "usb_descriptors.h"
+#include "test_util.h"
+#include <stdint.h>
+#include <string.h>
+
+#define MAX_ENTITIES 8
+#define MAX_RATES    8
+
+// usb_descriptors.c's hardware and control dependencies
+uint32_t HAL_GetUIDw0(void) { return 0x12345678; }
+uint32_t HAL_GetUIDw1(void) { return 0x9ABCDEF0; }
+uint32_t HAL_GetUIDw2(void) { return 0x0F1E2D3C; }
+bool tud_control_xfer(uint8_t rhport, tusb_control_request_t const *request,
+                      void *buffer, uint16_t len) {
+    (void)rhport;
+    (void)request;
+    (void)buffer;
+    (void)len;
+    return true;
+}
+
+typedef struct {
+    uint8_t id;
+    uint8_t subtype;
+    uint8_t source; // input to a unit or output terminal, 0 if none
+    uint8_t clock;  // UAC2 clock source of a terminal, 0 if none
+} entity_t;
+
+typedef struct {
+    uint8_t n_eps;
+    uint8_t terminal_link;
+    uint8_t channels;
+    uint8_t subslot;
+    uint8_t bits;
+    uint8_t n_rates; // UAC1: rates listed in the format descriptor
+    uint32_t rates[MAX_RATES];
+    uint8_t data_ep, data_attr, data_sync_addr;
+    uint16_t data_size;
+    uint8_t fb_ep, fb_attr;
+    uint16_t fb_size;
+} alt_t;
+
+typedef struct {
+    uint8_t n_itfs_config;
+    uint8_t n_itfs_seen;
+    uint8_t iad_first, iad_count, iad_protocol;
+    uint8_t ac_protocol;
+    uint16_t bcd_adc;
+    uint16_t cs_ac_declared, cs_ac_sum;
+    uint8_t n_collection; // UAC1: streaming interfaces the header lists
+    uint8_t collection[4];
+    uint8_t n_entities;
+    entity_t entities[MAX_ENTITIES];
+    uint8_t n_alts;
+    alt_t alts[3];
+    uint8_t n_cap_alts;   // loopback capture interface
+    alt_t cap_alts[2];
+    uint8_t strings[16];
+    uint8_t n_strings;
+} parsed_t;
+
+static uint16_t rd16(const uint8_t *p) { return (uint16_t)(p[0] | p[1] << 8); }
+
+static void parse(const uint8_t *desc, uint16_t len, parsed_t *out) {
+    memset(out, 0, sizeof(*out));
+    out->n_itfs_config = desc[4];
+
+    uint8_t itf_class = 0, itf_subclass = 0;
+    alt_t *alt = NULL;
+    bool capture = false;
+    bool in_ac = false;
+    uint16_t pos = 0;
+    while (pos < len) {
+        const uint8_t *d = &desc[pos];
+        CHECK(d[0] >= 2);
+        if (d[0] < 2 || pos + d[0] > len)
+            break;
+
+        switch (d[1]) {
+            case TUSB_DESC_INTERFACE_ASSOCIATION:
+                if (d[4] == TUSB_CLASS_AUDIO) {
+                    out->iad_first = d[2];
+                    out->iad_count = d[3];
+                    out->iad_protocol = d[6];
+                }
+                out->strings[out->n_strings++] = d[7];
+                break;
+
+            case TUSB_DESC_INTERFACE:
+                if (d[3] == 0)
+                    out->n_itfs_seen++;
+                itf_class = d[5];
+                itf_subclass = d[6];
+                in_ac = itf_class == TUSB_CLASS_AUDIO && itf_subclass == AUDIO_SUBCLASS_CONTROL;
+                if (in_ac)
+                    out->ac_protocol = d[7];
+                alt = NULL;
+                capture = false;
+#if USB_AUDIO_LOOPBACK
+                capture = d[2] == ITF_NUM_AUDIO_CAPTURE;
+                if (capture && d[3] < 2) {
+                    alt = &out->cap_alts[d[3]];
+                    alt->n_eps = d[4];
+                    if (d[3] >= out->n_cap_alts)
+                        out->n_cap_alts = (uint8_t)(d[3] + 1);
+                }
+#endif
+                if (!capture && itf_class == TUSB_CLASS_AUDIO && itf_subclass == AUDIO_SUBCLASS_STREAMING && d[3] < 3) {
+                    alt = &out->alts[d[3]];
+                    alt->n_eps = d[4];
+                    if (d[3] >= out->n_alts)
+                        out->n_alts = (uint8_t)(d[3] + 1);
+                }
+                out->strings[out->n_strings++] = d[8];
+                break;
+
+            case TUSB_DESC_CS_INTERFACE:
+                if (in_ac) {
+                    out->cs_ac_sum += d[0];
+                    if (d[2] == AUDIO10_CS_AC_INTERFACE_HEADER) {
+                        out->bcd_adc = rd16(&d[3]);
+                        out->cs_ac_declared = rd16(&d[USB_AUDIO_UAC2 ? 6 : 5]);
+#if !USB_AUDIO_UAC2
+                        out->n_collection = d[7];
+                        for (uint8_t i = 0; i < d[7] && i < sizeof(out->collection); i++)
+                            out->collection[i] = d[8 + i];
+#endif
+                        break;
+                    }
+                    if (out->n_entities == MAX_ENTITIES)
+                        break;
+                    entity_t *e = &out->entities[out->n_entities++];
+                    e->id = d[3];
+                    e->subtype = d[2];
+                    if (d[2] == AUDIO10_CS_AC_INTERFACE_FEATURE_UNIT)
+                        e->source = d[4];
+                    if (d[2] == AUDIO10_CS_AC_INTERFACE_OUTPUT_TERMINAL)
+                        e->source = d[7];
+#if USB_AUDIO_UAC2
+                    if (d[2] == AUDIO10_CS_AC_INTERFACE_INPUT_TERMINAL)
+                        e->clock = d[7];
+                    if (d[2] == AUDIO10_CS_AC_INTERFACE_OUTPUT_TERMINAL)
+                        e->clock = d[8];
+#endif
+                } else if (alt) {
+#if USB_AUDIO_UAC2
+                    if (d[2] == AUDIO20_CS_AS_INTERFACE_AS_GENERAL) {
+                        alt->terminal_link = d[3];
+                        alt->channels = d[10];
+                    } else if (d[2] == AUDIO20_CS_AS_INTERFACE_FORMAT_TYPE) {
+                        alt->subslot = d[4];
+                        alt->bits = d[5];
+                    }
+#else
+                    if (d[2] == AUDIO10_CS_AS_INTERFACE_AS_GENERAL) {
+                        alt->terminal_link = d[3];
+                    } else if (d[2] == AUDIO10_CS_AS_INTERFACE_FORMAT_TYPE) {
+                        alt->channels = d[4];
+                        alt->subslot = d[5];
+                        alt->bits = d[6];
+                        alt->n_rates = d[7];
+                        for (uint8_t i = 0; i < d[7] && i < MAX_RATES; i++)
+                            alt->rates[i] = (uint32_t)(d[8 + 3 * i] | d[9 + 3 * i] << 8 | d[10 + 3 * i] << 16);
+                    }
+#endif
+                }
+                break;
+
+            case TUSB_DESC_ENDPOINT:
+                if (alt) {
+                    // IN: the playback's feedback, or the capture's data
+                    if ((d[2] & TUSB_DIR_IN_MASK) && !capture) {
+                        alt->fb_ep = d[2];
+                        alt->fb_attr = d[3];
+                        alt->fb_size = rd16(&d[4]);
+                    } else {
+                        alt->data_ep = d[2];
+                        alt->data_attr = d[3];
+                        alt->data_size = rd16(&d[4]);
+                        alt->data_sync_addr = d[0] >= 9 ? d[8] : 0;
+                    }
+                }
+                break;
+
+            default:
+                break;
+        }
+        pos += d[0];
+    }
+    CHECK_EQ_I32(pos, len);
+}
+
+static const entity_t *find_entity(const parsed_t *p, uint8_t id) {
+    for (uint8_t i = 0; i < p->n_entities; i++)
+        if (p->entities[i].id == id)
+            return &p->entities[i];
+    return NULL;
+}
+
+static void test_lengths_and_interfaces(const parsed_t *p) {
+    const uint8_t *desc = tud_descriptor_configuration_cb(0);
+    CHECK_EQ_I32(desc[1], TUSB_DESC_CONFIGURATION);
+    CHECK_EQ_I32(p->n_itfs_config, ITF_NUM_TOTAL);
+    CHECK_EQ_I32(p->n_itfs_seen, ITF_NUM_TOTAL);
+
+    // One function: control and streaming interface, of this class version
+    CHECK_EQ_I32(p->iad_first, ITF_NUM_AUDIO_CONTROL);
+    CHECK_EQ_I32(p->iad_count, 2 + USB_AUDIO_CAPTURE_ITFS);
+    CHECK_EQ_I32(p->iad_protocol, USB_AUDIO_UAC2 ? AUDIO_FUNC_PROTOCOL_CODE_V2 : 0);
+    CHECK_EQ_I32(p->ac_protocol, USB_AUDIO_UAC2 ? AUDIO_INT_PROTOCOL_CODE_V2 : 0);
+    CHECK_EQ_I32(p->bcd_adc, USB_AUDIO_UAC2 ? 0x0200 : 0x0100);
+
+    // The class-specific AC length covers the header, units and terminals
+    CHECK_EQ_I32(p->cs_ac_declared, p->cs_ac_sum);
+
+#if !USB_AUDIO_UAC2
+    // ... and the header lists every streaming interface of the function
+    CHECK_EQ_I32(p->n_collection, 1 + USB_AUDIO_CAPTURE_ITFS);
+    CHECK_EQ_I32(p->collection[0], ITF_NUM_AUDIO_STREAMING);
+#if USB_AUDIO_LOOPBACK
+    CHECK_EQ_I32(p->collection[1], ITF_NUM_AUDIO_CAPTURE);
+#endif
+#endif
+}
+
+static void test_topology(const parsed_t *p) {
+    const entity_t *it = find_entity(p, UAC1_ENTITY_INPUT_TERMINAL);
+    const entity_t *fu = find_entity(p, UAC1_ENTITY_FEATURE_UNIT);
+    const entity_t *ot = find_entity(p, UAC1_ENTITY_OUTPUT_TERMINAL);
+    CHECK(it && fu && ot);
+    if (!it || !fu || !ot)
+        return;
+    CHECK_EQ_I32(it->subtype, AUDIO10_CS_AC_INTERFACE_INPUT_TERMINAL);
+    CHECK_EQ_I32(fu->subtype, AUDIO10_CS_AC_INTERFACE_FEATURE_UNIT);
+    CHECK_EQ_I32(ot->subtype, AUDIO10_CS_AC_INTERFACE_OUTPUT_TERMINAL);
+    CHECK_EQ_I32(fu->source, it->id);
+    CHECK_EQ_I32(ot->source, fu->id);
+
+#if USB_AUDIO_UAC2
+    const entity_t *clk = find_entity(p, UAC2_ENTITY_CLOCK_SOURCE);
+    CHECK(clk != NULL);
+    if (clk)
+        CHECK_EQ_I32(clk->subtype, AUDIO20_CS_AC_INTERFACE_CLOCK_SOURCE);
+    CHECK_EQ_I32(it->clock, UAC2_ENTITY_CLOCK_SOURCE);
+    CHECK_EQ_I32(ot->clock, UAC2_ENTITY_CLOCK_SOURCE);
+    CHECK_EQ_I32(p->n_entities, 4);
+#else
+    CHECK_EQ_I32(p->n_entities, 3 + 2 * USB_AUDIO_CAPTURE_ITFS);
+#endif
+
+#if USB_AUDIO_LOOPBACK
+    // Capture: straight from its input terminal to the USB streaming one
+    const entity_t *lit = find_entity(p, UAC1_ENTITY_LOOPBACK_INPUT_TERMINAL);
+    const entity_t *lot = find_entity(p, UAC1_ENTITY_LOOPBACK_OUTPUT_TERMINAL);
+    CHECK(lit && lot);
+    if (!lit || !lot)
+        return;
+    CHECK_EQ_I32(lit->subtype, AUDIO10_CS_AC_INTERFACE_INPUT_TERMINAL);
+    CHECK_EQ_I32(lot->subtype, AUDIO10_CS_AC_INTERFACE_OUTPUT_TERMINAL);
+    CHECK_EQ_I32(lot->source, lit->id);
+#endif
+}
+
+static void check_alt(const alt_t *a, uint8_t subslot, uint8_t bits, uint16_t ep_size) {
+    CHECK_EQ_I32(a->n_eps, AUDIO_ADAPTIVE_CLOCK ? 1 : 2);
+    CHECK_EQ_I32(a->terminal_link, UAC1_ENTITY_INPUT_TERMINAL);
+    CHECK_EQ_I32(a->channels, CFG_TUD_AUDIO_FUNC_1_N_CHANNELS_RX);
+    CHECK_EQ_I32(a->subslot, subslot);
+    CHECK_EQ_I32(a->bits, bits);
+
+    // Asynchronous (or adaptive) isochronous OUT, sized for a frame at the
+    // highest rate plus one sample (the feedback stretching it), within
+    // full speed's 1023
+    CHECK_EQ_I32(a->data_ep, EPNUM_AUDIO_OUT);
+    CHECK_EQ_I32(a->data_attr & 0x0F, TUSB_XFER_ISOCHRONOUS |
+                 (AUDIO_ADAPTIVE_CLOCK ? TUSB_ISO_EP_ATT_ADAPTIVE : TUSB_ISO_EP_ATT_ASYNCHRONOUS));
+    CHECK_EQ_I32(a->data_size, ep_size);
+    CHECK(a->data_size >= (CFG_TUD_AUDIO_FUNC_1_MAX_SAMPLE_RATE_FS / 1000 + 1) *
+                              CFG_TUD_AUDIO_FUNC_1_N_CHANNELS_RX * subslot);
+    CHECK(a->data_size <= 1023);
+
+#if AUDIO_ADAPTIVE_CLOCK
+    // No feedback: nothing IN, and no UAC1 sync endpoint named
+    CHECK_EQ_I32(a->fb_ep, 0);
+    CHECK_EQ_I32(a->data_sync_addr, 0);
+#else
+    // Explicit feedback IN: 10.14 in 3 bytes for UAC1, 16.16 in 4 for UAC2
+    CHECK_EQ_I32(a->fb_ep, EPNUM_AUDIO_FB);
+    CHECK_EQ_I32(a->fb_attr & TUSB_XFER_ISOCHRONOUS, TUSB_XFER_ISOCHRONOUS);
+#if USB_AUDIO_UAC2
+    CHECK_EQ_I32(a->fb_attr & 0x30, TUSB_ISO_EP_ATT_EXPLICIT_FB);
+    CHECK_EQ_I32(a->fb_size, UAC2_FEEDBACK_EP_SIZE);
+#else
+    CHECK_EQ_I32(a->fb_size, 3);
+    CHECK_EQ_I32(a->data_sync_addr, EPNUM_AUDIO_FB);
+#endif
+#endif
+
+#if !USB_AUDIO_UAC2
+
+    // The rates the firmware plays, in order
+    static const uint32_t rates[] = {USB_AUDIO_SAMPLE_RATES};
+    CHECK_EQ_I32(a->n_rates, USB_AUDIO_SAMPLE_RATE_COUNT);
+    for (uint8_t i = 0; i < USB_AUDIO_SAMPLE_RATE_COUNT; i++)
+        CHECK_EQ_I32(a->rates[i], rates[i]);
+#endif
+}
+
+static void test_streaming_settings(const parsed_t *p) {
+    CHECK_EQ_I32(p->n_alts, 3);
+    CHECK_EQ_I32(p->alts[0].n_eps, 0); // zero bandwidth
+    check_alt(&p->alts[USB_AUDIO_ALT_24], CFG_TUD_AUDIO_FUNC_1_N_BYTES_PER_SAMPLE_RX,
+              CFG_TUD_AUDIO_FUNC_1_RESOLUTION_RX, CFG_TUD_AUDIO_FUNC_1_EP_OUT_SZ_FS);
+    check_alt(&p->alts[USB_AUDIO_ALT_16], CFG_TUD_AUDIO_FUNC_1_N_BYTES_PER_SAMPLE_RX_16,
+              CFG_TUD_AUDIO_FUNC_1_RESOLUTION_RX_16, CFG_TUD_AUDIO_FUNC_1_EP_OUT_SZ_FS_16);
+}
+
+#if USB_AUDIO_LOOPBACK
+static void test_capture(const parsed_t *p) {
+    CHECK_EQ_I32(p->n_cap_alts, 2);
+    CHECK_EQ_I32(p->cap_alts[0].n_eps, 0); // zero bandwidth
+
+    // 24-bit stereo at the I2S rate, its only one, to the capture terminal
+    const alt_t *a = &p->cap_alts[USB_AUDIO_ALT_24];
+    CHECK_EQ_I32(a->n_eps, 1);
+    CHECK_EQ_I32(a->terminal_link, UAC1_ENTITY_LOOPBACK_OUTPUT_TERMINAL);
+    CHECK_EQ_I32(a->channels, 2);
+    CHECK_EQ_I32(a->subslot, 3);
+    CHECK_EQ_I32(a->bits, 24);
+    CHECK_EQ_I32(a->n_rates, 1);
+    CHECK_EQ_I32(a->rates[0], USB_AUDIO_CAPTURE_RATE);
+
+    // Asynchronous isochronous IN, no feedback, room for a frame's worth
+    // plus one (TinyUSB's flow control)
+    CHECK_EQ_I32(a->data_ep, EPNUM_AUDIO_IN);
+    CHECK_EQ_I32(a->data_attr & 0x0F, TUSB_XFER_ISOCHRONOUS | TUSB_ISO_EP_ATT_ASYNCHRONOUS);
+    CHECK_EQ_I32(a->data_sync_addr, 0);
+    CHECK_EQ_I32(a->data_size, (USB_AUDIO_CAPTURE_RATE / 1000 + 1) * 2 * 3);
+
+    // The playback is limited to the rates whose endpoint fits beside it
+    CHECK_EQ_I32(CFG_TUD_AUDIO_FUNC_1_MAX_SAMPLE_RATE_FS, USB_AUDIO_CAPTURE_RATE);
+}
+#endif
+
+static void test_strings(const parsed_t *p) {
+    const tusb_desc_device_t *dev = (const tusb_desc_device_t *)tud_descriptor_device_cb();
+    CHECK_EQ_I32(dev->bDeviceClass, TUSB_CLASS_MISC);
+    CHECK_EQ_I32(dev->bDeviceProtocol, MISC_PROTOCOL_IAD);
+
+    // Every string index the descriptors reference resolves
+    usb_desc_init_serial();
+    const uint8_t dev_strings[] = {dev->iManufacturer, dev->iProduct, dev->iSerialNumber};
+    for (unsigned i = 0; i < sizeof(dev_strings) + p->n_strings; i++) {
+        uint8_t idx = i < sizeof(dev_strings) ? dev_strings[i] : p->strings[i - sizeof(dev_strings)];
+        if (idx == 0)
+            continue;
+        const uint16_t *s = tud_descriptor_string_cb(idx, 0x0409);
+        CHECK(s != NULL);
+        if (s)
+            CHECK_EQ_I32(s[0] >> 8, TUSB_DESC_STRING);
+    }
+}
+
+int main(void) {
+    const uint8_t *desc = tud_descriptor_configuration_cb(0);
+    parsed_t p;
+    parse(desc, rd16(&desc[2]), &p);
+
+    test_lengths_and_interfaces(&p);
+    test_topology(&p);
+    test_streaming_settings(&p);
+#if USB_AUDIO_LOOPBACK
+    test_capture(&p);
+#endif
+    test_strings(&p);
+    return test_summary(USB_AUDIO_UAC2 ? (AUDIO_ADAPTIVE_CLOCK ? "usb_descriptors (UAC2, adaptive)" : "usb_descriptors (UAC2)")
+                        : USB_AUDIO_LOOPBACK ? "usb_descriptors (UAC1, loopback)"
+                                       : (AUDIO_ADAPTIVE_CLOCK ? "usb_descriptors (UAC1, adaptive)" : "usb_descriptors (UAC1)"));
+}